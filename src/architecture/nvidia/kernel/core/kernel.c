@@ -31,9 +31,12 @@ const char* debug_state_names[GPU_STATE_LAST] =
 void Kernel_SetState(gpu_state state)
 {
 #ifdef DEBUG
-    Logging_Write(LOG_LEVEL_DEBUG, "GPU Kernel/RM is transitioning to state %s", debug_state_names[state]);
+    Logging_WriteTo(LOG_CHANNEL_KERNEL, LOG_LEVEL_DEBUG, "GPU Kernel/RM is transitioning to state %s", debug_state_names[state]);
 #endif
 
+    if (NV_ShadowRefuse("The GPU kernel"))
+        return;
+
     switch (state)
     {
         case GPU_STATE_INIT:
@@ -43,7 +46,7 @@ void Kernel_SetState(gpu_state state)
         case GPU_STATE_SHUTDOWN:
             break; 
         default:
-            Logging_Write(LOG_LEVEL_ERROR, "Kernel: INVALID GPU state %d\n", state);
+            Logging_WriteTo(LOG_CHANNEL_KERNEL, LOG_LEVEL_ERROR, "Kernel: INVALID GPU state %d\n", state);
             return; // skip
     }
 
@@ -58,6 +61,9 @@ void Kernel_SetState(gpu_state state)
 
 void Kernel_Interrupt()
 {
+    if (NV_ShadowRefuse("The GPU kernel"))
+        return;
+
     if (!current_device.device_info.hal->interrupt_service)
         Kernel_Fatal("Kernel: No interrupt service for current GPU");
 
@@ -66,6 +72,10 @@ void Kernel_Interrupt()
 
 void Kernel_Main()
 {
+    // There's no HAL to run it against
+    if (NV_ShadowRefuse("The GPU kernel"))
+        return;
+
     Kernel_SetState(GPU_STATE_INIT);
 
     /* If we are initialising we have to reset */
@@ -81,9 +91,9 @@ void Kernel_Main()
 /* Triggered upon entry into an unrecoverable error condition. */
 void Kernel_Fatal(const char* err)
 {
-    Logging_Write(LOG_LEVEL_ERROR, "******* GPU Driver Kernel reported FATAL ERROR: *******\n");
-    Logging_Write(LOG_LEVEL_ERROR, "%s\n", err);
-    Logging_Write(LOG_LEVEL_ERROR, "******* A recovery will be attempted. However, success cannot be guaranteed."
+    Logging_WriteTo(LOG_CHANNEL_KERNEL, LOG_LEVEL_ERROR, "******* GPU Driver Kernel reported FATAL ERROR: *******\n");
+    Logging_WriteTo(LOG_CHANNEL_KERNEL, LOG_LEVEL_ERROR, "%s\n", err);
+    Logging_WriteTo(LOG_CHANNEL_KERNEL, LOG_LEVEL_ERROR, "******* A recovery will be attempted. However, success cannot be guaranteed."
         "It is recommended to reboot your system. *******\n");
 
     Kernel_SetState(GPU_STATE_SHUTDOWN);
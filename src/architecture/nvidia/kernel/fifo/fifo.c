@@ -15,13 +15,16 @@
 
 void Kernel_SetStateFifo(gpu_state state)
 {
+    if (NV_ShadowRefuse("PFIFO initialisation"))
+        return;
+
     switch (state)
     {
         case GPU_STATE_INIT:
             if (!current_device.device_info.hal->fifo_init)
                 Kernel_Fatal("KernelSetStateFifo: No FIFO initialisation function for the current GPU");
            
-            Logging_Write(LOG_LEVEL_DEBUG, "GPU Kernel: Initialising PFIFO...\n");
+            Logging_WriteTo(LOG_CHANNEL_FIFO, LOG_LEVEL_DEBUG, "GPU Kernel: Initialising PFIFO...\n");
 
             if (!current_device.device_info.hal->fifo_init())
                 Kernel_Fatal("KernelSetStateFifo: Failed to initialise PFIFO");
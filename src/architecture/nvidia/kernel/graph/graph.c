@@ -14,13 +14,16 @@
 
 void Kernel_SetStateGraph(gpu_state state)
 {
+    if (NV_ShadowRefuse("PGRAPH initialisation"))
+        return;
+
     switch (state)
     {
         case GPU_STATE_INIT:
             if (!current_device.device_info.hal->graph_init)
                 Kernel_Fatal("Kernel_SetStateGraph: No PGRAPH initialisation function for the current GPU");
 
-            Logging_Write(LOG_LEVEL_DEBUG, "GPU Kernel: Initialising PGRAPH...\n");
+            Logging_WriteTo(LOG_CHANNEL_GRAPH, LOG_LEVEL_DEBUG, "GPU Kernel: Initialising PGRAPH...\n");
 
             if (!current_device.device_info.hal->graph_init())
                 Kernel_Fatal("Kernel_SetStateGraph: Failed to initialise PGRAPH");
@@ -30,7 +33,7 @@ void Kernel_SetStateGraph(gpu_state state)
             if (!current_device.device_info.hal->graph_reset)
                 Kernel_Fatal("Kernel_SetStateGraph: No PGRAPH reset function for the current GPU");
 
-            Logging_Write(LOG_LEVEL_DEBUG, "GPU Kernel: Resetting PGRAPH...\n");
+            Logging_WriteTo(LOG_CHANNEL_GRAPH, LOG_LEVEL_DEBUG, "GPU Kernel: Resetting PGRAPH...\n");
 
             if (!current_device.device_info.hal->graph_reset)
                 Kernel_Fatal("Kernel_SetStateGraph: Failed to reset PGRAPH");
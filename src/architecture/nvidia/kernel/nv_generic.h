@@ -15,6 +15,89 @@
 #define NV_MMIO_SIZE                     0x1000000       // Max MMIO size
 #define NV5_MAX_VRAM_SIZE                0x2000000
 
+// Fingerprinting
+#define NV_FINGERPRINT_PAGE_SIZE         0x1000          // Granularity of page hashes
+#define NV_FINGERPRINT_DATABASE          "nvfprint.ini"  // Known-good fingerprints, keyed by NV_PMC_BOOT_0 and straps
+#define NV_FINGERPRINT_CAPTURE_FILE      "nvfpcap.ini"   // Fingerprint of this card, for adding to the database
+#define NV_FINGERPRINT_MASK_ENTRY        "Mask"          // Hash of the masked registers, fingerprints with a different one can't be compared
+#define NV_FINGERPRINT_FNV_OFFSET        0x811C9DC5
+#define NV_FINGERPRINT_FNV_PRIME         0x01000193
+
+/* Inclusive range of MMIO addresses. Lists of these are terminated by { 0, 0 } */
+typedef struct nv_mmio_range_s
+{
+    uint32_t start;
+    uint32_t end;
+} nv_mmio_range_t;
+
+// MMIO map discovery
+#define NV_MMIO_MAP_FILE                 "nvmap.txt"
+#define NV_MMIO_MAP_BLOCK_SIZE           0x10000         // Coarse probe granularity (refined to NV_FINGERPRINT_PAGE_SIZE)
+#define NV_MMIO_MAP_SAMPLES              16              // Registers sampled per block/page
+#define NV_MMIO_MAP_MAX_REGIONS          512
+
+typedef enum nv_mmio_map_class_e
+{
+    NV_MMIO_REGION_UNKNOWN = 0,                     // Not covered by the map
+    NV_MMIO_REGION_UNMAPPED = 1,                    // Reads back 0xFFFFFFFF or another bus-float pattern
+    NV_MMIO_REGION_MIRROR = 2,                      // Aliases another region (see mirror_of)
+    NV_MMIO_REGION_READONLY = 3,                    // Write probe didn't stick
+    NV_MMIO_REGION_SCRATCH = 4,                     // Write probe stuck
+    NV_MMIO_REGION_MAPPED = 5,                      // Real registers, not write probed
+
+    NV_MMIO_REGION_COUNT,
+} nv_mmio_map_class_t;
+
+typedef struct nv_mmio_map_region_s
+{
+    uint32_t start;
+    uint32_t end;                                   // Inclusive
+    nv_mmio_map_class_t class;
+    uint32_t mirror_of;                             // Start of the region this one aliases (mirrors only)
+} nv_mmio_map_region_t;
+
+typedef struct nv_mmio_map_s
+{
+    bool loaded;
+    uint32_t num_regions;
+    nv_mmio_map_region_t regions[NV_MMIO_MAP_MAX_REGIONS];
+} nv_mmio_map_t;
+
+extern nv_mmio_map_t mmio_map;
+
+// Volatile register detection
+#define NV_VOLATILE_DB_FILE              "nvvolat.txt"   // Registers that change by themselves, written by NV_DetectVolatile
+#define NV_VOLATILE_DB_MAX_ENTRIES       2048
+#define NV_VOLATILE_DEFAULT_SAMPLES      8               // Reads per register
+#define NV_VOLATILE_DEFAULT_INTERVAL_US  10000           // Spacing between each pass over the range
+#define NV_VOLATILE_DUMP_MARKER          0x564F4C54      // 'VOLT' - written to MMIO dumps instead of a volatile register, so dumps diff clean
+
+typedef enum nv_volatile_class_e
+{
+    NV_VOLATILE_CONSTANT = 0,                           // Never changed
+    NV_VOLATILE_COUNTER = 1,                            // Only ever went up (modulo 2^32)
+    NV_VOLATILE_NOISE = 2,                              // Changed with no pattern
+    NV_VOLATILE_READ_SIDE_EFFECT = 3,                   // Changed on the first read-back and then stayed put (clear-on-read etc)
+
+    NV_VOLATILE_CLASS_COUNT,
+} nv_volatile_class_t;
+
+typedef struct nv_volatile_entry_s
+{
+    uint32_t addr;
+    nv_volatile_class_t class;
+    double ticks_per_sec;                               // Counters only
+} nv_volatile_entry_t;
+
+typedef struct nv_volatile_db_s
+{
+    bool loaded;
+    uint32_t num_entries;
+    nv_volatile_entry_t entries[NV_VOLATILE_DB_MAX_ENTRIES];    // Sorted by address
+} nv_volatile_db_t;
+
+extern nv_volatile_db_t volatile_db;
+
 bool NVGeneric_DumpPCISpace();
 bool NVGeneric_DumpMMIO();
 bool NVGeneric_DumpVBIOS();
@@ -23,6 +106,26 @@ bool NVGeneric_DumpRAMHT();                         // Dump all currently loaded
 bool NVGeneric_DumpRAMFC();                         // Dump all channels that are not context switched to
 bool NVGeneric_DumpRAMRO();                         // Dump any errors that may have occurred 
 bool NVGeneric_DumpPGRAPHCache();
+bool NVGeneric_FingerprintMMIO();                   // Hash stable MMIO pages and compare against known-good cards
+
+bool NVGeneric_RangeListContains(nv_mmio_range_t* list, uint32_t addr);
+nv_mmio_range_t* NVGeneric_GetFingerprintRegions();
+nv_mmio_range_t* NVGeneric_GetVolatileRegisters();
+uint32_t NVGeneric_HashMMIOPage(uint32_t page);
+uint32_t NVGeneric_FingerprintMaskHash(nv_mmio_range_t* regions);
+
+bool NVGeneric_DiscoverMMIOMap();                   // Probe BAR0 for unmapped and mirrored areas and write out nvmap.txt
+bool NVGeneric_LoadMMIOMap(const char* file_name);
+bool NVGeneric_SaveMMIOMap(const char* file_name);
+nv_mmio_map_class_t NVGeneric_MMIOMapGetClass(uint32_t addr);
+bool NVGeneric_MMIOMapCanSkip(uint32_t addr);
+bool NVGeneric_DataFileIsForThisCard(const char* file_name, const char* header);
+
+bool NVGeneric_DetectVolatile();                    // Sample registers over time and write the ones that change to nvvolat.txt
+bool NVGeneric_LoadVolatileDB(const char* file_name);
+bool NVGeneric_SaveVolatileDB(const char* file_name);
+bool NVGeneric_VolatileDBContains(uint32_t addr);
+nv_volatile_class_t NVGeneric_ClassifyRegister(uint32_t* samples, uint32_t num_samples, uint32_t first_reread);
 
 // I considered using an array, but we'd have to define hardcoded indicies anyway so we can just define these entries
 extern nvhal_entry_t nvhal_nv1;
@@ -0,0 +1,268 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    nv_generic_fingerprint.c: Per-page MMIO fingerprinting
+
+    Hashes every 4KB page of the stable MMIO regions of the GPU and compares them against a database of known-good fingerprints (nvfprint.ini),
+    keyed by NV_PMC_BOOT_0 and the straps. Only pages that differ are reported, so we can tell if a card behaves like a reference card without
+    dumping all of BAR0/BAR1 and diffing it offline.
+
+    Which registers are masked depends on the build (the lists below) and on this machine's nvvolat.txt, so every fingerprint records a hash
+    of its mask (Mask=). Hashes made with a different mask can't be compared, and the reference is ignored if its mask doesn't match.
+*/
+
+#include "architecture/nvidia/nv1/nv1_ref.h"
+#include "architecture/nvidia/nv3/nv3_ref.h"
+#include "nvplay.h"
+#include "util/util.h"
+#include <architecture/nvidia/kernel/nv_generic.h>
+#include <architecture/nvidia/nv1/nv1.h>
+#include <architecture/nvidia/nv3/nv3.h>
+#include <architecture/nvidia/nv4/nv4.h>
+
+// Stable MMIO regions to fingerprint. PTIMER, PRAMIN, PROM and the USER/class areas are deliberately left out.
+nv_mmio_range_t fingerprint_regions_nv1[] =
+{
+    { 0x000000, 0x000FFF },                                     // PMC
+    { NV1_PFIFO_START, NV1_PFIFO_END },                         // PFIFO
+    { 0, 0 },                                                   // Sentinel value
+};
+
+nv_mmio_range_t fingerprint_regions_nv3[] =
+{
+    { NV3_PMC_START, NV3_PMC_END },                             // PMC
+    { NV3_PBUS_START, NV3_PBUS_END },                           // PBUS
+    { NV3_PFIFO_START, NV3_PFIFO_END },                         // PFIFO
+    { NV3_PRM_START, NV3_PRM_END },                             // PRM
+    { NV3_PFB_START, NV3_PFB_END },                             // PFB
+    { NV3_PEXTDEV_START, NV3_PEXTDEV_END },                     // PEXTDEV (straps)
+    { NV3_PGRAPH_START, NV3_PGRAPH_START + 0x1FFF },            // PGRAPH (real registers, not the class area)
+    { NV3_PVIDEO_START, NV3_PRAMDAC_END },                      // PVIDEO + PRAMDAC
+    { 0, 0 },                                                   // Sentinel value
+};
+
+nv_mmio_range_t fingerprint_regions_nv4[] =
+{
+    { NV4_PMC_START, NV4_PMC_END },                             // PMC
+    { NV4_PBUS_START, NV4_PBUS_END },                           // PBUS
+    { NV4_PFIFO_START, NV4_PFIFO_END },                         // PFIFO
+    { NV4_PFB_START, NV4_PFB_END },                             // PFB
+    { NV4_PGRAPH_START, NV4_PGRAPH_END },                       // PGRAPH
+    { NV4_PCRTC_START & ~(NV_FINGERPRINT_PAGE_SIZE - 1), NV4_PRMCIO_END },  // PCRTC + PRMCIO
+    { NV4_PDAC_START, NV4_PDAC_END },                           // PVIDEO + PRAMDAC
+    { 0, 0 },                                                   // Sentinel value
+};
+
+// Registers that change by themselves (interrupt status, FIFO pointers, scanout position) and are masked out of the hash.
+nv_mmio_range_t fingerprint_volatile_nv3[] =
+{
+    { NV3_PMC_INTERRUPT_STATUS, NV3_PMC_INTERRUPT_STATUS },
+    { NV3_PFIFO_INTR, NV3_PFIFO_INTR },
+    { NV3_PFIFO_RUNOUT_STATUS, NV3_PFIFO_RUNOUT_GET },
+    { NV3_PFIFO_CACHE1_PUT, NV3_PFIFO_CACHE1_STATUS },
+    { NV3_PFIFO_CACHE1_GET, NV3_PFIFO_CACHE1_GET },
+    { NV3_PGRAPH_INTR_0, NV3_PGRAPH_INTR_1 },
+    { NV3_PGRAPH_STATUS, NV3_PGRAPH_STATUS },
+    { 0, 0 },                                                   // Sentinel value
+};
+
+nv_mmio_range_t fingerprint_volatile_nv4[] =
+{
+    { NV4_PMC_INTR_0, NV4_PMC_INTR_0 },
+    { NV4_PFIFO_INTR_0, NV4_PFIFO_INTR_0 },
+    { NV4_PFIFO_RUNOUT_STATUS, NV4_PFIFO_RUNOUT_STATUS },
+    { NV4_PFIFO_CACHE1_PUT, NV4_PFIFO_CACHE1_STATUS },
+    { NV4_PFIFO_CACHE1_GET, NV4_PFIFO_CACHE1_GET },
+    { NV4_PGRAPH_INTR, NV4_PGRAPH_INTR },
+    { NV4_PGRAPH_STATUS, NV4_PGRAPH_STATUS },
+    { NV4_PCRTC_RASTER, NV4_PCRTC_RASTER },
+    { 0, 0 },                                                   // Sentinel value
+};
+
+// Determines if addr is inside any of the ranges in a sentinel-terminated range list.
+bool NVGeneric_RangeListContains(nv_mmio_range_t* list, uint32_t addr)
+{
+    if (!list)
+        return false;
+
+    // {0, 0} terminates the list. Ranges can start at 0 so check end too
+    for (uint32_t i = 0; list[i].start || list[i].end; i++)
+    {
+        if (addr >= list[i].start
+        && addr <= list[i].end)
+            return true;
+    }
+
+    return false;
+}
+
+nv_mmio_range_t* NVGeneric_GetFingerprintRegions()
+{
+    if (GPU_IsNV1())
+        return fingerprint_regions_nv1;
+    else if (GPU_IsNV3())
+        return fingerprint_regions_nv3;
+    else
+        return fingerprint_regions_nv4;
+}
+
+nv_mmio_range_t* NVGeneric_GetVolatileRegisters()
+{
+    if (GPU_IsNV1())
+        return NULL;
+    else if (GPU_IsNV3())
+        return fingerprint_volatile_nv3;
+    else
+        return fingerprint_volatile_nv4;
+}
+
+// Hash a single 4KB page of BAR0 (32-bit FNV-1a over each dword). Volatile registers hash as zero so their position still counts.
+// Registers found by NV_DetectVolatile are masked on top of the hardcoded list.
+uint32_t NVGeneric_HashMMIOPage(uint32_t page)
+{
+    nv_mmio_range_t* volatile_list = NVGeneric_GetVolatileRegisters();
+    uint32_t hash = NV_FINGERPRINT_FNV_OFFSET;
+
+    for (uint32_t addr = page; addr < page + NV_FINGERPRINT_PAGE_SIZE; addr += 4)
+    {
+        uint32_t value = 0;
+
+        if (!NVGeneric_RangeListContains(volatile_list, addr)
+        && !NVGeneric_VolatileDBContains(addr))
+            value = _farpeekl(current_device.bus_info.bar0_selector, addr);
+
+        for (uint32_t byte = 0; byte < 4; byte++)
+        {
+            hash ^= (value >> (byte << 3)) & 0xFF;
+            hash *= NV_FINGERPRINT_FNV_PRIME;
+        }
+    }
+
+    return hash;
+}
+
+/*
+    Hash of everything NVGeneric_HashMMIOPage masks in the pages we fingerprint: the hardcoded ranges and the nvvolat.txt registers inside
+    the fingerprint regions. Two fingerprints are only comparable if this is the same for both.
+*/
+uint32_t NVGeneric_FingerprintMaskHash(nv_mmio_range_t* regions)
+{
+    nv_mmio_range_t* volatile_list = NVGeneric_GetVolatileRegisters();
+    uint32_t hash = NV_FINGERPRINT_FNV_OFFSET;
+
+    for (uint32_t i = 0; volatile_list && (volatile_list[i].start || volatile_list[i].end); i++)
+    {
+        hash = (hash ^ volatile_list[i].start) * NV_FINGERPRINT_FNV_PRIME;
+        hash = (hash ^ volatile_list[i].end) * NV_FINGERPRINT_FNV_PRIME;
+    }
+
+    for (uint32_t i = 0; i < volatile_db.num_entries; i++)
+    {
+        uint32_t addr = volatile_db.entries[i].addr;
+
+        if (NVGeneric_RangeListContains(regions, addr)
+        && !NVGeneric_RangeListContains(volatile_list, addr))
+            hash = (hash ^ addr) * NV_FINGERPRINT_FNV_PRIME;
+    }
+
+    return hash;
+}
+
+// Fingerprints the stable areas of MMIO and compares them against the known-good database
+bool NVGeneric_FingerprintMMIO()
+{
+    char section_name[MAX_TEST_NAME_BUFFER_LEN] = {0};
+    char page_name[MAX_TEST_NAME_BUFFER_LEN] = {0};
+
+    if (NV_ShadowRefuse("The MMIO fingerprint"))
+        return false;
+
+    snprintf(section_name, MAX_TEST_NAME_BUFFER_LEN, "%08lX_%08lX", current_device.nv_pmc_boot_0, current_device.straps);
+
+    nv_mmio_range_t* regions = NVGeneric_GetFingerprintRegions();
+
+    // Only hash real, unique pages if this card has been mapped
+    bool have_mmio_map = NVGeneric_LoadMMIOMap(NV_MMIO_MAP_FILE);
+
+    // Mask registers that were seen changing on this card
+    NVGeneric_LoadVolatileDB(NV_VOLATILE_DB_FILE);
+
+    uint32_t mask = NVGeneric_FingerprintMaskHash(regions);
+
+    ini_t database = ini_read(NV_FINGERPRINT_DATABASE);
+    ini_section_t reference = NULL;
+
+    if (database)
+        reference = ini_find_section(database, section_name);
+
+    if (!reference)
+        Logging_Write(LOG_LEVEL_WARNING, "No reference fingerprint for %s in %s. Capturing only.\n", section_name, NV_FINGERPRINT_DATABASE);
+    else if (!ini_has_entry(reference, NV_FINGERPRINT_MASK_ENTRY)
+    || (uint32_t)ini_section_get_hex32(reference, NV_FINGERPRINT_MASK_ENTRY, 0) != mask)
+    {
+        Logging_Write(LOG_LEVEL_WARNING, "The reference fingerprint for %s masks different registers (%s=%08lX, this run is %08lX). Capturing only.\n",
+            section_name, NV_FINGERPRINT_MASK_ENTRY, (uint32_t)ini_section_get_hex32(reference, NV_FINGERPRINT_MASK_ENTRY, 0), mask);
+        reference = NULL;
+    }
+
+    // Always write out what we saw, so new reference cards can be added to the database
+    ini_t capture = ini_new();
+    ini_section_t capture_section = ini_find_or_create_section(capture, section_name);
+
+    ini_section_set_hex32(capture_section, NV_FINGERPRINT_MASK_ENTRY, mask);
+
+    uint32_t pages_total = 0, pages_different = 0, pages_unknown = 0;
+
+    uclock_t start_clock = uclock();
+
+    for (uint32_t region = 0; regions[region].start || regions[region].end; region++)
+    {
+        for (uint32_t page = regions[region].start; page < regions[region].end; page += NV_FINGERPRINT_PAGE_SIZE)
+        {
+            // don't touch anything that is known to crash the chip
+            if ((GPU_IsNV3() && NV3_MMIOAreaIsExcluded(page))
+            || (have_mmio_map && NVGeneric_MMIOMapCanSkip(page)))
+                continue;
+
+            uint32_t hash = NVGeneric_HashMMIOPage(page);
+            pages_total++;
+
+            snprintf(page_name, MAX_TEST_NAME_BUFFER_LEN, "%06lX", page);
+            ini_section_set_hex32(capture_section, page_name, hash);
+
+            if (!reference)
+                continue;
+
+            if (!ini_has_entry(reference, page_name))
+            {
+                pages_unknown++;
+                continue;
+            }
+
+            uint32_t expected = (uint32_t)ini_section_get_hex32(reference, page_name, 0);
+
+            if (expected != hash)
+            {
+                pages_different++;
+                Logging_Event(LOG_EVENT_FINGERPRINT_PAGE_DIFFERS, page, expected, hash);
+            }
+        }
+    }
+
+    uclock_t end_clock = uclock();
+
+    ini_write(capture, NV_FINGERPRINT_CAPTURE_FILE);
+    ini_close(capture);
+
+    if (database)
+        ini_close(database);
+
+    Logging_Write(LOG_LEVEL_MESSAGE, "Fingerprint: %lu pages hashed in %.3f sec, %lu differ, %lu not in database. Captured to %s\n",
+        pages_total, (double)(end_clock - start_clock) / UCLOCKS_PER_SEC, pages_different, pages_unknown, NV_FINGERPRINT_CAPTURE_FILE);
+
+    return (reference && !pages_different);
+}
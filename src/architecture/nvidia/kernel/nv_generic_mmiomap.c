@@ -0,0 +1,400 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    nv_generic_mmiomap.c: Automatic BAR0 map discovery
+
+    Most of the 16MB BAR0 aperture is either unmapped or a mirror of something else. This probes it at 64KB granularity, refines anything that
+    looks real down to 4KB pages, and writes out a compact region map (nvmap.txt). Dumps and fingerprint runs then use the map so they only read
+    the real, unique registers.
+*/
+
+#include "nvplay.h"
+#include "util/util.h"
+#include <architecture/nvidia/kernel/nv_generic.h>
+#include <architecture/nvidia/nv1/nv1.h>
+#include <architecture/nvidia/nv3/nv3.h>
+#include <architecture/nvidia/nv4/nv4.h>
+
+nv_mmio_map_t mmio_map = {0};
+
+// Values that undriven reads from BAR0 are known to return
+uint32_t mmio_map_bus_float_patterns[] =
+{
+    0xFFFFFFFF,
+    0x4E4F4E45,                                 // 'NONE' - not from hardware, but it means a dump was excluded here
+};
+
+#define MMIO_MAP_NUM_BUS_FLOAT_PATTERNS     (sizeof(mmio_map_bus_float_patterns) / sizeof(uint32_t))
+
+const char* mmio_map_class_names[] =
+{
+    "unknown",
+    "unmapped",
+    "mirror",
+    "readonly",
+    "scratch",
+    "mapped",
+};
+
+/* Per-page probe results. Only needed during discovery */
+typedef struct nv_mmio_map_probe_s
+{
+    uint32_t samples[NV_MMIO_MAP_SAMPLES];
+    uint32_t hash;
+    nv_mmio_map_class_t class;
+    uint32_t mirror_of;
+} nv_mmio_map_probe_t;
+
+bool NVGeneric_MMIOMapIsBusFloat(uint32_t value)
+{
+    for (uint32_t i = 0; i < MMIO_MAP_NUM_BUS_FLOAT_PATTERNS; i++)
+    {
+        if (value == mmio_map_bus_float_patterns[i])
+            return true;
+    }
+
+    return false;
+}
+
+// Sample a block of BAR0 at evenly spaced points. Returns true if every sample was the same value.
+bool NVGeneric_MMIOMapSample(uint32_t start, uint32_t size, uint32_t* samples, uint32_t* hash)
+{
+    uint32_t stride = size / NV_MMIO_MAP_SAMPLES;
+    bool uniform = true;
+
+    *hash = NV_FINGERPRINT_FNV_OFFSET;
+
+    for (uint32_t i = 0; i < NV_MMIO_MAP_SAMPLES; i++)
+    {
+        samples[i] = _farpeekl(current_device.bus_info.bar0_selector, start + (i * stride));
+
+        if (samples[i] != samples[0])
+            uniform = false;
+
+        *hash = (*hash ^ samples[i]) * NV_FINGERPRINT_FNV_PRIME;
+    }
+
+    return uniform;
+}
+
+// Compare two whole areas of BAR0. The samples only say two areas might be the same, a mirror has to match everywhere.
+bool NVGeneric_MMIOMapAreasMatch(uint32_t start, uint32_t other, uint32_t size)
+{
+    for (uint32_t offset = 0; offset < size; offset += 4)
+    {
+        if (_farpeekl(current_device.bus_info.bar0_selector, start + offset)
+        != _farpeekl(current_device.bus_info.bar0_selector, other + offset))
+            return false;
+    }
+
+    return true;
+}
+
+// Classify a block (or page) against everything that came before it.
+void NVGeneric_MMIOMapClassify(nv_mmio_map_probe_t* probes, uint32_t index, uint32_t size)
+{
+    nv_mmio_map_probe_t* probe = &probes[index];
+    uint32_t start = index * size;
+
+    bool uniform = NVGeneric_MMIOMapSample(start, size, probe->samples, &probe->hash);
+
+    if (uniform
+    && NVGeneric_MMIOMapIsBusFloat(probe->samples[0]))
+    {
+        probe->class = NV_MMIO_REGION_UNMAPPED;
+        return;
+    }
+
+    // Uniform non-float blocks (e.g. all zero) would match each other trivially, so don't treat them as mirrors
+    if (!uniform)
+    {
+        for (uint32_t i = 0; i < index; i++)
+        {
+            if (probes[i].class == NV_MMIO_REGION_UNMAPPED
+            || probes[i].class == NV_MMIO_REGION_MIRROR
+            || probes[i].hash != probe->hash)
+                continue;
+
+            // A counter in the area makes a real mirror fail this. That just means it gets read, which is the safe way to be wrong
+            if (!memcmp(probes[i].samples, probe->samples, sizeof(probe->samples))
+            && NVGeneric_MMIOMapAreasMatch(start, i * size, size))
+            {
+                probe->class = NV_MMIO_REGION_MIRROR;
+                probe->mirror_of = i * size;
+                return;
+            }
+        }
+    }
+
+    probe->class = NV_MMIO_REGION_MAPPED;
+
+    if (!nvplay_state.config.mmio_map_probe_writes)
+        return;
+
+    // Flip every bit of one register and see if it sticks. Always restore it.
+    uint32_t original = probe->samples[0];
+    _farpokel(current_device.bus_info.bar0_selector, start, ~original);
+    uint32_t readback = _farpeekl(current_device.bus_info.bar0_selector, start);
+    _farpokel(current_device.bus_info.bar0_selector, start, original);
+
+    if (readback == original)
+        probe->class = NV_MMIO_REGION_READONLY;
+    else if (readback == ~original)
+        probe->class = NV_MMIO_REGION_SCRATCH;
+}
+
+// Appends a region to the map, merging it with the previous one if it continues it.
+void NVGeneric_MMIOMapAppend(uint32_t start, uint32_t end, nv_mmio_map_class_t class, uint32_t mirror_of)
+{
+    if (mmio_map.num_regions > 0)
+    {
+        nv_mmio_map_region_t* last = &mmio_map.regions[mmio_map.num_regions - 1];
+
+        bool continues = (last->end + 1 == start
+        && last->class == class
+        && (class != NV_MMIO_REGION_MIRROR || (last->mirror_of + (start - last->start)) == mirror_of));
+
+        if (continues)
+        {
+            last->end = end;
+            return;
+        }
+    }
+
+    if (mmio_map.num_regions >= NV_MMIO_MAP_MAX_REGIONS)
+    {
+        Logging_Write(LOG_LEVEL_WARNING, "MMIO map: Too many regions, merging the rest into %06lX\n", mmio_map.regions[mmio_map.num_regions - 1].start);
+        mmio_map.regions[mmio_map.num_regions - 1].end = end;
+        return;
+    }
+
+    nv_mmio_map_region_t* region = &mmio_map.regions[mmio_map.num_regions++];
+
+    region->start = start;
+    region->end = end;
+    region->class = class;
+    region->mirror_of = mirror_of;
+}
+
+bool NVGeneric_SaveMMIOMap(const char* file_name)
+{
+    FILE* stream = fopen(file_name, "w");
+
+    if (!stream)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "Failed to open MMIO map file %s!\n", file_name);
+        return false;
+    }
+
+    fprintf(stream, "; NVPlay MMIO map. NV_PMC_BOOT_0=%08lX Straps=%08lX\n", current_device.nv_pmc_boot_0, current_device.straps);
+    fprintf(stream, "; start end class [mirror_of]\n");
+
+    for (uint32_t i = 0; i < mmio_map.num_regions; i++)
+    {
+        nv_mmio_map_region_t* region = &mmio_map.regions[i];
+
+        if (region->class == NV_MMIO_REGION_MIRROR)
+            fprintf(stream, "%06lX %06lX %s %06lX\n", region->start, region->end, mmio_map_class_names[region->class], region->mirror_of);
+        else
+            fprintf(stream, "%06lX %06lX %s\n", region->start, region->end, mmio_map_class_names[region->class]);
+    }
+
+    fclose(stream);
+    return true;
+}
+
+/*
+    Check the header line of a map or database we wrote was written on this card. They are only right for the card they were made on, and
+    a different GPU or board (straps) gets the wrong registers skipped.
+*/
+bool NVGeneric_DataFileIsForThisCard(const char* file_name, const char* header)
+{
+    uint32_t boot_0 = 0, straps = 0;
+    const char* card = strstr(header, "NV_PMC_BOOT_0=");
+
+    if (!card
+    || sscanf(card, "NV_PMC_BOOT_0=%lx Straps=%lx", &boot_0, &straps) < 2)
+    {
+        Logging_Write(LOG_LEVEL_WARNING, "%s doesn't say which card it is for, ignoring it\n", file_name);
+        return false;
+    }
+
+    if (boot_0 != current_device.nv_pmc_boot_0
+    || straps != current_device.straps)
+    {
+        Logging_Write(LOG_LEVEL_WARNING, "%s is for another card (NV_PMC_BOOT_0=%08lX Straps=%08lX, this one is %08lX %08lX), ignoring it\n",
+            file_name, boot_0, straps, current_device.nv_pmc_boot_0, current_device.straps);
+        return false;
+    }
+
+    return true;
+}
+
+// Load a map previously written by NV_DiscoverMMIOMap. Returns false (and leaves the map empty) if there isn't one or it is for another card.
+bool NVGeneric_LoadMMIOMap(const char* file_name)
+{
+    if (mmio_map.loaded)
+        return true;
+
+    FILE* stream = fopen(file_name, "r");
+
+    if (!stream)
+        return false;
+
+    char line_buf[MAX_STR] = {0};
+
+    if (!fgets(line_buf, MAX_STR, stream)
+    || !NVGeneric_DataFileIsForThisCard(file_name, line_buf))
+    {
+        fclose(stream);
+        return false;
+    }
+
+    mmio_map.num_regions = 0;
+
+    while (fgets(line_buf, MAX_STR, stream))
+    {
+        uint32_t start = 0, end = 0, mirror_of = 0;
+        char class_name[MAX_TEST_NAME_BUFFER_LEN] = {0};
+
+        if (line_buf[0] == ';'
+        || sscanf(line_buf, "%lx %lx %63s %lx", &start, &end, class_name, &mirror_of) < 3)
+            continue;
+
+        for (uint32_t class = 0; class < NV_MMIO_REGION_COUNT; class++)
+        {
+            if (!strcmp(class_name, mmio_map_class_names[class]))
+            {
+                NVGeneric_MMIOMapAppend(start, end, class, mirror_of);
+                break;
+            }
+        }
+    }
+
+    fclose(stream);
+
+    mmio_map.loaded = (mmio_map.num_regions > 0);
+
+    if (mmio_map.loaded)
+        Logging_Write(LOG_LEVEL_DEBUG, "Loaded MMIO map %s (%lu regions)\n", file_name, mmio_map.num_regions);
+
+    return mmio_map.loaded;
+}
+
+// Get the class of the region containing addr. Unknown if there's no map loaded or the address isn't covered.
+nv_mmio_map_class_t NVGeneric_MMIOMapGetClass(uint32_t addr)
+{
+    for (uint32_t i = 0; i < mmio_map.num_regions; i++)
+    {
+        if (addr >= mmio_map.regions[i].start
+        && addr <= mmio_map.regions[i].end)
+            return mmio_map.regions[i].class;
+    }
+
+    return NV_MMIO_REGION_UNKNOWN;
+}
+
+// True if the map says there is nothing unique to read at addr
+bool NVGeneric_MMIOMapCanSkip(uint32_t addr)
+{
+    nv_mmio_map_class_t class = NVGeneric_MMIOMapGetClass(addr);
+
+    return (class == NV_MMIO_REGION_UNMAPPED
+    || class == NV_MMIO_REGION_MIRROR);
+}
+
+bool NVGeneric_DiscoverMMIOMap()
+{
+    uint32_t mmio_size = NV_MMIO_SIZE;
+
+    if (NV_ShadowRefuse("MMIO map discovery"))
+        return false;
+
+    if (GPU_IsNV1())
+        mmio_size = NV1_PCI_BAR0_SIZE + 1;
+
+    uint32_t num_blocks = mmio_size / NV_MMIO_MAP_BLOCK_SIZE;
+    uint32_t num_pages = mmio_size / NV_FINGERPRINT_PAGE_SIZE;
+    uint32_t pages_per_block = NV_MMIO_MAP_BLOCK_SIZE / NV_FINGERPRINT_PAGE_SIZE;
+
+    nv_mmio_map_probe_t* blocks = calloc(num_blocks, sizeof(nv_mmio_map_probe_t));
+    nv_mmio_map_probe_t* pages = calloc(num_pages, sizeof(nv_mmio_map_probe_t));
+
+    if (!blocks || !pages)
+    {
+        free(blocks);
+        free(pages);
+        return false;
+    }
+
+    Logging_Write(LOG_LEVEL_MESSAGE, "MMIO map: Coarse probe (%lu x %luKB)...\n", num_blocks, NV_MMIO_MAP_BLOCK_SIZE >> 10);
+
+    if (nvplay_state.config.mmio_map_probe_writes)
+        Logging_Write(LOG_LEVEL_WARNING, "MMIO map: Write probing is enabled. This writes to every mapped page!\n");
+
+    uclock_t start_clock = uclock();
+
+    // Pass 1: coarse. Blocks that are unmapped or mirrors are settled here and don't need to be refined.
+    for (uint32_t block = 0; block < num_blocks; block++)
+    {
+        uint32_t start = block * NV_MMIO_MAP_BLOCK_SIZE;
+
+        if (GPU_IsNV3() && NV3_MMIOAreaIsExcluded(start))
+        {
+            blocks[block].class = NV_MMIO_REGION_UNMAPPED;
+            continue;
+        }
+
+        NVGeneric_MMIOMapClassify(blocks, block, NV_MMIO_MAP_BLOCK_SIZE);
+    }
+
+    Logging_Write(LOG_LEVEL_MESSAGE, "MMIO map: Refining...\n");
+
+    mmio_map.num_regions = 0;
+
+    // Pass 2: refine anything that looked real down to page granularity
+    for (uint32_t page = 0; page < num_pages; page++)
+    {
+        nv_mmio_map_probe_t* block = &blocks[page / pages_per_block];
+        uint32_t start = page * NV_FINGERPRINT_PAGE_SIZE;
+
+        if (block->class == NV_MMIO_REGION_UNMAPPED
+        || (GPU_IsNV3() && NV3_MMIOAreaIsExcluded(start)))
+        {
+            pages[page].class = NV_MMIO_REGION_UNMAPPED;
+        }
+        else if (block->class == NV_MMIO_REGION_MIRROR)
+        {
+            pages[page].class = NV_MMIO_REGION_MIRROR;
+            pages[page].mirror_of = block->mirror_of + (start % NV_MMIO_MAP_BLOCK_SIZE);
+        }
+        else
+            NVGeneric_MMIOMapClassify(pages, page, NV_FINGERPRINT_PAGE_SIZE);
+
+        NVGeneric_MMIOMapAppend(start, start + NV_FINGERPRINT_PAGE_SIZE - 1, pages[page].class, pages[page].mirror_of);
+    }
+
+    uclock_t end_clock = uclock();
+
+    free(blocks);
+    free(pages);
+
+    mmio_map.loaded = true;
+
+    uint32_t unique_bytes = 0;
+
+    for (uint32_t i = 0; i < mmio_map.num_regions; i++)
+    {
+        if (!NVGeneric_MMIOMapCanSkip(mmio_map.regions[i].start))
+            unique_bytes += (mmio_map.regions[i].end - mmio_map.regions[i].start) + 1;
+    }
+
+    Logging_Write(LOG_LEVEL_MESSAGE, "MMIO map: %lu regions, %luKB of %luKB unique, took %.3f sec\n", mmio_map.num_regions,
+        unique_bytes >> 10, mmio_size >> 10, (double)(end_clock - start_clock) / UCLOCKS_PER_SEC);
+
+    return NVGeneric_SaveMMIOMap(NV_MMIO_MAP_FILE);
+}
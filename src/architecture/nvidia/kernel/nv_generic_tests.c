@@ -91,6 +91,12 @@ bool NVGeneric_DumpMMIO_NV1()
     if (!mmio_dump_bar_buf)
         return false; 
 
+    // Registers NV_DetectVolatile saw changing by themselves are masked, so two dumps can be diffed
+    bool have_volatile_db = NVGeneric_LoadVolatileDB(NV_VOLATILE_DB_FILE);
+
+    if (have_volatile_db)
+        Logging_Write(LOG_LEVEL_MESSAGE, "Using volatile register database %s. Volatile registers will not be read\n", NV_VOLATILE_DB_FILE);
+
     /* 
         Dump all known memory regions except write-only ones and ones that crash
         We don't use nv_mmio_* because those will account for other things in the future
@@ -102,7 +108,7 @@ bool NVGeneric_DumpMMIO_NV1()
         if (bar0_pos % NV_MMIO_DUMP_FLUSH_FREQUENCY == 0 
             && bar0_pos > 0) // i'm lazy
         {
-            Logging_Write(LOG_LEVEL_DEBUG, "Dumped BAR0 up to: %08lX\n", bar0_pos);
+            Logging_Event(LOG_EVENT_DUMP_BAR0_PROGRESS, bar0_pos);
             fwrite(&mmio_dump_bar_buf[(bar0_pos - NV_MMIO_DUMP_FLUSH_FREQUENCY) >> 2], NV_MMIO_DUMP_FLUSH_FREQUENCY, 1, mmio_bar0);
             fflush(mmio_bar0);
 
@@ -111,7 +117,11 @@ bool NVGeneric_DumpMMIO_NV1()
                 break;
         }
 
-        mmio_dump_bar_buf[bar0_pos >> 2] = _farpeekl(current_device.bus_info.bar0_selector, bar0_pos);
+        if (have_volatile_db
+        && NVGeneric_VolatileDBContains(bar0_pos))
+            mmio_dump_bar_buf[bar0_pos >> 2] = NV_VOLATILE_DUMP_MARKER;
+        else
+            mmio_dump_bar_buf[bar0_pos >> 2] = _farpeekl(current_device.bus_info.bar0_selector, bar0_pos);
     }
 
     fclose(mmio_bar0);
@@ -150,6 +160,19 @@ bool NVGeneric_DumpMMIO_NV3AndLater()
     // yep!
     bool piece_of_crap_cant_even_read_registers_without_crashing = GPU_IsNV3();
 
+    // Skip unmapped and mirrored areas if NV_DiscoverMMIOMap has been run on this card
+    bool have_mmio_map = NVGeneric_LoadMMIOMap(NV_MMIO_MAP_FILE);
+    bool skip_page = false;
+
+    if (have_mmio_map)
+        Logging_Write(LOG_LEVEL_MESSAGE, "Using MMIO map %s. Unmapped and mirrored areas will not be read\n", NV_MMIO_MAP_FILE);
+
+    // Registers NV_DetectVolatile saw changing by themselves are masked too, so two dumps can be diffed
+    bool have_volatile_db = NVGeneric_LoadVolatileDB(NV_VOLATILE_DB_FILE);
+
+    if (have_volatile_db)
+        Logging_Write(LOG_LEVEL_MESSAGE, "Using volatile register database %s. Volatile registers will not be read\n", NV_VOLATILE_DB_FILE);
+
     /* 
         Dump all known memory regions except write-only ones and ones that crash
         We don't use nv_mmio_* because those will account for other things in the future
@@ -161,7 +184,7 @@ bool NVGeneric_DumpMMIO_NV3AndLater()
         if (bar0_pos % NV_MMIO_DUMP_FLUSH_FREQUENCY == 0 
             && bar0_pos > 0) // i'm lazy
         {
-            Logging_Write(LOG_LEVEL_DEBUG, "Dumped BAR0 up to: %08lX\n", bar0_pos);
+            Logging_Event(LOG_EVENT_DUMP_BAR0_PROGRESS, bar0_pos);
             fwrite(&mmio_dump_bar_buf[(bar0_pos - NV_MMIO_DUMP_FLUSH_FREQUENCY) >> 2], NV_MMIO_DUMP_FLUSH_FREQUENCY, 1, mmio_bar0);
             fflush(mmio_bar0);
 
@@ -170,11 +193,20 @@ bool NVGeneric_DumpMMIO_NV3AndLater()
                 break;
         }
 
+        // only look the map up once per page
+        if (have_mmio_map
+        && !(bar0_pos & (NV_FINGERPRINT_PAGE_SIZE - 1)))
+            skip_page = NVGeneric_MMIOMapCanSkip(bar0_pos);
+
         // skip the address if it will crash 
-        if (piece_of_crap_cant_even_read_registers_without_crashing && NV3_MMIOAreaIsExcluded(bar0_pos))
+        if ((piece_of_crap_cant_even_read_registers_without_crashing && NV3_MMIOAreaIsExcluded(bar0_pos))
+        || skip_page)
         {
             mmio_dump_bar_buf[bar0_pos >> 2] = 0x4E4F4E45; // 'NONE'
         }
+        else if (have_volatile_db
+        && NVGeneric_VolatileDBContains(bar0_pos))
+            mmio_dump_bar_buf[bar0_pos >> 2] = NV_VOLATILE_DUMP_MARKER;
         else
             mmio_dump_bar_buf[bar0_pos >> 2] = _farpeekl(current_device.bus_info.bar0_selector, bar0_pos);
 
@@ -187,7 +219,7 @@ bool NVGeneric_DumpMMIO_NV3AndLater()
         if ((bar1_pos % NV_MMIO_DUMP_FLUSH_FREQUENCY == 0 
             && bar1_pos > 0))
         {
-            Logging_Write(LOG_LEVEL_DEBUG, "Dumped BAR1 up to: %08lX\n", bar1_pos);
+            Logging_Event(LOG_EVENT_DUMP_BAR1_PROGRESS, bar1_pos);
             fwrite(&mmio_dump_bar_buf[(bar1_pos - NV_MMIO_DUMP_FLUSH_FREQUENCY) >> 2], NV_MMIO_DUMP_FLUSH_FREQUENCY, 1, mmio_bar1);
             fflush(mmio_bar1);
 
@@ -212,6 +244,9 @@ bool NVGeneric_DumpMMIO_NV3AndLater()
 
 bool NVGeneric_DumpMMIO()
 {
+    if (NV_ShadowRefuse("The MMIO dump"))
+        return false;
+
     if (GPU_IsNV1())
         return NVGeneric_DumpMMIO_NV1();
     else
@@ -257,6 +292,9 @@ bool NVGeneric_DumpVBIOS()
 
 bool NVGeneric_DumpFIFO()
 {
+    if (NV_ShadowRefuse("The FIFO dump"))
+        return false;
+
     // open a file
     char file_name[MSDOS_PATH_LENGTH] = {0};
     snprintf(file_name, MSDOS_PATH_LENGTH, "nv%lxfifo.txt", GPU_NV_GetGeneration());
@@ -282,6 +320,9 @@ bool NVGeneric_DumpFIFO()
 // Dump all currently loaded objects in the current channel
 bool NVGeneric_DumpRAMHT()
 {
+    if (NV_ShadowRefuse("The RAMHT dump"))
+        return false;
+
     // open a file
 
     char file_name[MSDOS_PATH_LENGTH] = {0};
@@ -308,7 +349,10 @@ bool NVGeneric_DumpRAMHT()
 
 // Dump all channels that are not the current
 bool NVGeneric_DumpRAMFC()
-{    
+{
+    if (NV_ShadowRefuse("The RAMFC dump"))
+        return false;
+
     char file_name[MSDOS_PATH_LENGTH] = {0};
     snprintf(file_name, MSDOS_PATH_LENGTH, "nv%lxramfc.txt", GPU_NV_GetGeneration());
     FILE* stream = fopen(file_name, "r+");
@@ -333,6 +377,9 @@ bool NVGeneric_DumpRAMFC()
 // Dump any errors that may have occurred 
 bool NVGeneric_DumpRAMRO()
 {
+    if (NV_ShadowRefuse("The RAMRO dump"))
+        return false;
+
     char file_name[MSDOS_PATH_LENGTH] = {0};
     snprintf(file_name, MSDOS_PATH_LENGTH, "nv%lxramro.txt", GPU_NV_GetGeneration());
     FILE* stream = fopen(file_name, "r+");
@@ -356,6 +403,9 @@ bool NVGeneric_DumpRAMRO()
 // The GPU really hates this test and explodes rendering and will probably also hardlock unless you are very careful
 bool NVGeneric_DumpPGRAPHCache()
 {
+    if (NV_ShadowRefuse("The PGRAPH cache dump"))
+        return false;
+
     if (GPU_IsNV10())
     {
         Logging_Write(LOG_LEVEL_ERROR, "DumpPGRAPHCache is not yet supported on NV10 because NV10 has a much more complicated and larger cache\n");
@@ -0,0 +1,359 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    nv_generic_volatile.c: Volatile register detection
+
+    Generalised version of NV3_ReadGarbageMMIO. Reads every register in a range several times at spaced intervals and classifies it as
+    constant, a counter (with an estimated tick rate), noise, or a register with read side-effects. Anything that isn't constant is written to
+    nvvolat.txt, which the fingerprint test loads so that it can mask those registers automatically.
+*/
+
+#include "nvplay.h"
+#include "util/util.h"
+#include <architecture/nvidia/kernel/nv_generic.h>
+#include <architecture/nvidia/nv1/nv1.h>
+#include <architecture/nvidia/nv3/nv3.h>
+#include <architecture/nvidia/nv4/nv4.h>
+
+nv_volatile_db_t volatile_db = {0};
+
+const char* volatile_class_names[] =
+{
+    "constant",
+    "counter",
+    "noise",
+    "readsideeffect",
+};
+
+// Extra ranges that are always scanned on top of the fingerprint regions, because they are where the counters live
+nv_mmio_range_t volatile_extra_regions[] =
+{
+    { NV3_PTIMER_START, NV3_PTIMER_END },                       // PTIMER (same place on NV3 and NV4)
+    { 0, 0 },                                                   // Sentinel value
+};
+
+// Classify a single register from its samples. first_reread is the value of an immediate second read done before any spacing.
+nv_volatile_class_t NVGeneric_ClassifyRegister(uint32_t* samples, uint32_t num_samples, uint32_t first_reread)
+{
+    bool all_same = true;
+    bool monotonic = true;
+
+    for (uint32_t i = 1; i < num_samples; i++)
+    {
+        uint32_t delta = samples[i] - samples[i - 1];
+
+        if (delta)
+            all_same = false;
+
+        // uint32 wraparound is fine, a counter going "backwards" by more than half the range is not a counter
+        if (delta >= 0x80000000)
+            monotonic = false;
+    }
+
+    // Changed on the very first back-to-back read and then settled: something is cleared or advanced by reading it
+    if (first_reread != samples[0])
+    {
+        bool settled = true;
+
+        for (uint32_t i = 1; i < num_samples; i++)
+        {
+            if (samples[i] != first_reread)
+                settled = false;
+        }
+
+        if (settled)
+            return NV_VOLATILE_READ_SIDE_EFFECT;
+    }
+
+    if (all_same)
+        return NV_VOLATILE_CONSTANT;
+
+    if (monotonic)
+        return NV_VOLATILE_COUNTER;
+
+    return NV_VOLATILE_NOISE;
+}
+
+bool NVGeneric_SaveVolatileDB(const char* file_name)
+{
+    FILE* stream = fopen(file_name, "w");
+
+    if (!stream)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "Failed to open volatile register database %s!\n", file_name);
+        return false;
+    }
+
+    fprintf(stream, "; NVPlay volatile register database. NV_PMC_BOOT_0=%08lX Straps=%08lX\n", current_device.nv_pmc_boot_0, current_device.straps);
+    fprintf(stream, "; address class ticks_per_sec\n");
+
+    for (uint32_t i = 0; i < volatile_db.num_entries; i++)
+    {
+        nv_volatile_entry_t* entry = &volatile_db.entries[i];
+        fprintf(stream, "%06lX %s %.0f\n", entry->addr, volatile_class_names[entry->class], entry->ticks_per_sec);
+    }
+
+    fclose(stream);
+    return true;
+}
+
+/*
+    Load a database previously written by NV_DetectVolatile. Entries must be in ascending address order (they always are when we write them).
+    Returns false if there isn't one or it is for another card.
+*/
+bool NVGeneric_LoadVolatileDB(const char* file_name)
+{
+    if (volatile_db.loaded)
+        return true;
+
+    FILE* stream = fopen(file_name, "r");
+
+    if (!stream)
+        return false;
+
+    char line_buf[MAX_STR] = {0};
+
+    if (!fgets(line_buf, MAX_STR, stream)
+    || !NVGeneric_DataFileIsForThisCard(file_name, line_buf))
+    {
+        fclose(stream);
+        return false;
+    }
+
+    volatile_db.num_entries = 0;
+
+    while (fgets(line_buf, MAX_STR, stream)
+    && volatile_db.num_entries < NV_VOLATILE_DB_MAX_ENTRIES)
+    {
+        uint32_t addr = 0;
+        double ticks_per_sec = 0;
+        char class_name[MAX_TEST_NAME_BUFFER_LEN] = {0};
+
+        if (line_buf[0] == ';'
+        || sscanf(line_buf, "%lx %63s %lf", &addr, class_name, &ticks_per_sec) < 2)
+            continue;
+
+        for (uint32_t class = 0; class < NV_VOLATILE_CLASS_COUNT; class++)
+        {
+            if (!strcmp(class_name, volatile_class_names[class]))
+            {
+                nv_volatile_entry_t* entry = &volatile_db.entries[volatile_db.num_entries++];
+
+                entry->addr = addr;
+                entry->class = class;
+                entry->ticks_per_sec = ticks_per_sec;
+                break;
+            }
+        }
+    }
+
+    fclose(stream);
+
+    volatile_db.loaded = (volatile_db.num_entries > 0);
+
+    if (volatile_db.loaded)
+        Logging_Write(LOG_LEVEL_DEBUG, "Loaded volatile register database %s (%lu registers)\n", file_name, volatile_db.num_entries);
+
+    return volatile_db.loaded;
+}
+
+// Binary search, this gets called for every register we hash
+bool NVGeneric_VolatileDBContains(uint32_t addr)
+{
+    int32_t low = 0, high = (int32_t)volatile_db.num_entries - 1;
+
+    while (low <= high)
+    {
+        int32_t mid = (low + high) >> 1;
+
+        if (volatile_db.entries[mid].addr == addr)
+            return true;
+        else if (volatile_db.entries[mid].addr < addr)
+            low = mid + 1;
+        else
+            high = mid - 1;
+    }
+
+    return false;
+}
+
+// Scan one range, appending anything non-constant to the database
+void NVGeneric_DetectVolatileRange(uint32_t start, uint32_t end, uint32_t num_samples, uint32_t interval_us, uint32_t* counts)
+{
+    uint32_t num_registers = ((end - start) >> 2) + 1;
+
+    uint32_t* samples = calloc(num_registers * num_samples, sizeof(uint32_t));
+    uint32_t* rereads = calloc(num_registers, sizeof(uint32_t));
+    bool* skipped = calloc(num_registers, sizeof(bool));
+
+    if (!samples || !rereads || !skipped)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "NV_DetectVolatile: Out of memory scanning %06lX-%06lX\n", start, end);
+        free(samples);
+        free(rereads);
+        free(skipped);
+        return;
+    }
+
+    for (uint32_t reg = 0; reg < num_registers; reg++)
+    {
+        uint32_t addr = start + (reg << 2);
+
+        skipped[reg] = ((GPU_IsNV3() && NV3_MMIOAreaIsExcluded(addr))
+        || NVGeneric_MMIOMapCanSkip(addr));
+    }
+
+    uclock_t first_clock = uclock(), last_clock = first_clock;
+
+    for (uint32_t sample = 0; sample < num_samples; sample++)
+    {
+        // Spread the passes out so slow counters (e.g. PCRTC line counters) get a chance to move
+        if (sample > 0)
+        {
+            uclock_t start_clock = uclock();
+
+            while (uclock() - start_clock < ((uclock_t)interval_us * UCLOCKS_PER_SEC) / 1000000)
+                ;
+        }
+
+        last_clock = uclock();
+
+        for (uint32_t reg = 0; reg < num_registers; reg++)
+        {
+            if (skipped[reg])
+                continue;
+
+            uint32_t addr = start + (reg << 2);
+
+            samples[reg * num_samples + sample] = NV_ReadMMIO32(addr);
+
+            if (!sample)
+                rereads[reg] = NV_ReadMMIO32(addr);
+        }
+    }
+
+    double elapsed = (double)(last_clock - first_clock) / UCLOCKS_PER_SEC;
+
+    for (uint32_t reg = 0; reg < num_registers; reg++)
+    {
+        if (skipped[reg])
+            continue;
+
+        uint32_t* reg_samples = &samples[reg * num_samples];
+        nv_volatile_class_t class = NVGeneric_ClassifyRegister(reg_samples, num_samples, rereads[reg]);
+
+        counts[class]++;
+
+        if (class == NV_VOLATILE_CONSTANT)
+            continue;
+
+        if (volatile_db.num_entries >= NV_VOLATILE_DB_MAX_ENTRIES)
+        {
+            Logging_Write(LOG_LEVEL_WARNING, "NV_DetectVolatile: Database full, ignoring %06lX\n", start + (reg << 2));
+            continue;
+        }
+
+        nv_volatile_entry_t* entry = &volatile_db.entries[volatile_db.num_entries++];
+
+        entry->addr = start + (reg << 2);
+        entry->class = class;
+        entry->ticks_per_sec = 0;
+
+        if (class == NV_VOLATILE_COUNTER
+        && elapsed > 0)
+            entry->ticks_per_sec = (double)(reg_samples[num_samples - 1] - reg_samples[0]) / elapsed;
+
+        uint32_t first = reg_samples[0], last = reg_samples[num_samples - 1];
+        uint32_t per_sec = (uint32_t)(entry->ticks_per_sec + 0.5);
+
+        // One event per class. Logging_Event needs the event by name, constants never get here
+        switch (class)
+        {
+            case NV_VOLATILE_COUNTER:
+                Logging_Event(LOG_EVENT_VOLATILE_COUNTER, entry->addr, first, last, per_sec);
+                break;
+            case NV_VOLATILE_NOISE:
+                Logging_Event(LOG_EVENT_VOLATILE_NOISE, entry->addr, first, last, per_sec);
+                break;
+            case NV_VOLATILE_READ_SIDE_EFFECT:
+                Logging_Event(LOG_EVENT_VOLATILE_READ_SIDE_EFFECT, entry->addr, first, last, per_sec);
+                break;
+            default:
+                break;
+        }
+    }
+
+    free(samples);
+    free(rereads);
+    free(skipped);
+}
+
+bool NVGeneric_DetectVolatile()
+{
+    uint32_t num_samples = nvplay_state.config.volatile_samples;
+    uint32_t interval_us = nvplay_state.config.volatile_interval_us;
+    uint32_t counts[NV_VOLATILE_CLASS_COUNT] = {0};
+
+    if (num_samples < 3)
+        num_samples = NV_VOLATILE_DEFAULT_SAMPLES;
+
+    if (!interval_us)
+        interval_us = NV_VOLATILE_DEFAULT_INTERVAL_US;
+
+    // Don't read unmapped or mirrored space if we know where it is
+    NVGeneric_LoadMMIOMap(NV_MMIO_MAP_FILE);
+
+    volatile_db.num_entries = 0;
+
+    Logging_Write(LOG_LEVEL_MESSAGE, "NV_DetectVolatile: %lu samples, %lu us apart\n", num_samples, interval_us);
+
+    // A range in nvplay.ini overrides the default regions
+    if (nvplay_state.config.volatile_range_end > nvplay_state.config.volatile_range_start)
+    {
+        NVGeneric_DetectVolatileRange(nvplay_state.config.volatile_range_start & ~3, nvplay_state.config.volatile_range_end & ~3,
+            num_samples, interval_us, counts);
+    }
+    else
+    {
+        nv_mmio_range_t* lists[] = { NVGeneric_GetFingerprintRegions(), GPU_IsNV1() ? NULL : volatile_extra_regions };
+
+        // Scan in ascending address order so that the database stays sorted
+        uint32_t next_start = 0;
+
+        while (true)
+        {
+            nv_mmio_range_t* best = NULL;
+
+            for (uint32_t list = 0; list < sizeof(lists) / sizeof(lists[0]); list++)
+            {
+                if (!lists[list])
+                    continue;
+
+                for (uint32_t i = 0; lists[list][i].start || lists[list][i].end; i++)
+                {
+                    if (lists[list][i].start >= next_start
+                    && (!best || lists[list][i].start < best->start))
+                        best = &lists[list][i];
+                }
+            }
+
+            if (!best)
+                break;
+
+            Logging_Write(LOG_LEVEL_MESSAGE, "NV_DetectVolatile: Scanning %06lX-%06lX...\n", best->start, best->end);
+            NVGeneric_DetectVolatileRange(best->start, best->end & ~3, num_samples, interval_us, counts);
+            next_start = best->end + 1;
+        }
+    }
+
+    Logging_Write(LOG_LEVEL_MESSAGE, "NV_DetectVolatile: %lu constant, %lu counter, %lu noise, %lu read side-effect\n",
+        counts[NV_VOLATILE_CONSTANT], counts[NV_VOLATILE_COUNTER], counts[NV_VOLATILE_NOISE], counts[NV_VOLATILE_READ_SIDE_EFFECT]);
+
+    volatile_db.loaded = true;
+
+    return NVGeneric_SaveVolatileDB(NV_VOLATILE_DB_FILE);
+}
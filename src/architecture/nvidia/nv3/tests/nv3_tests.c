@@ -139,7 +139,7 @@ bool NV3_TestOverclock()
         //not speed critical, use a double
         double megahertz = NV_ClockMNPToMhz(current_device.crystal_hz, final_clock);
 
-        Logging_Write(LOG_LEVEL_MESSAGE, "Trying MCLK = %.2f Mhz (NV_PRAMDAC_MPLL_COEFF = %08lx)...\n", megahertz, final_clock);
+        Logging_Event(LOG_EVENT_OVERCLOCK_STEP, (uint32_t)(megahertz * 1000.0), final_clock);
 
         NV_WriteMMIO32(NV3_PRAMDAC_CLOCK_MEMORY, final_clock);
 
@@ -147,7 +147,10 @@ bool NV3_TestOverclock()
 
         // Sit in a spinloop until it's time to wake up
         while (this_clock - start_clock < (UCLOCKS_PER_SEC * NV3_TESTOVERCLOCK_TIME_BETWEEN_RECLOCKS))
+        {
+            Console_PresentIfDue();
             this_clock = uclock();
+        }
     }
 
     Logging_Write(LOG_LEVEL_MESSAGE, "We survived. Returning to 100Mhz...\n");
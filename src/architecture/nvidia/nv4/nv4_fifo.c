@@ -32,6 +32,12 @@ bool NV4_InitFIFO()
 
     NV_WriteMMIO32(NV4_PFIFO_INTR_EN_0, fifo_intr_en);
 
+    // Let the DMA pusher go idle and CACHE1 drain before pulling the pointers out from under them
+    NV_WaitMMIO32("NV4_InitFIFO: DMA pusher idle", NV4_PFIFO_CACHE1_DMA_PUSH, (1 << NV4_PFIFO_CACHE1_DMA_PUSH_STATE),
+        (NV4_PFIFO_CACHE1_DMA_PUSH_STATE_IDLE << NV4_PFIFO_CACHE1_DMA_PUSH_STATE), NV_WAIT_DEFAULT_TIMEOUT_US, NULL);
+    NV_WaitMMIO32("NV4_InitFIFO: CACHE1 empty", NV4_PFIFO_CACHE1_STATUS, (1 << NV4_PFIFO_CACHE1_STATUS_LOW_MARK),
+        (NV4_PFIFO_CACHE1_STATUS_LOW_MARK_EMPTY << NV4_PFIFO_CACHE1_STATUS_LOW_MARK), NV_WAIT_DEFAULT_TIMEOUT_US, NULL);
+
     // Reset FIFO state
     NV_WriteMMIO32(NV4_PFIFO_CACHE1_GET, 0);
     NV_WriteMMIO32(NV4_PFIFO_CACHE1_PUT, 0);
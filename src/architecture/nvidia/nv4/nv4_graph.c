@@ -106,7 +106,10 @@ bool NV4_InitGraph()
     ;
 
     // NV4 driver initialises in DX3 mode.
-    Logging_Write(LOG_LEVEL_DEBUG, "NV4_InitGraph is initialising graphics hardware...\n");
+    Logging_WriteTo(LOG_CHANNEL_GRAPH, LOG_LEVEL_DEBUG, "NV4_InitGraph is initialising graphics hardware...\n");
+
+    // Don't change the debug registers under anything the VGA BIOS or a previous run left going
+    NV_WaitMMIO32("NV4_InitGraph: PGRAPH idle", NV4_PGRAPH_STATUS, 0xFFFFFFFF, 0, NV_WAIT_DEFAULT_TIMEOUT_US, NULL);
 
     NV_WriteMMIO32(NV4_PGRAPH_DEBUG_0, kernel_gpu->nv4.pgraph.debug_0);
     NV_WriteMMIO32(NV4_PGRAPH_DEBUG_1, kernel_gpu->nv4.pgraph.debug_1);
@@ -118,6 +121,10 @@ bool NV4_InitGraph()
 
 bool NV4_ResetGraph()
 {
+    /* Stop taking methods from PFIFO and let whatever is in flight finish */
+    NV_WriteMMIO32(NV4_PGRAPH_FIFO, NV4_PGRAPH_FIFO_ACCESS_DISABLED);
+    NV_WaitMMIO32("NV4_ResetGraph: PGRAPH idle", NV4_PGRAPH_STATUS, 0xFFFFFFFF, 0, NV_WAIT_DEFAULT_TIMEOUT_US, NULL);
+
     /* Now reset. */
     kernel_gpu->nv4.pgraph.debug_0 |= (1 << NV4_PGRAPH_DEBUG_0_STATE_RESET);
     kernel_gpu->nv4.pgraph.debug_1 |= (1 << NV4_PGRAPH_DEBUG_1_DMA_ACTIVITY_CANCEL);
@@ -135,6 +142,9 @@ bool NV4_ResetGraph()
     NV_WriteMMIO32(NV4_PGRAPH_DEBUG_0, kernel_gpu->nv4.pgraph.debug_0);
     NV_WriteMMIO32(NV4_PGRAPH_DEBUG_1, kernel_gpu->nv4.pgraph.debug_1);
 
+    // This only warns on timeout. Some status bits may not clear until a channel is loaded
+    NV_WaitMMIO32("NV4_ResetGraph: Leave reset", NV4_PGRAPH_STATUS, 0xFFFFFFFF, 0, NV_WAIT_DEFAULT_TIMEOUT_US, NULL);
+
     /* Reset current grobj */
 
     NV_WriteMMIO32(NV4_PGRAPH_CTX_SWITCH1, 0x0);
@@ -0,0 +1,92 @@
+#basic definitions
+cmake_minimum_required(VERSION 3.26)
+
+# Builds the table of register names scripts can use (script_registers.c) out of the reference headers.
+# Only plain numbers and (number<<number) are taken. Anything that needs an index or refers to another define is skipped
+
+set(ARCHITECTURE_DIR "${CMAKE_CURRENT_LIST_DIR}/../architecture/nvidia")
+set(HEADER_FILE "${CMAKE_CURRENT_LIST_DIR}/nvplay_registers.h")
+
+# Header, generation
+set(REGISTER_HEADERS
+    "nv1/nv1_ref.h" 1
+    "nv3/nv3_ref.h" 3
+    "nv4/nv4_ref.h" 4
+)
+
+set(REGISTER_ENTRIES "")
+
+list(LENGTH REGISTER_HEADERS REGISTER_HEADERS_LENGTH)
+math(EXPR REGISTER_HEADERS_LAST "${REGISTER_HEADERS_LENGTH} - 1")
+
+foreach(INDEX RANGE 0 ${REGISTER_HEADERS_LAST} 2)
+    math(EXPR GENERATION_INDEX "${INDEX} + 1")
+    list(GET REGISTER_HEADERS ${INDEX} REGISTER_HEADER)
+    list(GET REGISTER_HEADERS ${GENERATION_INDEX} GENERATION)
+
+    file(STRINGS "${ARCHITECTURE_DIR}/${REGISTER_HEADER}" LINES REGEX "^#define[ \t]+NV${GENERATION}_")
+
+    foreach(LINE IN LISTS LINES)
+        if(NOT LINE MATCHES "^#define[ \t]+(NV${GENERATION}_[A-Za-z0-9_]+)[ \t]+(0[xX][0-9A-Fa-f]+|[0-9]+|\\((0[xX][0-9A-Fa-f]+|[0-9]+)[ \t]*<<[ \t]*[0-9]+\\))[ \t]*(//.*|/\\*.*)?$")
+            continue()
+        endif()
+
+        set(HEADER_NAME "${CMAKE_MATCH_1}")
+        set(VALUE "${CMAKE_MATCH_2}")
+
+        # Script_FindRegister uppercases what it looks up, so a name with lowercase in it has to be uppercase in the table to be found
+        string(TOUPPER "${HEADER_NAME}" NAME)
+
+        # A few names are defined twice. Use the first one. Two different names that only differ in case would be one name in a script
+        if(DEFINED SEEN_${NAME})
+            if(NOT SEEN_${NAME} STREQUAL HEADER_NAME)
+                message(FATAL_ERROR "RegisterTable: ${SEEN_${NAME}} and ${HEADER_NAME} (${REGISTER_HEADER}) are the same name in a script")
+            endif()
+
+            continue()
+        endif()
+
+        set(SEEN_${NAME} "${HEADER_NAME}")
+
+        # A space sorts before any character a name can have, so this is the same order as strcmp
+        list(APPEND REGISTER_ENTRIES "${NAME} ${VALUE} ${GENERATION}")
+    endforeach()
+endforeach()
+
+list(SORT REGISTER_ENTRIES)
+list(LENGTH REGISTER_ENTRIES REGISTER_COUNT)
+
+# Names scripts must be able to find, as the headers spell them
+set(REGISTER_CHECKS
+    "NV1_PMC_BOOT_0"
+    "NV3_PMC_BOOT"
+    "NV4_PMC_BOOT_0"
+    "NV4_PFB_SCRAMBLE_w0"
+)
+
+foreach(CHECK IN LISTS REGISTER_CHECKS)
+    string(TOUPPER "${CHECK}" CHECK_NAME)
+
+    if(NOT DEFINED SEEN_${CHECK_NAME})
+        message(FATAL_ERROR "RegisterTable: ${CHECK} isn't in the table as ${CHECK_NAME}")
+    endif()
+endforeach()
+
+set(TABLE "")
+
+foreach(ENTRY IN LISTS REGISTER_ENTRIES)
+    string(REGEX MATCH "^([^ ]+) (.+) ([0-9]+)$" ENTRY_MATCH "${ENTRY}")
+    string(APPEND TABLE "    { \"${CMAKE_MATCH_1}\", ${CMAKE_MATCH_2}, ${CMAKE_MATCH_3} },\n")
+endforeach()
+
+set(CONTENTS "/* Register names for scripts (Auto-generated from the *_ref.h headers; modify using cmake/RegisterTable.cmake) */
+
+#define SCRIPT_NUM_REGISTERS ${REGISTER_COUNT}
+
+// Sorted by name
+const script_register_t script_registers[SCRIPT_NUM_REGISTERS] =
+{
+${TABLE}};
+")
+
+file(WRITE "${HEADER_FILE}" "${CONTENTS}")
@@ -0,0 +1,4987 @@
+/* Register names for scripts (Auto-generated from the *_ref.h headers; modify using cmake/RegisterTable.cmake) */
+
+#define SCRIPT_NUM_REGISTERS 4979
+
+// Sorted by name
+const script_register_t script_registers[SCRIPT_NUM_REGISTERS] =
+{
+    { "NV1_PAUTH_CHIP_TOKEN_0", 0x605400, 1 },
+    { "NV1_PAUTH_CHIP_TOKEN_1", 0x605404, 1 },
+    { "NV1_PAUTH_DEBUG_0", 0x605080, 1 },
+    { "NV1_PAUTH_DEBUG_0_BREACH_DETECTED", 0, 1 },
+    { "NV1_PAUTH_DEBUG_0_EEPROM_INVALID", 4, 1 },
+    { "NV1_PAUTH_PASSWORD_SIZE", 128, 1 },
+    { "NV1_PCI_BAR0_SIZE", 0xFFFFFF, 1 },
+    { "NV1_PFB_BOOT_0", 0x600000, 1 },
+    { "NV1_PFB_BOOT_0_RAM_AMOUNT", 0, 1 },
+    { "NV1_PFB_BOOT_0_RAM_AMOUNT_1MB", 0x0, 1 },
+    { "NV1_PFB_BOOT_0_RAM_AMOUNT_2MB", 0x1, 1 },
+    { "NV1_PFB_BOOT_0_RAM_AMOUNT_4MB", 0x2, 1 },
+    { "NV1_PFIFO_CACHE0_CTX_DEVICE", 22, 1 },
+    { "NV1_PFIFO_CACHE0_CTX_INSTANCE", 15, 1 },
+    { "NV1_PFIFO_CACHE0_CTX__SIZE_1", 1, 1 },
+    { "NV1_PFIFO_CACHE0_DATA__SIZE_1", 1, 1 },
+    { "NV1_PFIFO_CACHE0_GET", 0x00003070, 1 },
+    { "NV1_PFIFO_CACHE0_GET_ADDRESS", 2, 1 },
+    { "NV1_PFIFO_CACHE0_METHOD__SIZE_1", 1, 1 },
+    { "NV1_PFIFO_CACHE0_PULL0", 0x00003040, 1 },
+    { "NV1_PFIFO_CACHE0_PULL0_ACCESS", 0, 1 },
+    { "NV1_PFIFO_CACHE0_PULL0_ACCESS_DISABLED", 0x00000000, 1 },
+    { "NV1_PFIFO_CACHE0_PULL0_ACCESS_ENABLED", 0x00000001, 1 },
+    { "NV1_PFIFO_CACHE0_PULL1", 0x00003050, 1 },
+    { "NV1_PFIFO_CACHE0_PULL1_OBJECT", 8, 1 },
+    { "NV1_PFIFO_CACHE0_PULL1_OBJECT_CHANGED", 0x00000001, 1 },
+    { "NV1_PFIFO_CACHE0_PULL1_OBJECT_UNCHANGED", 0x00000000, 1 },
+    { "NV1_PFIFO_CACHE0_PUSH0", 0x00003000, 1 },
+    { "NV1_PFIFO_CACHE0_PUSH0_ACCESS", 0, 1 },
+    { "NV1_PFIFO_CACHE0_PUSH0_ACCESS_DISABLED", 0x00000000, 1 },
+    { "NV1_PFIFO_CACHE0_PUSH0_ACCESS_ENABLED", 0x00000001, 1 },
+    { "NV1_PFIFO_CACHE0_PUSH1", 0x00003010, 1 },
+    { "NV1_PFIFO_CACHE0_PUSH1_CHID", 0, 1 },
+    { "NV1_PFIFO_CACHE0_PUT", 0x00003030, 1 },
+    { "NV1_PFIFO_CACHE0_PUT_ADDRESS", 2, 1 },
+    { "NV1_PFIFO_CACHE0_STATUS", 0x00003020, 1 },
+    { "NV1_PFIFO_CACHE0_STATUS_HIGH_MARK", 8, 1 },
+    { "NV1_PFIFO_CACHE0_STATUS_HIGH_MARK_FULL", 0x00000001, 1 },
+    { "NV1_PFIFO_CACHE0_STATUS_HIGH_MARK_NOT_FULL", 0x00000000, 1 },
+    { "NV1_PFIFO_CACHE0_STATUS_LOW_MARK", 4, 1 },
+    { "NV1_PFIFO_CACHE0_STATUS_LOW_MARK_EMPTY", 0x00000001, 1 },
+    { "NV1_PFIFO_CACHE0_STATUS_LOW_MARK_NOT_EMPTY", 0x00000000, 1 },
+    { "NV1_PFIFO_CACHE1_CTX_DEVICE", 22, 1 },
+    { "NV1_PFIFO_CACHE1_CTX_INSTANCE", 15, 1 },
+    { "NV1_PFIFO_CACHE1_CTX_LIE", 24, 1 },
+    { "NV1_PFIFO_CACHE1_CTX_LIE_DISABLED", 0x00000000, 1 },
+    { "NV1_PFIFO_CACHE1_CTX_LIE_ENABLED", 0x00000001, 1 },
+    { "NV1_PFIFO_CACHE1_CTX__SIZE_1", 8, 1 },
+    { "NV1_PFIFO_CACHE1_DATA__SIZE_1", 32, 1 },
+    { "NV1_PFIFO_CACHE1_GET", 0x00003270, 1 },
+    { "NV1_PFIFO_CACHE1_GET_ADDRESS", 2, 1 },
+    { "NV1_PFIFO_CACHE1_METHOD__SIZE_1", 32, 1 },
+    { "NV1_PFIFO_CACHE1_PULL0", 0x00003240, 1 },
+    { "NV1_PFIFO_CACHE1_PULL0_ACCESS", 0, 1 },
+    { "NV1_PFIFO_CACHE1_PULL0_ACCESS_DISABLED", 0x00000000, 1 },
+    { "NV1_PFIFO_CACHE1_PULL0_ACCESS_ENABLED", 0x00000001, 1 },
+    { "NV1_PFIFO_CACHE1_PULL0_DEVICE", 8, 1 },
+    { "NV1_PFIFO_CACHE1_PULL0_DEVICE_HARDWARE", 0x00000000, 1 },
+    { "NV1_PFIFO_CACHE1_PULL0_DEVICE_SOFTWARE", 0x00000001, 1 },
+    { "NV1_PFIFO_CACHE1_PULL0_HASH", 4, 1 },
+    { "NV1_PFIFO_CACHE1_PULL0_HASH_FAILED", 0x00000001, 1 },
+    { "NV1_PFIFO_CACHE1_PULL0_HASH_SUCCEEDED", 0x00000000, 1 },
+    { "NV1_PFIFO_CACHE1_PULL1", 0x00003250, 1 },
+    { "NV1_PFIFO_CACHE1_PULL1_CTX", 4, 1 },
+    { "NV1_PFIFO_CACHE1_PULL1_CTX_CLEAN", 0x00000000, 1 },
+    { "NV1_PFIFO_CACHE1_PULL1_CTX_DIRTY", 0x00000001, 1 },
+    { "NV1_PFIFO_CACHE1_PULL1_OBJECT", 8, 1 },
+    { "NV1_PFIFO_CACHE1_PULL1_OBJECT_CHANGED", 0x00000001, 1 },
+    { "NV1_PFIFO_CACHE1_PULL1_OBJECT_UNCHANGED", 0x00000000, 1 },
+    { "NV1_PFIFO_CACHE1_PULL1_SUBCHANNEL", 0, 1 },
+    { "NV1_PFIFO_CACHE1_PUSH0", 0x00003200, 1 },
+    { "NV1_PFIFO_CACHE1_PUSH0_ACCESS", 0, 1 },
+    { "NV1_PFIFO_CACHE1_PUSH0_ACCESS_DISABLED", 0x00000000, 1 },
+    { "NV1_PFIFO_CACHE1_PUSH0_ACCESS_ENABLED", 0x00000001, 1 },
+    { "NV1_PFIFO_CACHE1_PUSH1", 0x00003210, 1 },
+    { "NV1_PFIFO_CACHE1_PUSH1_CHID", 0, 1 },
+    { "NV1_PFIFO_CACHE1_PUT", 0x00003230, 1 },
+    { "NV1_PFIFO_CACHE1_PUT_ADDRESS", 2, 1 },
+    { "NV1_PFIFO_CACHE1_STATUS", 0x00003220, 1 },
+    { "NV1_PFIFO_CACHE1_STATUS_HIGH_MARK", 8, 1 },
+    { "NV1_PFIFO_CACHE1_STATUS_HIGH_MARK_FULL", 0x00000001, 1 },
+    { "NV1_PFIFO_CACHE1_STATUS_HIGH_MARK_NOT_FULL", 0x00000000, 1 },
+    { "NV1_PFIFO_CACHE1_STATUS_LOW_MARK", 4, 1 },
+    { "NV1_PFIFO_CACHE1_STATUS_LOW_MARK_EMPTY", 0x00000001, 1 },
+    { "NV1_PFIFO_CACHE1_STATUS_LOW_MARK_NOT_EMPTY", 0x00000000, 1 },
+    { "NV1_PFIFO_CACHE1_STATUS_RANOUT", 0, 1 },
+    { "NV1_PFIFO_CACHE1_STATUS_RANOUT_FALSE", 0x00000000, 1 },
+    { "NV1_PFIFO_CACHE1_STATUS_RANOUT_TRUE", 0x00000001, 1 },
+    { "NV1_PFIFO_CACHES", 0x00002500, 1 },
+    { "NV1_PFIFO_CACHES_REASSIGN", 0, 1 },
+    { "NV1_PFIFO_CACHES_REASSIGN_DISABLED", 0x00000000, 1 },
+    { "NV1_PFIFO_CACHES_REASSIGN_ENABLED", 0x00000001, 1 },
+    { "NV1_PFIFO_CONFIG_0", 0x00002200, 1 },
+    { "NV1_PFIFO_CONFIG_0_FREE_LIE", 0, 1 },
+    { "NV1_PFIFO_CONFIG_0_FREE_LIE_1020_BYTES", 0x00000003, 1 },
+    { "NV1_PFIFO_CONFIG_0_FREE_LIE_252_BYTES", 0x00000001, 1 },
+    { "NV1_PFIFO_CONFIG_0_FREE_LIE_508_BYTES", 0x00000002, 1 },
+    { "NV1_PFIFO_CONFIG_0_FREE_LIE_DISABLED", 0x00000000, 1 },
+    { "NV1_PFIFO_DEBUG_0", 0x00002080, 1 },
+    { "NV1_PFIFO_DEBUG_0_CACHE_ERROR0", 0, 1 },
+    { "NV1_PFIFO_DEBUG_0_CACHE_ERROR0_NOT_PENDING", 0x00000000, 1 },
+    { "NV1_PFIFO_DEBUG_0_CACHE_ERROR0_PENDING", 0x00000001, 1 },
+    { "NV1_PFIFO_DEBUG_0_CACHE_ERROR1", 4, 1 },
+    { "NV1_PFIFO_DEBUG_0_CACHE_ERROR1_NOT_PENDING", 0x00000000, 1 },
+    { "NV1_PFIFO_DEBUG_0_CACHE_ERROR1_PENDING", 0x00000001, 1 },
+    { "NV1_PFIFO_DELAY_0", 0x00002040, 1 },
+    { "NV1_PFIFO_DELAY_0_WAIT_RETRY", 7, 1 },
+    { "NV1_PFIFO_DELAY_0_WAIT_RETRY_0", 0x00000000, 1 },
+    { "NV1_PFIFO_DEVICE_ACCESS", 28, 1 },
+    { "NV1_PFIFO_DEVICE_ACCESS_DISABLED", 0x00000000, 1 },
+    { "NV1_PFIFO_DEVICE_ACCESS_ENABLED", 0x00000001, 1 },
+    { "NV1_PFIFO_DEVICE_CHID", 0, 1 },
+    { "NV1_PFIFO_DEVICE_SWITCH", 24, 1 },
+    { "NV1_PFIFO_DEVICE_SWITCH_AVAILABLE", 0x00000001, 1 },
+    { "NV1_PFIFO_DEVICE_SWITCH_UNAVAILABLE", 0x00000000, 1 },
+    { "NV1_PFIFO_DEVICE__SIZE_1", 128, 1 },
+    { "NV1_PFIFO_END", 0x3FFF, 1 },
+    { "NV1_PFIFO_INTR_0", 0x00002100, 1 },
+    { "NV1_PFIFO_INTR_0_CACHE_ERROR", 0, 1 },
+    { "NV1_PFIFO_INTR_0_CACHE_ERROR_NOT_PENDING", 0x00000000, 1 },
+    { "NV1_PFIFO_INTR_0_CACHE_ERROR_PENDING", 0x00000001, 1 },
+    { "NV1_PFIFO_INTR_0_CACHE_ERROR_RESET", 0x00000001, 1 },
+    { "NV1_PFIFO_INTR_0_RUNOUT", 4, 1 },
+    { "NV1_PFIFO_INTR_0_RUNOUT_NOT_PENDING", 0x00000000, 1 },
+    { "NV1_PFIFO_INTR_0_RUNOUT_OVERFLOW", 8, 1 },
+    { "NV1_PFIFO_INTR_0_RUNOUT_OVERFLOW_NOT_PENDING", 0x00000000, 1 },
+    { "NV1_PFIFO_INTR_0_RUNOUT_OVERFLOW_PENDING", 0x00000001, 1 },
+    { "NV1_PFIFO_INTR_0_RUNOUT_OVERFLOW_RESET", 0x00000001, 1 },
+    { "NV1_PFIFO_INTR_0_RUNOUT_PENDING", 0x00000001, 1 },
+    { "NV1_PFIFO_INTR_0_RUNOUT_RESET", 0x00000001, 1 },
+    { "NV1_PFIFO_INTR_EN_0", 0x00002140, 1 },
+    { "NV1_PFIFO_INTR_EN_0_CACHE_ERROR", 0, 1 },
+    { "NV1_PFIFO_INTR_EN_0_CACHE_ERROR_DISABLED", 0x00000000, 1 },
+    { "NV1_PFIFO_INTR_EN_0_CACHE_ERROR_ENABLED", 0x00000001, 1 },
+    { "NV1_PFIFO_INTR_EN_0_RUNOUT", 4, 1 },
+    { "NV1_PFIFO_INTR_EN_0_RUNOUT_DISABLED", 0x00000000, 1 },
+    { "NV1_PFIFO_INTR_EN_0_RUNOUT_ENABLED", 0x00000001, 1 },
+    { "NV1_PFIFO_INTR_EN_0_RUNOUT_OVERFLOW", 8, 1 },
+    { "NV1_PFIFO_INTR_EN_0_RUNOUT_OVERFLOW_DISABLED", 0x00000000, 1 },
+    { "NV1_PFIFO_INTR_EN_0_RUNOUT_OVERFLOW_ENABLED", 0x00000001, 1 },
+    { "NV1_PFIFO_RUNOUT_GET", 0x00002420, 1 },
+    { "NV1_PFIFO_RUNOUT_GET_ADDRESS", 3, 1 },
+    { "NV1_PFIFO_RUNOUT_PUT", 0x00002410, 1 },
+    { "NV1_PFIFO_RUNOUT_PUT_ADDRESS", 3, 1 },
+    { "NV1_PFIFO_RUNOUT_PUT_ADDRESS__SIZE_0", 3, 1 },
+    { "NV1_PFIFO_RUNOUT_PUT_ADDRESS__SIZE_1", 3, 1 },
+    { "NV1_PFIFO_RUNOUT_PUT_ADDRESS__SIZE_2", 3, 1 },
+    { "NV1_PFIFO_RUNOUT_PUT_ADDRESS__SIZE_3", 3, 1 },
+    { "NV1_PFIFO_RUNOUT_STATUS", 0x00002400, 1 },
+    { "NV1_PFIFO_RUNOUT_STATUS_HIGH_MARK", 8, 1 },
+    { "NV1_PFIFO_RUNOUT_STATUS_HIGH_MARK_FULL", 0x00000001, 1 },
+    { "NV1_PFIFO_RUNOUT_STATUS_HIGH_MARK_NOT_FULL", 0x00000000, 1 },
+    { "NV1_PFIFO_RUNOUT_STATUS_LOW_MARK", 4, 1 },
+    { "NV1_PFIFO_RUNOUT_STATUS_LOW_MARK_EMPTY", 0x00000001, 1 },
+    { "NV1_PFIFO_RUNOUT_STATUS_LOW_MARK_NOT_EMPTY", 0x00000000, 1 },
+    { "NV1_PFIFO_RUNOUT_STATUS_RANOUT", 0, 1 },
+    { "NV1_PFIFO_RUNOUT_STATUS_RANOUT_FALSE", 0x00000000, 1 },
+    { "NV1_PFIFO_RUNOUT_STATUS_RANOUT_TRUE", 0x00000001, 1 },
+    { "NV1_PFIFO_START", 0x2000, 1 },
+    { "NV1_PMC_BOOT_0", 0x0, 1 },
+    { "NV1_PMC_BOOT_0_ARCHITECTURE", 16, 1 },
+    { "NV1_PMC_BOOT_0_ARCHITECTURE_NV0", 0x0, 1 },
+    { "NV1_PMC_BOOT_0_ARCHITECTURE_NV1", 0x1, 1 },
+    { "NV1_PMC_BOOT_0_ARCHITECTURE_NV2", 0x2, 1 },
+    { "NV1_PMC_BOOT_0_IMPLEMENTATION", 8, 1 },
+    { "NV1_PMC_BOOT_0_IMPLEMENTATION_NV0", 0x1, 1 },
+    { "NV1_PMC_BOOT_0_IMPLEMENTATION_NV1_D32", 0x2, 1 },
+    { "NV1_PMC_BOOT_0_IMPLEMENTATION_NV1_V32", 0x3, 1 },
+    { "NV1_PMC_BOOT_0_IMPLEMENTATION_PICASSO", 0x4, 1 },
+    { "NV1_PMC_BOOT_0_REVISION", 0, 1 },
+    { "NV1_PMC_BOOT_0_REVISION_A", 0x0, 1 },
+    { "NV1_PMC_BOOT_0_REVISION_B1", 0x0, 1 },
+    { "NV1_PMC_BOOT_0_REVISION_B2", 0x0, 1 },
+    { "NV1_PMC_BOOT_0_REVISION_B3", 0x0, 1 },
+    { "NV1_PMC_BOOT_0_REVISION_C", 0x0, 1 },
+    { "NV1_PMC_DEBUG_0", 0x80, 1 },
+    { "NV1_PMC_ENABLE", 0x200, 1 },
+    { "NV1_PMC_INTR_0", 0x100, 1 },
+    { "NV1_PMC_INTR_EN_0", 0x140, 1 },
+    { "NV1_PMC_INTR_EN_0_ALL", 0x3, 1 },
+    { "NV1_PMC_INTR_EN_0_DISABLED", 0x0, 1 },
+    { "NV1_PMC_INTR_EN_0_HARDWARE", 0x1, 1 },
+    { "NV1_PMC_INTR_EN_0_INTA", 0, 1 },
+    { "NV1_PMC_INTR_EN_0_INTB", 4, 1 },
+    { "NV1_PMC_INTR_EN_0_INTC", 8, 1 },
+    { "NV1_PMC_INTR_EN_0_INTD", 12, 1 },
+    { "NV1_PMC_INTR_EN_0_SOFTWARE", 0x2, 1 },
+    { "NV1_PMC_INTR_READ", 0x160, 1 },
+    { "NV1_PRAMPW", 0x606000, 1 },
+    { "NV1_PRAM_CONFIG", 0x602200, 1 },
+    { "NV1_PRAM_CONFIG_12KB", 0, 1 },
+    { "NV1_PRAM_CONFIG_20KB", 1, 1 },
+    { "NV1_PRAM_CONFIG_36KB", 2, 1 },
+    { "NV1_PRAM_CONFIG_68KB", 3, 1 },
+    { "NV1_PRAM_CONFIG_SIZE", 0, 1 },
+    { "NV1_PROM", 0x601000, 1 },
+    { "NV1_PROM_SIZE", 32768, 1 },
+    { "NV1_RAMIN_START", 0x100000, 1 },
+    { "NV1_RAMPW_POSITION_CONFIG0", 0x2c00, 1 },
+    { "NV1_RAMPW_POSITION_CONFIG1", 0x4c00, 1 },
+    { "NV1_RAMPW_POSITION_CONFIG2", 0x8c00, 1 },
+    { "NV1_RAMPW_POSITION_CONFIG3", 0x10c00, 1 },
+    { "NV1_RAMPW_SIZE", 0x400, 1 },
+    { "NV1_STRAPS", 0x608000, 1 },
+    { "NV1_STRAPS_STRAP_VENDOR", 0, 1 },
+    { "NV1_VRAM_SIZE_1MB", 0x100000, 1 },
+    { "NV1_VRAM_SIZE_2MB", 0x200000, 1 },
+    { "NV1_VRAM_SIZE_4MB", 0x400000, 1 },
+    { "NV3_AGP_CAPABILITIES", 0x44, 3 },
+    { "NV3_AGP_CAPABILITIES_AGP_VERSION_MAJOR", 20, 3 },
+    { "NV3_AGP_CAPABILITIES_AGP_VERSION_MINOR", 16, 3 },
+    { "NV3_AGP_CAPABILITIES_CAP_ID", 0, 3 },
+    { "NV3_AGP_CAPABILITIES_CAP_ID_AGP", 0x02, 3 },
+    { "NV3_AGP_CAPABILITIES_NEXT_PTR", 8, 3 },
+    { "NV3_AGP_CAPABILITIES_POINTER", 0x34, 3 },
+    { "NV3_AGP_COMMAND", 0x4C, 3 },
+    { "NV3_AGP_COMMAND_AGP_ENABLE", 8, 3 },
+    { "NV3_AGP_COMMAND_AGP_ENABLE_DISABLED", 0x0, 3 },
+    { "NV3_AGP_COMMAND_AGP_ENABLE_ENABLED", 0x1, 3 },
+    { "NV3_AGP_COMMAND_DATA_RATE", 0, 3 },
+    { "NV3_AGP_COMMAND_DATA_RATE_1X", 0x1, 3 },
+    { "NV3_AGP_COMMAND_DATA_RATE_2X", 0x2, 3 },
+    { "NV3_AGP_COMMAND_REQUEST_DEPTH", 24, 3 },
+    { "NV3_AGP_COMMAND_SBA_ENABLE", 9, 3 },
+    { "NV3_AGP_COMMAND_SBA_ENABLE_DISABLED", 0x0, 3 },
+    { "NV3_AGP_COMMAND_SBA_ENABLE_ENABLED", 0x1, 3 },
+    { "NV3_AGP_STATUS", 0x48, 3 },
+    { "NV3_AGP_STATUS_MAX_REQUESTS", 24, 3 },
+    { "NV3_AGP_STATUS_MAX_REQUESTS_AMOUNT", 4, 3 },
+    { "NV3_AGP_STATUS_RATE", 0, 3 },
+    { "NV3_AGP_STATUS_RATE_1X_SUPPORTED", 0x1, 3 },
+    { "NV3_AGP_STATUS_RATE_2X_SUPPORTED", 0x2, 3 },
+    { "NV3_AGP_STATUS_SBA", 9, 3 },
+    { "NV3_AGP_STATUS_SBA_SUPPORTED", 0x0, 3 },
+    { "NV3_AGP_STATUS_SBA_UNSUPPORTED", 0x1, 3 },
+    { "NV3_CIO_END", 0x3df, 3 },
+    { "NV3_CIO_START", 0x3b0, 3 },
+    { "NV3_CRTC_BANKED_128K_A0000", 0x00, 3 },
+    { "NV3_CRTC_BANKED_32K_B0000", 0x08, 3 },
+    { "NV3_CRTC_BANKED_32K_B8000", 0x0C, 3 },
+    { "NV3_CRTC_BANKED_64K_A0000", 0x04, 3 },
+    { "NV3_CRTC_DATA_OUT", 0x3C0, 3 },
+    { "NV3_CRTC_MISCOUT", 0x3C2, 3 },
+    { "NV3_CRTC_REGISTER_CRTCCONTROL", 0x17, 3 },
+    { "NV3_CRTC_REGISTER_CURRENT", 0x3D5, 3 },
+    { "NV3_CRTC_REGISTER_CURSORLOCATION_HIGH", 0x0E, 3 },
+    { "NV3_CRTC_REGISTER_CURSORLOCATION_LOW", 0x0F, 3 },
+    { "NV3_CRTC_REGISTER_CURSOR_ADDR0", 0x30, 3 },
+    { "NV3_CRTC_REGISTER_CURSOR_ADDR1", 0x31, 3 },
+    { "NV3_CRTC_REGISTER_CURSOR_END", 0x0B, 3 },
+    { "NV3_CRTC_REGISTER_CURSOR_START", 0x0A, 3 },
+    { "NV3_CRTC_REGISTER_CURSOR_START_DISABLED", 5, 3 },
+    { "NV3_CRTC_REGISTER_ENDVBLANK", 0x16, 3 },
+    { "NV3_CRTC_REGISTER_FORMAT", 0x25, 3 },
+    { "NV3_CRTC_REGISTER_FORMAT_HBE6", 4, 3 },
+    { "NV3_CRTC_REGISTER_FORMAT_VBS10", 3, 3 },
+    { "NV3_CRTC_REGISTER_FORMAT_VDE10", 1, 3 },
+    { "NV3_CRTC_REGISTER_FORMAT_VDT10", 0, 3 },
+    { "NV3_CRTC_REGISTER_FORMAT_VRS10", 2, 3 },
+    { "NV3_CRTC_REGISTER_HBLANKEND", 0x03, 3 },
+    { "NV3_CRTC_REGISTER_HBLANKSTART", 0x02, 3 },
+    { "NV3_CRTC_REGISTER_HDISPEND", 0x01, 3 },
+    { "NV3_CRTC_REGISTER_HEB", 0x2D, 3 },
+    { "NV3_CRTC_REGISTER_HRETRACEEND", 0x05, 3 },
+    { "NV3_CRTC_REGISTER_HRETRACESTART", 0x04, 3 },
+    { "NV3_CRTC_REGISTER_HTOTAL", 0x00, 3 },
+    { "NV3_CRTC_REGISTER_I2C", 0x3E, 3 },
+    { "NV3_CRTC_REGISTER_I2C_GPIO", 0x3F, 3 },
+    { "NV3_CRTC_REGISTER_INDEX", 0x3D4, 3 },
+    { "NV3_CRTC_REGISTER_LINECOMP", 0x18, 3 },
+    { "NV3_CRTC_REGISTER_MAXSCAN", 0x09, 3 },
+    { "NV3_CRTC_REGISTER_MAXSCAN_LINEDOUBLE", 6, 3 },
+    { "NV3_CRTC_REGISTER_NVIDIA_END", 0x3F, 3 },
+    { "NV3_CRTC_REGISTER_OFFSET", 0x13, 3 },
+    { "NV3_CRTC_REGISTER_OVERFLOW", 0x07, 3 },
+    { "NV3_CRTC_REGISTER_PIXELMODE", 0x28, 3 },
+    { "NV3_CRTC_REGISTER_PIXELMODE_16BPP", 0x02, 3 },
+    { "NV3_CRTC_REGISTER_PIXELMODE_32BPP", 0x03, 3 },
+    { "NV3_CRTC_REGISTER_PIXELMODE_8BPP", 0x01, 3 },
+    { "NV3_CRTC_REGISTER_PIXELMODE_CONFIG", 0, 3 },
+    { "NV3_CRTC_REGISTER_PIXELMODE_HORIZ_ADJUST", 3, 3 },
+    { "NV3_CRTC_REGISTER_PIXELMODE_TV_MODE", 6, 3 },
+    { "NV3_CRTC_REGISTER_PIXELMODE_TV_MODE_TV", 0x01, 3 },
+    { "NV3_CRTC_REGISTER_PIXELMODE_TV_MODE_VGA_MONITOR", 0x00, 3 },
+    { "NV3_CRTC_REGISTER_PIXELMODE_VGA", 0x00, 3 },
+    { "NV3_CRTC_REGISTER_PRESETROWSCAN", 0x08, 3 },
+    { "NV3_CRTC_REGISTER_READ_BANK", 0x1D, 3 },
+    { "NV3_CRTC_REGISTER_REFRESH_FIFO_CONFIG", 0x1B, 3 },
+    { "NV3_CRTC_REGISTER_REFRESH_FIFO_WATERMARK", 0x20, 3 },
+    { "NV3_CRTC_REGISTER_REPAINT_0", 0x19, 3 },
+    { "NV3_CRTC_REGISTER_REPAINT_1", 0x1A, 3 },
+    { "NV3_CRTC_REGISTER_REPAINT_1_LARGE_SCREEN", 2, 3 },
+    { "NV3_CRTC_REGISTER_RL0", 0x34, 3 },
+    { "NV3_CRTC_REGISTER_RL1", 0x35, 3 },
+    { "NV3_CRTC_REGISTER_RMA", 0x38, 3 },
+    { "NV3_CRTC_REGISTER_RMA_MODE_MAX", 0x0F, 3 },
+    { "NV3_CRTC_REGISTER_STANDARDVGA_END", 0x18, 3 },
+    { "NV3_CRTC_REGISTER_STARTADDR_HIGH", 0x0C, 3 },
+    { "NV3_CRTC_REGISTER_STARTADDR_LOW", 0x0D, 3 },
+    { "NV3_CRTC_REGISTER_STARTVBLANK", 0x15, 3 },
+    { "NV3_CRTC_REGISTER_UNDERLINELOCATION", 0x14, 3 },
+    { "NV3_CRTC_REGISTER_VDISPEND", 0x12, 3 },
+    { "NV3_CRTC_REGISTER_VRETRACEEND", 0x11, 3 },
+    { "NV3_CRTC_REGISTER_VRETRACESTART", 0x10, 3 },
+    { "NV3_CRTC_REGISTER_VTOTAL", 0x06, 3 },
+    { "NV3_CRTC_REGISTER_WRITE_BANK", 0x1E, 3 },
+    { "NV3_DMA_CHANNELS", 8, 3 },
+    { "NV3_DMA_CHANNELS_TOTAL", 0x7F, 3 },
+    { "NV3_DMA_SUBCHANNELS_PER_CHANNEL", 8, 3 },
+    { "NV3_LAST_VALID_GRAPHICS_OBJECT_ID", 0x1F, 3 },
+    { "NV3_LFB_MIRROR_START", 0x800000, 3 },
+    { "NV3_LFB_RAMIN_MIRROR_START", 0x400000, 3 },
+    { "NV3_LFB_RAMIN_START", 0xC00000, 3 },
+    { "NV3_NOTIFICATION_INFO_ADJUST", 0, 3 },
+    { "NV3_NOTIFICATION_PAGE_ACCESS", 1, 3 },
+    { "NV3_NOTIFICATION_PAGE_ACCESS_READ", 0x0, 3 },
+    { "NV3_NOTIFICATION_PAGE_ACCESS_READ_WRITE", 0x1, 3 },
+    { "NV3_NOTIFICATION_PAGE_FRAME_ADDRESS", 12, 3 },
+    { "NV3_NOTIFICATION_PAGE_IS_PRESENT", 0, 3 },
+    { "NV3_NOTIFICATION_PT_PRESENT", 16, 3 },
+    { "NV3_NOTIFICATION_STATUS_DONE_OK", 0x0, 3 },
+    { "NV3_NOTIFICATION_STATUS_ERROR", 0x100, 3 },
+    { "NV3_NOTIFICATION_STATUS_IN_PROGRESS", 0xFF, 3 },
+    { "NV3_NOTIFICATION_TARGET", 24, 3 },
+    { "NV3_NOTIFICATION_TARGET_AGP", 3, 3 },
+    { "NV3_NOTIFICATION_TARGET_CART", 1, 3 },
+    { "NV3_NOTIFICATION_TARGET_NVM", 0, 3 },
+    { "NV3_NOTIFICATION_TARGET_PCI", 2, 3 },
+    { "NV3_OBJECT_SUBMIT_CHANNEL", 16, 3 },
+    { "NV3_OBJECT_SUBMIT_SUBCHANNEL", 13, 3 },
+    { "NV3_PALT_END", 0x12FFFF, 3 },
+    { "NV3_PALT_START", 0x120000, 3 },
+    { "NV3_PBUS_DEBUG_0", 0x1084, 3 },
+    { "NV3_PBUS_END", 0x1FFF, 3 },
+    { "NV3_PBUS_INTR", 0x1100, 3 },
+    { "NV3_PBUS_INTR_EN", 0x1140, 3 },
+    { "NV3_PBUS_PCI_END", 0x18FF, 3 },
+    { "NV3_PBUS_PCI_START", 0x1800, 3 },
+    { "NV3_PBUS_START", 0x1000, 3 },
+    { "NV3_PCI_CFG_BAR0_BASE_ADDRESS", 0x13, 3 },
+    { "NV3_PCI_CFG_BAR0_BYTE1", 0x11, 3 },
+    { "NV3_PCI_CFG_BAR0_BYTE2", 0x12, 3 },
+    { "NV3_PCI_CFG_BAR0_L", 0x10, 3 },
+    { "NV3_PCI_CFG_BAR1_BASE_ADDRESS", 0x17, 3 },
+    { "NV3_PCI_CFG_BAR1_BYTE1", 0x15, 3 },
+    { "NV3_PCI_CFG_BAR1_BYTE2", 0x16, 3 },
+    { "NV3_PCI_CFG_BAR1_L", 0x14, 3 },
+    { "NV3_PCI_CFG_BAR_INVALID_END", 0x27, 3 },
+    { "NV3_PCI_CFG_BAR_INVALID_START", 0x18, 3 },
+    { "NV3_PCI_CFG_BAR_PREFETCHABLE", 3, 3 },
+    { "NV3_PCI_CFG_BAR_PREFETCHABLE_ENABLED", 0x1, 3 },
+    { "NV3_PCI_CFG_BIST", 0x0F, 3 },
+    { "NV3_PCI_CFG_CACHE_LINE_SIZE", 0x0C, 3 },
+    { "NV3_PCI_CFG_CACHE_LINE_SIZE_DEFAULT_FROM_VBIOS", 0x40, 3 },
+    { "NV3_PCI_CFG_CAPABILITIES", 0x4, 3 },
+    { "NV3_PCI_CFG_CLASS_CODE", 0x0B, 3 },
+    { "NV3_PCI_CFG_CLASS_CODE_VGA", 0x03, 3 },
+    { "NV3_PCI_CFG_DEVICE_ID", 0x2, 3 },
+    { "NV3_PCI_CFG_ENABLE_VBIOS", 0x30, 3 },
+    { "NV3_PCI_CFG_HEADER_TYPE", 0x0E, 3 },
+    { "NV3_PCI_CFG_INT_LINE", 0x3C, 3 },
+    { "NV3_PCI_CFG_INT_PIN", 0x3D, 3 },
+    { "NV3_PCI_CFG_LATENCY_TIMER", 0x0D, 3 },
+    { "NV3_PCI_CFG_MAX_LATENCY", 0x3F, 3 },
+    { "NV3_PCI_CFG_MAX_LATENCY_DEFAULT", 0x01, 3 },
+    { "NV3_PCI_CFG_MIN_GRANT", 0x3E, 3 },
+    { "NV3_PCI_CFG_MIN_GRANT_DEFAULT", 0x03, 3 },
+    { "NV3_PCI_CFG_PROGRAMMING_INTERFACE", 0x9, 3 },
+    { "NV3_PCI_CFG_REVISION", 0x8, 3 },
+    { "NV3_PCI_CFG_REVISION_A00", 0x00, 3 },
+    { "NV3_PCI_CFG_REVISION_B00", 0x10, 3 },
+    { "NV3_PCI_CFG_REVISION_C00", 0x20, 3 },
+    { "NV3_PCI_CFG_SUBCLASS_CODE", 0x0A, 3 },
+    { "NV3_PCI_CFG_SUBSYSTEM_ID", 0x2C, 3 },
+    { "NV3_PCI_CFG_SUBSYSTEM_ID_MIRROR_END", 0x43, 3 },
+    { "NV3_PCI_CFG_SUBSYSTEM_ID_MIRROR_START", 0x40, 3 },
+    { "NV3_PCI_CFG_VBIOS_BASE_H", 0x33, 3 },
+    { "NV3_PCI_CFG_VBIOS_BASE_L", 0x32, 3 },
+    { "NV3_PCI_CFG_VENDOR_ID", 0x0, 3 },
+    { "NV3_PCI_COMMAND_H_FAST_BACK2BACK", 0x01, 3 },
+    { "NV3_PCI_COMMAND_L_IO", 1, 3 },
+    { "NV3_PCI_COMMAND_L_IO_ENABLED", 0x1, 3 },
+    { "NV3_PCI_COMMAND_L_MEMORY", 2, 3 },
+    { "NV3_PCI_COMMAND_L_MEMORY_ENABLED", 0x1, 3 },
+    { "NV3_PCI_STATUS_H_DEVSEL_TIMING", 5, 3 },
+    { "NV3_PCI_STATUS_H_FAST_DEVSEL_TIMING", 0x00, 3 },
+    { "NV3_PCI_STATUS_L_66MHZ_CAPABLE", 0x20, 3 },
+    { "NV3_PDAC_END", 0x680FFF, 3 },
+    { "NV3_PDAC_START", 0x680000, 3 },
+    { "NV3_PEXTDEV_END", 0x101FFF, 3 },
+    { "NV3_PEXTDEV_START", 0x101000, 3 },
+    { "NV3_PFB_BOOT", 0x100000, 3 },
+    { "NV3_PFB_BOOT_RAM_AMOUNT", 0, 3 },
+    { "NV3_PFB_BOOT_RAM_AMOUNT_2MB", 0x1, 3 },
+    { "NV3_PFB_BOOT_RAM_AMOUNT_4MB", 0x2, 3 },
+    { "NV3_PFB_BOOT_RAM_AMOUNT_8MB", 0x0, 3 },
+    { "NV3_PFB_BOOT_RAM_AMOUNT_UNDEFINED", 0x3, 3 },
+    { "NV3_PFB_BOOT_RAM_BANKS", 3, 3 },
+    { "NV3_PFB_BOOT_RAM_BANKS_2", 0x0, 3 },
+    { "NV3_PFB_BOOT_RAM_BANKS_4", 0x1, 3 },
+    { "NV3_PFB_BOOT_RAM_DATA_TWIDDLE", 4, 3 },
+    { "NV3_PFB_BOOT_RAM_DATA_TWIDDLE_OFF", 0x0, 3 },
+    { "NV3_PFB_BOOT_RAM_DATA_TWIDDLE_ON", 0x1, 3 },
+    { "NV3_PFB_BOOT_RAM_EXTENSION", 5, 3 },
+    { "NV3_PFB_BOOT_RAM_EXTENSION_8MB", 0x1, 3 },
+    { "NV3_PFB_BOOT_RAM_EXTENSION_NONE", 0x0, 3 },
+    { "NV3_PFB_BOOT_RAM_WIDTH", 2, 3 },
+    { "NV3_PFB_BOOT_RAM_WIDTH_128", 0x1, 3 },
+    { "NV3_PFB_BOOT_RAM_WIDTH_64", 0x0, 3 },
+    { "NV3_PFB_CONFIG_0", 0x100200, 3 },
+    { "NV3_PFB_CONFIG_0_DEPTH_16BPP", 0x2, 3 },
+    { "NV3_PFB_CONFIG_0_DEPTH_32BPP", 0x3, 3 },
+    { "NV3_PFB_CONFIG_0_DEPTH_8BPP", 0x1, 3 },
+    { "NV3_PFB_CONFIG_0_HORIZ_RESOLUTION_1024", 0x20, 3 },
+    { "NV3_PFB_CONFIG_0_HORIZ_RESOLUTION_1152", 0x24, 3 },
+    { "NV3_PFB_CONFIG_0_HORIZ_RESOLUTION_1280", 0x28, 3 },
+    { "NV3_PFB_CONFIG_0_HORIZ_RESOLUTION_1600", 0x32, 3 },
+    { "NV3_PFB_CONFIG_0_HORIZ_RESOLUTION_320", 0xA, 3 },
+    { "NV3_PFB_CONFIG_0_HORIZ_RESOLUTION_400", 0xD, 3 },
+    { "NV3_PFB_CONFIG_0_HORIZ_RESOLUTION_480", 0xF, 3 },
+    { "NV3_PFB_CONFIG_0_HORIZ_RESOLUTION_512", 0x10, 3 },
+    { "NV3_PFB_CONFIG_0_HORIZ_RESOLUTION_640", 0x14, 3 },
+    { "NV3_PFB_CONFIG_0_HORIZ_RESOLUTION_800", 0x19, 3 },
+    { "NV3_PFB_CONFIG_0_HORIZ_RESOLUTION_960", 0x1E, 3 },
+    { "NV3_PFB_CONFIG_0_PIXEL_DEPTH", 8, 3 },
+    { "NV3_PFB_CONFIG_0_RESOLUTION", 0, 3 },
+    { "NV3_PFB_CONFIG_1", 0x100204, 3 },
+    { "NV3_PFB_DEBUG_0", 0x100080, 3 },
+    { "NV3_PFB_DELAY", 0x100044, 3 },
+    { "NV3_PFB_END", 0x100FFF, 3 },
+    { "NV3_PFB_GREEN_0", 0x1000C0, 3 },
+    { "NV3_PFB_RTL", 0x100300, 3 },
+    { "NV3_PFB_START", 0x100000, 3 },
+    { "NV3_PFIFO_CACHE0_CTX", 0x3080, 3 },
+    { "NV3_PFIFO_CACHE0_ERROR_PENDING", 0, 3 },
+    { "NV3_PFIFO_CACHE0_GET", 0x3070, 3 },
+    { "NV3_PFIFO_CACHE0_GET_ADDRESS", 2, 3 },
+    { "NV3_PFIFO_CACHE0_METHOD_ADDRESS", 2, 3 },
+    { "NV3_PFIFO_CACHE0_METHOD_END", 0x3200, 3 },
+    { "NV3_PFIFO_CACHE0_METHOD_START", 0x3100, 3 },
+    { "NV3_PFIFO_CACHE0_METHOD_SUBCHANNEL", 13, 3 },
+    { "NV3_PFIFO_CACHE0_PULL0", 0x3040, 3 },
+    { "NV3_PFIFO_CACHE0_PULL0_ENABLED", 0, 3 },
+    { "NV3_PFIFO_CACHE0_PULL0_HASH_FAILURE", 4, 3 },
+    { "NV3_PFIFO_CACHE0_PULL0_SOFTWARE_METHOD", 8, 3 },
+    { "NV3_PFIFO_CACHE0_PULLER_CTX_STATE", 0x3050, 3 },
+    { "NV3_PFIFO_CACHE0_PULLER_CTX_STATE_DIRTY", 4, 3 },
+    { "NV3_PFIFO_CACHE0_PUSH_CHANNEL_ID", 0x3004, 3 },
+    { "NV3_PFIFO_CACHE0_PUSH_ENABLED", 0x3000, 3 },
+    { "NV3_PFIFO_CACHE0_PUT", 0x3010, 3 },
+    { "NV3_PFIFO_CACHE0_PUT_ADDRESS", 2, 3 },
+    { "NV3_PFIFO_CACHE0_SIZE", 1, 3 },
+    { "NV3_PFIFO_CACHE0_STATUS", 0x3014, 3 },
+    { "NV3_PFIFO_CACHE0_STATUS_EMPTY", 4, 3 },
+    { "NV3_PFIFO_CACHE0_STATUS_FULL", 8, 3 },
+    { "NV3_PFIFO_CACHE1_CTX_END", 0x32F0, 3 },
+    { "NV3_PFIFO_CACHE1_CTX_START", 0x3280, 3 },
+    { "NV3_PFIFO_CACHE1_DMA_CONFIG_0", 0x3220, 3 },
+    { "NV3_PFIFO_CACHE1_DMA_CONFIG_1", 0x3224, 3 },
+    { "NV3_PFIFO_CACHE1_DMA_CONFIG_2", 0x3228, 3 },
+    { "NV3_PFIFO_CACHE1_DMA_CONFIG_3", 0x322C, 3 },
+    { "NV3_PFIFO_CACHE1_DMA_CONFIG_3_TARGET_NODE", 0, 3 },
+    { "NV3_PFIFO_CACHE1_DMA_CONFIG_3_TARGET_NODE_AGP", 0x03, 3 },
+    { "NV3_PFIFO_CACHE1_DMA_CONFIG_3_TARGET_NODE_PCI", 0x02, 3 },
+    { "NV3_PFIFO_CACHE1_DMA_STATUS", 0x3218, 3 },
+    { "NV3_PFIFO_CACHE1_DMA_TLB_PTE", 0x3234, 3 },
+    { "NV3_PFIFO_CACHE1_DMA_TLB_PT_BASE", 0x3238, 3 },
+    { "NV3_PFIFO_CACHE1_DMA_TLB_TAG", 0x3230, 3 },
+    { "NV3_PFIFO_CACHE1_ERROR_PENDING", 4, 3 },
+    { "NV3_PFIFO_CACHE1_GET", 0x3270, 3 },
+    { "NV3_PFIFO_CACHE1_GET_ADDRESS", 2, 3 },
+    { "NV3_PFIFO_CACHE1_METHOD_ADDRESS", 2, 3 },
+    { "NV3_PFIFO_CACHE1_METHOD_END", 0x3400, 3 },
+    { "NV3_PFIFO_CACHE1_METHOD_START", 0x3300, 3 },
+    { "NV3_PFIFO_CACHE1_METHOD_SUBCHANNEL", 13, 3 },
+    { "NV3_PFIFO_CACHE1_PULL0", 0x3240, 3 },
+    { "NV3_PFIFO_CACHE1_PULL0_ENABLED", 0, 3 },
+    { "NV3_PFIFO_CACHE1_PULL0_HASH_FAILURE", 4, 3 },
+    { "NV3_PFIFO_CACHE1_PULL0_SOFTWARE_METHOD", 8, 3 },
+    { "NV3_PFIFO_CACHE1_PULLER_CTX_STATE", 0x3250, 3 },
+    { "NV3_PFIFO_CACHE1_PULLER_CTX_STATE_DIRTY", 4, 3 },
+    { "NV3_PFIFO_CACHE1_PUSH_CHANNEL_ID", 0x3204, 3 },
+    { "NV3_PFIFO_CACHE1_PUSH_ENABLED", 0x3200, 3 },
+    { "NV3_PFIFO_CACHE1_PUT", 0x3210, 3 },
+    { "NV3_PFIFO_CACHE1_PUT_ADDRESS", 2, 3 },
+    { "NV3_PFIFO_CACHE1_SIZE_REV_AB", 32, 3 },
+    { "NV3_PFIFO_CACHE1_SIZE_REV_C", 64, 3 },
+    { "NV3_PFIFO_CACHE1_STATUS", 0x3214, 3 },
+    { "NV3_PFIFO_CACHE1_STATUS_EMPTY", 4, 3 },
+    { "NV3_PFIFO_CACHE1_STATUS_FULL", 8, 3 },
+    { "NV3_PFIFO_CACHE1_STATUS_RANOUT", 0, 3 },
+    { "NV3_PFIFO_CACHE_REASSIGNMENT", 0x2500, 3 },
+    { "NV3_PFIFO_CONFIG_0", 0x2200, 3 },
+    { "NV3_PFIFO_CONFIG_0_DMA_FETCH", 8, 3 },
+    { "NV3_PFIFO_CONFIG_RAMFC", 0x2214, 3 },
+    { "NV3_PFIFO_CONFIG_RAMFC_BASE_ADDRESS", 9, 3 },
+    { "NV3_PFIFO_CONFIG_RAMFC_BASE_ADDRESS_DEFAULT", 0x1C00, 3 },
+    { "NV3_PFIFO_CONFIG_RAMHT", 0x2210, 3 },
+    { "NV3_PFIFO_CONFIG_RAMHT_BASE_ADDRESS", 12, 3 },
+    { "NV3_PFIFO_CONFIG_RAMHT_BASE_ADDRESS_DEFAULT", 0x0, 3 },
+    { "NV3_PFIFO_CONFIG_RAMHT_SIZE", 16, 3 },
+    { "NV3_PFIFO_CONFIG_RAMHT_SIZE_16K", 0x2, 3 },
+    { "NV3_PFIFO_CONFIG_RAMHT_SIZE_32K", 0x3, 3 },
+    { "NV3_PFIFO_CONFIG_RAMHT_SIZE_4K", 0x0, 3 },
+    { "NV3_PFIFO_CONFIG_RAMHT_SIZE_8K", 0x1, 3 },
+    { "NV3_PFIFO_CONFIG_RAMRO", 0x2218, 3 },
+    { "NV3_PFIFO_CONFIG_RAMRO_BASE_ADDRESS", 9, 3 },
+    { "NV3_PFIFO_CONFIG_RAMRO_BASE_ADDRESS_DEFAULT", 0x1E00, 3 },
+    { "NV3_PFIFO_CONFIG_RAMRO_SIZE", 16, 3 },
+    { "NV3_PFIFO_CONFIG_RAMRO_SIZE_512B", 0x0, 3 },
+    { "NV3_PFIFO_CONFIG_RAMRO_SIZE_8K", 0x1, 3 },
+    { "NV3_PFIFO_DEBUG_0", 0x2080, 3 },
+    { "NV3_PFIFO_DELAY_0", 0x2040, 3 },
+    { "NV3_PFIFO_END", 0x3FFF, 3 },
+    { "NV3_PFIFO_FIRST_VALID_GRAPHICS_OBJECT_ID", 0x40, 3 },
+    { "NV3_PFIFO_INTR", 0x2100, 3 },
+    { "NV3_PFIFO_INTR_CACHE_ERROR", 0, 3 },
+    { "NV3_PFIFO_INTR_DMA_PTE", 16, 3 },
+    { "NV3_PFIFO_INTR_DMA_PUSHER", 12, 3 },
+    { "NV3_PFIFO_INTR_EN", 0x2140, 3 },
+    { "NV3_PFIFO_INTR_RUNOUT", 4, 3 },
+    { "NV3_PFIFO_INTR_RUNOUT_OVERFLOW", 8, 3 },
+    { "NV3_PFIFO_LAST_VALID_GRAPHICS_OBJECT_ID", 0x5F, 3 },
+    { "NV3_PFIFO_MINIMUM_GUARANTEED_DEPTH", 0x7C, 3 },
+    { "NV3_PFIFO_RUNOUT_GET", 0x2420, 3 },
+    { "NV3_PFIFO_RUNOUT_GET_ADDRESS", 3, 3 },
+    { "NV3_PFIFO_RUNOUT_PUT", 0x2410, 3 },
+    { "NV3_PFIFO_RUNOUT_PUT_ADDRESS", 3, 3 },
+    { "NV3_PFIFO_RUNOUT_RAMIN_ERR", 28, 3 },
+    { "NV3_PFIFO_RUNOUT_STATUS", 0x2400, 3 },
+    { "NV3_PFIFO_RUNOUT_STATUS_EMPTY", 4, 3 },
+    { "NV3_PFIFO_RUNOUT_STATUS_FULL", 8, 3 },
+    { "NV3_PFIFO_RUNOUT_STATUS_RANOUT", 0, 3 },
+    { "NV3_PFIFO_START", 0x2000, 3 },
+    { "NV3_PGRAPH_ABS_UCLIP_XMAX", 0x400540, 3 },
+    { "NV3_PGRAPH_ABS_UCLIP_XMIN", 0x40053C, 3 },
+    { "NV3_PGRAPH_ABS_UCLIP_YMAX", 0x400548, 3 },
+    { "NV3_PGRAPH_ABS_UCLIP_YMIN", 0x400544, 3 },
+    { "NV3_PGRAPH_BETA", 0x400640, 3 },
+    { "NV3_PGRAPH_CACHE_INDEX", 0x4006C0, 3 },
+    { "NV3_PGRAPH_CACHE_INDEX_ADDRESS", 3, 3 },
+    { "NV3_PGRAPH_CACHE_INDEX_ADDRESS_0", 0x0, 3 },
+    { "NV3_PGRAPH_CACHE_INDEX_ADDRESS_1024", 0x400, 3 },
+    { "NV3_PGRAPH_CACHE_INDEX_BANK", 2, 3 },
+    { "NV3_PGRAPH_CACHE_INDEX_BANK_10", 0x0, 3 },
+    { "NV3_PGRAPH_CACHE_INDEX_BANK_32", 0x1, 3 },
+    { "NV3_PGRAPH_CACHE_INDEX_OP", 13, 3 },
+    { "NV3_PGRAPH_CACHE_INDEX_OP_READ_CACHE", 0x1, 3 },
+    { "NV3_PGRAPH_CACHE_INDEX_OP_READ_INDEX", 0x2, 3 },
+    { "NV3_PGRAPH_CACHE_INDEX_OP_WRITE_CACHE", 0x0, 3 },
+    { "NV3_PGRAPH_CACHE_RAM", 0x4006C4, 3 },
+    { "NV3_PGRAPH_CHROMA_KEY", 0x40062C, 3 },
+    { "NV3_PGRAPH_CLASS01_BETA_END", 0x411FFF, 3 },
+    { "NV3_PGRAPH_CLASS01_BETA_START", 0x410000, 3 },
+    { "NV3_PGRAPH_CLASS02_ROP_END", 0x421FFF, 3 },
+    { "NV3_PGRAPH_CLASS02_ROP_START", 0x420000, 3 },
+    { "NV3_PGRAPH_CLASS03_COLORKEY_END", 0x431FFF, 3 },
+    { "NV3_PGRAPH_CLASS03_COLORKEY_START", 0x430000, 3 },
+    { "NV3_PGRAPH_CLASS04_PLANEMASK_END", 0x441FFF, 3 },
+    { "NV3_PGRAPH_CLASS04_PLANEMASK_START", 0x440000, 3 },
+    { "NV3_PGRAPH_CLASS05_CLIP_END", 0x451FFF, 3 },
+    { "NV3_PGRAPH_CLASS05_CLIP_START", 0x450000, 3 },
+    { "NV3_PGRAPH_CLASS06_PATTERN_END", 0x461FFF, 3 },
+    { "NV3_PGRAPH_CLASS06_PATTERN_START", 0x460000, 3 },
+    { "NV3_PGRAPH_CLASS07_RECTANGLE_END", 0x471FFF, 3 },
+    { "NV3_PGRAPH_CLASS07_RECTANGLE_START", 0x470000, 3 },
+    { "NV3_PGRAPH_CLASS08_POINT_END", 0x481FFF, 3 },
+    { "NV3_PGRAPH_CLASS08_POINT_START", 0x480000, 3 },
+    { "NV3_PGRAPH_CLASS09_LINE_END", 0x491FFF, 3 },
+    { "NV3_PGRAPH_CLASS09_LINE_START", 0x490000, 3 },
+    { "NV3_PGRAPH_CLASS0A_LIN_END", 0x4A1FFF, 3 },
+    { "NV3_PGRAPH_CLASS0A_LIN_START", 0x4A0000, 3 },
+    { "NV3_PGRAPH_CLASS0B_TRIANGLE_END", 0x4B1FFF, 3 },
+    { "NV3_PGRAPH_CLASS0B_TRIANGLE_START", 0x4B0000, 3 },
+    { "NV3_PGRAPH_CLASS0C_GDITEXT_END", 0x4C1FFF, 3 },
+    { "NV3_PGRAPH_CLASS0C_GDITEXT_START", 0x4C0000, 3 },
+    { "NV3_PGRAPH_CLASS0D_MEM2MEM_XFER_END", 0x4D1FFF, 3 },
+    { "NV3_PGRAPH_CLASS0D_MEM2MEM_XFER_START", 0x4D0000, 3 },
+    { "NV3_PGRAPH_CLASS0E_IMAGE2MEM_XFER_SCALED_START", 0x4E0000, 3 },
+    { "NV3_PGRAPH_CLASS0F_IMAGE2MEM_XFER_SCALED_END", 0x4E1FFF, 3 },
+    { "NV3_PGRAPH_CLASS10_BLIT_END", 0x501FFF, 3 },
+    { "NV3_PGRAPH_CLASS10_BLIT_START", 0x500000, 3 },
+    { "NV3_PGRAPH_CLASS11_CPU2MEM_IMAGE_END", 0x511FFF, 3 },
+    { "NV3_PGRAPH_CLASS11_CPU2MEM_IMAGE_START", 0x510000, 3 },
+    { "NV3_PGRAPH_CLASS12_CPU2MEM_BITMAP_END", 0x521FFF, 3 },
+    { "NV3_PGRAPH_CLASS12_CPU2MEM_BITMAP_START", 0x520000, 3 },
+    { "NV3_PGRAPH_CLASS14_IMAGE2MEM_XFER_END", 0x541FFF, 3 },
+    { "NV3_PGRAPH_CLASS14_IMAGE2MEM_XFER_START", 0x540000, 3 },
+    { "NV3_PGRAPH_CLASS15_CPU2MEM_STRETCHED_END", 0x551FFF, 3 },
+    { "NV3_PGRAPH_CLASS15_CPU2MEM_STRETCHED_START", 0x550000, 3 },
+    { "NV3_PGRAPH_CLASS17_D3D5TRI_ZETA_END", 0x571FFF, 3 },
+    { "NV3_PGRAPH_CLASS17_D3D5TRI_ZETA_START", 0x570000, 3 },
+    { "NV3_PGRAPH_CLASS18_POINTZETA_END", 0x581FFF, 3 },
+    { "NV3_PGRAPH_CLASS18_POINTZETA_START", 0x580000, 3 },
+    { "NV3_PGRAPH_CLASS1C_MEM2IMAGE_END", 0x5C1FFF, 3 },
+    { "NV3_PGRAPH_CLASS1C_MEM2IMAGE_START", 0x5C0000, 3 },
+    { "NV3_PGRAPH_CLASSES_END", 0x5FFFFF, 3 },
+    { "NV3_PGRAPH_CLASSES_START", 0x410000, 3 },
+    { "NV3_PGRAPH_CLIP0_MAX", 0x400694, 3 },
+    { "NV3_PGRAPH_CLIP0_MIN", 0x400690, 3 },
+    { "NV3_PGRAPH_CLIP1_MAX", 0x40069C, 3 },
+    { "NV3_PGRAPH_CLIP1_MIN", 0x400698, 3 },
+    { "NV3_PGRAPH_CLIP_MISC", 0x4006A0, 3 },
+    { "NV3_PGRAPH_CONTEXT_CACHE_SIZE", 8, 3 },
+    { "NV3_PGRAPH_CONTEXT_CONTROL", 0x400190, 3 },
+    { "NV3_PGRAPH_CONTEXT_SWITCH", 0x400180, 3 },
+    { "NV3_PGRAPH_CONTEXT_SWITCH_ALPHA", 3, 3 },
+    { "NV3_PGRAPH_CONTEXT_SWITCH_CHROMA_KEY", 13, 3 },
+    { "NV3_PGRAPH_CONTEXT_SWITCH_COLOR_FORMAT", 2, 3 },
+    { "NV3_PGRAPH_CONTEXT_SWITCH_DAC_BYPASS", 9, 3 },
+    { "NV3_PGRAPH_CONTEXT_SWITCH_DST_BUFFER0_ENABLED", 20, 3 },
+    { "NV3_PGRAPH_CONTEXT_SWITCH_DST_BUFFER1_ENABLED", 21, 3 },
+    { "NV3_PGRAPH_CONTEXT_SWITCH_DST_BUFFER2_ENABLED", 22, 3 },
+    { "NV3_PGRAPH_CONTEXT_SWITCH_DST_BUFFER3_ENABLED", 23, 3 },
+    { "NV3_PGRAPH_CONTEXT_SWITCH_MONO_FORMAT", 8, 3 },
+    { "NV3_PGRAPH_CONTEXT_SWITCH_PATCH_CONFIG", 24, 3 },
+    { "NV3_PGRAPH_CONTEXT_SWITCH_PLANE_MASK", 14, 3 },
+    { "NV3_PGRAPH_CONTEXT_SWITCH_SRC_BUFFER", 16, 3 },
+    { "NV3_PGRAPH_CONTEXT_SWITCH_USER_CLIP", 15, 3 },
+    { "NV3_PGRAPH_CONTEXT_SWITCH_VOLATILE", 31, 3 },
+    { "NV3_PGRAPH_CONTEXT_SWITCH_Z_WRITE", 12, 3 },
+    { "NV3_PGRAPH_CONTEXT_USER", 0x400194, 3 },
+    { "NV3_PGRAPH_DEBUG_0", 0x400080, 3 },
+    { "NV3_PGRAPH_DEBUG_0_3D_PIPE_IN_RESET", 3, 3 },
+    { "NV3_PGRAPH_DEBUG_0_ALPHA_ABORT", 28, 3 },
+    { "NV3_PGRAPH_DEBUG_0_AP_PIPE_IN_RESET", 1, 3 },
+    { "NV3_PGRAPH_DEBUG_0_BULK_READS", 4, 3 },
+    { "NV3_PGRAPH_DEBUG_0_CACHE_IN_RESET", 2, 3 },
+    { "NV3_PGRAPH_DEBUG_0_DRAWDIR_AUT", 24, 3 },
+    { "NV3_PGRAPH_DEBUG_0_DRAWDIR_Y", 25, 3 },
+    { "NV3_PGRAPH_DEBUG_0_STATE_IN_RESET", 0, 3 },
+    { "NV3_PGRAPH_DEBUG_0_TILING", 16, 3 },
+    { "NV3_PGRAPH_DEBUG_0_WRITE_ONLY_ROPS_2D", 20, 3 },
+    { "NV3_PGRAPH_DEBUG_0_WRITE_ONLY_ROPS_3D", 21, 3 },
+    { "NV3_PGRAPH_DEBUG_1", 0x400084, 3 },
+    { "NV3_PGRAPH_DEBUG_1_CACHE_FLUSH", 24, 3 },
+    { "NV3_PGRAPH_DEBUG_1_CONTEXT", 20, 3 },
+    { "NV3_PGRAPH_DEBUG_1_DMA_ACTIVITY_CANCEL", 4, 3 },
+    { "NV3_PGRAPH_DEBUG_1_INSTANCE", 16, 3 },
+    { "NV3_PGRAPH_DEBUG_1_TRIANGLE_CLIP_OPS", 13, 3 },
+    { "NV3_PGRAPH_DEBUG_1_TRIANGLE_OPS", 12, 3 },
+    { "NV3_PGRAPH_DEBUG_1_TURBO3D_2X", 8, 3 },
+    { "NV3_PGRAPH_DEBUG_1_TURBO3D_4X", 9, 3 },
+    { "NV3_PGRAPH_DEBUG_1_VOLATILE_RESET_LAST", 0, 3 },
+    { "NV3_PGRAPH_DEBUG_1_ZCLAMP", 28, 3 },
+    { "NV3_PGRAPH_DEBUG_2", 0x400088, 3 },
+    { "NV3_PGRAPH_DEBUG_2_ANISOTROPIC_FILTERING_2D", 17, 3 },
+    { "NV3_PGRAPH_DEBUG_2_ANISOTROPIC_FILTERING_3D", 13, 3 },
+    { "NV3_PGRAPH_DEBUG_2_AVOID_READMODIFYWRITE_BLEND", 0, 3 },
+    { "NV3_PGRAPH_DEBUG_2_BILINEAR_FILTERING_2D", 16, 3 },
+    { "NV3_PGRAPH_DEBUG_2_BILINEAR_FILTERING_3D", 12, 3 },
+    { "NV3_PGRAPH_DEBUG_2_D3D_COALESCE", 20, 3 },
+    { "NV3_PGRAPH_DEBUG_2_D3D_COALESCE_POINT_ZETA", 22, 3 },
+    { "NV3_PGRAPH_DEBUG_2_DPWR_FIFO", 8, 3 },
+    { "NV3_PGRAPH_DEBUG_2_FOG", 14, 3 },
+    { "NV3_PGRAPH_DEBUG_2_LIGHTING", 15, 3 },
+    { "NV3_PGRAPH_DEBUG_2_PREFETCH", 24, 3 },
+    { "NV3_PGRAPH_DEBUG_2_VOLATILE_RESET", 28, 3 },
+    { "NV3_PGRAPH_DEBUG_3", 0x40008C, 3 },
+    { "NV3_PGRAPH_DEBUG_3_ALPHA_CHECK", 24, 3 },
+    { "NV3_PGRAPH_DEBUG_3_AUTOZFLUSH_D3D", 9, 3 },
+    { "NV3_PGRAPH_DEBUG_3_AUTOZFLUSH_POINT_ZETA", 8, 3 },
+    { "NV3_PGRAPH_DEBUG_3_CULLING", 0, 3 },
+    { "NV3_PGRAPH_DEBUG_3_DATA_CHECK", 20, 3 },
+    { "NV3_PGRAPH_DEBUG_3_DATA_CHECK_FAIL", 21, 3 },
+    { "NV3_PGRAPH_DEBUG_3_DITHER", 15, 3 },
+    { "NV3_PGRAPH_DEBUG_3_EARLY_ZABORT", 12, 3 },
+    { "NV3_PGRAPH_DEBUG_3_FAST_DATA_D3D", 4, 3 },
+    { "NV3_PGRAPH_DEBUG_3_FAST_DATA_STRETCH", 5, 3 },
+    { "NV3_PGRAPH_DEBUG_3_FORCE_COLOR_BUFFER_READ", 16, 3 },
+    { "NV3_PGRAPH_DEBUG_3_FORCE_ZETA_BUFFER_READ", 17, 3 },
+    { "NV3_PGRAPH_DEBUG_3_FORMAT_CHECK", 22, 3 },
+    { "NV3_PGRAPH_DEBUG_3_SLOT_CONFLICT_D3D", 11, 3 },
+    { "NV3_PGRAPH_DEBUG_3_SLOT_CONFLICT_POINT_ZETA", 10, 3 },
+    { "NV3_PGRAPH_DEBUG_3_TRIANGLE_END_FLUSH", 13, 3 },
+    { "NV3_PGRAPH_DEBUG_3_ZFIFO_NOOP", 14, 3 },
+    { "NV3_PGRAPH_DEBUG_3_ZFLUSH", 7, 3 },
+    { "NV3_PGRAPH_DMA", 0x400680, 3 },
+    { "NV3_PGRAPH_DMA_INTR_0", 0x401100, 3 },
+    { "NV3_PGRAPH_DMA_INTR_EN_0", 0x401140, 3 },
+    { "NV3_PGRAPH_DMA_INTR_INSTANCE", 0, 3 },
+    { "NV3_PGRAPH_DMA_INTR_LINEAR", 12, 3 },
+    { "NV3_PGRAPH_DMA_INTR_NOTIFY", 16, 3 },
+    { "NV3_PGRAPH_DMA_INTR_PRESENT", 4, 3 },
+    { "NV3_PGRAPH_DMA_INTR_PROTECTION", 8, 3 },
+    { "NV3_PGRAPH_DST_CANVAS_MAX", 0x40055C, 3 },
+    { "NV3_PGRAPH_DST_CANVAS_MIN", 0x400558, 3 },
+    { "NV3_PGRAPH_FIFO_ACCESS", 0x4006A4, 3 },
+    { "NV3_PGRAPH_FIFO_ACCESS_DISABLED", 0x0, 3 },
+    { "NV3_PGRAPH_FIFO_ACCESS_ENABLED", 0x1, 3 },
+    { "NV3_PGRAPH_INSTANCE", 0x400688, 3 },
+    { "NV3_PGRAPH_INTR_0", 0x400100, 3 },
+    { "NV3_PGRAPH_INTR_0_SOFTWARE_NOTIFY", 28, 3 },
+    { "NV3_PGRAPH_INTR_0_VBLANK", 8, 3 },
+    { "NV3_PGRAPH_INTR_0_VBLANK_ENABLED", 0x1, 3 },
+    { "NV3_PGRAPH_INTR_1", 0x400104, 3 },
+    { "NV3_PGRAPH_INTR_1_CTXSW_NOTIFY", 16, 3 },
+    { "NV3_PGRAPH_INTR_1_DOUBLE_NOTIFY", 12, 3 },
+    { "NV3_PGRAPH_INTR_1_INVALID_DATA", 4, 3 },
+    { "NV3_PGRAPH_INTR_1_SOFTWARE_METHOD_PENDING", 0, 3 },
+    { "NV3_PGRAPH_INTR_EN_0", 0x400140, 3 },
+    { "NV3_PGRAPH_INTR_EN_1", 0x400144, 3 },
+    { "NV3_PGRAPH_MAX_BUFFERS", 4, 3 },
+    { "NV3_PGRAPH_NOTIFY", 0x400684, 3 },
+    { "NV3_PGRAPH_NOTIFY_INSTANCE", 0, 3 },
+    { "NV3_PGRAPH_NOTIFY_REQUEST_PENDING", 16, 3 },
+    { "NV3_PGRAPH_NOTIFY_REQUEST_TYPE", 20, 3 },
+    { "NV3_PGRAPH_NOTIFY_REQUEST_TYPE_HARDWARE", 0x0, 3 },
+    { "NV3_PGRAPH_PATTERN_BITMAP_HIGH", 0x400610, 3 },
+    { "NV3_PGRAPH_PATTERN_BITMAP_LOW", 0x400614, 3 },
+    { "NV3_PGRAPH_PATTERN_COLOR_0_ALPHA", 0x400604, 3 },
+    { "NV3_PGRAPH_PATTERN_COLOR_0_RGB", 0x400600, 3 },
+    { "NV3_PGRAPH_PATTERN_COLOR_1_ALPHA", 0x40060C, 3 },
+    { "NV3_PGRAPH_PATTERN_COLOR_1_RGB", 0x400608, 3 },
+    { "NV3_PGRAPH_PATTERN_SHAPE", 0x400618, 3 },
+    { "NV3_PGRAPH_PLANE_MASK", 0x400628, 3 },
+    { "NV3_PGRAPH_REAL_END", 0x5C1FFF, 3 },
+    { "NV3_PGRAPH_REGISTER_END", 0x401FFF, 3 },
+    { "NV3_PGRAPH_ROP3", 0x400624, 3 },
+    { "NV3_PGRAPH_SRC_CANVAS_MAX", 0x400554, 3 },
+    { "NV3_PGRAPH_SRC_CANVAS_MIN", 0x400550, 3 },
+    { "NV3_PGRAPH_START", 0x400000, 3 },
+    { "NV3_PGRAPH_STATUS", 0x4006B0, 3 },
+    { "NV3_PGRAPH_TRAPPED_ADDRESS", 0x4006B4, 3 },
+    { "NV3_PGRAPH_TRAPPED_DATA", 0x4006B8, 3 },
+    { "NV3_PGRAPH_TRAPPED_INSTANCE", 0x4006BC, 3 },
+    { "NV3_PMC_BOOT", 0x0, 3 },
+    { "NV3_PMC_ENABLE", 0x200, 3 },
+    { "NV3_PMC_ENABLE_PAUDIO", 0, 3 },
+    { "NV3_PMC_ENABLE_PAUDIO_ENABLED", 0x1, 3 },
+    { "NV3_PMC_ENABLE_PCRTC", 24, 3 },
+    { "NV3_PMC_ENABLE_PCRTC_ENABLED", 0x1, 3 },
+    { "NV3_PMC_ENABLE_PFB", 20, 3 },
+    { "NV3_PMC_ENABLE_PFB_ENABLED", 0x1, 3 },
+    { "NV3_PMC_ENABLE_PFIFO", 8, 3 },
+    { "NV3_PMC_ENABLE_PFIFO_ENABLED", 0x1, 3 },
+    { "NV3_PMC_ENABLE_PGRAPH", 12, 3 },
+    { "NV3_PMC_ENABLE_PGRAPH_ENABLED", 0x1, 3 },
+    { "NV3_PMC_ENABLE_PMEDIA", 4, 3 },
+    { "NV3_PMC_ENABLE_PMEDIA_ENABLED", 0x1, 3 },
+    { "NV3_PMC_ENABLE_PPMI", 16, 3 },
+    { "NV3_PMC_ENABLE_PPMI_ENABLED", 0x1, 3 },
+    { "NV3_PMC_ENABLE_PVIDEO", 28, 3 },
+    { "NV3_PMC_ENABLE_PVIDEO_ENABLED", 0x1, 3 },
+    { "NV3_PMC_END", 0xFFF, 3 },
+    { "NV3_PMC_INTERRUPT_ENABLE", 0x140, 3 },
+    { "NV3_PMC_INTERRUPT_ENABLE_HARDWARE", 0x1, 3 },
+    { "NV3_PMC_INTERRUPT_ENABLE_SOFTWARE", 0x2, 3 },
+    { "NV3_PMC_INTERRUPT_PAUDIO", 0, 3 },
+    { "NV3_PMC_INTERRUPT_PAUDIO_PENDING", 0x1, 3 },
+    { "NV3_PMC_INTERRUPT_PBUS", 28, 3 },
+    { "NV3_PMC_INTERRUPT_PBUS_PENDING", 0x1, 3 },
+    { "NV3_PMC_INTERRUPT_PFB", 24, 3 },
+    { "NV3_PMC_INTERRUPT_PFB_PENDING", 0x1, 3 },
+    { "NV3_PMC_INTERRUPT_PFIFO", 8, 3 },
+    { "NV3_PMC_INTERRUPT_PFIFO_PENDING", 0x1, 3 },
+    { "NV3_PMC_INTERRUPT_PGRAPH0", 12, 3 },
+    { "NV3_PMC_INTERRUPT_PGRAPH0_PENDING", 0x1, 3 },
+    { "NV3_PMC_INTERRUPT_PGRAPH1", 13, 3 },
+    { "NV3_PMC_INTERRUPT_PGRAPH1_PENDING", 0x1, 3 },
+    { "NV3_PMC_INTERRUPT_PMEDIA", 4, 3 },
+    { "NV3_PMC_INTERRUPT_PMEDIA_PENDING", 0x1, 3 },
+    { "NV3_PMC_INTERRUPT_PTIMER", 20, 3 },
+    { "NV3_PMC_INTERRUPT_PTIMER_PENDING", 0x1, 3 },
+    { "NV3_PMC_INTERRUPT_PVIDEO", 16, 3 },
+    { "NV3_PMC_INTERRUPT_PVIDEO_PENDING", 0x1, 3 },
+    { "NV3_PMC_INTERRUPT_SOFTWARE", 31, 3 },
+    { "NV3_PMC_INTERRUPT_SOFTWARE_PENDING", 0x1, 3 },
+    { "NV3_PMC_INTERRUPT_STATUS", 0x100, 3 },
+    { "NV3_PMC_START", 0x0, 3 },
+    { "NV3_PME_DEBUG_0", 0x200080, 3 },
+    { "NV3_PME_DEBUG_1", 0x200084, 3 },
+    { "NV3_PME_END", 0x200FFF, 3 },
+    { "NV3_PME_INTR", 0x200100, 3 },
+    { "NV3_PME_INTR_EN", 0x200140, 3 },
+    { "NV3_PME_START", 0x200000, 3 },
+    { "NV3_PNVM_END", 0x17FFFFF, 3 },
+    { "NV3_PNVM_START", 0x1000000, 3 },
+    { "NV3_POWER_CAP_ID", 0x60, 3 },
+    { "NV3_POWER_NEXT_PTR", 0x61, 3 },
+    { "NV3_POWER_STATE", 0x64, 3 },
+    { "NV3_POWER_STATE_D0", 0x0, 3 },
+    { "NV3_POWER_STATE_D3HOT", 0x3, 3 },
+    { "NV3_POWER_VERSION", 0x62, 3 },
+    { "NV3_PRAMDAC_CLOCK_MEMORY", 0x680504, 3 },
+    { "NV3_PRAMDAC_CLOCK_MEMORY_MDIV", 0, 3 },
+    { "NV3_PRAMDAC_CLOCK_MEMORY_NDIV", 8, 3 },
+    { "NV3_PRAMDAC_CLOCK_MEMORY_PDIV", 16, 3 },
+    { "NV3_PRAMDAC_CLOCK_PIXEL", 0x680508, 3 },
+    { "NV3_PRAMDAC_COEFF_SELECT", 0x68050C, 3 },
+    { "NV3_PRAMDAC_COEFF_SELECT_MPLL_BYPASS", 12, 3 },
+    { "NV3_PRAMDAC_COEFF_SELECT_MPLL_SOURCE", 8, 3 },
+    { "NV3_PRAMDAC_COEFF_SELECT_MPLL_SOURCE_DEFAULT", 0x0, 3 },
+    { "NV3_PRAMDAC_COEFF_SELECT_MPLL_SOURCE_SOFTWARE", 0x1, 3 },
+    { "NV3_PRAMDAC_COEFF_SELECT_PCLK_SOURCE", 24, 3 },
+    { "NV3_PRAMDAC_COEFF_SELECT_VCLK_RATIO", 28, 3 },
+    { "NV3_PRAMDAC_COEFF_SELECT_VCLK_RATIO_1", 0x0, 3 },
+    { "NV3_PRAMDAC_COEFF_SELECT_VCLK_RATIO_2", 0x1, 3 },
+    { "NV3_PRAMDAC_COEFF_SELECT_VPLL_BYPASS", 20, 3 },
+    { "NV3_PRAMDAC_COEFF_SELECT_VPLL_SOURCE", 16, 3 },
+    { "NV3_PRAMDAC_COEFF_SELECT_VPLL_SOURCE_DEFAULT", 0x0, 3 },
+    { "NV3_PRAMDAC_COEFF_SELECT_VPLL_SOURCE_SOFTWARE", 0x1, 3 },
+    { "NV3_PRAMDAC_CURSOR_SIZE_X", 32, 3 },
+    { "NV3_PRAMDAC_CURSOR_SIZE_Y", 32, 3 },
+    { "NV3_PRAMDAC_CURSOR_START_POSITION", 0x680300, 3 },
+    { "NV3_PRAMDAC_END", 0x680FFF, 3 },
+    { "NV3_PRAMDAC_GENERAL_CONTROL", 0x680600, 3 },
+    { "NV3_PRAMDAC_GENERAL_CONTROL_565_MODE", 12, 3 },
+    { "NV3_PRAMDAC_HBLANK_END", 0x680730, 3 },
+    { "NV3_PRAMDAC_HBLANK_START", 0x68072C, 3 },
+    { "NV3_PRAMDAC_HBURST_END", 0x680728, 3 },
+    { "NV3_PRAMDAC_HBURST_START", 0x680724, 3 },
+    { "NV3_PRAMDAC_HEQU_WIDTH", 0x680738, 3 },
+    { "NV3_PRAMDAC_HSERR_WIDTH", 0x68073C, 3 },
+    { "NV3_PRAMDAC_HSYNC_WIDTH", 0x680720, 3 },
+    { "NV3_PRAMDAC_HTOTAL", 0x680734, 3 },
+    { "NV3_PRAMDAC_START", 0x680300, 3 },
+    { "NV3_PRAMDAC_VBBLANK_END", 0x680708, 3 },
+    { "NV3_PRAMDAC_VBBLANK_START", 0x680714, 3 },
+    { "NV3_PRAMDAC_VBLANK_END", 0x68070C, 3 },
+    { "NV3_PRAMDAC_VBLANK_START", 0x680710, 3 },
+    { "NV3_PRAMDAC_VEQU_END", 0x680704, 3 },
+    { "NV3_PRAMDAC_VEQU_START", 0x680718, 3 },
+    { "NV3_PRAMDAC_VSERR_WIDTH", 0x680700, 3 },
+    { "NV3_PRAMDAC_VTOTAL", 0x68071C, 3 },
+    { "NV3_PRAM_END", 0x6FFF, 3 },
+    { "NV3_PRAM_START", 0x6000, 3 },
+    { "NV3_PRMCIO_CRTC_REGISTER_COLOR", 0x6013D5, 3 },
+    { "NV3_PRMCIO_CRTC_REGISTER_INDEX_COLOR", 0x6013D4, 3 },
+    { "NV3_PRMCIO_CRTC_REGISTER_INDEX_MONO", 0x6013B4, 3 },
+    { "NV3_PRMCIO_CRTC_REGISTER_MONO", 0x6013B5, 3 },
+    { "NV3_PRMCIO_END", 0x601FFF, 3 },
+    { "NV3_PRMCIO_START", 0x601000, 3 },
+    { "NV3_PRMIO_END", 0x7FFF, 3 },
+    { "NV3_PRMIO_START", 0x7000, 3 },
+    { "NV3_PRMVIO_AR_INDEX_END", 0x14, 3 },
+    { "NV3_PRMVIO_END", 0xC0400, 3 },
+    { "NV3_PRMVIO_GR", 0xC03CF, 3 },
+    { "NV3_PRMVIO_GR_INDEX", 0xC03CE, 3 },
+    { "NV3_PRMVIO_GR_INDEX_END", 0x8, 3 },
+    { "NV3_PRMVIO_SR", 0xC03C5, 3 },
+    { "NV3_PRMVIO_SR_INDEX", 0xC03C4, 3 },
+    { "NV3_PRMVIO_SR_INDEX_CHAR_MAP", 3, 3 },
+    { "NV3_PRMVIO_SR_INDEX_CLOCK", 1, 3 },
+    { "NV3_PRMVIO_SR_INDEX_END", 5, 3 },
+    { "NV3_PRMVIO_SR_INDEX_LOCK", 5, 3 },
+    { "NV3_PRMVIO_SR_INDEX_LOCK_LOCKED", 0x57, 3 },
+    { "NV3_PRMVIO_SR_INDEX_LOCK_UNLOCKED", 0x99, 3 },
+    { "NV3_PRMVIO_SR_INDEX_MEM_MODE", 4, 3 },
+    { "NV3_PRMVIO_SR_INDEX_PLANE_MASK", 2, 3 },
+    { "NV3_PRMVIO_SR_INDEX_RESET", 0, 3 },
+    { "NV3_PRM_END", 0x4FFF, 3 },
+    { "NV3_PRM_INTR", 0x4100, 3 },
+    { "NV3_PRM_INTR_EN", 0x4140, 3 },
+    { "NV3_PRM_START", 0x4000, 3 },
+    { "NV3_PROM_END", 0x11FFFF, 3 },
+    { "NV3_PROM_START", 0x110000, 3 },
+    { "NV3_PSTRAPS", 0x101000, 3 },
+    { "NV3_PSTRAPS_AGP2X", 9, 3 },
+    { "NV3_PSTRAPS_AGP2X_DISABLED", 0x1, 3 },
+    { "NV3_PSTRAPS_AGP2X_ENABLED", 0x0, 3 },
+    { "NV3_PSTRAPS_BIOS", 1, 3 },
+    { "NV3_PSTRAPS_BIOS_NOT_PRESENT", 0x0, 3 },
+    { "NV3_PSTRAPS_BIOS_PRESENT", 1, 3 },
+    { "NV3_PSTRAPS_BUS_SPEED", 0, 3 },
+    { "NV3_PSTRAPS_BUS_SPEED_33MHZ", 0x0, 3 },
+    { "NV3_PSTRAPS_BUS_SPEED_66MHZ", 0x1, 3 },
+    { "NV3_PSTRAPS_BUS_TYPE", 5, 3 },
+    { "NV3_PSTRAPS_BUS_TYPE_AGP", 0x1, 3 },
+    { "NV3_PSTRAPS_BUS_TYPE_PCI", 0x0, 3 },
+    { "NV3_PSTRAPS_BUS_WIDTH", 4, 3 },
+    { "NV3_PSTRAPS_BUS_WIDTH_128BIT", 0x0, 3 },
+    { "NV3_PSTRAPS_BUS_WIDTH_64BIT", 0x0, 3 },
+    { "NV3_PSTRAPS_CRYSTAL", 6, 3 },
+    { "NV3_PSTRAPS_CRYSTAL_13500K", 0x0, 3 },
+    { "NV3_PSTRAPS_CRYSTAL_14318180", 0x1, 3 },
+    { "NV3_PSTRAPS_NEC_MODE", 3, 3 },
+    { "NV3_PSTRAPS_NEC_MODE_DISABLED", 0x0, 3 },
+    { "NV3_PSTRAPS_NEC_MODE_ENABLED", 0x1, 3 },
+    { "NV3_PSTRAPS_OVERWRITE", 11, 3 },
+    { "NV3_PSTRAPS_OVERWRITE_DISABLED", 0x0, 3 },
+    { "NV3_PSTRAPS_OVERWRITE_ENABLED", 0x1, 3 },
+    { "NV3_PSTRAPS_RAM_TYPE", 2, 3 },
+    { "NV3_PSTRAPS_RAM_TYPE_16MBIT", 0x0, 3 },
+    { "NV3_PSTRAPS_RAM_TYPE_8MBIT", 0x1, 3 },
+    { "NV3_PSTRAPS_TVMODE", 7, 3 },
+    { "NV3_PSTRAPS_TVMODE_NONE", 0x3, 3 },
+    { "NV3_PSTRAPS_TVMODE_NTSC", 0x1, 3 },
+    { "NV3_PSTRAPS_TVMODE_PAL", 0x2, 3 },
+    { "NV3_PSTRAPS_TVMODE_SECAM", 0x0, 3 },
+    { "NV3_PSTRAPS_UNUSED", 10, 3 },
+    { "NV3_PTIMER_ALARM_NSEC", 0x9420, 3 },
+    { "NV3_PTIMER_DENOMINATOR", 0x9210, 3 },
+    { "NV3_PTIMER_END", 0x9FFF, 3 },
+    { "NV3_PTIMER_INTR", 0x9100, 3 },
+    { "NV3_PTIMER_INTR_ALARM", 0, 3 },
+    { "NV3_PTIMER_INTR_EN", 0x9140, 3 },
+    { "NV3_PTIMER_NUMERATOR", 0x9200, 3 },
+    { "NV3_PTIMER_START", 0x9000, 3 },
+    { "NV3_PTIMER_TIME_0_NSEC", 0x9400, 3 },
+    { "NV3_PTIMER_TIME_1_NSEC", 0x9410, 3 },
+    { "NV3_PVIDEO_END", 0x6802FF, 3 },
+    { "NV3_PVIDEO_FIFO_BURST_LENGTH", 0x68023C, 3 },
+    { "NV3_PVIDEO_FIFO_THRESHOLD", 0x680238, 3 },
+    { "NV3_PVIDEO_INTR", 0x680100, 3 },
+    { "NV3_PVIDEO_INTR_EN", 0x680140, 3 },
+    { "NV3_PVIDEO_OVERLAY", 0x680244, 3 },
+    { "NV3_PVIDEO_OVERLAY_FORMAT", 8, 3 },
+    { "NV3_PVIDEO_OVERLAY_KEY_ENABLED", 4, 3 },
+    { "NV3_PVIDEO_OVERLAY_VIDEO_IS_ON", 0, 3 },
+    { "NV3_PVIDEO_START", 0x680000, 3 },
+    { "NV3_RAMIN_END", 0xFFFFFF, 3 },
+    { "NV3_RAMIN_RAMAU_END", 0x1BFF, 3 },
+    { "NV3_RAMIN_RAMAU_START", 0x1000, 3 },
+    { "NV3_RAMIN_RAMFC_END", 0x1DFF, 3 },
+    { "NV3_RAMIN_RAMFC_SIZE_0", 0x1FF, 3 },
+    { "NV3_RAMIN_RAMFC_SIZE_1", 0xFFF, 3 },
+    { "NV3_RAMIN_RAMFC_START", 0x1C00, 3 },
+    { "NV3_RAMIN_RAMHT_END", 0xFF, 3 },
+    { "NV3_RAMIN_RAMHT_SIZE_0", 0xFFF, 3 },
+    { "NV3_RAMIN_RAMHT_SIZE_1", 0x1FFF, 3 },
+    { "NV3_RAMIN_RAMHT_SIZE_2", 0x3FFF, 3 },
+    { "NV3_RAMIN_RAMHT_SIZE_3", 0x7FFF, 3 },
+    { "NV3_RAMIN_RAMHT_START", 0x0, 3 },
+    { "NV3_RAMIN_RAMRM_END", 0x2FFF, 3 },
+    { "NV3_RAMIN_RAMRM_START", 0x2000, 3 },
+    { "NV3_RAMIN_RAMRO_END", 0x1FFF, 3 },
+    { "NV3_RAMIN_RAMRO_SIZE_0", 0x1FF, 3 },
+    { "NV3_RAMIN_RAMRO_SIZE_1", 0x1FFF, 3 },
+    { "NV3_RAMIN_RAMRO_START", 0x1E00, 3 },
+    { "NV3_RAMIN_SIZE", 0x400000, 3 },
+    { "NV3_RAMIN_START", 0xC00000, 3 },
+    { "NV3_RMA_REGISTER_END", 0x3D3, 3 },
+    { "NV3_RMA_REGISTER_START", 0x3D0, 3 },
+    { "NV3_RMA_SIGNATURE_BYTE1", 0x16, 3 },
+    { "NV3_RMA_SIGNATURE_BYTE2", 0xD0, 3 },
+    { "NV3_RMA_SIGNATURE_LSB", 0x2B, 3 },
+    { "NV3_RMA_SIGNATURE_MSB", 0x65, 3 },
+    { "NV3_USER_DAC_END", 0x681FFF, 3 },
+    { "NV3_USER_DAC_PALETTE_DATA", 0x6813C9, 3 },
+    { "NV3_USER_DAC_PALETTE_END", 0x6813C9, 3 },
+    { "NV3_USER_DAC_PALETTE_SIZE", 768, 3 },
+    { "NV3_USER_DAC_PALETTE_START", 0x6813C6, 3 },
+    { "NV3_USER_DAC_PIXEL_MASK", 0x6813C6, 3 },
+    { "NV3_USER_DAC_READ_MODE_ADDRESS", 0x6813C7, 3 },
+    { "NV3_USER_DAC_START", 0x681200, 3 },
+    { "NV3_USER_DAC_WRITE_MODE_ADDRESS", 0x6813C8, 3 },
+    { "NV3_USER_END", 0xFFFFFF, 3 },
+    { "NV3_USER_START", 0x800000, 3 },
+    { "NV3_VGA_END", 0xC7FFF, 3 },
+    { "NV3_VGA_GR", 0x3CF, 3 },
+    { "NV3_VGA_GR_INDEX", 0x3CE, 3 },
+    { "NV3_VGA_SR", 0x3C5, 3 },
+    { "NV3_VGA_SR_INDEX", 0x3C4, 3 },
+    { "NV3_VGA_VRAM_END", 0xBFFFF, 3 },
+    { "NV3_VGA_VRAM_START", 0xA0000, 3 },
+    { "NV3_VRAM_SIZE_1MB", 0x100000, 3 },
+    { "NV3_VRAM_SIZE_2MB", 0x200000, 3 },
+    { "NV3_VRAM_SIZE_4MB", 0x400000, 3 },
+    { "NV3_VRAM_SIZE_8MB", 0x800000, 3 },
+    { "NV4_CIO_ARX", 0x3c0, 4 },
+    { "NV4_CIO_AR_CSEL_INDEX", 0x14, 4 },
+    { "NV4_CIO_AR_CSEL_READ", 0x3c1, 4 },
+    { "NV4_CIO_AR_CSEL_WRITE", 0x3c0, 4 },
+    { "NV4_CIO_AR_HPP_INDEX", 0x13, 4 },
+    { "NV4_CIO_AR_HPP_READ", 0x3c1, 4 },
+    { "NV4_CIO_AR_HPP_WRITE", 0x3c0, 4 },
+    { "NV4_CIO_AR_MODE_INDEX", 0x10, 4 },
+    { "NV4_CIO_AR_MODE_READ", 0x3c1, 4 },
+    { "NV4_CIO_AR_MODE_WRITE", 0x3c0, 4 },
+    { "NV4_CIO_AR_OSCAN_INDEX", 0x11, 4 },
+    { "NV4_CIO_AR_OSCAN_READ", 0x3c1, 4 },
+    { "NV4_CIO_AR_OSCAN_WRITE", 0x3c0, 4 },
+    { "NV4_CIO_AR_PALETTE_READ", 0x3c1, 4 },
+    { "NV4_CIO_AR_PALETTE_WRITE", 0x3c0, 4 },
+    { "NV4_CIO_AR_PLANE_INDEX", 0x12, 4 },
+    { "NV4_CIO_AR_PLANE_READ", 0x3c1, 4 },
+    { "NV4_CIO_AR_PLANE_WRITE", 0x3c0, 4 },
+    { "NV4_CIO_CRE_CHIP_ID_INDEX", 0x27, 4 },
+    { "NV4_CIO_CRE_COLOR", 0x3d5, 4 },
+    { "NV4_CIO_CRE_DDC_STATUS_INDEX", 0x3E, 4 },
+    { "NV4_CIO_CRE_DDC_WR_INDEX", 0x3F, 4 },
+    { "NV4_CIO_CRE_ENH_INDEX", 0x1C, 4 },
+    { "NV4_CIO_CRE_FABID_INDEX", 0x25, 4 },
+    { "NV4_CIO_CRE_FFLWM_INDEX", 0x20, 4 },
+    { "NV4_CIO_CRE_FFLWM_LWM", 0, 4 },
+    { "NV4_CIO_CRE_FF_BURST", 0, 4 },
+    { "NV4_CIO_CRE_FF_BURST_128", 0x3, 4 },
+    { "NV4_CIO_CRE_FF_BURST_256", 0x4, 4 },
+    { "NV4_CIO_CRE_FF_BURST_32", 0x1, 4 },
+    { "NV4_CIO_CRE_FF_BURST_64", 0x2, 4 },
+    { "NV4_CIO_CRE_FF_BURST_8", 0x0, 4 },
+    { "NV4_CIO_CRE_FF_INDEX", 0x1B, 4 },
+    { "NV4_CIO_CRE_HCUR_ADDR0_ADR", 0, 4 },
+    { "NV4_CIO_CRE_HCUR_ADDR0_INDEX", 0x30, 4 },
+    { "NV4_CIO_CRE_HCUR_ADDR1_ADR", 2, 4 },
+    { "NV4_CIO_CRE_HCUR_ADDR1_CUR_DBL", 1, 4 },
+    { "NV4_CIO_CRE_HCUR_ADDR1_ENABLE", 0, 4 },
+    { "NV4_CIO_CRE_HCUR_ADDR1_INDEX", 0x31, 4 },
+    { "NV4_CIO_CRE_HCUR_ADDR2_INDEX", 0x2f, 4 },
+    { "NV4_CIO_CRE_HCUR_ASI", 7, 4 },
+    { "NV4_CIO_CRE_HCUR_ASI_FRAMEBUFFER", 0x1, 4 },
+    { "NV4_CIO_CRE_HCUR_ASI_INSTMEM", 0x0, 4 },
+    { "NV4_CIO_CRE_HEB_HBS_8", 2, 4 },
+    { "NV4_CIO_CRE_HEB_HDE_8", 1, 4 },
+    { "NV4_CIO_CRE_HEB_HDT_8", 0, 4 },
+    { "NV4_CIO_CRE_HEB_HRS_8", 3, 4 },
+    { "NV4_CIO_CRE_HEB_ILC_8", 4, 4 },
+    { "NV4_CIO_CRE_HEB_INDEX", 0x2D, 4 },
+    { "NV4_CIO_CRE_HEB_SA_23", 5, 4 },
+    { "NV4_CIO_CRE_ILACE_INDEX", 0x39, 4 },
+    { "NV4_CIO_CRE_LSR_HBE_6", 4, 4 },
+    { "NV4_CIO_CRE_LSR_INDEX", 0x25, 4 },
+    { "NV4_CIO_CRE_LSR_VBS_10", 3, 4 },
+    { "NV4_CIO_CRE_LSR_VDE_10", 1, 4 },
+    { "NV4_CIO_CRE_LSR_VDT_10", 0, 4 },
+    { "NV4_CIO_CRE_LSR_VRS_10", 2, 4 },
+    { "NV4_CIO_CRE_MONO", 0x3b5, 4 },
+    { "NV4_CIO_CRE_OSCOL_INDEX", 0x2A, 4 },
+    { "NV4_CIO_CRE_PAGE0_INDEX", 0x1D, 4 },
+    { "NV4_CIO_CRE_PAGE1_INDEX", 0x1E, 4 },
+    { "NV4_CIO_CRE_PAGE_OVFL_INDEX", 0x29, 4 },
+    { "NV4_CIO_CRE_PCI_TO_DELAY", 0, 4 },
+    { "NV4_CIO_CRE_PCI_TO_INDEX", 0x40, 4 },
+    { "NV4_CIO_CRE_PIXEL_FORMAT", 0, 4 },
+    { "NV4_CIO_CRE_PIXEL_FORMAT_16BPP", 0x2, 4 },
+    { "NV4_CIO_CRE_PIXEL_FORMAT_32BPP", 0x3, 4 },
+    { "NV4_CIO_CRE_PIXEL_FORMAT_8BPP", 0x1, 4 },
+    { "NV4_CIO_CRE_PIXEL_FORMAT_VGA", 0x0, 4 },
+    { "NV4_CIO_CRE_PIXEL_INDEX", 0x28, 4 },
+    { "NV4_CIO_CRE_PIXEL_TV_ADJ", 3, 4 },
+    { "NV4_CIO_CRE_RL0_INDEX", 0x34, 4 },
+    { "NV4_CIO_CRE_RL1_INDEX", 0x35, 4 },
+    { "NV4_CIO_CRE_RMA_INDEX", 0x38, 4 },
+    { "NV4_CIO_CRE_RPC0_INDEX", 0x19, 4 },
+    { "NV4_CIO_CRE_RPC0_OFFSET_10_8", 5, 4 },
+    { "NV4_CIO_CRE_RPC0_START", 0, 4 },
+    { "NV4_CIO_CRE_RPC1_INDEX", 0x1A, 4 },
+    { "NV4_CIO_CRE_RPC1_LARGE", 2, 4 },
+    { "NV4_CIO_CRE_SCRATCH0_INDEX", 0x2B, 4 },
+    { "NV4_CIO_CRE_SCRATCH1_INDEX", 0x2C, 4 },
+    { "NV4_CIO_CRE_SCRATCH2_INDEX", 0x3A, 4 },
+    { "NV4_CIO_CRE_SCRATCH3_INDEX", 0x3B, 4 },
+    { "NV4_CIO_CRE_SCRATCH4_INDEX", 0x3C, 4 },
+    { "NV4_CIO_CRE_TREG_HCNT", 6, 4 },
+    { "NV4_CIO_CRE_TREG_HCNT_INDEX", 0x0, 4 },
+    { "NV4_CIO_CRE_TREG_INDEX", 0x3D, 4 },
+    { "NV4_CIO_CRE_TREG_SHADOW", 0, 4 },
+    { "NV4_CIO_CRE_TREG_VCNT", 4, 4 },
+    { "NV4_CIO_CRE_TREG_VCNTA_INDEX", 0x6, 4 },
+    { "NV4_CIO_CRE_TREG_VCNTB_INDEX", 0x7, 4 },
+    { "NV4_CIO_CRE_VID_END0_INDEX", 0x32, 4 },
+    { "NV4_CIO_CRE_VID_END1_INDEX", 0x33, 4 },
+    { "NV4_CIO_CRE_VID_END_10_8", 0, 4 },
+    { "NV4_CIO_CRE_VID_END_7_0", 0, 4 },
+    { "NV4_CIO_CRE_VID_END_ENABLE", 4, 4 },
+    { "NV4_CIO_CRX_COLOR", 0x3d4, 4 },
+    { "NV4_CIO_CRX_MONO", 0x3b4, 4 },
+    { "NV4_CIO_CR_ARFF_INDEX", 0x24, 4 },
+    { "NV4_CIO_CR_ARX_INDEX", 0x26, 4 },
+    { "NV4_CIO_CR_CELL_HT_INDEX", 0x9, 4 },
+    { "NV4_CIO_CR_CELL_HT_SCANDBL", 7, 4 },
+    { "NV4_CIO_CR_CELL_HT_VBS_9", 5, 4 },
+    { "NV4_CIO_CR_COLOR", 0x3d5, 4 },
+    { "NV4_CIO_CR_CURS_END_INDEX", 0xB, 4 },
+    { "NV4_CIO_CR_CURS_ST_INDEX", 0xA, 4 },
+    { "NV4_CIO_CR_GDATA_INDEX", 0x22, 4 },
+    { "NV4_CIO_CR_HBE_4_0", 0, 4 },
+    { "NV4_CIO_CR_HBE_INDEX", 0x3, 4 },
+    { "NV4_CIO_CR_HBS_INDEX", 0x2, 4 },
+    { "NV4_CIO_CR_HDE_INDEX", 0x1, 4 },
+    { "NV4_CIO_CR_HDT_INDEX", 0x0, 4 },
+    { "NV4_CIO_CR_HRE_4_0", 0, 4 },
+    { "NV4_CIO_CR_HRE_HBE_5", 7, 4 },
+    { "NV4_CIO_CR_HRE_INDEX", 0x5, 4 },
+    { "NV4_CIO_CR_HRS_INDEX", 0x4, 4 },
+    { "NV4_CIO_CR_LCOMP_INDEX", 0x18, 4 },
+    { "NV4_CIO_CR_MODE_INDEX", 0x17, 4 },
+    { "NV4_CIO_CR_MONO", 0x3b5, 4 },
+    { "NV4_CIO_CR_OFFSET_INDEX", 0x13, 4 },
+    { "NV4_CIO_CR_OVL_INDEX", 0x7, 4 },
+    { "NV4_CIO_CR_OVL_VBS_8", 3, 4 },
+    { "NV4_CIO_CR_OVL_VDE_8", 1, 4 },
+    { "NV4_CIO_CR_OVL_VDE_9", 6, 4 },
+    { "NV4_CIO_CR_OVL_VDT_8", 0, 4 },
+    { "NV4_CIO_CR_OVL_VDT_9", 5, 4 },
+    { "NV4_CIO_CR_OVL_VRS_8", 2, 4 },
+    { "NV4_CIO_CR_OVL_VRS_9", 7, 4 },
+    { "NV4_CIO_CR_RSAL_INDEX", 0x8, 4 },
+    { "NV4_CIO_CR_RSAL_PANNING", 5, 4 },
+    { "NV4_CIO_CR_SA_HI_INDEX", 0xC, 4 },
+    { "NV4_CIO_CR_SA_LO_INDEX", 0xD, 4 },
+    { "NV4_CIO_CR_TCOFF_HI_INDEX", 0xE, 4 },
+    { "NV4_CIO_CR_TCOFF_LO_INDEX", 0xF, 4 },
+    { "NV4_CIO_CR_ULINE_INDEX", 0x14, 4 },
+    { "NV4_CIO_CR_VBE_INDEX", 0x16, 4 },
+    { "NV4_CIO_CR_VBS_INDEX", 0x15, 4 },
+    { "NV4_CIO_CR_VDE_INDEX", 0x12, 4 },
+    { "NV4_CIO_CR_VDT_INDEX", 0x6, 4 },
+    { "NV4_CIO_CR_VRE_3_0", 0, 4 },
+    { "NV4_CIO_CR_VRE_INDEX", 0x11, 4 },
+    { "NV4_CIO_CR_VRS_INDEX", 0x10, 4 },
+    { "NV4_CIO_END", 0x3DF, 4 },
+    { "NV4_CIO_INP0", 0x3c2, 4 },
+    { "NV4_CIO_INP0_COLOR", 0x3da, 4 },
+    { "NV4_CIO_INP0_MONO", 0x3ba, 4 },
+    { "NV4_CIO_INP0_READ_MONO", 0x3ca, 4 },
+    { "NV4_CIO_INP0_WRITE_COLOR", 0x3da, 4 },
+    { "NV4_CIO_INP0_WRITE_MONO", 0x3ba, 4 },
+    { "NV4_CIO_SR_LOCK_INDEX", 0x1F, 4 },
+    { "NV4_CIO_SR_LOCK_VALUE", 0x99, 4 },
+    { "NV4_CIO_SR_UNLOCK_RO_VALUE", 0x75, 4 },
+    { "NV4_CIO_SR_UNLOCK_RW_VALUE", 0x57, 4 },
+    { "NV4_CIO_START", 0x3B0, 4 },
+    { "NV4_DMA_ACCESS_READ_AND_WRITE", 0x1, 4 },
+    { "NV4_DMA_ACCESS_READ_ONLY", 0x0, 4 },
+    { "NV4_DMA_PAGE_ENTRY_LINEAR", 0x1, 4 },
+    { "NV4_DMA_PAGE_ENTRY_NOT_LINEAR", 0x0, 4 },
+    { "NV4_DMA_PAGE_TABLE_NOT_PRESENT", 0x0, 4 },
+    { "NV4_DMA_PAGE_TABLE_PRESENT", 0x1, 4 },
+    { "NV4_DMA_TARGET_NODE_AGP", 0x3, 4 },
+    { "NV4_DMA_TARGET_NODE_NVM", 0x0, 4 },
+    { "NV4_DMA_TARGET_NODE_PCI", 0x2, 4 },
+    { "NV4_FIFO_DMA_JUMP_OFFSET", 2, 4 },
+    { "NV4_FIFO_DMA_OPCODE_JUMP", 0x1, 4 },
+    { "NV4_FIFO_DMA_OPCODE_METHOD", 0x0, 4 },
+    { "NV4_IO_MPU_401_COM", 0x331, 4 },
+    { "NV4_IO_MPU_401_COM_ALIAS_1", 0x301, 4 },
+    { "NV4_IO_MPU_401_COM_ALIAS_2", 0x231, 4 },
+    { "NV4_IO_MPU_401_COM_UART_MODE", 0, 4 },
+    { "NV4_IO_MPU_401_COM_UART_MODE_COMPLEX", 0xff, 4 },
+    { "NV4_IO_MPU_401_COM_UART_MODE_SIMPLE", 0x3f, 4 },
+    { "NV4_IO_MPU_401_DATA", 0x330, 4 },
+    { "NV4_IO_MPU_401_DATA_ACK", 0xFE, 4 },
+    { "NV4_IO_MPU_401_DATA_ALIAS_1", 0x300, 4 },
+    { "NV4_IO_MPU_401_DATA_ALIAS_2", 0x230, 4 },
+    { "NV4_IO_MPU_401_DATA_VALUE", 0, 4 },
+    { "NV4_IO_MPU_401_STATUS", 0x331, 4 },
+    { "NV4_IO_MPU_401_STATUS_ALIAS_1", 0x301, 4 },
+    { "NV4_IO_MPU_401_STATUS_ALIAS_2", 0x231, 4 },
+    { "NV4_IO_MPU_401_STATUS_DATA", 0, 4 },
+    { "NV4_IO_MPU_401_STATUS_READ", 7, 4 },
+    { "NV4_IO_MPU_401_STATUS_READ_EMPTY", 0x1, 4 },
+    { "NV4_IO_MPU_401_STATUS_READ_FULL", 0x0, 4 },
+    { "NV4_IO_MPU_401_STATUS_WRITE", 6, 4 },
+    { "NV4_IO_MPU_401_STATUS_WRITE_EMPTY", 0x0, 4 },
+    { "NV4_IO_MPU_401_STATUS_WRITE_FULL", 0x1, 4 },
+    { "NV4_MMIO_SIZE", 0x1000000, 4 },
+    { "NV4_PBUS_AGP", 0x44, 4 },
+    { "NV4_PBUS_AGP_CAPABILITIES", 0x1844, 4 },
+    { "NV4_PBUS_AGP_CAPABILITY_AGP", 0x2, 4 },
+    { "NV4_PBUS_AGP_COMMAND", 0x184C, 4 },
+    { "NV4_PBUS_AGP_COMMAND_2", 0x184D, 4 },
+    { "NV4_PBUS_AGP_COMMAND_2_AGP_ENABLED", 0, 4 },
+    { "NV4_PBUS_AGP_COMMAND_2_SBA_ENABLED", 1, 4 },
+    { "NV4_PBUS_AGP_COMMAND_DATA_RATE", 0, 4 },
+    { "NV4_PBUS_AGP_COMMAND_DATA_RATE_1X", 0x1, 4 },
+    { "NV4_PBUS_AGP_COMMAND_DATA_RATE_2X", 0x2, 4 },
+    { "NV4_PBUS_AGP_COMMAND_DATA_RATE_OFF", 0x0, 4 },
+    { "NV4_PBUS_AGP_COMMAND_RQ_DEPTH", 0x184F, 4 },
+    { "NV4_PBUS_AGP_NEXT_PTR", 0x1845, 4 },
+    { "NV4_PBUS_AGP_REV", 0x1846, 4 },
+    { "NV4_PBUS_AGP_REV_MAJOR", 4, 4 },
+    { "NV4_PBUS_AGP_REV_MAJOR_1", 0x1, 4 },
+    { "NV4_PBUS_AGP_REV_MINOR", 0, 4 },
+    { "NV4_PBUS_AGP_REV_MINOR_0", 0x0, 4 },
+    { "NV4_PBUS_AGP_STATUS_RATE", 0x1848, 4 },
+    { "NV4_PBUS_AGP_STATUS_RATE_1X", 0x1, 4 },
+    { "NV4_PBUS_AGP_STATUS_RATE_1X_AND_2X", 0x3, 4 },
+    { "NV4_PBUS_AGP_STATUS_RATE_2X", 0x2, 4 },
+    { "NV4_PBUS_AGP_STATUS_RQ", 0x184B, 4 },
+    { "NV4_PBUS_AGP_STATUS_RQ_16", 0xF, 4 },
+    { "NV4_PBUS_AGP_STATUS_SBA", 0x1849, 4 },
+    { "NV4_PBUS_AGP_STATUS_SBA_STATUS", 1, 4 },
+    { "NV4_PBUS_AGP_STATUS_SBA_STATUS_CAPABLE", 0x1, 4 },
+    { "NV4_PBUS_AGP_STATUS_SBA_STATUS_NONE", 0x0, 4 },
+    { "NV4_PBUS_DEBUG_0", 0x1080, 4 },
+    { "NV4_PBUS_DEBUG_0_FBIO_ACLK_DELAY", 16, 4 },
+    { "NV4_PBUS_DEBUG_0_FBIO_ACLK_DELAY_8", 0x8, 4 },
+    { "NV4_PBUS_DEBUG_0_FBIO_ACLK_PC", 20, 4 },
+    { "NV4_PBUS_DEBUG_0_FBIO_ACLK_PC_NORMAL", 0x0, 4 },
+    { "NV4_PBUS_DEBUG_0_FBIO_ACLK_PC_OVERRIDE", 0x1, 4 },
+    { "NV4_PBUS_DEBUG_0_FBIO_FBCLK_DELAY", 8, 4 },
+    { "NV4_PBUS_DEBUG_0_FBIO_FBCLK_DELAY_8", 0x8, 4 },
+    { "NV4_PBUS_DEBUG_0_FBIO_FBCLK_PC", 12, 4 },
+    { "NV4_PBUS_DEBUG_0_FBIO_FBCLK_PC_NORMAL", 0x0, 4 },
+    { "NV4_PBUS_DEBUG_0_FBIO_FBCLK_PC_OVERRIDE", 0x1, 4 },
+    { "NV4_PBUS_DEBUG_0_FBIO_RCLK_DELAY", 24, 4 },
+    { "NV4_PBUS_DEBUG_0_FBIO_RCLK_DELAY_8", 0x8, 4 },
+    { "NV4_PBUS_DEBUG_0_FBIO_RCLK_PC", 28, 4 },
+    { "NV4_PBUS_DEBUG_0_FBIO_RCLK_PC_NORMAL", 0x0, 4 },
+    { "NV4_PBUS_DEBUG_0_FBIO_RCLK_PC_OVERRIDE", 0x1, 4 },
+    { "NV4_PBUS_DEBUG_0_FBIO_SCLK_DELAY", 0, 4 },
+    { "NV4_PBUS_DEBUG_0_FBIO_SCLK_DELAY_8", 0x8, 4 },
+    { "NV4_PBUS_DEBUG_0_FBIO_SCLK_PC", 4, 4 },
+    { "NV4_PBUS_DEBUG_0_FBIO_SCLK_PC_NORMAL", 0x0, 4 },
+    { "NV4_PBUS_DEBUG_0_FBIO_SCLK_PC_OVERRIDE", 0x1, 4 },
+    { "NV4_PBUS_DEBUG_1", 0x1084, 4 },
+    { "NV4_PBUS_DEBUG_1_AGPM_CMD", 3, 4 },
+    { "NV4_PBUS_DEBUG_1_AGPM_CMD_HP_ONLY", 0x2, 4 },
+    { "NV4_PBUS_DEBUG_1_AGPM_CMD_HP_ON_1ST", 0x0, 4 },
+    { "NV4_PBUS_DEBUG_1_AGPM_CMD_LP_ONLY", 0x1, 4 },
+    { "NV4_PBUS_DEBUG_1_DPSH_DECODE", 13, 4 },
+    { "NV4_PBUS_DEBUG_1_DPSH_DECODE_NV3", 0x1, 4 },
+    { "NV4_PBUS_DEBUG_1_DPSH_DECODE_NV4", 0x0, 4 },
+    { "NV4_PBUS_DEBUG_1_HASH_DECODE", 2, 4 },
+    { "NV4_PBUS_DEBUG_1_HASH_DECODE_1FF", 0x0, 4 },
+    { "NV4_PBUS_DEBUG_1_HASH_DECODE_2FF", 0x1, 4 },
+    { "NV4_PBUS_DEBUG_1_PCIM_CMD", 1, 4 },
+    { "NV4_PBUS_DEBUG_1_PCIM_CMD_MRL_ONLY", 0x1, 4 },
+    { "NV4_PBUS_DEBUG_1_PCIM_CMD_SIZE_BASED", 0x0, 4 },
+    { "NV4_PBUS_DEBUG_1_PCIM_THROTTLE", 0, 4 },
+    { "NV4_PBUS_DEBUG_1_PCIM_THROTTLE_ENABLED", 0x1, 4 },
+    { "NV4_PBUS_DEBUG_1_PCIS_2_1", 6, 4 },
+    { "NV4_PBUS_DEBUG_1_PCIS_2_1_ENABLED", 0x1, 4 },
+    { "NV4_PBUS_DEBUG_1_PCIS_CPUQ", 12, 4 },
+    { "NV4_PBUS_DEBUG_1_PCIS_CPUQ_ENABLED", 0x1, 4 },
+    { "NV4_PBUS_DEBUG_1_PCIS_EARLY_RTY", 10, 4 },
+    { "NV4_PBUS_DEBUG_1_PCIS_EARLY_RTY_ENABLED", 0x1, 4 },
+    { "NV4_PBUS_DEBUG_1_PCIS_RD_BURST", 8, 4 },
+    { "NV4_PBUS_DEBUG_1_PCIS_RD_BURST_ENABLED", 0x1, 4 },
+    { "NV4_PBUS_DEBUG_1_PCIS_RETRY", 7, 4 },
+    { "NV4_PBUS_DEBUG_1_PCIS_RETRY_ENABLED", 0x1, 4 },
+    { "NV4_PBUS_DEBUG_1_PCIS_WRITE", 5, 4 },
+    { "NV4_PBUS_DEBUG_1_PCIS_WRITE_0_CYCLE", 0x0, 4 },
+    { "NV4_PBUS_DEBUG_1_PCIS_WRITE_1_CYCLE", 0x1, 4 },
+    { "NV4_PBUS_DEBUG_1_PCIS_WR_BURST", 9, 4 },
+    { "NV4_PBUS_DEBUG_1_PCIS_WR_BURST_ENABLED", 0x1, 4 },
+    { "NV4_PBUS_DEBUG_1_SPARE1", 14, 4 },
+    { "NV4_PBUS_DEBUG_1_SPARE10", 23, 4 },
+    { "NV4_PBUS_DEBUG_1_SPARE2", 15, 4 },
+    { "NV4_PBUS_DEBUG_1_SPARE3", 16, 4 },
+    { "NV4_PBUS_DEBUG_1_SPARE4", 17, 4 },
+    { "NV4_PBUS_DEBUG_1_SPARE5", 18, 4 },
+    { "NV4_PBUS_DEBUG_1_SPARE6", 19, 4 },
+    { "NV4_PBUS_DEBUG_1_SPARE7", 20, 4 },
+    { "NV4_PBUS_DEBUG_1_SPARE8", 21, 4 },
+    { "NV4_PBUS_DEBUG_1_SPARE9", 22, 4 },
+    { "NV4_PBUS_DEBUG_2", 0x1088, 4 },
+    { "NV4_PBUS_DEBUG_2_AGP_DIFFERENTIAL", 0, 4 },
+    { "NV4_PBUS_DEBUG_2_AGP_DIFFERENTIAL_ENABLED", 0x1, 4 },
+    { "NV4_PBUS_DEBUG_2_AGP_SB_STB_DELAY_34", 0x22, 4 },
+    { "NV4_PBUS_DEBUG_2_AGP_SB_STB_PC", 12, 4 },
+    { "NV4_PBUS_DEBUG_2_AGP_SB_STB_PC_NORMAL", 0x0, 4 },
+    { "NV4_PBUS_DEBUG_2_AGP_SB_STB_PC_OVERRIDE", 0x1, 4 },
+    { "NV4_PBUS_DEBUG_3", 0x108C, 4 },
+    { "NV4_PBUS_DEBUG_3_AGP_MAX_SIZE", 0, 4 },
+    { "NV4_PBUS_DEBUG_3_AGP_MAX_SIZE_32_BYTES", 0x1, 4 },
+    { "NV4_PBUS_DEBUG_3_AGP_MAX_SIZE_64_BYTES", 0x2, 4 },
+    { "NV4_PBUS_DEBUG_3_AGP_MAX_SIZE_UNLIMITED", 0x0, 4 },
+    { "NV4_PBUS_DEBUG_CTL", 0x1090, 4 },
+    { "NV4_PBUS_DEBUG_CTL_MODE", 0, 4 },
+    { "NV4_PBUS_DEBUG_CTL_MODE_ENABLED", 0x1, 4 },
+    { "NV4_PBUS_DEBUG_CTL_READ_SELECT", 4, 4 },
+    { "NV4_PBUS_DEBUG_CTL_READ_SELECT_0", 0x0, 4 },
+    { "NV4_PBUS_DEBUG_CTL_READ_SELECT_1", 0x1, 4 },
+    { "NV4_PBUS_DEBUG_HOST", 0x109C, 4 },
+    { "NV4_PBUS_DEBUG_HOST_SEL", 0, 4 },
+    { "NV4_PBUS_DEBUG_READ", 0x1094, 4 },
+    { "NV4_PBUS_DEBUG_READ_DATA", 0, 4 },
+    { "NV4_PBUS_DEBUG_SEL_0", 0x10A0, 4 },
+    { "NV4_PBUS_DEBUG_SEL_0_X", 0, 4 },
+    { "NV4_PBUS_DEBUG_SEL_1", 0x10A4, 4 },
+    { "NV4_PBUS_DEBUG_SEL_1_X", 0, 4 },
+    { "NV4_PBUS_DEBUG_SEL_2", 0x10A8, 4 },
+    { "NV4_PBUS_DEBUG_SEL_2_X", 0, 4 },
+    { "NV4_PBUS_DEBUG_SEL_3", 0x10AC, 4 },
+    { "NV4_PBUS_DEBUG_SEL_3_X", 0, 4 },
+    { "NV4_PBUS_END", 0x1FFF, 4 },
+    { "NV4_PBUS_INTR_0", 0x1100, 4 },
+    { "NV4_PBUS_INTR_0_PCI_BUS_ERROR", 0, 4 },
+    { "NV4_PBUS_INTR_0_PCI_BUS_ERROR_NOT_PENDING", 0x0, 4 },
+    { "NV4_PBUS_INTR_0_PCI_BUS_ERROR_PENDING", 0x1, 4 },
+    { "NV4_PBUS_INTR_0_PCI_BUS_ERROR_RESET", 0x1, 4 },
+    { "NV4_PBUS_INTR_EN_0", 0x1140, 4 },
+    { "NV4_PBUS_INTR_EN_0_PCI_BUS_ERROR", 0, 4 },
+    { "NV4_PBUS_INTR_EN_0_PCI_BUS_ERROR_ENABLED", 0x1, 4 },
+    { "NV4_PBUS_PCIPOWER", 0x1860, 4 },
+    { "NV4_PBUS_PCIPOWER_2", 0x1862, 4 },
+    { "NV4_PBUS_PCIPOWER_2_CLOCK", 3, 4 },
+    { "NV4_PBUS_PCIPOWER_2_CLOCK_NOT_REQUIRED", 0x0, 4 },
+    { "NV4_PBUS_PCIPOWER_2_DSI", 5, 4 },
+    { "NV4_PBUS_PCIPOWER_2_DSI_NOT_REQUIRED", 0x0, 4 },
+    { "NV4_PBUS_PCIPOWER_2_VERSION", 0, 4 },
+    { "NV4_PBUS_PCIPOWER_2_VERSION_1", 0x1, 4 },
+    { "NV4_PBUS_PCIPOWER_CAP_ID", 0, 4 },
+    { "NV4_PBUS_PCIPOWER_CAP_ID_POWER_MGMT", 0x1, 4 },
+    { "NV4_PBUS_PCIPOWER_D1", 1, 4 },
+    { "NV4_PBUS_PCIPOWER_D1_SUPPORTED", 0x1, 4 },
+    { "NV4_PBUS_PCIPOWER_D2", 2, 4 },
+    { "NV4_PBUS_PCIPOWER_D2_SUPPORTED", 0x1, 4 },
+    { "NV4_PBUS_PCIPOWER_NEXT_PTR", 0x1861, 4 },
+    { "NV4_PBUS_PCIPOWER_PME_D0", 3, 4 },
+    { "NV4_PBUS_PCIPOWER_PME_D0_SUPPORTED", 0x1, 4 },
+    { "NV4_PBUS_PCIPOWER_PME_D1", 4, 4 },
+    { "NV4_PBUS_PCIPOWER_PME_D1_SUPPORTED", 0x1, 4 },
+    { "NV4_PBUS_PCIPOWER_PME_D2", 5, 4 },
+    { "NV4_PBUS_PCIPOWER_PME_D2_SUPPORTED", 0x1, 4 },
+    { "NV4_PBUS_PCIPOWER_PME_D3_COLD", 7, 4 },
+    { "NV4_PBUS_PCIPOWER_PME_D3_COLD_SUPPORTED", 0x1, 4 },
+    { "NV4_PBUS_PCIPOWER_PME_D3_HOT", 6, 4 },
+    { "NV4_PBUS_PCIPOWER_PME_D3_HOT_SUPPORTED", 0x1, 4 },
+    { "NV4_PBUS_PCIPOWER_STATE", 0, 4 },
+    { "NV4_PBUS_PCIPOWER_STATE_CURRENT", 0x1864, 4 },
+    { "NV4_PBUS_PCIPOWER_STATE_D0", 0x0, 4 },
+    { "NV4_PBUS_PCIPOWER_STATE_D1", 0x1, 4 },
+    { "NV4_PBUS_PCIPOWER_STATE_D2", 0x2, 4 },
+    { "NV4_PBUS_PCIPOWER_STATE_D3_HOT", 0x3, 4 },
+    { "NV4_PBUS_PCIPOWER_SUPPORTED_STATES", 0x1863, 4 },
+    { "NV4_PBUS_PCI_BAR0_BASE_31_TO_24", 0x1813, 4 },
+    { "NV4_PBUS_PCI_BAR0_INFO", 0x1810, 4 },
+    { "NV4_PBUS_PCI_BAR0_UNUSED1", 0x1811, 4 },
+    { "NV4_PBUS_PCI_BAR0_UNUSED2", 0x1812, 4 },
+    { "NV4_PBUS_PCI_BAR1_BASE_31_TO_24", 0x1817, 4 },
+    { "NV4_PBUS_PCI_BAR1_INFO", 0x1814, 4 },
+    { "NV4_PBUS_PCI_BAR1_UNUSED1", 0x1815, 4 },
+    { "NV4_PBUS_PCI_BAR1_UNUSED2", 0x1816, 4 },
+    { "NV4_PBUS_PCI_BAR_ADDRESS_TYPE", 1, 4 },
+    { "NV4_PBUS_PCI_BAR_ADDRESS_TYPE_20_BIT", 0x1, 4 },
+    { "NV4_PBUS_PCI_BAR_ADDRESS_TYPE_32_BIT", 0x0, 4 },
+    { "NV4_PBUS_PCI_BAR_ADDRESS_TYPE_64_BIT", 0x2, 4 },
+    { "NV4_PBUS_PCI_BAR_PREFETCHABLE", 3, 4 },
+    { "NV4_PBUS_PCI_BAR_PREFETCHABLE_MERGABLE", 0x1, 4 },
+    { "NV4_PBUS_PCI_BAR_PREFETCHABLE_NOT", 0x0, 4 },
+    { "NV4_PBUS_PCI_BAR_RESERVED_END", 0x182B, 4 },
+    { "NV4_PBUS_PCI_BAR_RESERVED_START", 0x1818, 4 },
+    { "NV4_PBUS_PCI_BAR_SPACE_TYPE", 0, 4 },
+    { "NV4_PBUS_PCI_BAR_SPACE_TYPE_IO", 0x1, 4 },
+    { "NV4_PBUS_PCI_BAR_SPACE_TYPE_MEMORY", 0x0, 4 },
+    { "NV4_PBUS_PCI_CAP_PTR_AGP", 0x44, 4 },
+    { "NV4_PBUS_PCI_CAP_PTR_POWER_MGMT", 0x60, 4 },
+    { "NV4_PBUS_PCI_CLASS_CODE", 0x180B, 4 },
+    { "NV4_PBUS_PCI_CLASS_CODE_VGA", 0x30000, 4 },
+    { "NV4_PBUS_PCI_COMMAND", 0x1804, 4 },
+    { "NV4_PBUS_PCI_COMMAND_BUS_MASTER", 2, 4 },
+    { "NV4_PBUS_PCI_COMMAND_BUS_MASTER_ENABLED", 0x1, 4 },
+    { "NV4_PBUS_PCI_COMMAND_H", 0x1805, 4 },
+    { "NV4_PBUS_PCI_COMMAND_IO_SPACE", 0, 4 },
+    { "NV4_PBUS_PCI_COMMAND_IO_SPACE_ENABLED", 0x1, 4 },
+    { "NV4_PBUS_PCI_COMMAND_MEMORY_SPACE", 1, 4 },
+    { "NV4_PBUS_PCI_COMMAND_MEMORY_SPACE_ENABLED", 0x1, 4 },
+    { "NV4_PBUS_PCI_COMMAND_PALETTE_SNOOP", 5, 4 },
+    { "NV4_PBUS_PCI_COMMAND_PALETTE_SNOOP_ENABLED", 0x1, 4 },
+    { "NV4_PBUS_PCI_COMMAND_WRITE_AND_INVAL", 4, 4 },
+    { "NV4_PBUS_PCI_COMMAND_WRITE_AND_INVAL_ENABLED", 0x1, 4 },
+    { "NV4_PBUS_PCI_DEVICE_ID", 0x1802, 4 },
+    { "NV4_PBUS_PCI_DEVICE_ID_NV4", 0x0020, 4 },
+    { "NV4_PBUS_PCI_DEVICE_VENDOR_NVIDIA", 0x10DE, 4 },
+    { "NV4_PBUS_PCI_DT", 0x185C, 4 },
+    { "NV4_PBUS_PCI_DT_TIMEOUT", 0, 4 },
+    { "NV4_PBUS_PCI_DT_TIMEOUT_16", 0xF, 4 },
+    { "NV4_PBUS_PCI_HEADER_TYPE", 0x180E, 4 },
+    { "NV4_PBUS_PCI_INTR_LINE", 0x183C, 4 },
+    { "NV4_PBUS_PCI_INTR_LINE_IRQ_NUM", 0, 4 },
+    { "NV4_PBUS_PCI_INTR_LINE_IRQ_NUM_UNKNOWN", 0xFF, 4 },
+    { "NV4_PBUS_PCI_INTR_PIN", 0x183D, 4 },
+    { "NV4_PBUS_PCI_INTR_PIN_INTA", 0x1, 4 },
+    { "NV4_PBUS_PCI_LATENCY_TIMER", 0x180D, 4 },
+    { "NV4_PBUS_PCI_LATENCY_TIMER_VALUE", 3, 4 },
+    { "NV4_PBUS_PCI_MAX_LAT", 0x183F, 4 },
+    { "NV4_PBUS_PCI_MAX_LAT_250NS", 0x1, 4 },
+    { "NV4_PBUS_PCI_MAX_LAT_NO_REQUIREMENTS", 0x0, 4 },
+    { "NV4_PBUS_PCI_MIN_GNT", 0x183E, 4 },
+    { "NV4_PBUS_PCI_MIN_GNT_1250NS", 0x5, 4 },
+    { "NV4_PBUS_PCI_MIN_GNT_750NS", 0x3, 4 },
+    { "NV4_PBUS_PCI_MIN_GNT_NO_REQUIREMENTS", 0x0, 4 },
+    { "NV4_PBUS_PCI_NEXT_PTR", 0x1834, 4 },
+    { "NV4_PBUS_PCI_REVISION_ID", 0x1808, 4 },
+    { "NV4_PBUS_PCI_REVISION_ID_A01", 0x0, 4 },
+    { "NV4_PBUS_PCI_REVISION_ID_B01", 0x1, 4 },
+    { "NV4_PBUS_PCI_ROM", 0x1830, 4 },
+    { "NV4_PBUS_PCI_ROM_BASE", 0x1832, 4 },
+    { "NV4_PBUS_PCI_ROM_DECODE", 0, 4 },
+    { "NV4_PBUS_PCI_ROM_DECODE_ENABLED", 0x1, 4 },
+    { "NV4_PBUS_PCI_ROM_SHADOW", 0x1850, 4 },
+    { "NV4_PBUS_PCI_ROM_SHADOW_IS_ENABLED", 0, 4 },
+    { "NV4_PBUS_PCI_SCRATCH", 0x1858, 4 },
+    { "NV4_PBUS_PCI_SCRATCH_DEFAULT", 0x23D6CE, 4 },
+    { "NV4_PBUS_PCI_STATUS", 0x1806, 4 },
+    { "NV4_PBUS_PCI_STATUS_2", 0x1807, 4 },
+    { "NV4_PBUS_PCI_STATUS_2_DEVSEL_TIMING", 1, 4 },
+    { "NV4_PBUS_PCI_STATUS_2_DEVSEL_TIMING_FAST", 0x0, 4 },
+    { "NV4_PBUS_PCI_STATUS_2_DEVSEL_TIMING_MEDIUM", 0x1, 4 },
+    { "NV4_PBUS_PCI_STATUS_2_DEVSEL_TIMING_SLOW", 0x2, 4 },
+    { "NV4_PBUS_PCI_STATUS_2_RECEIVED_MASTER", 5, 4 },
+    { "NV4_PBUS_PCI_STATUS_2_RECEIVED_MASTER_ABORT", 0x1, 4 },
+    { "NV4_PBUS_PCI_STATUS_2_RECEIVED_MASTER_CLEAR", 0x1, 4 },
+    { "NV4_PBUS_PCI_STATUS_2_RECEIVED_MASTER_NO_ABORT", 0x0, 4 },
+    { "NV4_PBUS_PCI_STATUS_2_RECEIVED_TARGET", 4, 4 },
+    { "NV4_PBUS_PCI_STATUS_2_RECEIVED_TARGET_ABORT", 0x1, 4 },
+    { "NV4_PBUS_PCI_STATUS_2_RECEIVED_TARGET_CLEAR", 0x1, 4 },
+    { "NV4_PBUS_PCI_STATUS_2_RECEIVED_TARGET_NO_ABORT", 0x0, 4 },
+    { "NV4_PBUS_PCI_STATUS_2_SIGNALED_TARGET", 3, 4 },
+    { "NV4_PBUS_PCI_STATUS_2_SIGNALED_TARGET_ABORT", 0x1, 4 },
+    { "NV4_PBUS_PCI_STATUS_2_SIGNALED_TARGET_CLEAR", 0x1, 4 },
+    { "NV4_PBUS_PCI_STATUS_2_SIGNALED_TARGET_NO_ABORT", 0x0, 4 },
+    { "NV4_PBUS_PCI_STATUS_66MHZ", 5, 4 },
+    { "NV4_PBUS_PCI_STATUS_66MHZ_CAPABLE", 0x1, 4 },
+    { "NV4_PBUS_PCI_STATUS_66MHZ_INCAPABLE", 0x0, 4 },
+    { "NV4_PBUS_PCI_STATUS_CAPLIST", 4, 4 },
+    { "NV4_PBUS_PCI_STATUS_CAPLIST_NOT_PRESENT", 0x0, 4 },
+    { "NV4_PBUS_PCI_STATUS_CAPLIST_PRESENT", 0x1, 4 },
+    { "NV4_PBUS_PCI_STATUS_FAST_BACK2BACK", 7, 4 },
+    { "NV4_PBUS_PCI_STATUS_FAST_BACK2BACK_CAPABLE", 0x1, 4 },
+    { "NV4_PBUS_PCI_STATUS_FAST_BACK2BACK_INCAPABLE", 0x0, 4 },
+    { "NV4_PBUS_PCI_SUBSYSTEM_ID", 0x182E, 4 },
+    { "NV4_PBUS_PCI_SUBSYSTEM_ID_WRITABLE", 0x1842, 4 },
+    { "NV4_PBUS_PCI_SUBSYSTEM_VENDOR_ID", 0x182C, 4 },
+    { "NV4_PBUS_PCI_SUBSYSTEM_VENDOR_ID_WRITABLE", 0x1840, 4 },
+    { "NV4_PBUS_PCI_VENDOR_ID", 0x1800, 4 },
+    { "NV4_PBUS_PCI_VGA", 0x1854, 4 },
+    { "NV4_PBUS_PCI_VGA_IS_ENABLED", 0, 4 },
+    { "NV4_PBUS_ROM_CONFIG", 0x1200, 4 },
+    { "NV4_PBUS_ROM_CONFIG_TW0", 4, 4 },
+    { "NV4_PBUS_ROM_CONFIG_TW0_DEFAULT", 0x3, 4 },
+    { "NV4_PBUS_ROM_CONFIG_TW1", 0, 4 },
+    { "NV4_PBUS_ROM_CONFIG_TW1_DEFAULT", 0xF, 4 },
+    { "NV4_PBUS_START", 0x1000, 4 },
+    { "NV4_PCRTC_CONFIG", 0x600804, 4 },
+    { "NV4_PCRTC_CONFIG_START_ADDRESS", 0, 4 },
+    { "NV4_PCRTC_CONFIG_START_ADDRESS_HSYNC", 0x2, 4 },
+    { "NV4_PCRTC_CONFIG_START_ADDRESS_NON_VGA", 0x1, 4 },
+    { "NV4_PCRTC_CONFIG_START_ADDRESS_VGA", 0x0, 4 },
+    { "NV4_PCRTC_INTR_0", 0x600100, 4 },
+    { "NV4_PCRTC_INTR_0_VBLANK", 0, 4 },
+    { "NV4_PCRTC_INTR_0_VBLANK_NOT_PENDING", 0x0, 4 },
+    { "NV4_PCRTC_INTR_0_VBLANK_PENDING", 0x1, 4 },
+    { "NV4_PCRTC_INTR_0_VBLANK_RESET", 0x1, 4 },
+    { "NV4_PCRTC_INTR_EN_0", 0x600140, 4 },
+    { "NV4_PCRTC_INTR_EN_0_VBLANK", 0, 4 },
+    { "NV4_PCRTC_INTR_EN_0_VBLANK_ENABLED", 0x1, 4 },
+    { "NV4_PCRTC_RASTER", 0x600808, 4 },
+    { "NV4_PCRTC_RASTER_POSITION", 0, 4 },
+    { "NV4_PCRTC_RASTER_SA_LOAD", 12, 4 },
+    { "NV4_PCRTC_RASTER_SA_LOAD_AFTER", 0x2, 4 },
+    { "NV4_PCRTC_RASTER_SA_LOAD_BEFORE", 0x1, 4 },
+    { "NV4_PCRTC_RASTER_SA_LOAD_DISPLAY", 0x0, 4 },
+    { "NV4_PCRTC_RASTER_VERT_BLANK", 16, 4 },
+    { "NV4_PCRTC_RASTER_VERT_BLANK_ACTIVE", 0x1, 4 },
+    { "NV4_PCRTC_RASTER_VERT_BLANK_INACTIVE", 0x0, 4 },
+    { "NV4_PCRTC_START", 0x600800, 4 },
+    { "NV4_PCRTC_START_ADDRESS", 2, 4 },
+    { "NV4_PDAC_DATA_SIZE_1", 16, 4 },
+    { "NV4_PDAC_DATA_VALUE", 0, 4 },
+    { "NV4_PDAC_END", 0x680FFF, 4 },
+    { "NV4_PDAC_START", 0x680000, 4 },
+    { "NV4_PFB_BOOT_0", 0x100000, 4 },
+    { "NV4_PFB_BOOT_0_RAM_AMOUNT", 0, 4 },
+    { "NV4_PFB_BOOT_0_RAM_AMOUNT_16MB", 0x3, 4 },
+    { "NV4_PFB_BOOT_0_RAM_AMOUNT_2MB", 0x0, 4 },
+    { "NV4_PFB_BOOT_0_RAM_AMOUNT_4MB", 0x1, 4 },
+    { "NV4_PFB_BOOT_0_RAM_AMOUNT_8MB", 0x2, 4 },
+    { "NV4_PFB_BOOT_0_RAM_TYPE", 3, 4 },
+    { "NV4_PFB_BOOT_0_RAM_TYPE_1024K_2BANK", 0x3, 4 },
+    { "NV4_PFB_BOOT_0_RAM_TYPE_256K", 0x0, 4 },
+    { "NV4_PFB_BOOT_0_RAM_TYPE_512K_2BANK", 0x1, 4 },
+    { "NV4_PFB_BOOT_0_RAM_TYPE_512K_4BANK", 0x2, 4 },
+    { "NV4_PFB_BOOT_0_RAM_TYPE_SDRAM_16MBIT", 0x3, 4 },
+    { "NV4_PFB_BOOT_0_RAM_TYPE_SDRAM_64MBIT", 0x4, 4 },
+    { "NV4_PFB_BOOT_0_RAM_TYPE_SDRAM_64MBITX16", 0x5, 4 },
+    { "NV4_PFB_BOOT_0_RAM_TYPE_SGRAM_16MBIT", 0x1, 4 },
+    { "NV4_PFB_BOOT_0_RAM_TYPE_SGRAM_16MBIT_4BANK", 0x2, 4 },
+    { "NV4_PFB_BOOT_0_RAM_TYPE_SGRAM_8MBIT", 0x0, 4 },
+    { "NV4_PFB_BOOT_0_RAM_WIDTH_128", 2, 4 },
+    { "NV4_PFB_BOOT_0_RAM_WIDTH_128_OFF", 0x0, 4 },
+    { "NV4_PFB_BOOT_0_RAM_WIDTH_128_ON", 0x1, 4 },
+    { "NV4_PFB_BOOT_0_UMA", 8, 4 },
+    { "NV4_PFB_BOOT_0_UMA_DISABLE", 0x0, 4 },
+    { "NV4_PFB_BOOT_0_UMA_ENABLE", 0x1, 4 },
+    { "NV4_PFB_BOOT_0_UMA_SIZE", 12, 4 },
+    { "NV4_PFB_BOOT_0_UMA_SIZE_10M", 0x4, 4 },
+    { "NV4_PFB_BOOT_0_UMA_SIZE_12M", 0x5, 4 },
+    { "NV4_PFB_BOOT_0_UMA_SIZE_14M", 0x6, 4 },
+    { "NV4_PFB_BOOT_0_UMA_SIZE_16M", 0x7, 4 },
+    { "NV4_PFB_BOOT_0_UMA_SIZE_18M", 0x8, 4 },
+    { "NV4_PFB_BOOT_0_UMA_SIZE_20M", 0x9, 4 },
+    { "NV4_PFB_BOOT_0_UMA_SIZE_22M", 0xA, 4 },
+    { "NV4_PFB_BOOT_0_UMA_SIZE_24M", 0xB, 4 },
+    { "NV4_PFB_BOOT_0_UMA_SIZE_26M", 0xC, 4 },
+    { "NV4_PFB_BOOT_0_UMA_SIZE_28M", 0xD, 4 },
+    { "NV4_PFB_BOOT_0_UMA_SIZE_2M", 0x0, 4 },
+    { "NV4_PFB_BOOT_0_UMA_SIZE_30M", 0xE, 4 },
+    { "NV4_PFB_BOOT_0_UMA_SIZE_32M", 0xF, 4 },
+    { "NV4_PFB_BOOT_0_UMA_SIZE_4M", 0x1, 4 },
+    { "NV4_PFB_BOOT_0_UMA_SIZE_6M", 0x2, 4 },
+    { "NV4_PFB_BOOT_0_UMA_SIZE_8M", 0x3, 4 },
+    { "NV4_PFB_BOOT_0_UMA_SIZE_DEFAULT", 0x7, 4 },
+    { "NV4_PFB_CONFIG_0", 0x100200, 4 },
+    { "NV4_PFB_CONFIG_0_BANK_SWAP", 20, 4 },
+    { "NV4_PFB_CONFIG_0_BANK_SWAP_1M", 0x1, 4 },
+    { "NV4_PFB_CONFIG_0_BANK_SWAP_2M", 0x5, 4 },
+    { "NV4_PFB_CONFIG_0_BANK_SWAP_4M", 0x7, 4 },
+    { "NV4_PFB_CONFIG_0_BANK_SWAP_OFF", 0x0, 4 },
+    { "NV4_PFB_CONFIG_0_PIXEL_DEPTH", 8, 4 },
+    { "NV4_PFB_CONFIG_0_PIXEL_DEPTH_16_BITS", 0x2, 4 },
+    { "NV4_PFB_CONFIG_0_PIXEL_DEPTH_32_BITS", 0x3, 4 },
+    { "NV4_PFB_CONFIG_0_PIXEL_DEPTH_8_BITS", 0x1, 4 },
+    { "NV4_PFB_CONFIG_0_PIXEL_DEPTH_DEFAULT", 0x1, 4 },
+    { "NV4_PFB_CONFIG_0_PRAMIN_WR", 28, 4 },
+    { "NV4_PFB_CONFIG_0_PRAMIN_WR_DISABLED", 0x1, 4 },
+    { "NV4_PFB_CONFIG_0_PRAMIN_WR_INIT", 0x0, 4 },
+    { "NV4_PFB_CONFIG_0_PRAMIN_WR_MASK", 24, 4 },
+    { "NV4_PFB_CONFIG_0_PRAMIN_WR_MASK_CLEAR", 0xF, 4 },
+    { "NV4_PFB_CONFIG_0_PRAMIN_WR_MASK_INIT", 0x0, 4 },
+    { "NV4_PFB_CONFIG_0_RESOLUTION", 0, 4 },
+    { "NV4_PFB_CONFIG_0_RESOLUTION_1024_PIXELS", 0x20, 4 },
+    { "NV4_PFB_CONFIG_0_RESOLUTION_1152_PIXELS", 0x24, 4 },
+    { "NV4_PFB_CONFIG_0_RESOLUTION_1280_PIXELS", 0x28, 4 },
+    { "NV4_PFB_CONFIG_0_RESOLUTION_1600_PIXELS", 0x32, 4 },
+    { "NV4_PFB_CONFIG_0_RESOLUTION_320_PIXELS", 0xA, 4 },
+    { "NV4_PFB_CONFIG_0_RESOLUTION_400_PIXELS", 0xD, 4 },
+    { "NV4_PFB_CONFIG_0_RESOLUTION_480_PIXELS", 0xF, 4 },
+    { "NV4_PFB_CONFIG_0_RESOLUTION_512_PIXELS", 0x10, 4 },
+    { "NV4_PFB_CONFIG_0_RESOLUTION_640_PIXELS", 0x14, 4 },
+    { "NV4_PFB_CONFIG_0_RESOLUTION_800_PIXELS", 0x19, 4 },
+    { "NV4_PFB_CONFIG_0_RESOLUTION_960_PIXELS", 0x1e, 4 },
+    { "NV4_PFB_CONFIG_0_RESOLUTION_DEFAULT", 0x14, 4 },
+    { "NV4_PFB_CONFIG_0_SCRAMBLE_ACTIVE", 0x1, 4 },
+    { "NV4_PFB_CONFIG_0_SCRAMBLE_EN", 29, 4 },
+    { "NV4_PFB_CONFIG_0_SCRAMBLE_EN_INIT", 0x0, 4 },
+    { "NV4_PFB_CONFIG_0_TETRIS_MODE", 15, 4 },
+    { "NV4_PFB_CONFIG_0_TETRIS_MODE_PASS", 0x0, 4 },
+    { "NV4_PFB_CONFIG_0_TETRIS_SHIFT", 18, 4 },
+    { "NV4_PFB_CONFIG_0_TILE", 12, 4 },
+    { "NV4_PFB_CONFIG_0_TILE_OLD1024_FIXED", 0x0, 4 },
+    { "NV4_PFB_CONFIG_0_TILE_OLD1024_VARIABLE", 0x4, 4 },
+    { "NV4_PFB_CONFIG_0_TILE_TETRIS_ALLOW", 0x1, 4 },
+    { "NV4_PFB_CONFIG_0_TILE_TETRIS_REDUNDANT", 0x2, 4 },
+    { "NV4_PFB_CONFIG_0_TILE_TETRIS_REDUNDANT2", 0x3, 4 },
+    { "NV4_PFB_CONFIG_0_TILING", 12, 4 },
+    { "NV4_PFB_CONFIG_0_TILING_DEBUG", 13, 4 },
+    { "NV4_PFB_CONFIG_0_TILING_DEBUG_BANK_SWAP", 20, 4 },
+    { "NV4_PFB_CONFIG_0_TILING_DEBUG_BANK_SWAP_MSB", 21, 4 },
+    { "NV4_PFB_CONFIG_0_TILING_DEBUG_BANK_SWAP_MSB_1M", 0x0, 4 },
+    { "NV4_PFB_CONFIG_0_TILING_DEBUG_BANK_SWAP_MSB_2M", 0x2, 4 },
+    { "NV4_PFB_CONFIG_0_TILING_DEBUG_BANK_SWAP_MSB_4M", 0x3, 4 },
+    { "NV4_PFB_CONFIG_0_TILING_DEBUG_BANK_SWAP_OFF", 0x0, 4 },
+    { "NV4_PFB_CONFIG_0_TILING_DEBUG_BANK_SWAP_ON", 0x1, 4 },
+    { "NV4_PFB_CONFIG_0_TILING_DEBUG_DISABLED", 0x0, 4 },
+    { "NV4_PFB_CONFIG_0_TILING_DEBUG_ON", 13, 4 },
+    { "NV4_PFB_CONFIG_0_TILING_DEBUG_ON_DISABLED", 0x1, 4 },
+    { "NV4_PFB_CONFIG_0_TILING_DEBUG_ON_ENABLED", 0x0, 4 },
+    { "NV4_PFB_CONFIG_0_TILING_DEBUG_TETRIS_MODE", 15, 4 },
+    { "NV4_PFB_CONFIG_0_TILING_DEBUG_TETRIS_MODE_PASS", 0x0, 4 },
+    { "NV4_PFB_CONFIG_0_TILING_DEBUG_TETRIS_SHIFT", 18, 4 },
+    { "NV4_PFB_CONFIG_0_TILING_DEBUG_TILESIZE", 14, 4 },
+    { "NV4_PFB_CONFIG_0_TILING_DEBUG_TILESIZE_FIXED", 0x0, 4 },
+    { "NV4_PFB_CONFIG_0_TILING_DEBUG_TILESIZE_VARIABLE", 0x1, 4 },
+    { "NV4_PFB_CONFIG_0_TILING_DEBUG_UNUSED", 23, 4 },
+    { "NV4_PFB_CONFIG_0_TILING_DISABLED", 0x1, 4 },
+    { "NV4_PFB_CONFIG_0_TILING_ENABLED", 0x0, 4 },
+    { "NV4_PFB_CONFIG_0_TYPE", 0, 4 },
+    { "NV4_PFB_CONFIG_0_TYPE_NOTILING", 0x1114, 4 },
+    { "NV4_PFB_CONFIG_0_TYPE_OLD1024_FIXED_16BPP", 0x220, 4 },
+    { "NV4_PFB_CONFIG_0_TYPE_OLD1024_FIXED_32BPP", 0x320, 4 },
+    { "NV4_PFB_CONFIG_0_TYPE_OLD1024_FIXED_8BPP", 0x120, 4 },
+    { "NV4_PFB_CONFIG_0_TYPE_OLD1024_VAR_16BPP", 0x4220, 4 },
+    { "NV4_PFB_CONFIG_0_TYPE_OLD1024_VAR_32BPP", 0x4320, 4 },
+    { "NV4_PFB_CONFIG_0_TYPE_OLD1024_VAR_8BPP", 0x4120, 4 },
+    { "NV4_PFB_CONFIG_0_TYPE_TETRIS", 0x2000, 4 },
+    { "NV4_PFB_CONFIG_0_UNUSED", 23, 4 },
+    { "NV4_PFB_CONFIG_1", 0x100204, 4 },
+    { "NV4_PFB_CONFIG_1_CAS_LATENCY", 0, 4 },
+    { "NV4_PFB_CONFIG_1_CAS_LATENCY_2", 0x2, 4 },
+    { "NV4_PFB_CONFIG_1_CAS_LATENCY_3", 0x3, 4 },
+    { "NV4_PFB_CONFIG_1_CAS_LATENCY_4", 0x4, 4 },
+    { "NV4_PFB_CONFIG_1_MRS_TO_RAS", 16, 4 },
+    { "NV4_PFB_CONFIG_1_MRS_TO_RAS_0CYCLES", 0x0, 4 },
+    { "NV4_PFB_CONFIG_1_MRS_TO_RAS_2CYCLES", 0x2, 4 },
+    { "NV4_PFB_CONFIG_1_MRS_TO_RAS_DEFAULT", 0x1, 4 },
+    { "NV4_PFB_CONFIG_1_RAS_LOW", 12, 4 },
+    { "NV4_PFB_CONFIG_1_RAS_LOW_4CYCLES", 0x4, 4 },
+    { "NV4_PFB_CONFIG_1_RAS_LOW_5CYCLES", 0x5, 4 },
+    { "NV4_PFB_CONFIG_1_RAS_LOW_7CYCLES", 0x7, 4 },
+    { "NV4_PFB_CONFIG_1_RAS_LOW_DEFAULT", 0x6, 4 },
+    { "NV4_PFB_CONFIG_1_RAS_PCHG", 8, 4 },
+    { "NV4_PFB_CONFIG_1_RAS_PCHG_2CYCLES", 0x1, 4 },
+    { "NV4_PFB_CONFIG_1_RAS_PCHG_DEFAULT", 0x2, 4 },
+    { "NV4_PFB_CONFIG_1_RAS_RAS", 4, 4 },
+    { "NV4_PFB_CONFIG_1_RAS_RAS_7CYCLES", 0x6, 4 },
+    { "NV4_PFB_CONFIG_1_RAS_RAS_8CYCLES", 0x7, 4 },
+    { "NV4_PFB_CONFIG_1_RAS_RAS_9CYCLES", 0x8, 4 },
+    { "NV4_PFB_CONFIG_1_RAS_RAS_DEFAULT", 0x9, 4 },
+    { "NV4_PFB_CONFIG_1_RAS_TO_CAS_M1", 24, 4 },
+    { "NV4_PFB_CONFIG_1_RAS_TO_CAS_M1_0CYCLES", 0x0, 4 },
+    { "NV4_PFB_CONFIG_1_RAS_TO_CAS_M1_2CYCLES", 0x2, 4 },
+    { "NV4_PFB_CONFIG_1_RAS_TO_CAS_M1_DEFAULT", 0x1, 4 },
+    { "NV4_PFB_CONFIG_1_READ_TO_PCHG", 31, 4 },
+    { "NV4_PFB_CONFIG_1_READ_TO_PCHG_OFF", 0x0, 4 },
+    { "NV4_PFB_CONFIG_1_READ_TO_PCHG_ON", 0x1, 4 },
+    { "NV4_PFB_CONFIG_1_READ_TO_WRITE", 28, 4 },
+    { "NV4_PFB_CONFIG_1_READ_TO_WRITE_2CYCLES", 0x2, 4 },
+    { "NV4_PFB_CONFIG_1_READ_TO_WRITE_3CYCLES", 0x3, 4 },
+    { "NV4_PFB_CONFIG_1_READ_TO_WRITE_5CYCLES", 0x5, 4 },
+    { "NV4_PFB_CONFIG_1_READ_TO_WRITE_DEFAULT", 0x4, 4 },
+    { "NV4_PFB_CONFIG_1_SGRAM100", 3, 4 },
+    { "NV4_PFB_CONFIG_1_SGRAM100_DISABLED", 0x1, 4 },
+    { "NV4_PFB_CONFIG_1_SGRAM100_ENABLED", 0x0, 4 },
+    { "NV4_PFB_CONFIG_1_WRITE_TO_READ", 20, 4 },
+    { "NV4_PFB_CONFIG_1_WRITE_TO_READ_DEFAULT", 0x0, 4 },
+    { "NV4_PFB_DEBUG_0", 0x100080, 4 },
+    { "NV4_PFB_DEBUG_0_CASOE", 20, 4 },
+    { "NV4_PFB_DEBUG_0_CASOE_DISABLED", 0x1, 4 },
+    { "NV4_PFB_DEBUG_0_CASOE_ENABLED", 0x0, 4 },
+    { "NV4_PFB_DEBUG_0_CKE_ALWAYSON", 29, 4 },
+    { "NV4_PFB_DEBUG_0_CKE_ALWAYSON_OFF", 0x0, 4 },
+    { "NV4_PFB_DEBUG_0_CKE_ALWAYSON_ON", 0x1, 4 },
+    { "NV4_PFB_DEBUG_0_CKE_INVERT", 28, 4 },
+    { "NV4_PFB_DEBUG_0_CKE_INVERT_OFF", 0x0, 4 },
+    { "NV4_PFB_DEBUG_0_CKE_INVERT_ON", 0x1, 4 },
+    { "NV4_PFB_DEBUG_0_PAGE_MODE", 0, 4 },
+    { "NV4_PFB_DEBUG_0_PAGE_MODE_DISABLED", 0x1, 4 },
+    { "NV4_PFB_DEBUG_0_PAGE_MODE_ENABLED", 0x0, 4 },
+    { "NV4_PFB_DEBUG_0_REFINC", 29, 4 },
+    { "NV4_PFB_DEBUG_0_REFINC_DISABLED", 0x0, 4 },
+    { "NV4_PFB_DEBUG_0_REFINC_ENABLED", 0x1, 4 },
+    { "NV4_PFB_DEBUG_0_REFRESH", 4, 4 },
+    { "NV4_PFB_DEBUG_0_REFRESH_COUNTX64", 8, 4 },
+    { "NV4_PFB_DEBUG_0_REFRESH_COUNTX64_DEFAULT", 0x10, 4 },
+    { "NV4_PFB_DEBUG_0_REFRESH_DISABLED", 0x1, 4 },
+    { "NV4_PFB_DEBUG_0_REFRESH_ENABLED", 0x0, 4 },
+    { "NV4_PFB_DEBUG_0_REFRESH_SLOW_CLK", 14, 4 },
+    { "NV4_PFB_DEBUG_0_REFRESH_SLOW_CLK_ENABLED", 0x1, 4 },
+    { "NV4_PFB_DEBUG_0_SAVE_POWER", 30, 4 },
+    { "NV4_PFB_DEBUG_0_SAVE_POWER_OFF", 0x1, 4 },
+    { "NV4_PFB_DEBUG_0_SAVE_POWER_ON", 0x0, 4 },
+    { "NV4_PFB_END", 0x100FFF, 4 },
+    { "NV4_PFB_GREEN_0", 0x1000C0, 4 },
+    { "NV4_PFB_GREEN_0_LEVEL", 0, 4 },
+    { "NV4_PFB_GREEN_0_LEVEL_MEMORY_DISABLED", 0x3, 4 },
+    { "NV4_PFB_GREEN_0_LEVEL_TIMING_DISABLED", 0x2, 4 },
+    { "NV4_PFB_GREEN_0_LEVEL_VIDEO_DISABLED", 0x1, 4 },
+    { "NV4_PFB_GREEN_0_LEVEL_VIDEO_ENABLED", 0x0, 4 },
+    { "NV4_PFB_RTL", 0x100300, 4 },
+    { "NV4_PFB_RTL_G", 3, 4 },
+    { "NV4_PFB_RTL_GB", 4, 4 },
+    { "NV4_PFB_RTL_GB_DEFAULT", 0x0, 4 },
+    { "NV4_PFB_RTL_G_DEFAULT", 0x0, 4 },
+    { "NV4_PFB_RTL_H", 0, 4 },
+    { "NV4_PFB_RTL_H_DEFAULT", 0x0, 4 },
+    { "NV4_PFB_RTL_MC", 1, 4 },
+    { "NV4_PFB_RTL_MC_DEFAULT", 0x0, 4 },
+    { "NV4_PFB_RTL_V", 2, 4 },
+    { "NV4_PFB_RTL_V_DEFAULT", 0x0, 4 },
+    { "NV4_PFB_SCRAMBLE_EN", 0x100420, 4 },
+    { "NV4_PFB_SCRAMBLE_SIZE_1", 8, 4 },
+    { "NV4_PFB_SCRAMBLE_VALUE_0", 0x03020100, 4 },
+    { "NV4_PFB_SCRAMBLE_VALUE_1", 0x07060504, 4 },
+    { "NV4_PFB_SCRAMBLE_VALUE_2", 0x0b0a0908, 4 },
+    { "NV4_PFB_SCRAMBLE_VALUE_3", 0x0f0e0d0c, 4 },
+    { "NV4_PFB_SCRAMBLE_VALUE_4", 0x13121110, 4 },
+    { "NV4_PFB_SCRAMBLE_VALUE_5", 0x17161514, 4 },
+    { "NV4_PFB_SCRAMBLE_VALUE_6", 0x1b1a1918, 4 },
+    { "NV4_PFB_SCRAMBLE_VALUE_7", 0x1f1e1d1c, 4 },
+    { "NV4_PFB_SCRAMBLE_W0", 0, 4 },
+    { "NV4_PFB_SCRAMBLE_W1", 8, 4 },
+    { "NV4_PFB_SCRAMBLE_W2", 16, 4 },
+    { "NV4_PFB_SCRAMBLE_W3", 24, 4 },
+    { "NV4_PFB_START", 0x100000, 4 },
+    { "NV4_PFIFO_CACHE0_DATA_SIZE_1", 1, 4 },
+    { "NV4_PFIFO_CACHE0_DATA_VALUE", 0, 4 },
+    { "NV4_PFIFO_CACHE0_ENGINE", 0x3080, 4 },
+    { "NV4_PFIFO_CACHE0_GET", 0x3070, 4 },
+    { "NV4_PFIFO_CACHE0_GET_ADDRESS", 2, 4 },
+    { "NV4_PFIFO_CACHE0_HASH", 0x3058, 4 },
+    { "NV4_PFIFO_CACHE0_HASH_INSTANCE", 0, 4 },
+    { "NV4_PFIFO_CACHE0_HASH_VALID", 16, 4 },
+    { "NV4_PFIFO_CACHE0_METHOD_ADDRESS", 2, 4 },
+    { "NV4_PFIFO_CACHE0_METHOD_SIZE_1", 1, 4 },
+    { "NV4_PFIFO_CACHE0_METHOD_SUBCHANNEL", 13, 4 },
+    { "NV4_PFIFO_CACHE0_PULL0", 0x3050, 4 },
+    { "NV4_PFIFO_CACHE0_PULL0_ACCESS", 0, 4 },
+    { "NV4_PFIFO_CACHE0_PULL0_ACCESS_ENABLED", 0x1, 4 },
+    { "NV4_PFIFO_CACHE0_PULL0_DEVICE", 8, 4 },
+    { "NV4_PFIFO_CACHE0_PULL0_DEVICE_HARDWARE", 0x0, 4 },
+    { "NV4_PFIFO_CACHE0_PULL0_DEVICE_SOFTWARE", 0x1, 4 },
+    { "NV4_PFIFO_CACHE0_PULL0_HASH", 4, 4 },
+    { "NV4_PFIFO_CACHE0_PULL0_HASH_FAILED", 0x1, 4 },
+    { "NV4_PFIFO_CACHE0_PULL0_HASH_STATE", 12, 4 },
+    { "NV4_PFIFO_CACHE0_PULL0_HASH_STATE_BUSY", 0x1, 4 },
+    { "NV4_PFIFO_CACHE0_PULL0_HASH_STATE_IDLE", 0x0, 4 },
+    { "NV4_PFIFO_CACHE0_PULL0_HASH_SUCCEEDED", 0x0, 4 },
+    { "NV4_PFIFO_CACHE0_PULL1", 0x3054, 4 },
+    { "NV4_PFIFO_CACHE0_PULL1_ENGINE", 0, 4 },
+    { "NV4_PFIFO_CACHE0_PULL1_ENGINE_DVD", 0x2, 4 },
+    { "NV4_PFIFO_CACHE0_PULL1_ENGINE_GRAPHICS", 0x1, 4 },
+    { "NV4_PFIFO_CACHE0_PULL1_ENGINE_SW", 0x0, 4 },
+    { "NV4_PFIFO_CACHE0_PUSH0", 0x3000, 4 },
+    { "NV4_PFIFO_CACHE0_PUSH0_ACCESS", 0, 4 },
+    { "NV4_PFIFO_CACHE0_PUSH0_ACCESS_ENABLED", 0x1, 4 },
+    { "NV4_PFIFO_CACHE0_PUSH1", 0x3004, 4 },
+    { "NV4_PFIFO_CACHE0_PUSH1_CHID", 0, 4 },
+    { "NV4_PFIFO_CACHE0_PUT", 0x3010, 4 },
+    { "NV4_PFIFO_CACHE0_PUT_ADDRESS", 2, 4 },
+    { "NV4_PFIFO_CACHE0_STATUS", 0x3014, 4 },
+    { "NV4_PFIFO_CACHE0_STATUS_HIGH_MARK", 8, 4 },
+    { "NV4_PFIFO_CACHE0_STATUS_HIGH_MARK_FULL", 0x1, 4 },
+    { "NV4_PFIFO_CACHE0_STATUS_HIGH_MARK_NOT_FULL", 0x0, 4 },
+    { "NV4_PFIFO_CACHE0_STATUS_LOW_MARK", 4, 4 },
+    { "NV4_PFIFO_CACHE0_STATUS_LOW_MARK_EMPTY", 0x1, 4 },
+    { "NV4_PFIFO_CACHE0_STATUS_LOW_MARK_NOT_EMPTY", 0x0, 4 },
+    { "NV4_PFIFO_CACHE0_SUBCHANNEL_0_ENGINE", 0, 4 },
+    { "NV4_PFIFO_CACHE0_SUBCHANNEL_1_ENGINE", 4, 4 },
+    { "NV4_PFIFO_CACHE0_SUBCHANNEL_2_ENGINE", 8, 4 },
+    { "NV4_PFIFO_CACHE0_SUBCHANNEL_3_ENGINE", 12, 4 },
+    { "NV4_PFIFO_CACHE0_SUBCHANNEL_4_ENGINE", 16, 4 },
+    { "NV4_PFIFO_CACHE0_SUBCHANNEL_5_ENGINE", 20, 4 },
+    { "NV4_PFIFO_CACHE0_SUBCHANNEL_6_ENGINE", 24, 4 },
+    { "NV4_PFIFO_CACHE0_SUBCHANNEL_7_ENGINE", 28, 4 },
+    { "NV4_PFIFO_CACHE1_DATA_ALIAS_SIZE_1", 128, 4 },
+    { "NV4_PFIFO_CACHE1_DATA_SIZE_1", 128, 4 },
+    { "NV4_PFIFO_CACHE1_DATA_VALUE", 0, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_CTL", 0x3230, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_CTL_AT_INFO", 31, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_CTL_AT_INFO_INVALID", 0x0, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_CTL_AT_INFO_VALID", 0x1, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_CTL_PAGE_ENTRY", 13, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_CTL_PAGE_ENTRY_LINEAR", 0x1, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_CTL_PAGE_ENTRY_NOT_LINEAR", 0x0, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_CTL_PAGE_TABLE", 12, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_CTL_PAGE_TABLE_NOT_PRESENT", 0x0, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_CTL_PAGE_TABLE_PRESENT", 0x1, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_CTL_TARGET_NODE", 16, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_CTL_TARGET_NODE_AGP", 0x3, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_CTL_TARGET_NODE_PCI", 0x2, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_DATA_SHADOW", 0x32AC, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_DATA_SHADOW_VALUE", 0, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_DCOUNT", 0x32A0, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_DCOUNT_VALUE", 2, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH", 0x3224, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_MAX_REQS", 16, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_SIZE", 13, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_SIZE_128_BYTES", 0x3, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_SIZE_160_BYTES", 0x4, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_SIZE_192_BYTES", 0x5, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_SIZE_224_BYTES", 0x6, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_SIZE_256_BYTES", 0x7, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_SIZE_32_BYTES", 0x0, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_SIZE_64_BYTES", 0x1, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_SIZE_96_BYTES", 0x2, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_104_BYTES", 0xC, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_112_BYTES", 0xD, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_120_BYTES", 0xE, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_128_BYTES", 0xF, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_136_BYTES", 0x10, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_144_BYTES", 0x11, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_152_BYTES", 0x12, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_160_BYTES", 0x13, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_168_BYTES", 0x14, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_16_BYTES", 0x1, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_176_BYTES", 0x15, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_184_BYTES", 0x16, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_192_BYTES", 0x17, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_200_BYTES", 0x18, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_208_BYTES", 0x19, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_216_BYTES", 0x1A, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_224_BYTES", 0x1B, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_232_BYTES", 0x1C, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_240_BYTES", 0x1D, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_248_BYTES", 0x1E, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_24_BYTES", 0x2, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_256_BYTES", 0x1F, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_32_BYTES", 0x3, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_40_BYTES", 0x4, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_48_BYTES", 0x5, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_56_BYTES", 0x6, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_64_BYTES", 0x7, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_72_BYTES", 0x8, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_80_BYTES", 0x9, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_88_BYTES", 0xA, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_8_BYTES", 0x0, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_FETCH_TRIG_96_BYTES", 0xB, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_GET", 0x3244, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_GET_JMP_SHADOW", 0x32A4, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_GET_JMP_SHADOW_OFFSET", 2, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_GET_OFFSET", 2, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_INSTANCE", 0x322C, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_INSTANCE_ADDRESS", 0, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_LIMIT", 0x3234, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_LIMIT_OFFSET", 2, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_PUSH", 0x3220, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_PUSH_ACCESS", 0, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_PUSH_ACCESS_ENABLED", 0x1, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_PUSH_BUFFER", 8, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_PUSH_BUFFER_EMPTY", 0x1, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_PUSH_BUFFER_NOT_EMPTY", 0x0, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_PUSH_STATE", 4, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_PUSH_STATE_BUSY", 0x1, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_PUSH_STATE_IDLE", 0x0, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_PUSH_STATUS", 12, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_PUSH_STATUS_RUNNING", 0x0, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_PUSH_STATUS_SUSPENDED", 0x1, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_PUT", 0x3240, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_PUT_OFFSET", 2, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_RSVD_SHADOW", 0x32A8, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_RSVD_SHADOW_CMD", 0, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_STATE", 0x3228, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_STATE_ERROR", 30, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_STATE_ERROR_NONE", 0x0, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_STATE_ERROR_NON_CACHE", 0x1, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_STATE_ERROR_PROTECTION", 0x3, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_STATE_ERROR_RESERVED_CMD", 0x2, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_STATE_METHOD", 2, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_STATE_METHOD_COUNT", 18, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_STATE_METHOD_COUNT_0", 0x0, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_STATE_SUBCHANNEL", 13, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_TLB_PTE", 0x323C, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_TLB_PTE_FRAME_ADDRESS", 12, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_TLB_TAG", 0x3238, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_TLB_TAG_STATE", 0, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_TLB_TAG_STATE_INVALID", 0x0, 4 },
+    { "NV4_PFIFO_CACHE1_DMA_TLB_TAG_STATE_VALID", 0x1, 4 },
+    { "NV4_PFIFO_CACHE1_ENGINE", 0x3280, 4 },
+    { "NV4_PFIFO_CACHE1_GET", 0x3270, 4 },
+    { "NV4_PFIFO_CACHE1_GET_ADDRESS", 2, 4 },
+    { "NV4_PFIFO_CACHE1_HASH", 0x3258, 4 },
+    { "NV4_PFIFO_CACHE1_HASH_INSTANCE", 0, 4 },
+    { "NV4_PFIFO_CACHE1_HASH_VALID", 16, 4 },
+    { "NV4_PFIFO_CACHE1_METHOD_ADDRESS", 2, 4 },
+    { "NV4_PFIFO_CACHE1_METHOD_ALIAS_SIZE_1", 128, 4 },
+    { "NV4_PFIFO_CACHE1_METHOD_SIZE_1", 128, 4 },
+    { "NV4_PFIFO_CACHE1_METHOD_SUBCHANNEL", 13, 4 },
+    { "NV4_PFIFO_CACHE1_PULL0", 0x3250, 4 },
+    { "NV4_PFIFO_CACHE1_PULL0_ACCESS", 0, 4 },
+    { "NV4_PFIFO_CACHE1_PULL0_ACCESS_ENABLED", 0x1, 4 },
+    { "NV4_PFIFO_CACHE1_PULL0_DEVICE", 8, 4 },
+    { "NV4_PFIFO_CACHE1_PULL0_DEVICE_HARDWARE", 0x0, 4 },
+    { "NV4_PFIFO_CACHE1_PULL0_DEVICE_SOFTWARE", 0x1, 4 },
+    { "NV4_PFIFO_CACHE1_PULL0_HASH", 4, 4 },
+    { "NV4_PFIFO_CACHE1_PULL0_HASH_FAILED", 0x1, 4 },
+    { "NV4_PFIFO_CACHE1_PULL0_HASH_STATE", 12, 4 },
+    { "NV4_PFIFO_CACHE1_PULL0_HASH_STATE_BUSY", 0x1, 4 },
+    { "NV4_PFIFO_CACHE1_PULL0_HASH_STATE_IDLE", 0x0, 4 },
+    { "NV4_PFIFO_CACHE1_PULL0_HASH_SUCCEEDED", 0x0, 4 },
+    { "NV4_PFIFO_CACHE1_PULL1", 0x3254, 4 },
+    { "NV4_PFIFO_CACHE1_PULL1_ENGINE", 0, 4 },
+    { "NV4_PFIFO_CACHE1_PULL1_ENGINE_DVD", 0x2, 4 },
+    { "NV4_PFIFO_CACHE1_PULL1_ENGINE_GRAPHICS", 0x1, 4 },
+    { "NV4_PFIFO_CACHE1_PULL1_ENGINE_SW", 0x0, 4 },
+    { "NV4_PFIFO_CACHE1_PUSH0", 0x3200, 4 },
+    { "NV4_PFIFO_CACHE1_PUSH0_ACCESS", 0, 4 },
+    { "NV4_PFIFO_CACHE1_PUSH0_ACCESS_ENABLED", 0x1, 4 },
+    { "NV4_PFIFO_CACHE1_PUSH1", 0x3204, 4 },
+    { "NV4_PFIFO_CACHE1_PUSH1_CHID", 0, 4 },
+    { "NV4_PFIFO_CACHE1_PUSH1_MODE", 8, 4 },
+    { "NV4_PFIFO_CACHE1_PUSH1_MODE_DMA", 0x1, 4 },
+    { "NV4_PFIFO_CACHE1_PUSH1_MODE_PIO", 0x0, 4 },
+    { "NV4_PFIFO_CACHE1_PUT", 0x3210, 4 },
+    { "NV4_PFIFO_CACHE1_PUT_ADDRESS", 2, 4 },
+    { "NV4_PFIFO_CACHE1_STATUS", 0x3214, 4 },
+    { "NV4_PFIFO_CACHE1_STATUS1", 0x3218, 4 },
+    { "NV4_PFIFO_CACHE1_STATUS1_RANOUT", 0, 4 },
+    { "NV4_PFIFO_CACHE1_STATUS1_RANOUT_TRUE", 0x1, 4 },
+    { "NV4_PFIFO_CACHE1_STATUS_HIGH_MARK", 8, 4 },
+    { "NV4_PFIFO_CACHE1_STATUS_HIGH_MARK_FULL", 0x1, 4 },
+    { "NV4_PFIFO_CACHE1_STATUS_HIGH_MARK_NOT_FULL", 0x0, 4 },
+    { "NV4_PFIFO_CACHE1_STATUS_LOW_MARK", 4, 4 },
+    { "NV4_PFIFO_CACHE1_STATUS_LOW_MARK_EMPTY", 0x1, 4 },
+    { "NV4_PFIFO_CACHE1_STATUS_LOW_MARK_NOT_EMPTY", 0x0, 4 },
+    { "NV4_PFIFO_CACHE1_SUBCHANNEL_0_ENGINE", 0, 4 },
+    { "NV4_PFIFO_CACHE1_SUBCHANNEL_1_ENGINE", 4, 4 },
+    { "NV4_PFIFO_CACHE1_SUBCHANNEL_2_ENGINE", 8, 4 },
+    { "NV4_PFIFO_CACHE1_SUBCHANNEL_3_ENGINE", 12, 4 },
+    { "NV4_PFIFO_CACHE1_SUBCHANNEL_4_ENGINE", 16, 4 },
+    { "NV4_PFIFO_CACHE1_SUBCHANNEL_5_ENGINE", 20, 4 },
+    { "NV4_PFIFO_CACHE1_SUBCHANNEL_6_ENGINE", 24, 4 },
+    { "NV4_PFIFO_CACHE1_SUBCHANNEL_7_ENGINE", 28, 4 },
+    { "NV4_PFIFO_CACHES", 0x2500, 4 },
+    { "NV4_PFIFO_CACHES_DMA_SUSPEND", 4, 4 },
+    { "NV4_PFIFO_CACHES_DMA_SUSPEND_BUSY", 0x1, 4 },
+    { "NV4_PFIFO_CACHES_DMA_SUSPEND_IDLE", 0x0, 4 },
+    { "NV4_PFIFO_CACHES_REASSIGN", 0, 4 },
+    { "NV4_PFIFO_CACHES_REASSIGN_ENABLED", 0x1, 4 },
+    { "NV4_PFIFO_DEBUG_0", 0x2080, 4 },
+    { "NV4_PFIFO_DEBUG_0_CACHE_ERROR0", 0, 4 },
+    { "NV4_PFIFO_DEBUG_0_CACHE_ERROR0_NOT_PENDING", 0x0, 4 },
+    { "NV4_PFIFO_DEBUG_0_CACHE_ERROR0_PENDING", 0x1, 4 },
+    { "NV4_PFIFO_DEBUG_0_CACHE_ERROR1", 4, 4 },
+    { "NV4_PFIFO_DEBUG_0_CACHE_ERROR1_NOT_PENDING", 0x0, 4 },
+    { "NV4_PFIFO_DEBUG_0_CACHE_ERROR1_PENDING", 0x1, 4 },
+    { "NV4_PFIFO_DELAY_0", 0x2040, 4 },
+    { "NV4_PFIFO_DELAY_0_WAIT_RETRY", 0, 4 },
+    { "NV4_PFIFO_DELAY_0_WAIT_RETRY_0", 0x0, 4 },
+    { "NV4_PFIFO_DEVICE_CHID", 0, 4 },
+    { "NV4_PFIFO_DEVICE_SIZE_1", 128, 4 },
+    { "NV4_PFIFO_DEVICE_SWITCH", 24, 4 },
+    { "NV4_PFIFO_DEVICE_SWITCH_AVAILABLE", 0x1, 4 },
+    { "NV4_PFIFO_DMA", 0x2508, 4 },
+    { "NV4_PFIFO_DMA_CHANNEL_0", 0, 4 },
+    { "NV4_PFIFO_DMA_CHANNEL_1", 1, 4 },
+    { "NV4_PFIFO_DMA_CHANNEL_10", 10, 4 },
+    { "NV4_PFIFO_DMA_CHANNEL_11", 11, 4 },
+    { "NV4_PFIFO_DMA_CHANNEL_12", 12, 4 },
+    { "NV4_PFIFO_DMA_CHANNEL_13", 13, 4 },
+    { "NV4_PFIFO_DMA_CHANNEL_14", 14, 4 },
+    { "NV4_PFIFO_DMA_CHANNEL_15", 15, 4 },
+    { "NV4_PFIFO_DMA_CHANNEL_2", 2, 4 },
+    { "NV4_PFIFO_DMA_CHANNEL_3", 3, 4 },
+    { "NV4_PFIFO_DMA_CHANNEL_4", 4, 4 },
+    { "NV4_PFIFO_DMA_CHANNEL_5", 5, 4 },
+    { "NV4_PFIFO_DMA_CHANNEL_6", 6, 4 },
+    { "NV4_PFIFO_DMA_CHANNEL_7", 7, 4 },
+    { "NV4_PFIFO_DMA_CHANNEL_8", 8, 4 },
+    { "NV4_PFIFO_DMA_CHANNEL_9", 9, 4 },
+    { "NV4_PFIFO_DMA_CHANNEL_IS_PENDING", 0x1, 4 },
+    { "NV4_PFIFO_DMA_TIMESLICE", 0x2044, 4 },
+    { "NV4_PFIFO_DMA_TIMESLICE_SELECT", 0, 4 },
+    { "NV4_PFIFO_DMA_TIMESLICE_SELECT_1", 0x0, 4 },
+    { "NV4_PFIFO_DMA_TIMESLICE_SELECT_128K", 0x1ffff, 4 },
+    { "NV4_PFIFO_DMA_TIMESLICE_SELECT_16K", 0x3fff, 4 },
+    { "NV4_PFIFO_DMA_TIMESLICE_SELECT_32K", 0x7fff, 4 },
+    { "NV4_PFIFO_DMA_TIMESLICE_SELECT_64K", 0xffff, 4 },
+    { "NV4_PFIFO_DMA_TIMESLICE_TIMEOUT", 24, 4 },
+    { "NV4_PFIFO_DMA_TIMESLICE_TIMEOUT_ENABLED", 0x1, 4 },
+    { "NV4_PFIFO_END", 0x3FFF, 4 },
+    { "NV4_PFIFO_ENGINE_DVD", 0x2, 4 },
+    { "NV4_PFIFO_ENGINE_GRAPHICS", 0x1, 4 },
+    { "NV4_PFIFO_ENGINE_SW", 0x0, 4 },
+    { "NV4_PFIFO_INTR_0", 0x2100, 4 },
+    { "NV4_PFIFO_INTR_0_CACHE_ERROR", 0, 4 },
+    { "NV4_PFIFO_INTR_0_CACHE_ERROR_NOT_PENDING", 0x0, 4 },
+    { "NV4_PFIFO_INTR_0_CACHE_ERROR_PENDING", 0x1, 4 },
+    { "NV4_PFIFO_INTR_0_CACHE_ERROR_RESET", 0x1, 4 },
+    { "NV4_PFIFO_INTR_0_DMA_PT", 16, 4 },
+    { "NV4_PFIFO_INTR_0_DMA_PT_NOT_PENDING", 0x0, 4 },
+    { "NV4_PFIFO_INTR_0_DMA_PT_PENDING", 0x1, 4 },
+    { "NV4_PFIFO_INTR_0_DMA_PT_RESET", 0x1, 4 },
+    { "NV4_PFIFO_INTR_0_DMA_PUSHER", 12, 4 },
+    { "NV4_PFIFO_INTR_0_DMA_PUSHER_NOT_PENDING", 0x0, 4 },
+    { "NV4_PFIFO_INTR_0_DMA_PUSHER_PENDING", 0x1, 4 },
+    { "NV4_PFIFO_INTR_0_DMA_PUSHER_RESET", 0x1, 4 },
+    { "NV4_PFIFO_INTR_0_RUNOUT", 4, 4 },
+    { "NV4_PFIFO_INTR_0_RUNOUT_NOT_PENDING", 0x0, 4 },
+    { "NV4_PFIFO_INTR_0_RUNOUT_OVERFLOW", 8, 4 },
+    { "NV4_PFIFO_INTR_0_RUNOUT_OVERFLOW_NOT_PENDING", 0x0, 4 },
+    { "NV4_PFIFO_INTR_0_RUNOUT_OVERFLOW_PENDING", 0x1, 4 },
+    { "NV4_PFIFO_INTR_0_RUNOUT_OVERFLOW_RESET", 0x1, 4 },
+    { "NV4_PFIFO_INTR_0_RUNOUT_PENDING", 0x1, 4 },
+    { "NV4_PFIFO_INTR_0_RUNOUT_RESET", 0x1, 4 },
+    { "NV4_PFIFO_INTR_EN_0", 0x2140, 4 },
+    { "NV4_PFIFO_INTR_EN_0_CACHE_ERROR", 0, 4 },
+    { "NV4_PFIFO_INTR_EN_0_CACHE_ERROR_ENABLED", 0x1, 4 },
+    { "NV4_PFIFO_INTR_EN_0_DMA_PT", 16, 4 },
+    { "NV4_PFIFO_INTR_EN_0_DMA_PT_ENABLED", 0x1, 4 },
+    { "NV4_PFIFO_INTR_EN_0_DMA_PUSHER", 12, 4 },
+    { "NV4_PFIFO_INTR_EN_0_DMA_PUSHER_ENABLED", 0x1, 4 },
+    { "NV4_PFIFO_INTR_EN_0_RUNOUT", 4, 4 },
+    { "NV4_PFIFO_INTR_EN_0_RUNOUT_ENABLED", 0x1, 4 },
+    { "NV4_PFIFO_INTR_EN_0_RUNOUT_OVERFLOW", 8, 4 },
+    { "NV4_PFIFO_INTR_EN_0_RUNOUT_OVERFLOW_ENABLED", 0x1, 4 },
+    { "NV4_PFIFO_MODE", 0x2504, 4 },
+    { "NV4_PFIFO_MODE_CHANNEL_0", 0, 4 },
+    { "NV4_PFIFO_MODE_CHANNEL_1", 1, 4 },
+    { "NV4_PFIFO_MODE_CHANNEL_10", 10, 4 },
+    { "NV4_PFIFO_MODE_CHANNEL_11", 11, 4 },
+    { "NV4_PFIFO_MODE_CHANNEL_12", 12, 4 },
+    { "NV4_PFIFO_MODE_CHANNEL_13", 13, 4 },
+    { "NV4_PFIFO_MODE_CHANNEL_14", 14, 4 },
+    { "NV4_PFIFO_MODE_CHANNEL_15", 15, 4 },
+    { "NV4_PFIFO_MODE_CHANNEL_2", 2, 4 },
+    { "NV4_PFIFO_MODE_CHANNEL_3", 3, 4 },
+    { "NV4_PFIFO_MODE_CHANNEL_4", 4, 4 },
+    { "NV4_PFIFO_MODE_CHANNEL_5", 5, 4 },
+    { "NV4_PFIFO_MODE_CHANNEL_6", 6, 4 },
+    { "NV4_PFIFO_MODE_CHANNEL_7", 7, 4 },
+    { "NV4_PFIFO_MODE_CHANNEL_8", 8, 4 },
+    { "NV4_PFIFO_MODE_CHANNEL_9", 9, 4 },
+    { "NV4_PFIFO_MODE_CHANNEL_IS_DMA", 0x1, 4 },
+    { "NV4_PFIFO_MODE_CHANNEL_IS_PIO", 0x0, 4 },
+    { "NV4_PFIFO_NEXT_CHANNEL", 0x2050, 4 },
+    { "NV4_PFIFO_NEXT_CHANNEL_CHID", 0, 4 },
+    { "NV4_PFIFO_NEXT_CHANNEL_MODE", 8, 4 },
+    { "NV4_PFIFO_NEXT_CHANNEL_MODE_DMA", 0x1, 4 },
+    { "NV4_PFIFO_NEXT_CHANNEL_MODE_PIO", 0x0, 4 },
+    { "NV4_PFIFO_NEXT_CHANNEL_SWITCH", 12, 4 },
+    { "NV4_PFIFO_NEXT_CHANNEL_SWITCH_NOT_PENDING", 0x0, 4 },
+    { "NV4_PFIFO_NEXT_CHANNEL_SWITCH_PENDING", 0x1, 4 },
+    { "NV4_PFIFO_PIO_TIMESLICE", 0x2048, 4 },
+    { "NV4_PFIFO_PIO_TIMESLICE_SELECT", 0, 4 },
+    { "NV4_PFIFO_PIO_TIMESLICE_SELECT_1", 0x0, 4 },
+    { "NV4_PFIFO_PIO_TIMESLICE_SELECT_128K", 0x1ffff, 4 },
+    { "NV4_PFIFO_PIO_TIMESLICE_SELECT_16K", 0x3fff, 4 },
+    { "NV4_PFIFO_PIO_TIMESLICE_SELECT_32K", 0x7fff, 4 },
+    { "NV4_PFIFO_PIO_TIMESLICE_SELECT_64K", 0xffff, 4 },
+    { "NV4_PFIFO_PIO_TIMESLICE_TIMEOUT", 24, 4 },
+    { "NV4_PFIFO_PIO_TIMESLICE_TIMEOUT_ENABLED", 0x1, 4 },
+    { "NV4_PFIFO_RAMFC", 0x2214, 4 },
+    { "NV4_PFIFO_RAMFC_BASE_ADDRESS", 1, 4 },
+    { "NV4_PFIFO_RAMFC_BASE_ADDRESS_11000", 0x88, 4 },
+    { "NV4_PFIFO_RAMHT", 0x2210, 4 },
+    { "NV4_PFIFO_RAMHT_BASE_ADDRESS", 4, 4 },
+    { "NV4_PFIFO_RAMHT_BASE_ADDRESS_10000", 0x10, 4 },
+    { "NV4_PFIFO_RAMHT_SEARCH", 24, 4 },
+    { "NV4_PFIFO_RAMHT_SEARCH_128", 0x3, 4 },
+    { "NV4_PFIFO_RAMHT_SEARCH_16", 0x0, 4 },
+    { "NV4_PFIFO_RAMHT_SEARCH_32", 0x1, 4 },
+    { "NV4_PFIFO_RAMHT_SEARCH_64", 0x2, 4 },
+    { "NV4_PFIFO_RAMHT_SIZE", 16, 4 },
+    { "NV4_PFIFO_RAMHT_SIZE_16K", 0x2, 4 },
+    { "NV4_PFIFO_RAMHT_SIZE_32K", 0x3, 4 },
+    { "NV4_PFIFO_RAMHT_SIZE_4K", 0x0, 4 },
+    { "NV4_PFIFO_RAMHT_SIZE_8K", 0x1, 4 },
+    { "NV4_PFIFO_RAMRO", 0x2218, 4 },
+    { "NV4_PFIFO_RAMRO_BASE_ADDRESS", 1, 4 },
+    { "NV4_PFIFO_RAMRO_BASE_ADDRESS_11200", 0x89, 4 },
+    { "NV4_PFIFO_RAMRO_BASE_ADDRESS_12000", 0x90, 4 },
+    { "NV4_PFIFO_RAMRO_SIZE", 16, 4 },
+    { "NV4_PFIFO_RAMRO_SIZE_512", 0x0, 4 },
+    { "NV4_PFIFO_RAMRO_SIZE_8K", 0x1, 4 },
+    { "NV4_PFIFO_RUNOUT_GET", 0x2420, 4 },
+    { "NV4_PFIFO_RUNOUT_GET_ADDRESS", 3, 4 },
+    { "NV4_PFIFO_RUNOUT_PUT", 0x2410, 4 },
+    { "NV4_PFIFO_RUNOUT_PUT_ADDRESS", 3, 4 },
+    { "NV4_PFIFO_RUNOUT_STATUS", 0x2400, 4 },
+    { "NV4_PFIFO_RUNOUT_STATUS_HIGH_MARK", 8, 4 },
+    { "NV4_PFIFO_RUNOUT_STATUS_HIGH_MARK_FULL", 0x1, 4 },
+    { "NV4_PFIFO_RUNOUT_STATUS_HIGH_MARK_NOT_FULL", 0x0, 4 },
+    { "NV4_PFIFO_RUNOUT_STATUS_LOW_MARK", 4, 4 },
+    { "NV4_PFIFO_RUNOUT_STATUS_LOW_MARK_EMPTY", 0x1, 4 },
+    { "NV4_PFIFO_RUNOUT_STATUS_LOW_MARK_NOT_EMPTY", 0x0, 4 },
+    { "NV4_PFIFO_RUNOUT_STATUS_RANOUT", 0, 4 },
+    { "NV4_PFIFO_RUNOUT_STATUS_RANOUT_TRUE", 0x1, 4 },
+    { "NV4_PFIFO_SIZE", 0x250C, 4 },
+    { "NV4_PFIFO_SIZE_CHANNEL_0", 0, 4 },
+    { "NV4_PFIFO_SIZE_CHANNEL_1", 1, 4 },
+    { "NV4_PFIFO_SIZE_CHANNEL_10", 10, 4 },
+    { "NV4_PFIFO_SIZE_CHANNEL_11", 11, 4 },
+    { "NV4_PFIFO_SIZE_CHANNEL_12", 12, 4 },
+    { "NV4_PFIFO_SIZE_CHANNEL_13", 13, 4 },
+    { "NV4_PFIFO_SIZE_CHANNEL_14", 14, 4 },
+    { "NV4_PFIFO_SIZE_CHANNEL_15", 15, 4 },
+    { "NV4_PFIFO_SIZE_CHANNEL_2", 2, 4 },
+    { "NV4_PFIFO_SIZE_CHANNEL_3", 3, 4 },
+    { "NV4_PFIFO_SIZE_CHANNEL_4", 4, 4 },
+    { "NV4_PFIFO_SIZE_CHANNEL_5", 5, 4 },
+    { "NV4_PFIFO_SIZE_CHANNEL_6", 6, 4 },
+    { "NV4_PFIFO_SIZE_CHANNEL_7", 7, 4 },
+    { "NV4_PFIFO_SIZE_CHANNEL_8", 8, 4 },
+    { "NV4_PFIFO_SIZE_CHANNEL_9", 9, 4 },
+    { "NV4_PFIFO_SIZE_CHANNEL_SIZE_IS_124_BYTES", 0x0, 4 },
+    { "NV4_PFIFO_SIZE_CHANNEL_SIZE_IS_512_BYTES", 0x1, 4 },
+    { "NV4_PFIFO_START", 0x2000, 4 },
+    { "NV4_PFIFO_TIMESLICE", 0x204C, 4 },
+    { "NV4_PFIFO_TIMESLICE_TIMER", 0, 4 },
+    { "NV4_PFIFO_TIMESLICE_TIMER_EXPIRED", 0x3FFFF, 4 },
+    { "NV4_PGRAPH_ABS_ICLIP_XMAX", 0x400534, 4 },
+    { "NV4_PGRAPH_ABS_ICLIP_XMAX_VALUE", 0, 4 },
+    { "NV4_PGRAPH_ABS_ICLIP_YMAX", 0x400538, 4 },
+    { "NV4_PGRAPH_ABS_ICLIP_YMAX_VALUE", 0, 4 },
+    { "NV4_PGRAPH_ABS_UCLIPA_XMAX", 0x400568, 4 },
+    { "NV4_PGRAPH_ABS_UCLIPA_XMAX_VALUE", 0, 4 },
+    { "NV4_PGRAPH_ABS_UCLIPA_XMIN", 0x400560, 4 },
+    { "NV4_PGRAPH_ABS_UCLIPA_XMIN_VALUE", 0, 4 },
+    { "NV4_PGRAPH_ABS_UCLIPA_YMAX", 0x40056C, 4 },
+    { "NV4_PGRAPH_ABS_UCLIPA_YMAX_VALUE", 0, 4 },
+    { "NV4_PGRAPH_ABS_UCLIPA_YMIN", 0x400564, 4 },
+    { "NV4_PGRAPH_ABS_UCLIPA_YMIN_VALUE", 0, 4 },
+    { "NV4_PGRAPH_ABS_UCLIP_XMAX", 0x400544, 4 },
+    { "NV4_PGRAPH_ABS_UCLIP_XMAX_VALUE", 0, 4 },
+    { "NV4_PGRAPH_ABS_UCLIP_XMIN", 0x40053C, 4 },
+    { "NV4_PGRAPH_ABS_UCLIP_XMIN_VALUE", 0, 4 },
+    { "NV4_PGRAPH_ABS_UCLIP_YMAX", 0x400548, 4 },
+    { "NV4_PGRAPH_ABS_UCLIP_YMAX_VALUE", 0, 4 },
+    { "NV4_PGRAPH_ABS_UCLIP_YMIN", 0x400540, 4 },
+    { "NV4_PGRAPH_ABS_UCLIP_YMIN_VALUE", 0, 4 },
+    { "NV4_PGRAPH_ABS_X_RAM_SIZE_1", 32, 4 },
+    { "NV4_PGRAPH_ABS_X_RAM_VALUE", 0, 4 },
+    { "NV4_PGRAPH_ABS_Y_RAM_SIZE_1", 32, 4 },
+    { "NV4_PGRAPH_ABS_Y_RAM_VALUE", 0, 4 },
+    { "NV4_PGRAPH_ALPHACNTRL_ALPHA_COMPARE", 8, 4 },
+    { "NV4_PGRAPH_ALPHACNTRL_ALPHA_COMPARE_EQ", 0x3, 4 },
+    { "NV4_PGRAPH_ALPHACNTRL_ALPHA_COMPARE_FALSE", 0x1, 4 },
+    { "NV4_PGRAPH_ALPHACNTRL_ALPHA_COMPARE_GE", 0x7, 4 },
+    { "NV4_PGRAPH_ALPHACNTRL_ALPHA_COMPARE_GT", 0x5, 4 },
+    { "NV4_PGRAPH_ALPHACNTRL_ALPHA_COMPARE_ILLEGAL", 0x0, 4 },
+    { "NV4_PGRAPH_ALPHACNTRL_ALPHA_COMPARE_LE", 0x4, 4 },
+    { "NV4_PGRAPH_ALPHACNTRL_ALPHA_COMPARE_LT", 0x2, 4 },
+    { "NV4_PGRAPH_ALPHACNTRL_ALPHA_COMPARE_NE", 0x6, 4 },
+    { "NV4_PGRAPH_ALPHACNTRL_ALPHA_COMPARE_TRUE", 0x8, 4 },
+    { "NV4_PGRAPH_ALPHACNTRL_ALPHA_KEY", 0, 4 },
+    { "NV4_PGRAPH_BBASE0", 0x400658, 4 },
+    { "NV4_PGRAPH_BBASE0_LINADRS", 0, 4 },
+    { "NV4_PGRAPH_BBASE1", 0x40065c, 4 },
+    { "NV4_PGRAPH_BBASE1_LINADRS", 0, 4 },
+    { "NV4_PGRAPH_BBASE2", 0x400660, 4 },
+    { "NV4_PGRAPH_BBASE2_LINADRS", 0, 4 },
+    { "NV4_PGRAPH_BBASE3", 0x400664, 4 },
+    { "NV4_PGRAPH_BBASE3_LINADRS", 0, 4 },
+    { "NV4_PGRAPH_BBASE4", 0x400668, 4 },
+    { "NV4_PGRAPH_BBASE4_LINADRS", 0, 4 },
+    { "NV4_PGRAPH_BBASE5", 0x40066C, 4 },
+    { "NV4_PGRAPH_BBASE5_LINADRS", 0, 4 },
+    { "NV4_PGRAPH_BBASE_LINADRS", 0, 4 },
+    { "NV4_PGRAPH_BBASE_LINADRS_DEFAULT", 0x0, 4 },
+    { "NV4_PGRAPH_BBASE_SIZE_1", 6, 4 },
+    { "NV4_PGRAPH_BETA_AND", 0x400608, 4 },
+    { "NV4_PGRAPH_BETA_AND_VALUE_FRACTION", 23, 4 },
+    { "NV4_PGRAPH_BETA_PREMULT", 0x40060c, 4 },
+    { "NV4_PGRAPH_BETA_PREMULT_VALUE", 0, 4 },
+    { "NV4_PGRAPH_BLEND", 0x400824, 4 },
+    { "NV4_PGRAPH_BLEND_ALPHABLENDENABLE", 20, 4 },
+    { "NV4_PGRAPH_BLEND_ALPHABLENDENABLE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_BLEND_DESTBLEND", 28, 4 },
+    { "NV4_PGRAPH_BLEND_DESTBLEND_DESTALPHA", 0x7, 4 },
+    { "NV4_PGRAPH_BLEND_DESTBLEND_DESTCOLOR", 0x9, 4 },
+    { "NV4_PGRAPH_BLEND_DESTBLEND_INVDESTALPHA", 0x8, 4 },
+    { "NV4_PGRAPH_BLEND_DESTBLEND_INVDESTCOLOR", 0xA, 4 },
+    { "NV4_PGRAPH_BLEND_DESTBLEND_INVSRCALPHA", 0x6, 4 },
+    { "NV4_PGRAPH_BLEND_DESTBLEND_INVSRCCOLOR", 0x4, 4 },
+    { "NV4_PGRAPH_BLEND_DESTBLEND_ONE", 0x2, 4 },
+    { "NV4_PGRAPH_BLEND_DESTBLEND_SRCALPHA", 0x5, 4 },
+    { "NV4_PGRAPH_BLEND_DESTBLEND_SRCALPHASAT", 0xB, 4 },
+    { "NV4_PGRAPH_BLEND_DESTBLEND_SRCCOLOR", 0x3, 4 },
+    { "NV4_PGRAPH_BLEND_DESTBLEND_ZERO", 0x1, 4 },
+    { "NV4_PGRAPH_BLEND_FOGENABLE", 16, 4 },
+    { "NV4_PGRAPH_BLEND_FOGENABLE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_BLEND_MASK_BIT", 4, 4 },
+    { "NV4_PGRAPH_BLEND_MASK_BIT_LSB", 0x1, 4 },
+    { "NV4_PGRAPH_BLEND_MASK_BIT_MSB", 0x2, 4 },
+    { "NV4_PGRAPH_BLEND_SHADEMODE", 6, 4 },
+    { "NV4_PGRAPH_BLEND_SHADEMODE_FLAT", 0x1, 4 },
+    { "NV4_PGRAPH_BLEND_SHADEMODE_GOURAUD", 0x2, 4 },
+    { "NV4_PGRAPH_BLEND_SHADEMODE_PHONG", 0x3, 4 },
+    { "NV4_PGRAPH_BLEND_SPECULARENABLE", 12, 4 },
+    { "NV4_PGRAPH_BLEND_SPECULARENABLE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_BLEND_SRCBLEND", 24, 4 },
+    { "NV4_PGRAPH_BLEND_SRCBLEND_BETA", 0xD, 4 },
+    { "NV4_PGRAPH_BLEND_SRCBLEND_DESTALPHA", 0x7, 4 },
+    { "NV4_PGRAPH_BLEND_SRCBLEND_DESTCOLOR", 0x9, 4 },
+    { "NV4_PGRAPH_BLEND_SRCBLEND_INVDESTALPHA", 0x8, 4 },
+    { "NV4_PGRAPH_BLEND_SRCBLEND_INVDESTCOLOR", 0xA, 4 },
+    { "NV4_PGRAPH_BLEND_SRCBLEND_INVSRCALPHA", 0x6, 4 },
+    { "NV4_PGRAPH_BLEND_SRCBLEND_INVSRCALPHASAT", 0xC, 4 },
+    { "NV4_PGRAPH_BLEND_SRCBLEND_INVSRCCOLOR", 0x4, 4 },
+    { "NV4_PGRAPH_BLEND_SRCBLEND_ONE", 0x2, 4 },
+    { "NV4_PGRAPH_BLEND_SRCBLEND_SRCALPHA", 0x5, 4 },
+    { "NV4_PGRAPH_BLEND_SRCBLEND_SRCALPHASAT", 0xB, 4 },
+    { "NV4_PGRAPH_BLEND_SRCBLEND_SRCCOLOR", 0x3, 4 },
+    { "NV4_PGRAPH_BLEND_SRCBLEND_ZERO", 0x1, 4 },
+    { "NV4_PGRAPH_BLEND_TEXTUREMAPBLEND", 0, 4 },
+    { "NV4_PGRAPH_BLEND_TEXTUREMAPBLEND_ADD", 0x8, 4 },
+    { "NV4_PGRAPH_BLEND_TEXTUREMAPBLEND_COPY", 0x7, 4 },
+    { "NV4_PGRAPH_BLEND_TEXTUREMAPBLEND_DECAL", 0x1, 4 },
+    { "NV4_PGRAPH_BLEND_TEXTUREMAPBLEND_DECALALPHA", 0x3, 4 },
+    { "NV4_PGRAPH_BLEND_TEXTUREMAPBLEND_DECALMASK", 0x5, 4 },
+    { "NV4_PGRAPH_BLEND_TEXTUREMAPBLEND_MODULATE", 0x2, 4 },
+    { "NV4_PGRAPH_BLEND_TEXTUREMAPBLEND_MODULATEALPHA", 0x4, 4 },
+    { "NV4_PGRAPH_BLEND_TEXTUREMAPBLEND_MODULATEMASK", 0x6, 4 },
+    { "NV4_PGRAPH_BLEND_TEXTUREPERSPECTIVE", 8, 4 },
+    { "NV4_PGRAPH_BLEND_TEXTUREPERSPECTIVE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_BLIMIT0", 0x400684, 4 },
+    { "NV4_PGRAPH_BLIMIT1", 0x400688, 4 },
+    { "NV4_PGRAPH_BLIMIT2", 0x40068c, 4 },
+    { "NV4_PGRAPH_BLIMIT3", 0x400690, 4 },
+    { "NV4_PGRAPH_BLIMIT4", 0x400694, 4 },
+    { "NV4_PGRAPH_BLIMIT5", 0x400698, 4 },
+    { "NV4_PGRAPH_BLIMIT_SIZE_1", 6, 4 },
+    { "NV4_PGRAPH_BLIMIT_TYPE", 31, 4 },
+    { "NV4_PGRAPH_BLIMIT_TYPE_IN_MEMORY", 0x0, 4 },
+    { "NV4_PGRAPH_BLIMIT_TYPE_NULL", 0x1, 4 },
+    { "NV4_PGRAPH_BLIMIT_VALUE", 0, 4 },
+    { "NV4_PGRAPH_BOFFSET0", 0x400640, 4 },
+    { "NV4_PGRAPH_BOFFSET0_LINADRS", 0, 4 },
+    { "NV4_PGRAPH_BOFFSET1", 0x400644, 4 },
+    { "NV4_PGRAPH_BOFFSET1_LINADRS", 0, 4 },
+    { "NV4_PGRAPH_BOFFSET2", 0x400648, 4 },
+    { "NV4_PGRAPH_BOFFSET2_LINADRS", 0, 4 },
+    { "NV4_PGRAPH_BOFFSET3", 0x40064C, 4 },
+    { "NV4_PGRAPH_BOFFSET3_LINADRS", 0, 4 },
+    { "NV4_PGRAPH_BOFFSET4", 0x400650, 4 },
+    { "NV4_PGRAPH_BOFFSET4_LINADRS", 0, 4 },
+    { "NV4_PGRAPH_BOFFSET5", 0x400654, 4 },
+    { "NV4_PGRAPH_BOFFSET5_LINADRS", 0, 4 },
+    { "NV4_PGRAPH_BOFFSET_LINADRS", 0, 4 },
+    { "NV4_PGRAPH_BOFFSET_LINADRS_0", 0x0, 4 },
+    { "NV4_PGRAPH_BOFFSET_LINADRS_DEFAULT", 0x0, 4 },
+    { "NV4_PGRAPH_BOFFSET_SIZE_1", 6, 4 },
+    { "NV4_PGRAPH_BPITCH0", 0x400670, 4 },
+    { "NV4_PGRAPH_BPITCH1", 0x400674, 4 },
+    { "NV4_PGRAPH_BPITCH2", 0x400678, 4 },
+    { "NV4_PGRAPH_BPITCH3", 0x40067C, 4 },
+    { "NV4_PGRAPH_BPITCH4", 0x400680, 4 },
+    { "NV4_PGRAPH_BPITCH_LINADRS_DEFAULT", 0x0, 4 },
+    { "NV4_PGRAPH_BPITCH_SIZE_1", 5, 4 },
+    { "NV4_PGRAPH_BPITCH_VALUE", 0, 4 },
+    { "NV4_PGRAPH_BPITCH_VALUE_0", 0x0, 4 },
+    { "NV4_PGRAPH_BPIXEL", 0x400724, 4 },
+    { "NV4_PGRAPH_BPIXEL_DEPTH0", 0, 4 },
+    { "NV4_PGRAPH_BPIXEL_DEPTH1", 4, 4 },
+    { "NV4_PGRAPH_BPIXEL_DEPTH2", 8, 4 },
+    { "NV4_PGRAPH_BPIXEL_DEPTH3", 12, 4 },
+    { "NV4_PGRAPH_BPIXEL_DEPTH4", 16, 4 },
+    { "NV4_PGRAPH_BPIXEL_DEPTH5", 20, 4 },
+    { "NV4_PGRAPH_BPIXEL_DEPTH_FORMAT_A1R5G5B5", 0x4, 4 },
+    { "NV4_PGRAPH_BPIXEL_DEPTH_FORMAT_A8R8G8B8", 0xC, 4 },
+    { "NV4_PGRAPH_BPIXEL_DEPTH_FORMAT_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_BPIXEL_DEPTH_FORMAT_R5G6B5", 0x5, 4 },
+    { "NV4_PGRAPH_BPIXEL_DEPTH_FORMAT_V8YB8U8YA8", 0xE, 4 },
+    { "NV4_PGRAPH_BPIXEL_DEPTH_FORMAT_X1A7R8G8B8_O1A7R8G8B8", 0xA, 4 },
+    { "NV4_PGRAPH_BPIXEL_DEPTH_FORMAT_X1A7R8G8B8_Z1A7R8G8B8", 0x9, 4 },
+    { "NV4_PGRAPH_BPIXEL_DEPTH_FORMAT_X1R5G5B5_O1R5G5B5", 0x3, 4 },
+    { "NV4_PGRAPH_BPIXEL_DEPTH_FORMAT_X1R5G5B5_Z1R5G5B5", 0x2, 4 },
+    { "NV4_PGRAPH_BPIXEL_DEPTH_FORMAT_X8R8G8B8_O1Z7R8G8B8", 0x8, 4 },
+    { "NV4_PGRAPH_BPIXEL_DEPTH_FORMAT_X8R8G8B8_O8R8G8B8", 0xB, 4 },
+    { "NV4_PGRAPH_BPIXEL_DEPTH_FORMAT_X8R8G8B8_Z8R8G8B8", 0x7, 4 },
+    { "NV4_PGRAPH_BPIXEL_DEPTH_FORMAT_Y16", 0x6, 4 },
+    { "NV4_PGRAPH_BPIXEL_DEPTH_FORMAT_Y32", 0xD, 4 },
+    { "NV4_PGRAPH_BPIXEL_DEPTH_FORMAT_Y8", 0x1, 4 },
+    { "NV4_PGRAPH_BPIXEL_DEPTH_FORMAT_YB8V8YA8U8", 0xF, 4 },
+    { "NV4_PGRAPH_BSWIZZLE2", 0x40069c, 4 },
+    { "NV4_PGRAPH_BSWIZZLE2_HEIGHT", 24, 4 },
+    { "NV4_PGRAPH_BSWIZZLE2_HEIGHT_0", 0x0, 4 },
+    { "NV4_PGRAPH_BSWIZZLE2_WIDTH", 16, 4 },
+    { "NV4_PGRAPH_BSWIZZLE2_WIDTH_0", 0x0, 4 },
+    { "NV4_PGRAPH_BSWIZZLE5", 0x4006a0, 4 },
+    { "NV4_PGRAPH_BSWIZZLE5_HEIGHT", 24, 4 },
+    { "NV4_PGRAPH_BSWIZZLE5_HEIGHT_0", 0x0, 4 },
+    { "NV4_PGRAPH_BSWIZZLE5_WIDTH", 16, 4 },
+    { "NV4_PGRAPH_BSWIZZLE5_WIDTH_0", 0x0, 4 },
+    { "NV4_PGRAPH_CACHE_INDEX", 0x400728, 4 },
+    { "NV4_PGRAPH_CACHE_INDEX_ADRS", 3, 4 },
+    { "NV4_PGRAPH_CACHE_INDEX_ADRS_0", 0x0, 4 },
+    { "NV4_PGRAPH_CACHE_INDEX_ADRS_1024", 0x400, 4 },
+    { "NV4_PGRAPH_CACHE_INDEX_BANK", 2, 4 },
+    { "NV4_PGRAPH_CACHE_INDEX_BANK_10", 0x0, 4 },
+    { "NV4_PGRAPH_CACHE_INDEX_BANK_32", 0x1, 4 },
+    { "NV4_PGRAPH_CACHE_INDEX_OP", 13, 4 },
+    { "NV4_PGRAPH_CACHE_INDEX_OP_RD_CACHE", 0x1, 4 },
+    { "NV4_PGRAPH_CACHE_INDEX_OP_RD_INDEX", 0x2, 4 },
+    { "NV4_PGRAPH_CACHE_INDEX_OP_WR_CACHE", 0x0, 4 },
+    { "NV4_PGRAPH_CACHE_RAM", 0x40072c, 4 },
+    { "NV4_PGRAPH_CACHE_RAM_VALUE", 0, 4 },
+    { "NV4_PGRAPH_CHROMA", 0x400814, 4 },
+    { "NV4_PGRAPH_CHROMA_VALUE", 0, 4 },
+    { "NV4_PGRAPH_CLIPX_0", 0x400524, 4 },
+    { "NV4_PGRAPH_CLIPX_0_CLIP0_MAX", 2, 4 },
+    { "NV4_PGRAPH_CLIPX_0_CLIP0_MIN", 0, 4 },
+    { "NV4_PGRAPH_CLIPX_0_CLIP1_MAX", 6, 4 },
+    { "NV4_PGRAPH_CLIPX_0_CLIP1_MIN", 4, 4 },
+    { "NV4_PGRAPH_CLIPX_0_CLIP2_MAX", 10, 4 },
+    { "NV4_PGRAPH_CLIPX_0_CLIP2_MIN", 8, 4 },
+    { "NV4_PGRAPH_CLIPX_0_CLIP3_MAX", 14, 4 },
+    { "NV4_PGRAPH_CLIPX_0_CLIP3_MIN", 12, 4 },
+    { "NV4_PGRAPH_CLIPX_0_CLIP4_MAX", 18, 4 },
+    { "NV4_PGRAPH_CLIPX_0_CLIP4_MIN", 16, 4 },
+    { "NV4_PGRAPH_CLIPX_0_CLIP5_MAX", 22, 4 },
+    { "NV4_PGRAPH_CLIPX_0_CLIP5_MIN", 20, 4 },
+    { "NV4_PGRAPH_CLIPX_0_CLIP6_MAX", 26, 4 },
+    { "NV4_PGRAPH_CLIPX_0_CLIP6_MIN", 24, 4 },
+    { "NV4_PGRAPH_CLIPX_0_CLIP7_MAX", 30, 4 },
+    { "NV4_PGRAPH_CLIPX_0_CLIP7_MIN", 28, 4 },
+    { "NV4_PGRAPH_CLIPX_1", 0x400528, 4 },
+    { "NV4_PGRAPH_CLIPX_1_CLIP10_MAX", 10, 4 },
+    { "NV4_PGRAPH_CLIPX_1_CLIP10_MIN", 8, 4 },
+    { "NV4_PGRAPH_CLIPX_1_CLIP11_MAX", 14, 4 },
+    { "NV4_PGRAPH_CLIPX_1_CLIP11_MIN", 12, 4 },
+    { "NV4_PGRAPH_CLIPX_1_CLIP12_MAX", 18, 4 },
+    { "NV4_PGRAPH_CLIPX_1_CLIP12_MIN", 16, 4 },
+    { "NV4_PGRAPH_CLIPX_1_CLIP13_MAX", 22, 4 },
+    { "NV4_PGRAPH_CLIPX_1_CLIP13_MIN", 20, 4 },
+    { "NV4_PGRAPH_CLIPX_1_CLIP14_MAX", 26, 4 },
+    { "NV4_PGRAPH_CLIPX_1_CLIP14_MIN", 24, 4 },
+    { "NV4_PGRAPH_CLIPX_1_CLIP15_MAX", 30, 4 },
+    { "NV4_PGRAPH_CLIPX_1_CLIP15_MIN", 28, 4 },
+    { "NV4_PGRAPH_CLIPX_1_CLIP8_MAX", 2, 4 },
+    { "NV4_PGRAPH_CLIPX_1_CLIP8_MIN", 0, 4 },
+    { "NV4_PGRAPH_CLIPX_1_CLIP9_MAX", 6, 4 },
+    { "NV4_PGRAPH_CLIPX_1_CLIP9_MIN", 4, 4 },
+    { "NV4_PGRAPH_CLIPY_0", 0x40052c, 4 },
+    { "NV4_PGRAPH_CLIPY_0_CLIP0_MAX", 2, 4 },
+    { "NV4_PGRAPH_CLIPY_0_CLIP0_MIN", 0, 4 },
+    { "NV4_PGRAPH_CLIPY_0_CLIP1_MAX", 6, 4 },
+    { "NV4_PGRAPH_CLIPY_0_CLIP1_MIN", 4, 4 },
+    { "NV4_PGRAPH_CLIPY_0_CLIP2_MAX", 10, 4 },
+    { "NV4_PGRAPH_CLIPY_0_CLIP2_MIN", 8, 4 },
+    { "NV4_PGRAPH_CLIPY_0_CLIP3_MAX", 14, 4 },
+    { "NV4_PGRAPH_CLIPY_0_CLIP3_MIN", 12, 4 },
+    { "NV4_PGRAPH_CLIPY_0_CLIP4_MAX", 18, 4 },
+    { "NV4_PGRAPH_CLIPY_0_CLIP4_MIN", 16, 4 },
+    { "NV4_PGRAPH_CLIPY_0_CLIP5_MAX", 22, 4 },
+    { "NV4_PGRAPH_CLIPY_0_CLIP5_MIN", 20, 4 },
+    { "NV4_PGRAPH_CLIPY_0_CLIP6_MAX", 26, 4 },
+    { "NV4_PGRAPH_CLIPY_0_CLIP6_MIN", 24, 4 },
+    { "NV4_PGRAPH_CLIPY_0_CLIP7_MAX", 30, 4 },
+    { "NV4_PGRAPH_CLIPY_0_CLIP7_MIN", 28, 4 },
+    { "NV4_PGRAPH_CLIPY_1", 0x400530, 4 },
+    { "NV4_PGRAPH_CLIPY_1_CLIP10_MAX", 10, 4 },
+    { "NV4_PGRAPH_CLIPY_1_CLIP10_MIN", 8, 4 },
+    { "NV4_PGRAPH_CLIPY_1_CLIP11_MAX", 14, 4 },
+    { "NV4_PGRAPH_CLIPY_1_CLIP11_MIN", 12, 4 },
+    { "NV4_PGRAPH_CLIPY_1_CLIP12_MAX", 18, 4 },
+    { "NV4_PGRAPH_CLIPY_1_CLIP12_MIN", 16, 4 },
+    { "NV4_PGRAPH_CLIPY_1_CLIP13_MAX", 22, 4 },
+    { "NV4_PGRAPH_CLIPY_1_CLIP13_MIN", 20, 4 },
+    { "NV4_PGRAPH_CLIPY_1_CLIP14_MAX", 26, 4 },
+    { "NV4_PGRAPH_CLIPY_1_CLIP14_MIN", 24, 4 },
+    { "NV4_PGRAPH_CLIPY_1_CLIP15_MAX", 30, 4 },
+    { "NV4_PGRAPH_CLIPY_1_CLIP15_MIN", 28, 4 },
+    { "NV4_PGRAPH_CLIPY_1_CLIP8_MAX", 2, 4 },
+    { "NV4_PGRAPH_CLIPY_1_CLIP8_MIN", 0, 4 },
+    { "NV4_PGRAPH_CLIPY_1_CLIP9_MAX", 6, 4 },
+    { "NV4_PGRAPH_CLIPY_1_CLIP9_MIN", 4, 4 },
+    { "NV4_PGRAPH_CLIP_CONDITION_IS_EQ", 0x2, 4 },
+    { "NV4_PGRAPH_CLIP_CONDITION_IS_GT", 0x0, 4 },
+    { "NV4_PGRAPH_CLIP_CONDITION_IS_LT", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA", 0x400590, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_0_DIFFUSE", 0x3, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_0_FACTOR", 0x2, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_0_INPUT", 0x4, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_0_TEXTURE0", 0x5, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_0_TEXTURE1", 0x6, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_0_TEXTURELOD", 0x7, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_0_ZERO", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_1", 10, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_1_DIFFUSE", 0x3, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_1_FACTOR", 0x2, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_1_INPUT", 0x4, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_1_TEXTURE0", 0x5, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_1_TEXTURE1", 0x6, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_1_TEXTURELOD", 0x7, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_1_ZERO", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_2", 18, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_2_DIFFUSE", 0x3, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_2_FACTOR", 0x2, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_2_INPUT", 0x4, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_2_TEXTURE0", 0x5, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_2_TEXTURE1", 0x6, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_2_TEXTURELOD", 0x7, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_2_ZERO", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_3", 26, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_3_DIFFUSE", 0x3, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_3_FACTOR", 0x2, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_3_INPUT", 0x4, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_3_TEXTURE0", 0x5, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_3_TEXTURE1", 0x6, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_3_TEXTURELOD", 0x7, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_ARGUMENT_3_ZERO", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_INVERSE_0", 0, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_INVERSE_0_INVERSE", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_INVERSE_0_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_INVERSE_1", 8, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_INVERSE_1_INVERSE", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_INVERSE_1_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_INVERSE_2", 16, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_INVERSE_2_INVERSE", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_INVERSE_2_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_INVERSE_3", 24, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_INVERSE_3_INVERSE", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_INVERSE_3_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_OPERATION", 29, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_OPERATION_ADD", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_OPERATION_ADD2", 0x2, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_OPERATION_ADD4", 0x3, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_OPERATION_ADDCOMPLEMENT", 0x6, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_OPERATION_ADDSIGNED", 0x4, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_OPERATION_ADDSIGNED2", 0x7, 4 },
+    { "NV4_PGRAPH_COMBINE0ALPHA_OPERATION_MUX", 0x5, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR", 0x400594, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ALPHA_0", 1, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ALPHA_0_ALPHA", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ALPHA_0_COLOR", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ALPHA_1", 9, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ALPHA_1_ALPHA", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ALPHA_1_COLOR", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ALPHA_2", 17, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ALPHA_2_ALPHA", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ALPHA_2_COLOR", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ALPHA_3", 25, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ALPHA_3_ALPHA", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ALPHA_3_COLOR", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_0", 2, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_0_DIFFUSE", 0x3, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_0_FACTOR", 0x2, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_0_INPUT", 0x4, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_0_TEXTURE0", 0x5, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_0_TEXTURE1", 0x6, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_0_TEXTURELOD", 0x7, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_0_ZERO", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_1", 10, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_1_DIFFUSE", 0x3, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_1_FACTOR", 0x2, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_1_INPUT", 0x4, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_1_TEXTURE0", 0x5, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_1_TEXTURE1", 0x6, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_1_TEXTURELOD", 0x7, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_1_ZERO", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_2", 18, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_2_DIFFUSE", 0x3, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_2_FACTOR", 0x2, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_2_INPUT", 0x4, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_2_TEXTURE0", 0x5, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_2_TEXTURE1", 0x6, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_2_TEXTURELOD", 0x7, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_2_ZERO", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_3", 26, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_3_DIFFUSE", 0x3, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_3_FACTOR", 0x2, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_3_INPUT", 0x4, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_3_TEXTURE0", 0x5, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_3_TEXTURE1", 0x6, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_3_TEXTURELOD", 0x7, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_ARGUMENT_3_ZERO", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_INVERSE_0", 0, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_INVERSE_0_INVERSE", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_INVERSE_0_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_INVERSE_1", 8, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_INVERSE_1_INVERSE", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_INVERSE_1_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_INVERSE_2", 16, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_INVERSE_2_INVERSE", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_INVERSE_2_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_INVERSE_3", 24, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_INVERSE_3_INVERSE", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_INVERSE_3_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_OPERATION", 29, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_OPERATION_ADD", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_OPERATION_ADD2", 0x2, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_OPERATION_ADD4", 0x3, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_OPERATION_ADDCOMPLEMENT", 0x6, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_OPERATION_ADDSIGNED", 0x4, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_OPERATION_ADDSIGNED2", 0x7, 4 },
+    { "NV4_PGRAPH_COMBINE0COLOR_OPERATION_MUX", 0x5, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA", 0x400598, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_0", 2, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_0_DIFFUSE", 0x3, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_0_FACTOR", 0x2, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_0_INPUT", 0x4, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_0_TEXTURE0", 0x5, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_0_TEXTURE1", 0x6, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_0_ZERO", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_1", 10, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_1_DIFFUSE", 0x3, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_1_FACTOR", 0x2, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_1_INPUT", 0x4, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_1_TEXTURE0", 0x5, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_1_TEXTURE1", 0x6, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_1_ZERO", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_2", 18, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_2_DIFFUSE", 0x3, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_2_FACTOR", 0x2, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_2_INPUT", 0x4, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_2_TEXTURE0", 0x5, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_2_TEXTURE1", 0x6, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_2_ZERO", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_3", 26, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_3_DIFFUSE", 0x3, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_3_FACTOR", 0x2, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_3_INPUT", 0x4, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_3_TEXTURE0", 0x5, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_3_TEXTURE1", 0x6, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_ARGUMENT_3_ZERO", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_INVERSE_0", 0, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_INVERSE_0_INVERSE", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_INVERSE_0_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_INVERSE_1", 8, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_INVERSE_1_INVERSE", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_INVERSE_1_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_INVERSE_2", 16, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_INVERSE_2_INVERSE", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_INVERSE_2_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_INVERSE_3", 24, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_INVERSE_3_INVERSE", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_INVERSE_3_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_OPERATION", 29, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_OPERATION_ADD", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_OPERATION_ADD2", 0x2, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_OPERATION_ADD4", 0x3, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_OPERATION_ADDCOMPLEMENT", 0x6, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_OPERATION_ADDSIGNED", 0x4, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_OPERATION_ADDSIGNED2", 0x7, 4 },
+    { "NV4_PGRAPH_COMBINE1ALPHA_OPERATION_MUX", 0x5, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR", 0x40059C, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ALPHA_0", 1, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ALPHA_0_ALPHA", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ALPHA_0_COLOR", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ALPHA_1", 9, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ALPHA_1_ALPHA", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ALPHA_1_COLOR", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ALPHA_2", 17, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ALPHA_2_ALPHA", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ALPHA_2_COLOR", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ALPHA_3", 25, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ALPHA_3_ALPHA", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ALPHA_3_COLOR", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_0_DIFFUSE", 0x3, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_0_FACTOR", 0x2, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_0_INPUT", 0x4, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_0_TEXTURE0", 0x5, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_0_TEXTURE1", 0x6, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_0_ZERO", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_1", 10, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_1_DIFFUSE", 0x3, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_1_FACTOR", 0x2, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_1_INPUT", 0x4, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_1_TEXTURE0", 0x5, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_1_TEXTURE1", 0x6, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_1_ZERO", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_2", 18, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_2_DIFFUSE", 0x3, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_2_FACTOR", 0x2, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_2_INPUT", 0x4, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_2_TEXTURE0", 0x5, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_2_TEXTURE1", 0x6, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_2_ZERO", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_3", 26, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_3_DIFFUSE", 0x3, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_3_FACTOR", 0x2, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_3_INPUT", 0x4, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_3_TEXTURE0", 0x5, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_3_TEXTURE1", 0x6, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_ARGUMENT_3_ZERO", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_INVERSE_0", 0, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_INVERSE_0_INVERSE", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_INVERSE_0_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_INVERSE_1", 8, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_INVERSE_1_INVERSE", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_INVERSE_1_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_INVERSE_2", 16, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_INVERSE_2_INVERSE", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_INVERSE_2_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_INVERSE_3", 24, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_INVERSE_3_INVERSE", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_INVERSE_3_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_OPERATION", 29, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_OPERATION_ADD", 0x1, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_OPERATION_ADD2", 0x2, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_OPERATION_ADD4", 0x3, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_OPERATION_ADDCOMPLEMENT", 0x6, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_OPERATION_ADDSIGNED", 0x4, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_OPERATION_ADDSIGNED2", 0x7, 4 },
+    { "NV4_PGRAPH_COMBINE1COLOR_OPERATION_MUX", 0x5, 4 },
+    { "NV4_PGRAPH_CONTROL0", 0x400818, 4 },
+    { "NV4_PGRAPH_CONTROL0_ALPHAFUNC", 8, 4 },
+    { "NV4_PGRAPH_CONTROL0_ALPHAFUNC_ALWAYS", 0x8, 4 },
+    { "NV4_PGRAPH_CONTROL0_ALPHAFUNC_EQUAL", 0x3, 4 },
+    { "NV4_PGRAPH_CONTROL0_ALPHAFUNC_GREATER", 0x5, 4 },
+    { "NV4_PGRAPH_CONTROL0_ALPHAFUNC_GREATEREQUAL", 0x7, 4 },
+    { "NV4_PGRAPH_CONTROL0_ALPHAFUNC_LESS", 0x2, 4 },
+    { "NV4_PGRAPH_CONTROL0_ALPHAFUNC_LESSEQUAL", 0x4, 4 },
+    { "NV4_PGRAPH_CONTROL0_ALPHAFUNC_NEVER", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL0_ALPHAFUNC_NOTEQUAL", 0x6, 4 },
+    { "NV4_PGRAPH_CONTROL0_ALPHAREF", 0, 4 },
+    { "NV4_PGRAPH_CONTROL0_ALPHATESTENABLE", 12, 4 },
+    { "NV4_PGRAPH_CONTROL0_ALPHATESTENABLE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL0_ALPHA_WRITE_ENABLE", 26, 4 },
+    { "NV4_PGRAPH_CONTROL0_ALPHA_WRITE_ENABLE_FALSE", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL0_ALPHA_WRITE_ENABLE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL0_BLUE_WRITE_ENABLE", 29, 4 },
+    { "NV4_PGRAPH_CONTROL0_BLUE_WRITE_ENABLE_FALSE", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL0_BLUE_WRITE_ENABLE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL0_CULLMODE", 20, 4 },
+    { "NV4_PGRAPH_CONTROL0_CULLMODE_CCW", 0x3, 4 },
+    { "NV4_PGRAPH_CONTROL0_CULLMODE_CW", 0x2, 4 },
+    { "NV4_PGRAPH_CONTROL0_CULLMODE_NONE", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL0_DITHERENABLE", 22, 4 },
+    { "NV4_PGRAPH_CONTROL0_DITHERENABLE_FALSE", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL0_DITHERENABLE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL0_GREEN_WRITE_ENABLE", 28, 4 },
+    { "NV4_PGRAPH_CONTROL0_GREEN_WRITE_ENABLE_FALSE", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL0_GREEN_WRITE_ENABLE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL0_RED_WRITE_ENABLE", 27, 4 },
+    { "NV4_PGRAPH_CONTROL0_RED_WRITE_ENABLE_FALSE", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL0_RED_WRITE_ENABLE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL0_STENCIL_WRITE_ENABLE", 25, 4 },
+    { "NV4_PGRAPH_CONTROL0_STENCIL_WRITE_ENABLE_FALSE", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL0_STENCIL_WRITE_ENABLE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL0_ZENABLE", 14, 4 },
+    { "NV4_PGRAPH_CONTROL0_ZENABLE_FALSE", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL0_ZENABLE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL0_ZFUNC", 16, 4 },
+    { "NV4_PGRAPH_CONTROL0_ZFUNC_ALWAYS", 0x8, 4 },
+    { "NV4_PGRAPH_CONTROL0_ZFUNC_EQUAL", 0x3, 4 },
+    { "NV4_PGRAPH_CONTROL0_ZFUNC_GREATER", 0x5, 4 },
+    { "NV4_PGRAPH_CONTROL0_ZFUNC_GREATEREQUAL", 0x7, 4 },
+    { "NV4_PGRAPH_CONTROL0_ZFUNC_LESS", 0x2, 4 },
+    { "NV4_PGRAPH_CONTROL0_ZFUNC_LESSEQUAL", 0x4, 4 },
+    { "NV4_PGRAPH_CONTROL0_ZFUNC_NEVER", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL0_ZFUNC_NOTEQUAL", 0x6, 4 },
+    { "NV4_PGRAPH_CONTROL0_ZWRITEENABLE", 24, 4 },
+    { "NV4_PGRAPH_CONTROL0_ZWRITEENABLE_FALSE", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL0_ZWRITEENABLE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL0_Z_FORMAT", 30, 4 },
+    { "NV4_PGRAPH_CONTROL0_Z_FORMAT_FIXED", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL0_Z_FORMAT_FLOAT", 0x2, 4 },
+    { "NV4_PGRAPH_CONTROL0_Z_PERSPECTIVE_ENABLE", 23, 4 },
+    { "NV4_PGRAPH_CONTROL0_Z_PERSPECTIVE_ENABLE_FALSE", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL0_Z_PERSPECTIVE_ENABLE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL1", 0x40081c, 4 },
+    { "NV4_PGRAPH_CONTROL1_STENCIL_FUNC", 4, 4 },
+    { "NV4_PGRAPH_CONTROL1_STENCIL_FUNC_ALWAYS", 0x8, 4 },
+    { "NV4_PGRAPH_CONTROL1_STENCIL_FUNC_EQUAL", 0x3, 4 },
+    { "NV4_PGRAPH_CONTROL1_STENCIL_FUNC_GREATER", 0x5, 4 },
+    { "NV4_PGRAPH_CONTROL1_STENCIL_FUNC_GREATEREQUAL", 0x7, 4 },
+    { "NV4_PGRAPH_CONTROL1_STENCIL_FUNC_LESS", 0x2, 4 },
+    { "NV4_PGRAPH_CONTROL1_STENCIL_FUNC_LESSEQUAL", 0x4, 4 },
+    { "NV4_PGRAPH_CONTROL1_STENCIL_FUNC_NEVER", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL1_STENCIL_FUNC_NOTEQUAL", 0x6, 4 },
+    { "NV4_PGRAPH_CONTROL1_STENCIL_MASK_READ", 16, 4 },
+    { "NV4_PGRAPH_CONTROL1_STENCIL_MASK_WRITE", 24, 4 },
+    { "NV4_PGRAPH_CONTROL1_STENCIL_REF", 8, 4 },
+    { "NV4_PGRAPH_CONTROL1_STENCIL_TEST_ENABLE", 0, 4 },
+    { "NV4_PGRAPH_CONTROL1_STENCIL_TEST_ENABLE_FALSE", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL1_STENCIL_TEST_ENABLE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL2", 0x400820, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_FAIL", 0, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_FAIL_DECR", 0x8, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_FAIL_DECRSAT", 0x5, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_FAIL_INCR", 0x7, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_FAIL_INCRSAT", 0x4, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_FAIL_INVERT", 0x6, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_FAIL_KEEP", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_FAIL_REPLACE", 0x3, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_FAIL_ZERO", 0x2, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_ZFAIL", 4, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_ZFAIL_DECR", 0x8, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_ZFAIL_DECRSAT", 0x5, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_ZFAIL_INCR", 0x7, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_ZFAIL_INCRSAT", 0x4, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_ZFAIL_INVERT", 0x6, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_ZFAIL_KEEP", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_ZFAIL_REPLACE", 0x3, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_ZFAIL_ZERO", 0x2, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_ZPASS", 8, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_ZPASS_DECR", 0x8, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_ZPASS_DECRSAT", 0x5, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_ZPASS_INCR", 0x7, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_ZPASS_INCRSAT", 0x4, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_ZPASS_INVERT", 0x6, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_ZPASS_KEEP", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_ZPASS_REPLACE", 0x3, 4 },
+    { "NV4_PGRAPH_CONTROL2_STENCIL_OP_ZPASS_ZERO", 0x2, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_BLEND_BETA", 29, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_BLEND_BETA_DESTCOLOR", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_BLEND_BETA_SRCALPHA", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_BLEND_INPUT0", 30, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_BLEND_INPUT0_DESTCOLOR", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_BLEND_INPUT0_ZERO", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_BLEND_INPUT1", 31, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_BLEND_INPUT1_SRCCOLOR", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_BLEND_INPUT1_ZERO", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_COLOR_FORMAT", 8, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_COLOR_FORMAT_LE_A8R8G8B8", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_COLOR_FORMAT_LE_X8R8G8B8", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_COLOR_WRITE", 24, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_COLOR_WRITE_ALPHA", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_COLOR_WRITE_ALPHA_ZETA", 0x2, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_COLOR_WRITE_NEVER", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_COLOR_WRITE_ZETA", 0x3, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_CULLING", 12, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_CULLING_CLOCKWISE", 0x3, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_CULLING_COUNTERCLOCKWISE", 0x2, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_CULLING_ILLEGAL", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_CULLING_NONE", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_INTERPOLATOR", 0, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_INTERPOLATOR_FOH", 0x2, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_INTERPOLATOR_ZOH", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_INTERPOLATOR_ZOH_MS", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_ROP", 28, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_ROP_ADD_WITH_SATURATION", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_ROP_BLEND_AND", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_SRCCOLOR", 10, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_SRCCOLOR_ALPHA_INVERSE", 0x2, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_SRCCOLOR_ALPHA_ONE", 0x3, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_SRCCOLOR_COLOR_INVERSE", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_SRCCOLOR_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_WRAP_U", 4, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_WRAP_U_CLAMP", 0x3, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_WRAP_U_CYLINDRICAL", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_WRAP_U_MIRROR", 0x2, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_WRAP_U_WRAP", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_WRAP_V", 6, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_WRAP_V_CLAMP", 0x3, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_WRAP_V_CYLINDRICAL", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_WRAP_V_MIRROR", 0x2, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_WRAP_V_WRAP", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_ZBUFFER", 15, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_ZBUFFER_LINEAR", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_ZBUFFER_SCREEN", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_ZETA_COMPARE", 16, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_ZETA_COMPARE_EQ", 0x3, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_ZETA_COMPARE_FALSE", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_ZETA_COMPARE_GE", 0x7, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_ZETA_COMPARE_GT", 0x5, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_ZETA_COMPARE_ILLEGAL", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_ZETA_COMPARE_LE", 0x4, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_ZETA_COMPARE_LT", 0x2, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_ZETA_COMPARE_NE", 0x6, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_ZETA_COMPARE_TRUE", 0x8, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_ZETA_WRITE", 20, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_ZETA_WRITE_ALPHA", 0x1, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_ZETA_WRITE_ALPHA_ZETA", 0x2, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_ZETA_WRITE_ALWAYS", 0x4, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_ZETA_WRITE_NEVER", 0x0, 4 },
+    { "NV4_PGRAPH_CONTROL_OUT_ZETA_WRITE_ZETA", 0x3, 4 },
+    { "NV4_PGRAPH_CTX_CACHE1_CHROMA_KEY", 12, 4 },
+    { "NV4_PGRAPH_CTX_CACHE1_CONTEXT_SURFACE", 25, 4 },
+    { "NV4_PGRAPH_CTX_CACHE1_GRCLASS", 0, 4 },
+    { "NV4_PGRAPH_CTX_CACHE1_PATCH_STATUS", 24, 4 },
+    { "NV4_PGRAPH_CTX_CACHE1_SIZE_1", 8, 4 },
+    { "NV4_PGRAPH_CTX_CACHE1_SPARE1", 20, 4 },
+    { "NV4_PGRAPH_CTX_CACHE1_SWIZZLE", 14, 4 },
+    { "NV4_PGRAPH_CTX_CACHE1_USER_CLIP", 13, 4 },
+    { "NV4_PGRAPH_CTX_CACHE2_MONO_FORMAT", 0, 4 },
+    { "NV4_PGRAPH_CTX_CACHE2_NOTIFY_INSTANCE", 16, 4 },
+    { "NV4_PGRAPH_CTX_CACHE2_SIZE_1", 8, 4 },
+    { "NV4_PGRAPH_CTX_CACHE3_DMA_INSTANCE_0", 0, 4 },
+    { "NV4_PGRAPH_CTX_CACHE3_DMA_INSTANCE_1", 16, 4 },
+    { "NV4_PGRAPH_CTX_CACHE3_SIZE_1", 8, 4 },
+    { "NV4_PGRAPH_CTX_CACHE4_SIZE_1", 8, 4 },
+    { "NV4_PGRAPH_CTX_CACHE4_USER_INSTANCE", 0, 4 },
+    { "NV4_PGRAPH_CTX_CONTROL", 0x400170, 4 },
+    { "NV4_PGRAPH_CTX_CONTROL_CHANGE", 20, 4 },
+    { "NV4_PGRAPH_CTX_CONTROL_CHANGE_AVAILABLE", 0x1, 4 },
+    { "NV4_PGRAPH_CTX_CONTROL_CHANGE_UNAVAILABLE", 0x0, 4 },
+    { "NV4_PGRAPH_CTX_CONTROL_CHID", 16, 4 },
+    { "NV4_PGRAPH_CTX_CONTROL_CHID_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_CTX_CONTROL_CHID_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_CTX_CONTROL_DEVICE", 28, 4 },
+    { "NV4_PGRAPH_CTX_CONTROL_DEVICE_DISABLED", 0x0, 4 },
+    { "NV4_PGRAPH_CTX_CONTROL_DEVICE_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_CTX_CONTROL_MINIMUM_TIME", 0, 4 },
+    { "NV4_PGRAPH_CTX_CONTROL_MINIMUM_TIME_17MS", 0x3, 4 },
+    { "NV4_PGRAPH_CTX_CONTROL_MINIMUM_TIME_262US", 0x1, 4 },
+    { "NV4_PGRAPH_CTX_CONTROL_MINIMUM_TIME_2MS", 0x2, 4 },
+    { "NV4_PGRAPH_CTX_CONTROL_MINIMUM_TIME_33US", 0x0, 4 },
+    { "NV4_PGRAPH_CTX_CONTROL_SWITCHING", 24, 4 },
+    { "NV4_PGRAPH_CTX_CONTROL_SWITCHING_BUSY", 0x1, 4 },
+    { "NV4_PGRAPH_CTX_CONTROL_SWITCHING_IDLE", 0x0, 4 },
+    { "NV4_PGRAPH_CTX_CONTROL_TIME", 8, 4 },
+    { "NV4_PGRAPH_CTX_CONTROL_TIME_EXPIRED", 0x0, 4 },
+    { "NV4_PGRAPH_CTX_CONTROL_TIME_NOT_EXPIRED", 0x1, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1", 0x400160, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_CHROMA_KEY", 12, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_CHROMA_KEY_DISABLE", 0x0, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_CHROMA_KEY_ENABLE", 0x1, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_CONTEXT_SURFACE", 25, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_CONTEXT_SURFACE_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_CONTEXT_SURFACE_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_DITHER_MODE", 20, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_DITHER_MODE_COMPATIBILITY", 0x0, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_DITHER_MODE_DITHER", 0x1, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_DITHER_MODE_MS", 0x3, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_DITHER_MODE_TRUNCATE", 0x2, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_GRCLASS", 0, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_PATCH_CONFIG_BLEND_AND", 0x2, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_PATCH_CONFIG_BLEND_PRE", 0x5, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_PATCH_CONFIG_ROP_AND", 0x1, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_PATCH_CONFIG_SRCCOPY", 0x3, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_PATCH_CONFIG_SRCCOPY_AND", 0x0, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_PATCH_CONFIG_SRCCOPY_PRE", 0x4, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_PATCH_STATUS", 24, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_PATCH_STATUS_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_PATCH_STATUS_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_SWIZZLE", 14, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_SWIZZLE_DISABLE", 0x0, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_SWIZZLE_ENABLE", 0x1, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_USER_CLIP", 13, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_USER_CLIP_DISABLE", 0x0, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_USER_CLIP_ENABLE", 0x1, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_VOLATILE_RESET", 31, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_VOLATILE_RESET_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH1_VOLATILE_RESET_IGNORE", 0x0, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2", 0x400164, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_COLOR_FORMAT_INVALID", 0x00, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_COLOR_FORMAT_LE_A16R5G6B5", 0x0B, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_COLOR_FORMAT_LE_A16Y16", 0x10, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_COLOR_FORMAT_LE_A1R5G5B5", 0x06, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_COLOR_FORMAT_LE_A8R8G8B8", 0x0D, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_COLOR_FORMAT_LE_R5G6B5", 0x0A, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_COLOR_FORMAT_LE_V8YB8U8YA8", 0x12, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_COLOR_FORMAT_LE_X16A1R5G5B5", 0x08, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_COLOR_FORMAT_LE_X16A8Y8", 0x02, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_COLOR_FORMAT_LE_X16R5G6B5", 0x0C, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_COLOR_FORMAT_LE_X16Y16", 0x11, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_COLOR_FORMAT_LE_X17R5G5B5", 0x09, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_COLOR_FORMAT_LE_X1R5G5B5", 0x07, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_COLOR_FORMAT_LE_X24Y8", 0x03, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_COLOR_FORMAT_LE_X8R8G8B8", 0x0E, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_COLOR_FORMAT_LE_Y16", 0x0F, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_COLOR_FORMAT_LE_Y32", 0x14, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_COLOR_FORMAT_LE_Y8", 0x01, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_COLOR_FORMAT_LE_YB8V8YA8U8", 0x13, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_MONO_FORMAT", 0, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_MONO_FORMAT_CGA6_M1", 0x01, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_MONO_FORMAT_INVALID", 0x00, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_MONO_FORMAT_LE_M1", 0x02, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_NOTIFY_INSTANCE", 16, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH2_NOTIFY_INSTANCE_INVALID", 0x00, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH3", 0x400168, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH3_DMA_INSTANCE_0", 0, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH3_DMA_INSTANCE_0_INVALID", 0x00, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH3_DMA_INSTANCE_1", 16, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH3_DMA_INSTANCE_1_INVALID", 0x00, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH4", 0x40016C, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH4_USER_INSTANCE", 0, 4 },
+    { "NV4_PGRAPH_CTX_SWITCH4_USER_INSTANCE_INVALID", 0x00, 4 },
+    { "NV4_PGRAPH_CTX_USER", 0x400174, 4 },
+    { "NV4_PGRAPH_CTX_USER_CHID", 24, 4 },
+    { "NV4_PGRAPH_CTX_USER_CHID_0", 0x0, 4 },
+    { "NV4_PGRAPH_CTX_USER_SUBCH", 13, 4 },
+    { "NV4_PGRAPH_CTX_USER_SUBCH_0", 0x0, 4 },
+    { "NV4_PGRAPH_D3D_M", 0x4005e0, 4 },
+    { "NV4_PGRAPH_D3D_M_VALUE", 6, 4 },
+    { "NV4_PGRAPH_D3D_RGB", 0x4005d8, 4 },
+    { "NV4_PGRAPH_D3D_RGB_VALUE", 0, 4 },
+    { "NV4_PGRAPH_D3D_S", 0x4005dc, 4 },
+    { "NV4_PGRAPH_D3D_S_VALUE", 0, 4 },
+    { "NV4_PGRAPH_D3D_U0", 0x4005c4, 4 },
+    { "NV4_PGRAPH_D3D_U0_VALUE", 6, 4 },
+    { "NV4_PGRAPH_D3D_U1", 0x4005cc, 4 },
+    { "NV4_PGRAPH_D3D_U1_VALUE", 6, 4 },
+    { "NV4_PGRAPH_D3D_V0", 0x4005c8, 4 },
+    { "NV4_PGRAPH_D3D_V0_VALUE", 6, 4 },
+    { "NV4_PGRAPH_D3D_V1", 0x4005d0, 4 },
+    { "NV4_PGRAPH_D3D_V1_VALUE", 6, 4 },
+    { "NV4_PGRAPH_D3D_XY", 0x4005c0, 4 },
+    { "NV4_PGRAPH_D3D_XY_X_VALUE", 0, 4 },
+    { "NV4_PGRAPH_D3D_XY_Y_VALUE", 16, 4 },
+    { "NV4_PGRAPH_D3D_ZETA", 0x4005d4, 4 },
+    { "NV4_PGRAPH_D3D_ZETA_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DEBUG_0", 0x400080, 4 },
+    { "NV4_PGRAPH_DEBUG_0_ALPHA_ABORT", 28, 4 },
+    { "NV4_PGRAPH_DEBUG_0_ALPHA_ABORT_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_0_BLIT_DST_LIMIT", 15, 4 },
+    { "NV4_PGRAPH_DEBUG_0_BLIT_DST_LIMIT_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_0_CACHE_STATE", 2, 4 },
+    { "NV4_PGRAPH_DEBUG_0_CACHE_STATE_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_DEBUG_0_CACHE_STATE_RESET", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_0_D3D_PIPE_STATE", 3, 4 },
+    { "NV4_PGRAPH_DEBUG_0_D3D_PIPE_STATE_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_DEBUG_0_D3D_PIPE_STATE_RESET", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_0_DMA_STATE", 8, 4 },
+    { "NV4_PGRAPH_DEBUG_0_DMA_STATE_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_DEBUG_0_DMA_STATE_RESET", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_0_DRAWDIR_AUTO", 24, 4 },
+    { "NV4_PGRAPH_DEBUG_0_DRAWDIR_AUTO_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_0_DRAWDIR_Y", 25, 4 },
+    { "NV4_PGRAPH_DEBUG_0_DRAWDIR_Y_DECR", 0x0, 4 },
+    { "NV4_PGRAPH_DEBUG_0_DRAWDIR_Y_INCR", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_0_FE_STATE", 1, 4 },
+    { "NV4_PGRAPH_DEBUG_0_FE_STATE_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_DEBUG_0_FE_STATE_RESET", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_0_LIGHT_STATE", 7, 4 },
+    { "NV4_PGRAPH_DEBUG_0_LIGHT_STATE_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_DEBUG_0_LIGHT_STATE_RESET", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_0_LIMIT_CHECK", 16, 4 },
+    { "NV4_PGRAPH_DEBUG_0_LIMIT_CHECK_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_0_LIMIT_INT", 17, 4 },
+    { "NV4_PGRAPH_DEBUG_0_LIMIT_INT_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_0_MINUSD5", 14, 4 },
+    { "NV4_PGRAPH_DEBUG_0_MINUSD5_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_0_OVRFLW_INT", 18, 4 },
+    { "NV4_PGRAPH_DEBUG_0_OVRFLW_INT_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_0_PREROP_STATE", 4, 4 },
+    { "NV4_PGRAPH_DEBUG_0_PREROP_STATE_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_DEBUG_0_PREROP_STATE_RESET", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_0_ROP_STATE", 5, 4 },
+    { "NV4_PGRAPH_DEBUG_0_ROP_STATE_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_DEBUG_0_ROP_STATE_RESET", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_0_RSTR_STATE", 6, 4 },
+    { "NV4_PGRAPH_DEBUG_0_RSTR_STATE_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_DEBUG_0_RSTR_STATE_RESET", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_0_SPARE1", 12, 4 },
+    { "NV4_PGRAPH_DEBUG_0_SPARE2", 13, 4 },
+    { "NV4_PGRAPH_DEBUG_0_STATE", 0, 4 },
+    { "NV4_PGRAPH_DEBUG_0_STATE_NORMAL", 0x0, 4 },
+    { "NV4_PGRAPH_DEBUG_0_STATE_RESET", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_0_WRITE_ONLY_ROPS_2D", 20, 4 },
+    { "NV4_PGRAPH_DEBUG_0_WRITE_ONLY_ROPS_2D_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_0_WRITE_ONLY_ROPS_3D", 21, 4 },
+    { "NV4_PGRAPH_DEBUG_0_WRITE_ONLY_ROPS_3D_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_1", 0x400084, 4 },
+    { "NV4_PGRAPH_DEBUG_1_ALOM_BURST", 17, 4 },
+    { "NV4_PGRAPH_DEBUG_1_ALOM_BURST_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_1_ALT_RW_SEQ", 10, 4 },
+    { "NV4_PGRAPH_DEBUG_1_ALT_RW_SEQ_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_1_BIDIR_DRAIN", 18, 4 },
+    { "NV4_PGRAPH_DEBUG_1_BIDIR_DRAIN_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_1_CACHE", 24, 4 },
+    { "NV4_PGRAPH_DEBUG_1_CACHE_FLUSH", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_1_CACHE_IGNORE", 0x0, 4 },
+    { "NV4_PGRAPH_DEBUG_1_CACHE_MODE", 25, 4 },
+    { "NV4_PGRAPH_DEBUG_1_CACHE_MODE_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_1_CTX", 20, 4 },
+    { "NV4_PGRAPH_DEBUG_1_CTX_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_1_DITHER_RANGE_ADJ_2D", 22, 4 },
+    { "NV4_PGRAPH_DEBUG_1_DITHER_RANGE_ADJ_2D_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_1_DITHER_RANGE_ADJ_3D", 23, 4 },
+    { "NV4_PGRAPH_DEBUG_1_DITHER_RANGE_ADJ_3D_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_1_DMA_ACTIVITY", 4, 4 },
+    { "NV4_PGRAPH_DEBUG_1_DMA_ACTIVITY_CANCEL", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_1_DMA_ACTIVITY_IGNORE", 0x0, 4 },
+    { "NV4_PGRAPH_DEBUG_1_DX6_2PIXMODE", 31, 4 },
+    { "NV4_PGRAPH_DEBUG_1_DX6_2PIXMODE_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_1_EARLY_POST", 19, 4 },
+    { "NV4_PGRAPH_DEBUG_1_EARLY_POST_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_1_FIXED_ADRS", 21, 4 },
+    { "NV4_PGRAPH_DEBUG_1_FIXED_ADRS_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_1_INSTANCE", 16, 4 },
+    { "NV4_PGRAPH_DEBUG_1_INSTANCE_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_1_PATCH_INV", 8, 4 },
+    { "NV4_PGRAPH_DEBUG_1_PATCH_INV_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_1_RCLAMP", 30, 4 },
+    { "NV4_PGRAPH_DEBUG_1_RCLAMP_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_1_TRICLIP_OPTS", 13, 4 },
+    { "NV4_PGRAPH_DEBUG_1_TRICLIP_OPTS_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_1_TRI_OPTS", 12, 4 },
+    { "NV4_PGRAPH_DEBUG_1_TRI_OPTS_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_1_UCLAMP", 29, 4 },
+    { "NV4_PGRAPH_DEBUG_1_UCLAMP_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_1_VOLATILE_RESET", 0, 4 },
+    { "NV4_PGRAPH_DEBUG_1_VOLATILE_RESET_LAST", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_1_VOLATILE_RESET_NOT_LAST", 0x0, 4 },
+    { "NV4_PGRAPH_DEBUG_1_ZCLAMP", 28, 4 },
+    { "NV4_PGRAPH_DEBUG_1_ZCLAMP_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_2", 0x400088, 4 },
+    { "NV4_PGRAPH_DEBUG_2_ALPHA_3D", 16, 4 },
+    { "NV4_PGRAPH_DEBUG_2_ALPHA_3D_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_2_ANISOTROPIC_3D", 13, 4 },
+    { "NV4_PGRAPH_DEBUG_2_ANISOTROPIC_3D_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_2_BILINEAR_3D", 12, 4 },
+    { "NV4_PGRAPH_DEBUG_2_BILINEAR_3D_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_2_BLIT_MULTILINE", 24, 4 },
+    { "NV4_PGRAPH_DEBUG_2_BLIT_MULTILINE_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_2_COELESCE_2D", 22, 4 },
+    { "NV4_PGRAPH_DEBUG_2_COELESCE_2D_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_2_COELESCE_D3D", 20, 4 },
+    { "NV4_PGRAPH_DEBUG_2_COELESCE_D3D_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_2_FAST_VERTEX_LOAD", 23, 4 },
+    { "NV4_PGRAPH_DEBUG_2_FAST_VERTEX_LOAD_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_2_FOG_3D", 14, 4 },
+    { "NV4_PGRAPH_DEBUG_2_FOG_3D_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_2_HONOR_SRCFMT", 0, 4 },
+    { "NV4_PGRAPH_DEBUG_2_HONOR_SRCFMT_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_2_MCLK_RECTS", 11, 4 },
+    { "NV4_PGRAPH_DEBUG_2_MCLK_RECTS_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_2_PINGPONG", 0, 4 },
+    { "NV4_PGRAPH_DEBUG_2_PINGPONG_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_2_SPARE1", 4, 4 },
+    { "NV4_PGRAPH_DEBUG_2_SPARE2", 5, 4 },
+    { "NV4_PGRAPH_DEBUG_2_SPARE3", 6, 4 },
+    { "NV4_PGRAPH_DEBUG_2_SPARE4", 7, 4 },
+    { "NV4_PGRAPH_DEBUG_2_SPARE5", 8, 4 },
+    { "NV4_PGRAPH_DEBUG_2_SPARE6", 9, 4 },
+    { "NV4_PGRAPH_DEBUG_2_SPARE7", 10, 4 },
+    { "NV4_PGRAPH_DEBUG_2_SPECULAR_3D", 15, 4 },
+    { "NV4_PGRAPH_DEBUG_2_SPECULAR_3D_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_2_VOLATILE_RESET", 28, 4 },
+    { "NV4_PGRAPH_DEBUG_2_VOLATILE_RESET_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_2_ZBUF_SEQ", 17, 4 },
+    { "NV4_PGRAPH_DEBUG_2_ZBUF_SEQ_AUTO", 0x2, 4 },
+    { "NV4_PGRAPH_DEBUG_2_ZBUF_SEQ_CRZRWCW", 0x0, 4 },
+    { "NV4_PGRAPH_DEBUG_2_ZBUF_SEQ_ZRWCRW", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3", 0x40008C, 4 },
+    { "NV4_PGRAPH_DEBUG_3_AUTOZFLUSH_D3D", 9, 4 },
+    { "NV4_PGRAPH_DEBUG_3_AUTOZFLUSH_D3D_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_AUTOZFLUSH_PTZ", 8, 4 },
+    { "NV4_PGRAPH_DEBUG_3_AUTOZFLUSH_PTZ_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_CLIP_METHODS", 25, 4 },
+    { "NV4_PGRAPH_DEBUG_3_CLIP_METHODS_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_CONTEXT_METHODS", 29, 4 },
+    { "NV4_PGRAPH_DEBUG_3_CONTEXT_METHODS_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_CULLING", 0, 4 },
+    { "NV4_PGRAPH_DEBUG_3_CULLING_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_CULLING_TYPE", 1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_CULLING_TYPE_DX3", 0x0, 4 },
+    { "NV4_PGRAPH_DEBUG_3_CULLING_TYPE_DX5", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_DATA_CHECK", 20, 4 },
+    { "NV4_PGRAPH_DEBUG_3_DATA_CHECK_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_DATA_CHECK_FAIL", 21, 4 },
+    { "NV4_PGRAPH_DEBUG_3_DATA_CHECK_FAIL_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_DMA_CHECK", 23, 4 },
+    { "NV4_PGRAPH_DEBUG_3_DMA_CHECK_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_EARLYZ_ABORT", 18, 4 },
+    { "NV4_PGRAPH_DEBUG_3_EARLYZ_ABORT_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_EXCLUDE_ROP_IN_IDLE", 27, 4 },
+    { "NV4_PGRAPH_DEBUG_3_EXCLUDE_ROP_IN_IDLE_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_FAST_DATA_D3D", 5, 4 },
+    { "NV4_PGRAPH_DEBUG_3_FAST_DATA_D3D_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_FAST_DATA_IMAGE", 6, 4 },
+    { "NV4_PGRAPH_DEBUG_3_FAST_DATA_IMAGE_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_FAST_DATA_STRTCH", 4, 4 },
+    { "NV4_PGRAPH_DEBUG_3_FAST_DATA_STRTCH_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_FORCE_CREAD", 16, 4 },
+    { "NV4_PGRAPH_DEBUG_3_FORCE_CREAD_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_FORCE_ZREAD", 17, 4 },
+    { "NV4_PGRAPH_DEBUG_3_FORCE_ZREAD_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_FORMAT_CHECK", 22, 4 },
+    { "NV4_PGRAPH_DEBUG_3_FORMAT_CHECK_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_IGNORE_PATCHVALID", 31, 4 },
+    { "NV4_PGRAPH_DEBUG_3_IGNORE_PATCHVALID_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_OPERATION_METHOD", 30, 4 },
+    { "NV4_PGRAPH_DEBUG_3_OPERATION_METHOD_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_POSTDITHER_2D", 12, 4 },
+    { "NV4_PGRAPH_DEBUG_3_POSTDITHER_2D_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_POSTDITHER_3D", 13, 4 },
+    { "NV4_PGRAPH_DEBUG_3_POSTDITHER_3D_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_PREDITHER_2D", 14, 4 },
+    { "NV4_PGRAPH_DEBUG_3_PREDITHER_2D_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_PREDITHER_3D", 15, 4 },
+    { "NV4_PGRAPH_DEBUG_3_PREDITHER_3D_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_RAMREADBACK", 24, 4 },
+    { "NV4_PGRAPH_DEBUG_3_RAMREADBACK_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_SLOT_CONFLICT_D3D", 11, 4 },
+    { "NV4_PGRAPH_DEBUG_3_SLOT_CONFLICT_D3D_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_SLOT_CONFLICT_PTZ", 10, 4 },
+    { "NV4_PGRAPH_DEBUG_3_SLOT_CONFLICT_PTZ_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_STATE_CHECK", 28, 4 },
+    { "NV4_PGRAPH_DEBUG_3_STATE_CHECK_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_TRIEND_FLUSH", 19, 4 },
+    { "NV4_PGRAPH_DEBUG_3_TRIEND_FLUSH_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_ZFLUSH", 7, 4 },
+    { "NV4_PGRAPH_DEBUG_3_ZFLUSH_ACTIVATE", 0x1, 4 },
+    { "NV4_PGRAPH_DEBUG_3_ZFLUSH_IGNORE", 0x0, 4 },
+    { "NV4_PGRAPH_DMA_A_ADJ_OFFSET", 0x401054, 4 },
+    { "NV4_PGRAPH_DMA_A_ADJ_OFFSET_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DMA_A_CONTROL", 0x401044, 4 },
+    { "NV4_PGRAPH_DMA_A_CONTROL_ADJUST", 20, 4 },
+    { "NV4_PGRAPH_DMA_A_CONTROL_PAGE_ENTRY", 13, 4 },
+    { "NV4_PGRAPH_DMA_A_CONTROL_PAGE_ENTRY_LINEAR", 0x1, 4 },
+    { "NV4_PGRAPH_DMA_A_CONTROL_PAGE_ENTRY_NOT_LINEAR", 0x0, 4 },
+    { "NV4_PGRAPH_DMA_A_CONTROL_PAGE_TABLE", 12, 4 },
+    { "NV4_PGRAPH_DMA_A_CONTROL_PAGE_TABLE_NOT_PRESENT", 0x0, 4 },
+    { "NV4_PGRAPH_DMA_A_CONTROL_PAGE_TABLE_PRESENT", 0x1, 4 },
+    { "NV4_PGRAPH_DMA_A_CONTROL_TARGET_NODE", 16, 4 },
+    { "NV4_PGRAPH_DMA_A_CONTROL_TARGET_NODE_AGP", 0x3, 4 },
+    { "NV4_PGRAPH_DMA_A_CONTROL_TARGET_NODE_NVM", 0x0, 4 },
+    { "NV4_PGRAPH_DMA_A_CONTROL_TARGET_NODE_PCI", 0x2, 4 },
+    { "NV4_PGRAPH_DMA_A_LIMIT", 0x401048, 4 },
+    { "NV4_PGRAPH_DMA_A_LIMIT_OFFSET", 0, 4 },
+    { "NV4_PGRAPH_DMA_A_OFFSET", 0x401058, 4 },
+    { "NV4_PGRAPH_DMA_A_OFFSET_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DMA_A_SIZE", 0x40105C, 4 },
+    { "NV4_PGRAPH_DMA_A_SIZE_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DMA_A_TLB_PTE", 0x40104C, 4 },
+    { "NV4_PGRAPH_DMA_A_TLB_PTE_ACCESS", 1, 4 },
+    { "NV4_PGRAPH_DMA_A_TLB_PTE_ACCESS_READ_ONLY", 0x0, 4 },
+    { "NV4_PGRAPH_DMA_A_TLB_PTE_ACCESS_READ_WRITE", 0x1, 4 },
+    { "NV4_PGRAPH_DMA_A_TLB_PTE_FRAME_ADDRESS", 12, 4 },
+    { "NV4_PGRAPH_DMA_A_TLB_TAG", 0x401050, 4 },
+    { "NV4_PGRAPH_DMA_A_TLB_TAG_ADDRESS", 12, 4 },
+    { "NV4_PGRAPH_DMA_A_XLATE_INST", 0x401040, 4 },
+    { "NV4_PGRAPH_DMA_A_XLATE_INST_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DMA_A_Y_SIZE", 0x401060, 4 },
+    { "NV4_PGRAPH_DMA_A_Y_SIZE_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DMA_B_ADJ_OFFSET", 0x401094, 4 },
+    { "NV4_PGRAPH_DMA_B_ADJ_OFFSET_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DMA_B_CONTROL", 0x401084, 4 },
+    { "NV4_PGRAPH_DMA_B_CONTROL_ADJUST", 20, 4 },
+    { "NV4_PGRAPH_DMA_B_CONTROL_PAGE_ENTRY", 13, 4 },
+    { "NV4_PGRAPH_DMA_B_CONTROL_PAGE_ENTRY_LINEAR", 0x1, 4 },
+    { "NV4_PGRAPH_DMA_B_CONTROL_PAGE_ENTRY_NOT_LINEAR", 0x0, 4 },
+    { "NV4_PGRAPH_DMA_B_CONTROL_PAGE_TABLE", 12, 4 },
+    { "NV4_PGRAPH_DMA_B_CONTROL_PAGE_TABLE_NOT_PRESENT", 0x0, 4 },
+    { "NV4_PGRAPH_DMA_B_CONTROL_PAGE_TABLE_PRESENT", 0x1, 4 },
+    { "NV4_PGRAPH_DMA_B_CONTROL_TARGET_NODE", 16, 4 },
+    { "NV4_PGRAPH_DMA_B_CONTROL_TARGET_NODE_AGP", 0x3, 4 },
+    { "NV4_PGRAPH_DMA_B_CONTROL_TARGET_NODE_NVM", 0x0, 4 },
+    { "NV4_PGRAPH_DMA_B_CONTROL_TARGET_NODE_PCI", 0x2, 4 },
+    { "NV4_PGRAPH_DMA_B_LIMIT", 0x401088, 4 },
+    { "NV4_PGRAPH_DMA_B_LIMIT_OFFSET", 0, 4 },
+    { "NV4_PGRAPH_DMA_B_OFFSET", 0x401098, 4 },
+    { "NV4_PGRAPH_DMA_B_OFFSET_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DMA_B_SIZE", 0x40109C, 4 },
+    { "NV4_PGRAPH_DMA_B_SIZE_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DMA_B_TLB_PTE", 0x40108C, 4 },
+    { "NV4_PGRAPH_DMA_B_TLB_PTE_ACCESS", 1, 4 },
+    { "NV4_PGRAPH_DMA_B_TLB_PTE_ACCESS_READ_ONLY", 0x0, 4 },
+    { "NV4_PGRAPH_DMA_B_TLB_PTE_ACCESS_READ_WRITE", 0x1, 4 },
+    { "NV4_PGRAPH_DMA_B_TLB_PTE_FRAME_ADDRESS", 12, 4 },
+    { "NV4_PGRAPH_DMA_B_TLB_TAG", 0x401090, 4 },
+    { "NV4_PGRAPH_DMA_B_TLB_TAG_ADDRESS", 12, 4 },
+    { "NV4_PGRAPH_DMA_B_XLATE_INST", 0x401080, 4 },
+    { "NV4_PGRAPH_DMA_B_XLATE_INST_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DMA_B_Y_SIZE", 0x4010A0, 4 },
+    { "NV4_PGRAPH_DMA_B_Y_SIZE_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DMA_DATA_0", 0x401020, 4 },
+    { "NV4_PGRAPH_DMA_DATA_0_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DMA_DATA_1", 0x401024, 4 },
+    { "NV4_PGRAPH_DMA_DATA_1_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DMA_LENGTH", 0x401008, 4 },
+    { "NV4_PGRAPH_DMA_LENGTH_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DMA_MISC", 0x40100C, 4 },
+    { "NV4_PGRAPH_DMA_MISC_COUNT", 0, 4 },
+    { "NV4_PGRAPH_DMA_MISC_FMT_DST", 20, 4 },
+    { "NV4_PGRAPH_DMA_MISC_FMT_SRC", 16, 4 },
+    { "NV4_PGRAPH_DMA_PITCH", 0x400760, 4 },
+    { "NV4_PGRAPH_DMA_PITCH_S0", 0, 4 },
+    { "NV4_PGRAPH_DMA_PITCH_S1", 16, 4 },
+    { "NV4_PGRAPH_DMA_RM", 0x401030, 4 },
+    { "NV4_PGRAPH_DMA_RM_ASSIST_A", 0, 4 },
+    { "NV4_PGRAPH_DMA_RM_ASSIST_A_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_DMA_RM_ASSIST_A_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_DMA_RM_ASSIST_A_RESET", 0x1, 4 },
+    { "NV4_PGRAPH_DMA_RM_ASSIST_B", 1, 4 },
+    { "NV4_PGRAPH_DMA_RM_ASSIST_B_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_DMA_RM_ASSIST_B_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_DMA_RM_ASSIST_B_RESET", 0x1, 4 },
+    { "NV4_PGRAPH_DMA_RM_WRITE_REQ", 4, 4 },
+    { "NV4_PGRAPH_DMA_RM_WRITE_REQ_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_DMA_RM_WRITE_REQ_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_DMA_START_0", 0x401000, 4 },
+    { "NV4_PGRAPH_DMA_START_0_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DMA_START_1", 0x401004, 4 },
+    { "NV4_PGRAPH_DMA_START_1_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DPRAM_ADRS_0", 0x40082c, 4 },
+    { "NV4_PGRAPH_DPRAM_ADRS_0_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DPRAM_ADRS_1", 0x40082c, 4 },
+    { "NV4_PGRAPH_DPRAM_ADRS_1_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DPRAM_ALPHA_0", 0x40082c, 4 },
+    { "NV4_PGRAPH_DPRAM_ALPHA_0_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DPRAM_ALPHA_1", 0x40082c, 4 },
+    { "NV4_PGRAPH_DPRAM_ALPHA_1_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DPRAM_DATA", 0x40082c, 4 },
+    { "NV4_PGRAPH_DPRAM_DATA_0", 0x40082c, 4 },
+    { "NV4_PGRAPH_DPRAM_DATA_0_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DPRAM_DATA_1", 0x40082c, 4 },
+    { "NV4_PGRAPH_DPRAM_DATA_1_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DPRAM_DATA_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DPRAM_INDEX", 0x400828, 4 },
+    { "NV4_PGRAPH_DPRAM_INDEX_ADRS", 0, 4 },
+    { "NV4_PGRAPH_DPRAM_INDEX_ADRS_0", 0x0, 4 },
+    { "NV4_PGRAPH_DPRAM_INDEX_SELECT", 8, 4 },
+    { "NV4_PGRAPH_DPRAM_INDEX_SELECT_ADRS_0", 0x0, 4 },
+    { "NV4_PGRAPH_DPRAM_INDEX_SELECT_ADRS_1", 0x1, 4 },
+    { "NV4_PGRAPH_DPRAM_INDEX_SELECT_ALPHA_0", 0x6, 4 },
+    { "NV4_PGRAPH_DPRAM_INDEX_SELECT_ALPHA_1", 0x7, 4 },
+    { "NV4_PGRAPH_DPRAM_INDEX_SELECT_DATA_0", 0x2, 4 },
+    { "NV4_PGRAPH_DPRAM_INDEX_SELECT_DATA_1", 0x3, 4 },
+    { "NV4_PGRAPH_DPRAM_INDEX_SELECT_WE_0", 0x4, 4 },
+    { "NV4_PGRAPH_DPRAM_INDEX_SELECT_WE_1", 0x5, 4 },
+    { "NV4_PGRAPH_DPRAM_WE_0", 0x40082c, 4 },
+    { "NV4_PGRAPH_DPRAM_WE_0_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DPRAM_WE_1", 0x40082c, 4 },
+    { "NV4_PGRAPH_DPRAM_WE_1_VALUE", 0, 4 },
+    { "NV4_PGRAPH_DVD_COLORFMT", 0x400764, 4 },
+    { "NV4_PGRAPH_DVD_COLORFMT_IMAGE", 0, 4 },
+    { "NV4_PGRAPH_DVD_COLORFMT_IMAGE_FORMAT_INVALID", 0x00, 4 },
+    { "NV4_PGRAPH_DVD_COLORFMT_IMAGE_FORMAT_LE_V8YB8U8YA8", 0x12, 4 },
+    { "NV4_PGRAPH_DVD_COLORFMT_IMAGE_FORMAT_LE_YB8V8YA8U8", 0x13, 4 },
+    { "NV4_PGRAPH_DVD_COLORFMT_OVLY", 8, 4 },
+    { "NV4_PGRAPH_DVD_COLORFMT_OVLY_FORMAT_INVALID", 0x00, 4 },
+    { "NV4_PGRAPH_DVD_COLORFMT_OVLY_FORMAT_LE_A4V6YB6A4U6YA6", 0x02, 4 },
+    { "NV4_PGRAPH_DVD_COLORFMT_OVLY_FORMAT_LE_A8Y8U8V8", 0x01, 4 },
+    { "NV4_PGRAPH_DVD_COLORFMT_OVLY_FORMAT_TRANSPARENT", 0x03, 4 },
+    { "NV4_PGRAPH_END", 0x401FFF, 4 },
+    { "NV4_PGRAPH_FFINTFC_FIFO_0_MTHD", 4, 4 },
+    { "NV4_PGRAPH_FFINTFC_FIFO_0_MTHD_CTX_SWITCH", 0x0, 4 },
+    { "NV4_PGRAPH_FFINTFC_FIFO_0_SIZE_1", 4, 4 },
+    { "NV4_PGRAPH_FFINTFC_FIFO_0_SUBCH", 1, 4 },
+    { "NV4_PGRAPH_FFINTFC_FIFO_0_TAG", 0, 4 },
+    { "NV4_PGRAPH_FFINTFC_FIFO_0_TAG_CHSW", 0x1, 4 },
+    { "NV4_PGRAPH_FFINTFC_FIFO_0_TAG_MTHD", 0x0, 4 },
+    { "NV4_PGRAPH_FFINTFC_FIFO_1_ARGUMENT", 0, 4 },
+    { "NV4_PGRAPH_FFINTFC_FIFO_1_SIZE_1", 4, 4 },
+    { "NV4_PGRAPH_FFINTFC_FIFO_PTR", 0x400750, 4 },
+    { "NV4_PGRAPH_FFINTFC_FIFO_PTR_READ", 4, 4 },
+    { "NV4_PGRAPH_FFINTFC_FIFO_PTR_READ_0", 0x0, 4 },
+    { "NV4_PGRAPH_FFINTFC_FIFO_PTR_WRITE", 0, 4 },
+    { "NV4_PGRAPH_FFINTFC_FIFO_PTR_WRITE_0", 0x0, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2", 0x400754, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CHID", 15, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CHID_0", 0x0, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CHID_1", 0x1, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CHID_10", 0xA, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CHID_11", 0xB, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CHID_12", 0xC, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CHID_13", 0xD, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CHID_14", 0xE, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CHID_15", 0xF, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CHID_2", 0x2, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CHID_3", 0x3, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CHID_4", 0x4, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CHID_5", 0x5, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CHID_6", 0x6, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CHID_7", 0x7, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CHID_8", 0x8, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CHID_9", 0x9, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CHID_STATUS", 19, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CHID_STATUS_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CHID_STATUS_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CH_SWITCH_DETECT", 20, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CH_SWITCH_DETECT_CLEAR", 0x0, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_CH_SWITCH_DETECT_SET", 0x1, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_D", 0x400758, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_D_ARGUMENT", 0, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_D_ARGUMENT_0", 0x0, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_FIFO_HOLD", 21, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_FIFO_HOLD_CLEAR", 0x0, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_FIFO_HOLD_SET", 0x1, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_MTHD", 1, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_MTHD_CTX_SWITCH", 0x0, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_STATUS", 0, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_STATUS_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_STATUS_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_SUBCH", 12, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_SUBCH_0", 0x0, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_SUBCH_1", 0x1, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_SUBCH_2", 0x2, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_SUBCH_3", 0x3, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_SUBCH_4", 0x4, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_SUBCH_5", 0x5, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_SUBCH_6", 0x6, 4 },
+    { "NV4_PGRAPH_FFINTFC_ST2_SUBCH_7", 0x7, 4 },
+    { "NV4_PGRAPH_FIFO", 0x400720, 4 },
+    { "NV4_PGRAPH_FIFO_ACCESS", 0, 4 },
+    { "NV4_PGRAPH_FIFO_ACCESS_DISABLED", 0x0, 4 },
+    { "NV4_PGRAPH_FIFO_ACCESS_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_FILTER0", 0x4005B0, 4 },
+    { "NV4_PGRAPH_FILTER0_ANISOTROPIC_MAG_ENABLE", 31, 4 },
+    { "NV4_PGRAPH_FILTER0_ANISOTROPIC_MAG_ENABLE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_FILTER0_ANISOTROPIC_MIN_ENABLE", 27, 4 },
+    { "NV4_PGRAPH_FILTER0_ANISOTROPIC_MIN_ENABLE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_FILTER0_KERNEL_SIZE_X", 1, 4 },
+    { "NV4_PGRAPH_FILTER0_KERNEL_SIZE_Y", 9, 4 },
+    { "NV4_PGRAPH_FILTER0_MIPMAPLODBIAS", 16, 4 },
+    { "NV4_PGRAPH_FILTER0_MIPMAP_DITHER_ENABLE", 15, 4 },
+    { "NV4_PGRAPH_FILTER0_MIPMAP_DITHER_ENABLE_FALSE", 0x0, 4 },
+    { "NV4_PGRAPH_FILTER0_MIPMAP_DITHER_ENABLE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_FILTER0_TEXTUREMAG", 28, 4 },
+    { "NV4_PGRAPH_FILTER0_TEXTUREMAG_LINEAR", 0x2, 4 },
+    { "NV4_PGRAPH_FILTER0_TEXTUREMAG_LINEARMIPLINEAR", 0x6, 4 },
+    { "NV4_PGRAPH_FILTER0_TEXTUREMAG_LINEARMIPNEAREST", 0x5, 4 },
+    { "NV4_PGRAPH_FILTER0_TEXTUREMAG_MIPLINEAR", 0x4, 4 },
+    { "NV4_PGRAPH_FILTER0_TEXTUREMAG_MIPNEAREST", 0x3, 4 },
+    { "NV4_PGRAPH_FILTER0_TEXTUREMAG_NEAREST", 0x1, 4 },
+    { "NV4_PGRAPH_FILTER0_TEXTUREMIN", 24, 4 },
+    { "NV4_PGRAPH_FILTER0_TEXTUREMIN_LINEAR", 0x2, 4 },
+    { "NV4_PGRAPH_FILTER0_TEXTUREMIN_LINEARMIPLINEAR", 0x6, 4 },
+    { "NV4_PGRAPH_FILTER0_TEXTUREMIN_LINEARMIPNEAREST", 0x5, 4 },
+    { "NV4_PGRAPH_FILTER0_TEXTUREMIN_MIPLINEAR", 0x4, 4 },
+    { "NV4_PGRAPH_FILTER0_TEXTUREMIN_MIPNEAREST", 0x3, 4 },
+    { "NV4_PGRAPH_FILTER0_TEXTUREMIN_NEAREST", 0x1, 4 },
+    { "NV4_PGRAPH_FILTER1", 0x4005B4, 4 },
+    { "NV4_PGRAPH_FILTER1_ANISOTROPIC_MAG_ENABLE", 31, 4 },
+    { "NV4_PGRAPH_FILTER1_ANISOTROPIC_MAG_ENABLE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_FILTER1_ANISOTROPIC_MIN_ENABLE", 27, 4 },
+    { "NV4_PGRAPH_FILTER1_ANISOTROPIC_MIN_ENABLE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_FILTER1_KERNEL_SIZE_X", 1, 4 },
+    { "NV4_PGRAPH_FILTER1_KERNEL_SIZE_Y", 9, 4 },
+    { "NV4_PGRAPH_FILTER1_MIPMAPLODBIAS", 16, 4 },
+    { "NV4_PGRAPH_FILTER1_MIPMAP_DITHER_ENABLE", 15, 4 },
+    { "NV4_PGRAPH_FILTER1_MIPMAP_DITHER_ENABLE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_FILTER1_TEXTUREMAG", 28, 4 },
+    { "NV4_PGRAPH_FILTER1_TEXTUREMAG_LINEAR", 0x2, 4 },
+    { "NV4_PGRAPH_FILTER1_TEXTUREMAG_LINEARMIPLINEAR", 0x6, 4 },
+    { "NV4_PGRAPH_FILTER1_TEXTUREMAG_LINEARMIPNEAREST", 0x5, 4 },
+    { "NV4_PGRAPH_FILTER1_TEXTUREMAG_MIPLINEAR", 0x4, 4 },
+    { "NV4_PGRAPH_FILTER1_TEXTUREMAG_MIPNEAREST", 0x3, 4 },
+    { "NV4_PGRAPH_FILTER1_TEXTUREMAG_NEAREST", 0x1, 4 },
+    { "NV4_PGRAPH_FILTER1_TEXTUREMIN", 24, 4 },
+    { "NV4_PGRAPH_FILTER1_TEXTUREMIN_LINEAR", 0x2, 4 },
+    { "NV4_PGRAPH_FILTER1_TEXTUREMIN_LINEARMIPLINEAR", 0x6, 4 },
+    { "NV4_PGRAPH_FILTER1_TEXTUREMIN_LINEARMIPNEAREST", 0x5, 4 },
+    { "NV4_PGRAPH_FILTER1_TEXTUREMIN_MIPLINEAR", 0x4, 4 },
+    { "NV4_PGRAPH_FILTER1_TEXTUREMIN_MIPNEAREST", 0x3, 4 },
+    { "NV4_PGRAPH_FILTER1_TEXTUREMIN_NEAREST", 0x1, 4 },
+    { "NV4_PGRAPH_FORMAT0", 0x4005A8, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_U", 16, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_U_1", 0x0, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_U_1024", 0xA, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_U_128", 0x7, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_U_16", 0x4, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_U_2", 0x1, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_U_2048", 0xB, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_U_256", 0x8, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_U_32", 0x5, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_U_4", 0x2, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_U_512", 0x9, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_U_64", 0x6, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_U_8", 0x3, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_V", 20, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_V_1", 0x0, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_V_1024", 0xA, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_V_128", 0x7, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_V_16", 0x4, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_V_2", 0x1, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_V_2048", 0xB, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_V_256", 0x8, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_V_32", 0x5, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_V_4", 0x2, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_V_512", 0x9, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_V_64", 0x6, 4 },
+    { "NV4_PGRAPH_FORMAT0_BASE_SIZE_V_8", 0x3, 4 },
+    { "NV4_PGRAPH_FORMAT0_COLOR", 8, 4 },
+    { "NV4_PGRAPH_FORMAT0_COLORKEYENABLE", 2, 4 },
+    { "NV4_PGRAPH_FORMAT0_COLORKEYENABLE_FALSE", 0x0, 4 },
+    { "NV4_PGRAPH_FORMAT0_COLORKEYENABLE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_FORMAT0_COLOR_LE_A1R5G5B5", 0x2, 4 },
+    { "NV4_PGRAPH_FORMAT0_COLOR_LE_A4R4G4B4", 0x4, 4 },
+    { "NV4_PGRAPH_FORMAT0_COLOR_LE_A8R8G8B8", 0x6, 4 },
+    { "NV4_PGRAPH_FORMAT0_COLOR_LE_AY8", 0x1, 4 },
+    { "NV4_PGRAPH_FORMAT0_COLOR_LE_R5G6B5", 0x5, 4 },
+    { "NV4_PGRAPH_FORMAT0_COLOR_LE_X1R5G5B5", 0x3, 4 },
+    { "NV4_PGRAPH_FORMAT0_COLOR_LE_X8R8G8B8", 0x7, 4 },
+    { "NV4_PGRAPH_FORMAT0_COLOR_LE_Y8", 0x0, 4 },
+    { "NV4_PGRAPH_FORMAT0_CONTEXT_DMA", 1, 4 },
+    { "NV4_PGRAPH_FORMAT0_CONTEXT_DMA_A", 0x0, 4 },
+    { "NV4_PGRAPH_FORMAT0_CONTEXT_DMA_B", 0x1, 4 },
+    { "NV4_PGRAPH_FORMAT0_MIPMAP_LEVELS", 12, 4 },
+    { "NV4_PGRAPH_FORMAT0_MIPMAP_LEVELS_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_FORMAT0_ORIGIN_FOH", 7, 4 },
+    { "NV4_PGRAPH_FORMAT0_ORIGIN_FOH_CENTER", 0x0, 4 },
+    { "NV4_PGRAPH_FORMAT0_ORIGIN_FOH_CORNER", 0x1, 4 },
+    { "NV4_PGRAPH_FORMAT0_ORIGIN_ZOH", 5, 4 },
+    { "NV4_PGRAPH_FORMAT0_ORIGIN_ZOH_CENTER", 0x0, 4 },
+    { "NV4_PGRAPH_FORMAT0_ORIGIN_ZOH_CORNER", 0x1, 4 },
+    { "NV4_PGRAPH_FORMAT0_TEXTUREADDRESSU", 24, 4 },
+    { "NV4_PGRAPH_FORMAT0_TEXTUREADDRESSU_BORDER", 0x4, 4 },
+    { "NV4_PGRAPH_FORMAT0_TEXTUREADDRESSU_CLAMP", 0x3, 4 },
+    { "NV4_PGRAPH_FORMAT0_TEXTUREADDRESSU_MIRROR", 0x2, 4 },
+    { "NV4_PGRAPH_FORMAT0_TEXTUREADDRESSU_WRAP", 0x1, 4 },
+    { "NV4_PGRAPH_FORMAT0_TEXTUREADDRESSV", 28, 4 },
+    { "NV4_PGRAPH_FORMAT0_TEXTUREADDRESSV_BORDER", 0x4, 4 },
+    { "NV4_PGRAPH_FORMAT0_TEXTUREADDRESSV_CLAMP", 0x3, 4 },
+    { "NV4_PGRAPH_FORMAT0_TEXTUREADDRESSV_MIRROR", 0x2, 4 },
+    { "NV4_PGRAPH_FORMAT0_TEXTUREADDRESSV_WRAP", 0x1, 4 },
+    { "NV4_PGRAPH_FORMAT0_WRAPU", 27, 4 },
+    { "NV4_PGRAPH_FORMAT0_WRAPU_FALSE", 0x0, 4 },
+    { "NV4_PGRAPH_FORMAT0_WRAPU_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_FORMAT0_WRAPV", 31, 4 },
+    { "NV4_PGRAPH_FORMAT0_WRAPV_FALSE", 0x0, 4 },
+    { "NV4_PGRAPH_FORMAT0_WRAPV_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_FORMAT1", 0x4005AC, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_U", 16, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_U_1", 0x0, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_U_1024", 0xA, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_U_128", 0x7, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_U_16", 0x4, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_U_2", 0x1, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_U_2048", 0xB, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_U_256", 0x8, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_U_32", 0x5, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_U_4", 0x2, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_U_512", 0x9, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_U_64", 0x6, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_U_8", 0x3, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_V", 20, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_V_1", 0x0, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_V_1024", 0xA, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_V_128", 0x7, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_V_16", 0x4, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_V_2", 0x1, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_V_2048", 0xB, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_V_256", 0x8, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_V_32", 0x5, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_V_4", 0x2, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_V_512", 0x9, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_V_64", 0x6, 4 },
+    { "NV4_PGRAPH_FORMAT1_BASE_SIZE_V_8", 0x3, 4 },
+    { "NV4_PGRAPH_FORMAT1_COLOR", 8, 4 },
+    { "NV4_PGRAPH_FORMAT1_COLORKEYENABLE", 2, 4 },
+    { "NV4_PGRAPH_FORMAT1_COLORKEYENABLE_FALSE", 0x0, 4 },
+    { "NV4_PGRAPH_FORMAT1_COLORKEYENABLE_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_FORMAT1_COLOR_LE_A1R5G5B5", 0x2, 4 },
+    { "NV4_PGRAPH_FORMAT1_COLOR_LE_A4R4G4B4", 0x4, 4 },
+    { "NV4_PGRAPH_FORMAT1_COLOR_LE_A8R8G8B8", 0x6, 4 },
+    { "NV4_PGRAPH_FORMAT1_COLOR_LE_AY8", 0x1, 4 },
+    { "NV4_PGRAPH_FORMAT1_COLOR_LE_R5G6B5", 0x5, 4 },
+    { "NV4_PGRAPH_FORMAT1_COLOR_LE_X1R5G5B5", 0x3, 4 },
+    { "NV4_PGRAPH_FORMAT1_COLOR_LE_X8R8G8B8", 0x7, 4 },
+    { "NV4_PGRAPH_FORMAT1_COLOR_LE_Y8", 0x0, 4 },
+    { "NV4_PGRAPH_FORMAT1_CONTEXT_DMA", 1, 4 },
+    { "NV4_PGRAPH_FORMAT1_CONTEXT_DMA_A", 0x0, 4 },
+    { "NV4_PGRAPH_FORMAT1_CONTEXT_DMA_B", 0x1, 4 },
+    { "NV4_PGRAPH_FORMAT1_MIPMAP_LEVELS", 12, 4 },
+    { "NV4_PGRAPH_FORMAT1_MIPMAP_LEVELS_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_FORMAT1_ORIGIN_FOH", 7, 4 },
+    { "NV4_PGRAPH_FORMAT1_ORIGIN_FOH_CENTER", 0x0, 4 },
+    { "NV4_PGRAPH_FORMAT1_ORIGIN_FOH_CORNER", 0x1, 4 },
+    { "NV4_PGRAPH_FORMAT1_ORIGIN_ZOH", 5, 4 },
+    { "NV4_PGRAPH_FORMAT1_ORIGIN_ZOH_CENTER", 0x0, 4 },
+    { "NV4_PGRAPH_FORMAT1_ORIGIN_ZOH_CORNER", 0x1, 4 },
+    { "NV4_PGRAPH_FORMAT1_TEXTUREADDRESSU", 24, 4 },
+    { "NV4_PGRAPH_FORMAT1_TEXTUREADDRESSU_BORDER", 0x4, 4 },
+    { "NV4_PGRAPH_FORMAT1_TEXTUREADDRESSU_CLAMP", 0x3, 4 },
+    { "NV4_PGRAPH_FORMAT1_TEXTUREADDRESSU_MIRROR", 0x2, 4 },
+    { "NV4_PGRAPH_FORMAT1_TEXTUREADDRESSU_WRAP", 0x1, 4 },
+    { "NV4_PGRAPH_FORMAT1_TEXTUREADDRESSV", 28, 4 },
+    { "NV4_PGRAPH_FORMAT1_TEXTUREADDRESSV_BORDER", 0x4, 4 },
+    { "NV4_PGRAPH_FORMAT1_TEXTUREADDRESSV_CLAMP", 0x3, 4 },
+    { "NV4_PGRAPH_FORMAT1_TEXTUREADDRESSV_MIRROR", 0x2, 4 },
+    { "NV4_PGRAPH_FORMAT1_TEXTUREADDRESSV_WRAP", 0x1, 4 },
+    { "NV4_PGRAPH_FORMAT1_WRAPU", 27, 4 },
+    { "NV4_PGRAPH_FORMAT1_WRAPU_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_FORMAT1_WRAPV", 31, 4 },
+    { "NV4_PGRAPH_FORMAT1_WRAPV_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_FORMATS", 0x400618, 4 },
+    { "NV4_PGRAPH_FORMATS_FB", 12, 4 },
+    { "NV4_PGRAPH_FORMATS_FB_A1R5G5B5", 0x4, 4 },
+    { "NV4_PGRAPH_FORMATS_FB_A8R8G8B8", 0xC, 4 },
+    { "NV4_PGRAPH_FORMATS_FB_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_FORMATS_FB_R5G6B5", 0x5, 4 },
+    { "NV4_PGRAPH_FORMATS_FB_V8YB8U8YA8", 0xE, 4 },
+    { "NV4_PGRAPH_FORMATS_FB_X1A7R8G8B8_O1A7R8G8B8", 0xA, 4 },
+    { "NV4_PGRAPH_FORMATS_FB_X1A7R8G8B8_Z1A7R8G8B8", 0x9, 4 },
+    { "NV4_PGRAPH_FORMATS_FB_X1R5G5B5_O1R5G5B5", 0x3, 4 },
+    { "NV4_PGRAPH_FORMATS_FB_X1R5G5B5_Z1R5G5B5", 0x2, 4 },
+    { "NV4_PGRAPH_FORMATS_FB_X8R8G8B8_O1Z7R8G8B8", 0x8, 4 },
+    { "NV4_PGRAPH_FORMATS_FB_X8R8G8B8_O8R8G8B8", 0xB, 4 },
+    { "NV4_PGRAPH_FORMATS_FB_X8R8G8B8_Z8R8G8B8", 0x7, 4 },
+    { "NV4_PGRAPH_FORMATS_FB_Y16", 0x6, 4 },
+    { "NV4_PGRAPH_FORMATS_FB_Y32", 0xD, 4 },
+    { "NV4_PGRAPH_FORMATS_FB_Y8", 0x1, 4 },
+    { "NV4_PGRAPH_FORMATS_FB_YB8V8YA8U8", 0xF, 4 },
+    { "NV4_PGRAPH_FORMATS_ROP", 0, 4 },
+    { "NV4_PGRAPH_FORMATS_ROP_INVALID", 0x4, 4 },
+    { "NV4_PGRAPH_FORMATS_ROP_RGB15", 0x1, 4 },
+    { "NV4_PGRAPH_FORMATS_ROP_RGB16", 0x2, 4 },
+    { "NV4_PGRAPH_FORMATS_ROP_RGB24", 0x5, 4 },
+    { "NV4_PGRAPH_FORMATS_ROP_RGB30", 0x6, 4 },
+    { "NV4_PGRAPH_FORMATS_ROP_Y16", 0x3, 4 },
+    { "NV4_PGRAPH_FORMATS_ROP_Y32", 0x7, 4 },
+    { "NV4_PGRAPH_FORMATS_ROP_Y8", 0x0, 4 },
+    { "NV4_PGRAPH_FORMATS_SRC", 4, 4 },
+    { "NV4_PGRAPH_FORMATS_SRC_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_FORMATS_SRC_LE_A16R5G6B5", 0xB, 4 },
+    { "NV4_PGRAPH_FORMATS_SRC_LE_A16Y16", 0x10, 4 },
+    { "NV4_PGRAPH_FORMATS_SRC_LE_A1R5G5B5", 0x6, 4 },
+    { "NV4_PGRAPH_FORMATS_SRC_LE_A8R8G8B8", 0xD, 4 },
+    { "NV4_PGRAPH_FORMATS_SRC_LE_R5G6B5", 0xA, 4 },
+    { "NV4_PGRAPH_FORMATS_SRC_LE_V8YB8U8YA8", 0x12, 4 },
+    { "NV4_PGRAPH_FORMATS_SRC_LE_X16A1R5G5B5", 0x8, 4 },
+    { "NV4_PGRAPH_FORMATS_SRC_LE_X16A8Y8", 0x2, 4 },
+    { "NV4_PGRAPH_FORMATS_SRC_LE_X16R5G6B5", 0xC, 4 },
+    { "NV4_PGRAPH_FORMATS_SRC_LE_X16Y16", 0x11, 4 },
+    { "NV4_PGRAPH_FORMATS_SRC_LE_X17R5G5B5", 0x9, 4 },
+    { "NV4_PGRAPH_FORMATS_SRC_LE_X1R5G5B5", 0x7, 4 },
+    { "NV4_PGRAPH_FORMATS_SRC_LE_X24Y8", 0x3, 4 },
+    { "NV4_PGRAPH_FORMATS_SRC_LE_X8R8G8B8", 0xE, 4 },
+    { "NV4_PGRAPH_FORMATS_SRC_LE_Y16", 0xF, 4 },
+    { "NV4_PGRAPH_FORMATS_SRC_LE_Y32", 0x14, 4 },
+    { "NV4_PGRAPH_FORMATS_SRC_LE_Y8", 0x1, 4 },
+    { "NV4_PGRAPH_FORMATS_SRC_LE_YB8V8YA8U8", 0x13, 4 },
+    { "NV4_PGRAPH_INTR", 0x400100, 4 },
+    { "NV4_PGRAPH_INTR_BUFFER_NOTIFY", 16, 4 },
+    { "NV4_PGRAPH_INTR_BUFFER_NOTIFY_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_INTR_BUFFER_NOTIFY_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_INTR_BUFFER_NOTIFY_RESET", 0x1, 4 },
+    { "NV4_PGRAPH_INTR_CONTEXT_SWITCH", 12, 4 },
+    { "NV4_PGRAPH_INTR_CONTEXT_SWITCH_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_INTR_CONTEXT_SWITCH_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_INTR_CONTEXT_SWITCH_RESET", 0x1, 4 },
+    { "NV4_PGRAPH_INTR_EN", 0x400140, 4 },
+    { "NV4_PGRAPH_INTR_EN_BUFFER_NOTIFY", 16, 4 },
+    { "NV4_PGRAPH_INTR_EN_BUFFER_NOTIFY_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_INTR_EN_CONTEXT_SWITCH", 12, 4 },
+    { "NV4_PGRAPH_INTR_EN_CONTEXT_SWITCH_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_INTR_EN_MISSING_HW", 4, 4 },
+    { "NV4_PGRAPH_INTR_EN_MISSING_HW_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_INTR_EN_NOTIFY", 0, 4 },
+    { "NV4_PGRAPH_INTR_EN_NOTIFY_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_INTR_EN_TLB_PRESENT_A", 8, 4 },
+    { "NV4_PGRAPH_INTR_EN_TLB_PRESENT_A_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_INTR_EN_TLB_PRESENT_B", 9, 4 },
+    { "NV4_PGRAPH_INTR_EN_TLB_PRESENT_B_ENABLED", 0x1, 4 },
+    { "NV4_PGRAPH_INTR_MISSING_HW", 4, 4 },
+    { "NV4_PGRAPH_INTR_MISSING_HW_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_INTR_MISSING_HW_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_INTR_MISSING_HW_RESET", 0x1, 4 },
+    { "NV4_PGRAPH_INTR_NOTIFY", 0, 4 },
+    { "NV4_PGRAPH_INTR_NOTIFY_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_INTR_NOTIFY_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_INTR_NOTIFY_RESET", 0x1, 4 },
+    { "NV4_PGRAPH_INTR_TLB_PRESENT_A", 8, 4 },
+    { "NV4_PGRAPH_INTR_TLB_PRESENT_A_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_INTR_TLB_PRESENT_A_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_INTR_TLB_PRESENT_A_RESET", 0x1, 4 },
+    { "NV4_PGRAPH_INTR_TLB_PRESENT_B", 9, 4 },
+    { "NV4_PGRAPH_INTR_TLB_PRESENT_B_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_INTR_TLB_PRESENT_B_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_INTR_TLB_PRESENT_B_RESET", 0x1, 4 },
+    { "NV4_PGRAPH_LIMIT_VIOL_PIX", 0x400610, 4 },
+    { "NV4_PGRAPH_LIMIT_VIOL_PIX_ADRS", 0, 4 },
+    { "NV4_PGRAPH_LIMIT_VIOL_PIX_ADRS_0", 0x0, 4 },
+    { "NV4_PGRAPH_LIMIT_VIOL_PIX_BLIT", 29, 4 },
+    { "NV4_PGRAPH_LIMIT_VIOL_PIX_BLIT_NO_VIOL", 0x0, 4 },
+    { "NV4_PGRAPH_LIMIT_VIOL_PIX_BLIT_VIOL", 0x1, 4 },
+    { "NV4_PGRAPH_LIMIT_VIOL_PIX_LIMIT", 30, 4 },
+    { "NV4_PGRAPH_LIMIT_VIOL_PIX_LIMIT_NO_VIOL", 0x0, 4 },
+    { "NV4_PGRAPH_LIMIT_VIOL_PIX_LIMIT_VIOL", 0x1, 4 },
+    { "NV4_PGRAPH_LIMIT_VIOL_PIX_OVRFLW", 31, 4 },
+    { "NV4_PGRAPH_LIMIT_VIOL_PIX_OVRFLW_NO_VIOL", 0x0, 4 },
+    { "NV4_PGRAPH_LIMIT_VIOL_PIX_OVRFLW_VIOL", 0x1, 4 },
+    { "NV4_PGRAPH_LIMIT_VIOL_Z", 0x400614, 4 },
+    { "NV4_PGRAPH_LIMIT_VIOL_Z_ADRS", 0, 4 },
+    { "NV4_PGRAPH_LIMIT_VIOL_Z_ADRS_0", 0x0, 4 },
+    { "NV4_PGRAPH_LIMIT_VIOL_Z_LIMIT", 30, 4 },
+    { "NV4_PGRAPH_LIMIT_VIOL_Z_LIMIT_NO_VIOL", 0x0, 4 },
+    { "NV4_PGRAPH_LIMIT_VIOL_Z_LIMIT_VIOL", 0x1, 4 },
+    { "NV4_PGRAPH_LIMIT_VIOL_Z_OVRFLW", 31, 4 },
+    { "NV4_PGRAPH_LIMIT_VIOL_Z_OVRFLW_NO_VIOL", 0x0, 4 },
+    { "NV4_PGRAPH_LIMIT_VIOL_Z_OVRFLW_VIOL", 0x1, 4 },
+    { "NV4_PGRAPH_MISC24_0", 0x400510, 4 },
+    { "NV4_PGRAPH_MISC24_0_VALUE", 0, 4 },
+    { "NV4_PGRAPH_MISC24_1", 0x400570, 4 },
+    { "NV4_PGRAPH_MISC24_1_VALUE", 0, 4 },
+    { "NV4_PGRAPH_MISC24_2", 0x400574, 4 },
+    { "NV4_PGRAPH_MISC24_2_VALUE", 0, 4 },
+    { "NV4_PGRAPH_MONO_COLOR0", 0x400600, 4 },
+    { "NV4_PGRAPH_MONO_COLOR0_VALUE", 0, 4 },
+    { "NV4_PGRAPH_M_RAM_SIZE_1", 16, 4 },
+    { "NV4_PGRAPH_M_RAM_VALUE", 6, 4 },
+    { "NV4_PGRAPH_NOTIFY", 0x400714, 4 },
+    { "NV4_PGRAPH_NOTIFY_BUFFER_REQ", 0, 4 },
+    { "NV4_PGRAPH_NOTIFY_BUFFER_REQ_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_NOTIFY_BUFFER_REQ_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_NOTIFY_BUFFER_STYLE", 8, 4 },
+    { "NV4_PGRAPH_NOTIFY_BUFFER_STYLE_WRITE_ONLY", 0x0, 4 },
+    { "NV4_PGRAPH_NOTIFY_BUFFER_STYLE_WRITE_THEN_AWAKEN", 0x1, 4 },
+    { "NV4_PGRAPH_NOTIFY_REQ", 16, 4 },
+    { "NV4_PGRAPH_NOTIFY_REQ_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_NOTIFY_REQ_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_NOTIFY_STYLE", 20, 4 },
+    { "NV4_PGRAPH_NOTIFY_STYLE_WRITE_ONLY", 0x0, 4 },
+    { "NV4_PGRAPH_NOTIFY_STYLE_WRITE_THEN_AWAKEN", 0x1, 4 },
+    { "NV4_PGRAPH_NSOURCE", 0x400108, 4 },
+    { "NV4_PGRAPH_NSOURCE_BFR_NOTIFICATION", 15, 4 },
+    { "NV4_PGRAPH_NSOURCE_BFR_NOTIFICATION_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_NSOURCE_BFR_NOTIFICATION_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_NSOURCE_DATA_ERROR", 1, 4 },
+    { "NV4_PGRAPH_NSOURCE_DATA_ERROR_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_NSOURCE_DATA_ERROR_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_NSOURCE_DMA_R_PROTECTION", 7, 4 },
+    { "NV4_PGRAPH_NSOURCE_DMA_R_PROTECTION_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_NSOURCE_DMA_R_PROTECTION_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_NSOURCE_DMA_W_PROTECTION", 8, 4 },
+    { "NV4_PGRAPH_NSOURCE_DMA_W_PROTECTION_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_NSOURCE_DMA_W_PROTECTION_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_NSOURCE_DOUBLE_NOTIFY", 12, 4 },
+    { "NV4_PGRAPH_NSOURCE_DOUBLE_NOTIFY_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_NSOURCE_DOUBLE_NOTIFY_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_NSOURCE_FORMAT_EXCEPTION", 9, 4 },
+    { "NV4_PGRAPH_NSOURCE_FORMAT_EXCEPTION_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_NSOURCE_FORMAT_EXCEPTION_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_NSOURCE_ILLEGAL_MTHD", 6, 4 },
+    { "NV4_PGRAPH_NSOURCE_ILLEGAL_MTHD_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_NSOURCE_ILLEGAL_MTHD_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_NSOURCE_LIMIT_COLOR", 4, 4 },
+    { "NV4_PGRAPH_NSOURCE_LIMIT_COLOR_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_NSOURCE_LIMIT_COLOR_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_NSOURCE_LIMIT_ZETA_", 5, 4 },
+    { "NV4_PGRAPH_NSOURCE_LIMIT_ZETA_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_NSOURCE_LIMIT_ZETA_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_NSOURCE_METHOD_CNT", 14, 4 },
+    { "NV4_PGRAPH_NSOURCE_METHOD_CNT_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_NSOURCE_METHOD_CNT_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_NSOURCE_NOTIFICATION", 0, 4 },
+    { "NV4_PGRAPH_NSOURCE_NOTIFICATION_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_NSOURCE_NOTIFICATION_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_NSOURCE_NOTIFY_IN_USE", 13, 4 },
+    { "NV4_PGRAPH_NSOURCE_NOTIFY_IN_USE_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_NSOURCE_NOTIFY_IN_USE_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_NSOURCE_PATCH_EXCEPTION", 10, 4 },
+    { "NV4_PGRAPH_NSOURCE_PATCH_EXCEPTION_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_NSOURCE_PATCH_EXCEPTION_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_NSOURCE_PROTECTION_ERROR", 2, 4 },
+    { "NV4_PGRAPH_NSOURCE_PROTECTION_ERROR_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_NSOURCE_PROTECTION_ERROR_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_NSOURCE_RANGE_EXCEPTION", 3, 4 },
+    { "NV4_PGRAPH_NSOURCE_RANGE_EXCEPTION_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_NSOURCE_RANGE_EXCEPTION_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_NSOURCE_STATE_INVALID", 11, 4 },
+    { "NV4_PGRAPH_NSOURCE_STATE_INVALID_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_NSOURCE_STATE_INVALID_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_NSTATUS", 0x400104, 4 },
+    { "NV4_PGRAPH_NSTATUS_BAD_ARGUMENT", 13, 4 },
+    { "NV4_PGRAPH_NSTATUS_BAD_ARGUMENT_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_NSTATUS_BAD_ARGUMENT_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_NSTATUS_INVALID_STATE", 12, 4 },
+    { "NV4_PGRAPH_NSTATUS_INVALID_STATE_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_NSTATUS_INVALID_STATE_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_NSTATUS_PROTECTION_FAULT", 14, 4 },
+    { "NV4_PGRAPH_NSTATUS_PROTECTION_FAULT_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_NSTATUS_PROTECTION_FAULT_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_NSTATUS_STATE_IN_USE", 11, 4 },
+    { "NV4_PGRAPH_NSTATUS_STATE_IN_USE_NOT_PENDING", 0x0, 4 },
+    { "NV4_PGRAPH_NSTATUS_STATE_IN_USE_PENDING", 0x1, 4 },
+    { "NV4_PGRAPH_PASSTHRU_0", 0x40057C, 4 },
+    { "NV4_PGRAPH_PASSTHRU_0_VALUE", 0, 4 },
+    { "NV4_PGRAPH_PASSTHRU_1", 0x400580, 4 },
+    { "NV4_PGRAPH_PASSTHRU_1_VALUE", 0, 4 },
+    { "NV4_PGRAPH_PASSTHRU_2", 0x400584, 4 },
+    { "NV4_PGRAPH_PASSTHRU_2_VALUE", 0, 4 },
+    { "NV4_PGRAPH_PATTERN_BITMAP", 0, 4 },
+    { "NV4_PGRAPH_PATTERN_SHAPE", 0x400810, 4 },
+    { "NV4_PGRAPH_PATTERN_SHAPE_SELECT", 4, 4 },
+    { "NV4_PGRAPH_PATTERN_SHAPE_SELECT_2COLOR", 0x0, 4 },
+    { "NV4_PGRAPH_PATTERN_SHAPE_SELECT_FULLCOLOR", 0x1, 4 },
+    { "NV4_PGRAPH_PATTERN_SHAPE_VALUE", 0, 4 },
+    { "NV4_PGRAPH_PATTERN_SHAPE_VALUE_1X_64Y", 0x2, 4 },
+    { "NV4_PGRAPH_PATTERN_SHAPE_VALUE_64X_1Y", 0x1, 4 },
+    { "NV4_PGRAPH_PATTERN_SHAPE_VALUE_8X_8Y", 0x0, 4 },
+    { "NV4_PGRAPH_PATTERN_SIZE_1", 2, 4 },
+    { "NV4_PGRAPH_PATT_COLOR0", 0x400800, 4 },
+    { "NV4_PGRAPH_PATT_COLOR0_VALUE", 0, 4 },
+    { "NV4_PGRAPH_PATT_COLOR1", 0x400804, 4 },
+    { "NV4_PGRAPH_PATT_COLOR1_VALUE", 0, 4 },
+    { "NV4_PGRAPH_PATT_COLORRAM_SIZE_1", 64, 4 },
+    { "NV4_PGRAPH_PATT_COLORRAM_VALUE", 0, 4 },
+    { "NV4_PGRAPH_ROP3", 0x400604, 4 },
+    { "NV4_PGRAPH_ROP3_VALUE", 0, 4 },
+    { "NV4_PGRAPH_SCALED_FORMAT", 0x400768, 4 },
+    { "NV4_PGRAPH_SCALED_FORMAT_INTERPOLATOR", 24, 4 },
+    { "NV4_PGRAPH_SCALED_FORMAT_INTERPOLATOR_FOH", 0x1, 4 },
+    { "NV4_PGRAPH_SCALED_FORMAT_INTERPOLATOR_ZOH", 0x0, 4 },
+    { "NV4_PGRAPH_SCALED_FORMAT_ORIGIN", 16, 4 },
+    { "NV4_PGRAPH_SCALED_FORMAT_ORIGIN_CENTER", 0x1, 4 },
+    { "NV4_PGRAPH_SCALED_FORMAT_ORIGIN_CORNER", 0x2, 4 },
+    { "NV4_PGRAPH_SCALED_FORMAT_ORIGIN_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_SOURCE_COLOR", 0x40050C, 4 },
+    { "NV4_PGRAPH_SOURCE_COLOR_VALUE", 0, 4 },
+    { "NV4_PGRAPH_SOURCE_COLOR_VALUE_0", 0x0, 4 },
+    { "NV4_PGRAPH_START", 0x400000, 4 },
+    { "NV4_PGRAPH_STATE", 0x400710, 4 },
+    { "NV4_PGRAPH_STATE_BUFFER_0", 0, 4 },
+    { "NV4_PGRAPH_STATE_BUFFER_0_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_STATE_BUFFER_0_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_STATE_BUFFER_1", 1, 4 },
+    { "NV4_PGRAPH_STATE_BUFFER_1_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_STATE_BUFFER_1_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_STATE_BUFFER_2", 2, 4 },
+    { "NV4_PGRAPH_STATE_BUFFER_2_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_STATE_BUFFER_2_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_STATE_BUFFER_3", 3, 4 },
+    { "NV4_PGRAPH_STATE_BUFFER_3_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_STATE_BUFFER_3_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_STATE_BUFFER_4", 4, 4 },
+    { "NV4_PGRAPH_STATE_BUFFER_4_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_STATE_BUFFER_4_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_STATE_BUFFER_5", 5, 4 },
+    { "NV4_PGRAPH_STATE_BUFFER_5_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_STATE_BUFFER_5_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_STATE_CHROMA_COLOR", 16, 4 },
+    { "NV4_PGRAPH_STATE_CHROMA_COLORFMT", 17, 4 },
+    { "NV4_PGRAPH_STATE_CHROMA_COLORFMT_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_STATE_CHROMA_COLORFMT_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_STATE_CHROMA_COLOR_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_STATE_CHROMA_COLOR_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_STATE_CPATTERN_COLORFMT", 20, 4 },
+    { "NV4_PGRAPH_STATE_CPATTERN_COLORFMT_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_STATE_CPATTERN_COLORFMT_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_STATE_CPATTERN_MONOFMT", 21, 4 },
+    { "NV4_PGRAPH_STATE_CPATTERN_MONOFMT_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_STATE_CPATTERN_MONOFMT_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_STATE_CPATTERN_SELECT", 22, 4 },
+    { "NV4_PGRAPH_STATE_CPATTERN_SELECT_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_STATE_CPATTERN_SELECT_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_STATE_PATTERN_COLOR0", 24, 4 },
+    { "NV4_PGRAPH_STATE_PATTERN_COLOR0_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_STATE_PATTERN_COLOR0_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_STATE_PATTERN_COLOR1", 25, 4 },
+    { "NV4_PGRAPH_STATE_PATTERN_COLOR1_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_STATE_PATTERN_COLOR1_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_STATE_PATTERN_PATT0", 26, 4 },
+    { "NV4_PGRAPH_STATE_PATTERN_PATT0_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_STATE_PATTERN_PATT0_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_STATE_PATTERN_PATT1", 27, 4 },
+    { "NV4_PGRAPH_STATE_PATTERN_PATT1_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_STATE_PATTERN_PATT1_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_STATE_PITCH_0", 8, 4 },
+    { "NV4_PGRAPH_STATE_PITCH_0_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_STATE_PITCH_0_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_STATE_PITCH_1", 9, 4 },
+    { "NV4_PGRAPH_STATE_PITCH_1_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_STATE_PITCH_1_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_STATE_PITCH_2", 10, 4 },
+    { "NV4_PGRAPH_STATE_PITCH_2_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_STATE_PITCH_2_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_STATE_PITCH_3", 11, 4 },
+    { "NV4_PGRAPH_STATE_PITCH_3_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_STATE_PITCH_3_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_STATE_PITCH_4", 12, 4 },
+    { "NV4_PGRAPH_STATE_PITCH_4_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_STATE_PITCH_4_VALID", 0x1, 4 },
+    { "NV4_PGRAPH_STATUS", 0x400700, 4 },
+    { "NV4_PGRAPH_STATUS_CACHE", 25, 4 },
+    { "NV4_PGRAPH_STATUS_CACHE_BUSY", 0x1, 4 },
+    { "NV4_PGRAPH_STATUS_CACHE_IDLE", 0x0, 4 },
+    { "NV4_PGRAPH_STATUS_D3D", 24, 4 },
+    { "NV4_PGRAPH_STATUS_D3D_BUSY", 0x1, 4 },
+    { "NV4_PGRAPH_STATUS_D3D_IDLE", 0x0, 4 },
+    { "NV4_PGRAPH_STATUS_DMA_BUFFER_NOTIFY", 21, 4 },
+    { "NV4_PGRAPH_STATUS_DMA_BUFFER_NOTIFY_BUSY", 0x1, 4 },
+    { "NV4_PGRAPH_STATUS_DMA_BUFFER_NOTIFY_IDLE", 0x0, 4 },
+    { "NV4_PGRAPH_STATUS_DMA_ENGINE", 17, 4 },
+    { "NV4_PGRAPH_STATUS_DMA_ENGINE_BUSY", 0x1, 4 },
+    { "NV4_PGRAPH_STATUS_DMA_ENGINE_IDLE", 0x0, 4 },
+    { "NV4_PGRAPH_STATUS_DMA_NOTIFY", 20, 4 },
+    { "NV4_PGRAPH_STATUS_DMA_NOTIFY_BUSY", 0x1, 4 },
+    { "NV4_PGRAPH_STATUS_DMA_NOTIFY_IDLE", 0x0, 4 },
+    { "NV4_PGRAPH_STATUS_FE", 5, 4 },
+    { "NV4_PGRAPH_STATUS_FE_BUSY", 0x1, 4 },
+    { "NV4_PGRAPH_STATUS_FE_IDLE", 0x0, 4 },
+    { "NV4_PGRAPH_STATUS_LIGHTING", 26, 4 },
+    { "NV4_PGRAPH_STATUS_LIGHTING_BUSY", 0x1, 4 },
+    { "NV4_PGRAPH_STATUS_LIGHTING_IDLE", 0x0, 4 },
+    { "NV4_PGRAPH_STATUS_PORT_DMA", 16, 4 },
+    { "NV4_PGRAPH_STATUS_PORT_DMA_BUSY", 0x1, 4 },
+    { "NV4_PGRAPH_STATUS_PORT_DMA_IDLE", 0x0, 4 },
+    { "NV4_PGRAPH_STATUS_PORT_NOTIFY", 8, 4 },
+    { "NV4_PGRAPH_STATUS_PORT_NOTIFY_BUSY", 0x1, 4 },
+    { "NV4_PGRAPH_STATUS_PORT_NOTIFY_IDLE", 0x0, 4 },
+    { "NV4_PGRAPH_STATUS_PORT_REGISTER", 12, 4 },
+    { "NV4_PGRAPH_STATUS_PORT_REGISTER_BUSY", 0x1, 4 },
+    { "NV4_PGRAPH_STATUS_PORT_REGISTER_IDLE", 0x0, 4 },
+    { "NV4_PGRAPH_STATUS_PORT_USER", 29, 4 },
+    { "NV4_PGRAPH_STATUS_PORT_USER_BUSY", 0x1, 4 },
+    { "NV4_PGRAPH_STATUS_PORT_USER_IDLE", 0x0, 4 },
+    { "NV4_PGRAPH_STATUS_PREROP", 27, 4 },
+    { "NV4_PGRAPH_STATUS_PREROP_BUSY", 0x1, 4 },
+    { "NV4_PGRAPH_STATUS_PREROP_IDLE", 0x0, 4 },
+    { "NV4_PGRAPH_STATUS_RASTERIZER", 6, 4 },
+    { "NV4_PGRAPH_STATUS_RASTERIZER_BUSY", 0x1, 4 },
+    { "NV4_PGRAPH_STATUS_RASTERIZER_IDLE", 0x0, 4 },
+    { "NV4_PGRAPH_STATUS_ROP", 28, 4 },
+    { "NV4_PGRAPH_STATUS_ROP_BUSY", 0x1, 4 },
+    { "NV4_PGRAPH_STATUS_ROP_IDLE", 0x0, 4 },
+    { "NV4_PGRAPH_STATUS_STATE", 0, 4 },
+    { "NV4_PGRAPH_STATUS_STATE_BUSY", 0x1, 4 },
+    { "NV4_PGRAPH_STATUS_STATE_IDLE", 0x0, 4 },
+    { "NV4_PGRAPH_STATUS_XY_LOGIC", 4, 4 },
+    { "NV4_PGRAPH_STATUS_XY_LOGIC_BUSY", 0x1, 4 },
+    { "NV4_PGRAPH_STATUS_XY_LOGIC_IDLE", 0x0, 4 },
+    { "NV4_PGRAPH_STORED_FMT", 0x400830, 4 },
+    { "NV4_PGRAPH_STORED_FMT_CHROMA", 24, 4 },
+    { "NV4_PGRAPH_STORED_FMT_MONO0", 0, 4 },
+    { "NV4_PGRAPH_STORED_FMT_PATT0", 8, 4 },
+    { "NV4_PGRAPH_STORED_FMT_PATT1", 16, 4 },
+    { "NV4_PGRAPH_SURFACE", 0x40070C, 4 },
+    { "NV4_PGRAPH_SURFACE_TYPE", 0, 4 },
+    { "NV4_PGRAPH_SURFACE_TYPE_INVALID", 0x0, 4 },
+    { "NV4_PGRAPH_SURFACE_TYPE_NON_SWIZZLE", 0x1, 4 },
+    { "NV4_PGRAPH_SURFACE_TYPE_SWIZZLE", 0x2, 4 },
+    { "NV4_PGRAPH_TRAPPED_ADDR", 0x400704, 4 },
+    { "NV4_PGRAPH_TRAPPED_ADDR_CHID", 24, 4 },
+    { "NV4_PGRAPH_TRAPPED_ADDR_MTHD", 2, 4 },
+    { "NV4_PGRAPH_TRAPPED_ADDR_SUBCH", 13, 4 },
+    { "NV4_PGRAPH_TRAPPED_DATA", 0x400708, 4 },
+    { "NV4_PGRAPH_TRAPPED_DATA_VALUE", 0, 4 },
+    { "NV4_PGRAPH_U_RAM_SIZE_1", 16, 4 },
+    { "NV4_PGRAPH_U_RAM_VALUE", 6, 4 },
+    { "NV4_PGRAPH_VALID1", 0x400508, 4 },
+    { "NV4_PGRAPH_VALID1_CLIPA_MAX", 31, 4 },
+    { "NV4_PGRAPH_VALID1_CLIPA_MAX_NO_ERROR", 0x0, 4 },
+    { "NV4_PGRAPH_VALID1_CLIPA_MAX_ONLY", 0x1, 4 },
+    { "NV4_PGRAPH_VALID1_CLIPA_MIN", 29, 4 },
+    { "NV4_PGRAPH_VALID1_CLIPA_MIN_NO_ERROR", 0x0, 4 },
+    { "NV4_PGRAPH_VALID1_CLIPA_MIN_ONLY", 0x1, 4 },
+    { "NV4_PGRAPH_VALID1_CLIP_MAX", 30, 4 },
+    { "NV4_PGRAPH_VALID1_CLIP_MAX_NO_ERROR", 0x0, 4 },
+    { "NV4_PGRAPH_VALID1_CLIP_MAX_ONLY", 0x1, 4 },
+    { "NV4_PGRAPH_VALID1_CLIP_MIN", 28, 4 },
+    { "NV4_PGRAPH_VALID1_CLIP_MIN_NO_ERROR", 0x0, 4 },
+    { "NV4_PGRAPH_VALID1_CLIP_MIN_ONLY", 0x1, 4 },
+    { "NV4_PGRAPH_VALID1_VLD", 0, 4 },
+    { "NV4_PGRAPH_VALID1_VLD_0", 0x0, 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTBOFFSET", (0x1<<3), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTBPITCH", (0x1<<2), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTCLIP", (0x1<<20), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTCOLOR0", (0x1<<17), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTCOLOR1", (0x1<<18), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTCOUNT", (0x1<<5), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTDUDX", (0x1<<4), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTDUDX2", (0x1<<12), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTDVDY", (0x1<<5), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTDVDY2", (0x1<<13), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTFONT", (0x1<<22), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTFORMAT", (0x1<<6), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTLENGTH", (0x1<<4), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTMOVE", (0x1<<21), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTNOTIFY", (0x1<<7), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTOFFSET", (0x1<<22), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTOFFSIN", (0x1<<0), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTOFFSOUT", (0x1<<1), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTPITCH", (0x1<<10), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTPITCH2", (0x1<<16), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTPITCHIN", (0x1<<2), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTPITCHOUT", (0x1<<3), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTPOINT", (0x1<<8), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTPOINT2", (0x1<<14), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTSIZE", (0x1<<9), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTSIZE2", (0x1<<15), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTSTART", (0x1<<11), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTSTART2", (0x1<<17), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTX01", (0x3<<0), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTX02", (0x7<<0), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTX03", (0xF<<0), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTXCHAIN01", (0x3<<4), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTXCHAIN02", (0x7<<4), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTXCHAIN03", (0xF<<4), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTY01", (0x3<<8), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTY02", (0x7<<8), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTY03", (0xF<<8), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTYCHAIN01", (0x3<<12), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTYCHAIN02", (0x7<<12), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_GOTYCHAIN03", (0xF<<12), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_NOCLIP", (0x1<<19), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_SRCCOLOR", (0x1<<16), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_XCHAIN_OFFSET", (0x1<<4), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_X_OFFSET", (0x1<<0), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_YCHAIN_OFFSET", (0x1<<12), 4 },
+    { "NV4_PGRAPH_VALID1_VLD_Y_OFFSET", (0x1<<8), 4 },
+    { "NV4_PGRAPH_VALID2", 0x400578, 4 },
+    { "NV4_PGRAPH_VALID2_VLD2", 0, 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_0", 0x0, 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_DX3FULLSTATE", (0x3f<<13), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_DX3FULLVERTEX", (0x7f<<0), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_DX5FULLSTATE", (0x1ff<<12), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_DX5FULLVERTEX", (0x7f<<0), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_DX6FULLSTATE", (0xFfff<<13), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_DX6FULLVERTEX", (0x1ff<<0), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_BLEND", (1<<20), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_COLOR", (1<<1), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_COLORKEY", (1<<12), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_COMBFACTOR", (1<<24), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_COMBINE0A", (1<<28), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_COMBINE0C", (1<<27), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_COMBINE1A", (1<<26), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_COMBINE1C", (1<<25), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_CONTROL0", (1<<17), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_CONTROL1", (1<<18), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_CONTROL2", (1<<19), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_FILTER0", (1<<16), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_FILTER1", (1<<23), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_FOGCOLOR", (1<<13), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_FORMAT0", (1<<15), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_FORMAT1", (1<<21), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_M", (1<<2), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_OFFSET0", (1<<14), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_OFFSET1", (1<<22), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_SPECULAR", (1<<0), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_U0", (1<<6), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_U1", (1<<8), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_V0", (1<<7), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_V1", (1<<9), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_X", (1<<5), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_Y", (1<<4), 4 },
+    { "NV4_PGRAPH_VALID2_VLD2_GOT3D_ZETA", (1<<3), 4 },
+    { "NV4_PGRAPH_V_RAM_SIZE_1", 16, 4 },
+    { "NV4_PGRAPH_V_RAM_VALUE", 6, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC0", 0x400514, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC0_COUNTER", 0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC0_COUNTER_0", 0x0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC0_DIMENSION", 20, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC0_DIMENSION_NONZERO", 0x0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC0_DIMENSION_ZERO", 0x1, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC0_INDEX", 28, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC0_INDEX_0", 0x0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC1", 0x400518, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC1_INITIAL", 0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC1_INITIAL_DONE", 0x1, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC1_INITIAL_NEEDED", 0x0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC1_SEL_XIMAX", 12, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC1_SEL_XIMAX_IMAGEMAX", 0x1, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC1_SEL_XIMAX_UUMAX", 0x0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC1_SEL_XXTRA", 20, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC1_SEL_XXTRA_CLIPMAX", 0x0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC1_SEL_XXTRA_IMAGEMAX", 0x1, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC1_SEL_YIMAX", 16, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC1_SEL_YIMAX_IMAGEMAX", 0x1, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC1_SEL_YIMAX_UUMAX", 0x0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC1_XTRACLIPX", 4, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC1_XTRACLIPX_NOTNULL", 0x0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC1_XTRACLIPX_NULL", 0x1, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC1_XTRACLIPY", 5, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC1_XTRACLIPY_NOTNULL", 0x0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC1_XTRACLIPY_NULL", 0x1, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC2", 0x40051C, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC2_HANDOFF", 0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC2_HANDOFF_DISABLE", 0x0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC2_HANDOFF_ENABLE", 0x1, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC2_SEL_XIMAX", 12, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC2_SEL_XIMAX_IMAGEMAX", 0x1, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC2_SEL_XIMAX_UCMAX", 0x0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC2_SEL_XXTRA", 20, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC2_SEL_XXTRA_CLIPMAX", 0x0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC2_SEL_XXTRA_IMAGEMAX", 0x1, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC2_SEL_YIMAX", 16, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC2_SEL_YIMAX_IMAGEMAX", 0x1, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC2_SEL_YIMAX_UCMAX", 0x0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC2_XTRACLIPX", 4, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC2_XTRACLIPX_NOTNULL", 0x0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC2_XTRACLIPX_NULL", 0x1, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC2_XTRACLIPY", 5, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC2_XTRACLIPY_NOTNULL", 0x0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC2_XTRACLIPY_NULL", 0x1, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC3", 0x400520, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC3_RELOAD_WDIMY", 4, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC3_RELOAD_WDIMY_NULL", 0x0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC3_RELOAD_WDIMY_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC3_RELOAD_WX", 8, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC3_RELOAD_WX_NULL", 0x0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC3_RELOAD_WX_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC3_TEXT_ALG", 12, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC3_TEXT_ALG_NULL", 0x0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC3_TEXT_ALG_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC3_TEXT_DIMX", 16, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC3_TEXT_DIMX_0", 0x0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC3_TEXT_WDIMX", 24, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC3_TEXT_WDIMX_0", 0x0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC3_WDIMY_EQ_0", 0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC3_WDIMY_EQ_0_NULL", 0x0, 4 },
+    { "NV4_PGRAPH_XY_LOGIC_MISC3_WDIMY_EQ_0_TRUE", 0x1, 4 },
+    { "NV4_PGRAPH_X_MISC", 0x400500, 4 },
+    { "NV4_PGRAPH_X_MISC_ADDER_OUTPUT", 28, 4 },
+    { "NV4_PGRAPH_X_MISC_ADDER_OUTPUT_EQ_0", 0x0, 4 },
+    { "NV4_PGRAPH_X_MISC_ADDER_OUTPUT_GT_0", 0x2, 4 },
+    { "NV4_PGRAPH_X_MISC_ADDER_OUTPUT_LT_0", 0x1, 4 },
+    { "NV4_PGRAPH_X_MISC_BIT33_0", 0, 4 },
+    { "NV4_PGRAPH_X_MISC_BIT33_0_0", 0x0, 4 },
+    { "NV4_PGRAPH_X_MISC_BIT33_1", 1, 4 },
+    { "NV4_PGRAPH_X_MISC_BIT33_1_0", 0x0, 4 },
+    { "NV4_PGRAPH_X_MISC_BIT33_2", 2, 4 },
+    { "NV4_PGRAPH_X_MISC_BIT33_2_0", 0x0, 4 },
+    { "NV4_PGRAPH_X_MISC_BIT33_3", 3, 4 },
+    { "NV4_PGRAPH_X_MISC_BIT33_3_0", 0x0, 4 },
+    { "NV4_PGRAPH_X_MISC_RANGE_0", 4, 4 },
+    { "NV4_PGRAPH_X_MISC_RANGE_0_0", 0x0, 4 },
+    { "NV4_PGRAPH_X_MISC_RANGE_1", 5, 4 },
+    { "NV4_PGRAPH_X_MISC_RANGE_1_0", 0x0, 4 },
+    { "NV4_PGRAPH_X_MISC_RANGE_2", 6, 4 },
+    { "NV4_PGRAPH_X_MISC_RANGE_2_0", 0x0, 4 },
+    { "NV4_PGRAPH_X_MISC_RANGE_3", 7, 4 },
+    { "NV4_PGRAPH_X_MISC_RANGE_3_0", 0x0, 4 },
+    { "NV4_PGRAPH_X_RAM_BPORT_SIZE_1", 32, 4 },
+    { "NV4_PGRAPH_X_RAM_BPORT_VALUE", 0, 4 },
+    { "NV4_PGRAPH_Y_MISC", 0x400504, 4 },
+    { "NV4_PGRAPH_Y_MISC_ADDER_OUTPUT", 28, 4 },
+    { "NV4_PGRAPH_Y_MISC_ADDER_OUTPUT_EQ_0", 0x0, 4 },
+    { "NV4_PGRAPH_Y_MISC_ADDER_OUTPUT_GT_0", 0x2, 4 },
+    { "NV4_PGRAPH_Y_MISC_ADDER_OUTPUT_LT_0", 0x1, 4 },
+    { "NV4_PGRAPH_Y_MISC_BIT33_0", 0, 4 },
+    { "NV4_PGRAPH_Y_MISC_BIT33_0_0", 0x0, 4 },
+    { "NV4_PGRAPH_Y_MISC_BIT33_1", 1, 4 },
+    { "NV4_PGRAPH_Y_MISC_BIT33_1_0", 0x0, 4 },
+    { "NV4_PGRAPH_Y_MISC_BIT33_2", 2, 4 },
+    { "NV4_PGRAPH_Y_MISC_BIT33_2_0", 0x0, 4 },
+    { "NV4_PGRAPH_Y_MISC_BIT33_3", 3, 4 },
+    { "NV4_PGRAPH_Y_MISC_BIT33_3_0", 0x0, 4 },
+    { "NV4_PGRAPH_Y_MISC_RANGE_0", 4, 4 },
+    { "NV4_PGRAPH_Y_MISC_RANGE_0_0", 0x0, 4 },
+    { "NV4_PGRAPH_Y_MISC_RANGE_1", 5, 4 },
+    { "NV4_PGRAPH_Y_MISC_RANGE_1_0", 0x0, 4 },
+    { "NV4_PGRAPH_Y_MISC_RANGE_2", 6, 4 },
+    { "NV4_PGRAPH_Y_MISC_RANGE_2_0", 0x0, 4 },
+    { "NV4_PGRAPH_Y_MISC_RANGE_3", 7, 4 },
+    { "NV4_PGRAPH_Y_MISC_RANGE_3_0", 0x0, 4 },
+    { "NV4_PGRAPH_Y_RAM_BPORT_SIZE_1", 32, 4 },
+    { "NV4_PGRAPH_Y_RAM_BPORT_VALUE", 0, 4 },
+    { "NV4_PMC_BOOT_0", 0x0, 4 },
+    { "NV4_PMC_BOOT_0_ARCHITECTURE", 12, 4 },
+    { "NV4_PMC_BOOT_0_ARCHITECTURE_NV0", 0x0, 4 },
+    { "NV4_PMC_BOOT_0_ARCHITECTURE_NV1", 0x1, 4 },
+    { "NV4_PMC_BOOT_0_ARCHITECTURE_NV2", 0x2, 4 },
+    { "NV4_PMC_BOOT_0_ARCHITECTURE_NV3", 0x3, 4 },
+    { "NV4_PMC_BOOT_0_ARCHITECTURE_NV4", 0x4, 4 },
+    { "NV4_PMC_BOOT_0_FIB_REVISION", 16, 4 },
+    { "NV4_PMC_BOOT_0_FIB_REVISION_0", 0x0, 4 },
+    { "NV4_PMC_BOOT_0_FOUNDRY", 28, 4 },
+    { "NV4_PMC_BOOT_0_FOUNDRY_HELIOS", 0x1, 4 },
+    { "NV4_PMC_BOOT_0_FOUNDRY_SGS", 0x0, 4 },
+    { "NV4_PMC_BOOT_0_FOUNDRY_TSMC", 0x2, 4 },
+    { "NV4_PMC_BOOT_0_GENERIC_VALUE", 0x20040001, 4 },
+    { "NV4_PMC_BOOT_0_IMPLEMENTATION", 8, 4 },
+    { "NV4_PMC_BOOT_0_IMPLEMENTATION_NV4_0", 0x0, 4 },
+    { "NV4_PMC_BOOT_0_MAJOR_REVISION", 4, 4 },
+    { "NV4_PMC_BOOT_0_MAJOR_REVISION_A", 0x0, 4 },
+    { "NV4_PMC_BOOT_0_MAJOR_REVISION_B", 0x1, 4 },
+    { "NV4_PMC_BOOT_0_MANUFACTURER", 24, 4 },
+    { "NV4_PMC_BOOT_0_MANUFACTURER_NVIDIA", 0x0, 4 },
+    { "NV4_PMC_BOOT_0_MASK_REVISION", 20, 4 },
+    { "NV4_PMC_BOOT_0_MASK_REVISION_A", 0x0, 4 },
+    { "NV4_PMC_BOOT_0_MASK_REVISION_B", 0x1, 4 },
+    { "NV4_PMC_BOOT_0_MASK_REVISION_C", 0x2, 4 },
+    { "NV4_PMC_BOOT_0_MINOR_REVISION", 0, 4 },
+    { "NV4_PMC_BOOT_0_MINOR_REVISION_0", 0x0, 4 },
+    { "NV4_PMC_ENABLE", 0x200, 4 },
+    { "NV4_PMC_ENABLE_PCRTC", 24, 4 },
+    { "NV4_PMC_ENABLE_PCRTC_ENABLED", 0x1, 4 },
+    { "NV4_PMC_ENABLE_PFB", 20, 4 },
+    { "NV4_PMC_ENABLE_PFB_ENABLED", 0x1, 4 },
+    { "NV4_PMC_ENABLE_PFIFO", 8, 4 },
+    { "NV4_PMC_ENABLE_PFIFO_ENABLED", 0x1, 4 },
+    { "NV4_PMC_ENABLE_PGRAPH", 12, 4 },
+    { "NV4_PMC_ENABLE_PGRAPH_ENABLED", 0x1, 4 },
+    { "NV4_PMC_ENABLE_PMEDIA", 4, 4 },
+    { "NV4_PMC_ENABLE_PMEDIA_ENABLED", 0x1, 4 },
+    { "NV4_PMC_ENABLE_PPMI", 16, 4 },
+    { "NV4_PMC_ENABLE_PPMI_ENABLED", 0x1, 4 },
+    { "NV4_PMC_ENABLE_PVIDEO", 28, 4 },
+    { "NV4_PMC_ENABLE_PVIDEO_ENABLED", 0x1, 4 },
+    { "NV4_PMC_END", 0xFFF, 4 },
+    { "NV4_PMC_INTR_0", 0x100, 4 },
+    { "NV4_PMC_INTR_0_PBUS", 28, 4 },
+    { "NV4_PMC_INTR_0_PBUS_NOT_PENDING", 0x0, 4 },
+    { "NV4_PMC_INTR_0_PBUS_PENDING", 0x1, 4 },
+    { "NV4_PMC_INTR_0_PCRTC", 24, 4 },
+    { "NV4_PMC_INTR_0_PCRTC_NOT_PENDING", 0x0, 4 },
+    { "NV4_PMC_INTR_0_PCRTC_PENDING", 0x1, 4 },
+    { "NV4_PMC_INTR_0_PFIFO", 8, 4 },
+    { "NV4_PMC_INTR_0_PFIFO_NOT_PENDING", 0x0, 4 },
+    { "NV4_PMC_INTR_0_PFIFO_PENDING", 0x1, 4 },
+    { "NV4_PMC_INTR_0_PGRAPH", 12, 4 },
+    { "NV4_PMC_INTR_0_PGRAPH_NOT_PENDING", 0x0, 4 },
+    { "NV4_PMC_INTR_0_PGRAPH_PENDING", 0x1, 4 },
+    { "NV4_PMC_INTR_0_PMEDIA", 4, 4 },
+    { "NV4_PMC_INTR_0_PMEDIA_NOT_PENDING", 0x0, 4 },
+    { "NV4_PMC_INTR_0_PMEDIA_PENDING", 0x1, 4 },
+    { "NV4_PMC_INTR_0_PTIMER", 20, 4 },
+    { "NV4_PMC_INTR_0_PTIMER_NOT_PENDING", 0x0, 4 },
+    { "NV4_PMC_INTR_0_PTIMER_PENDING", 0x1, 4 },
+    { "NV4_PMC_INTR_0_PVIDEO", 16, 4 },
+    { "NV4_PMC_INTR_0_PVIDEO_NOT_PENDING", 0x0, 4 },
+    { "NV4_PMC_INTR_0_PVIDEO_PENDING", 0x1, 4 },
+    { "NV4_PMC_INTR_0_SOFTWARE", 31, 4 },
+    { "NV4_PMC_INTR_0_SOFTWARE_NOT_PENDING", 0x0, 4 },
+    { "NV4_PMC_INTR_0_SOFTWARE_PENDING", 0x1, 4 },
+    { "NV4_PMC_INTR_EN_0", 0x140, 4 },
+    { "NV4_PMC_INTR_EN_0_INTA", 0, 4 },
+    { "NV4_PMC_INTR_EN_0_INTA_DISABLED", 0x0, 4 },
+    { "NV4_PMC_INTR_EN_0_INTA_HARDWARE", 0x1, 4 },
+    { "NV4_PMC_INTR_EN_0_INTA_SOFTWARE", 0x2, 4 },
+    { "NV4_PMC_INTR_READ_0", 0x160, 4 },
+    { "NV4_PMC_INTR_READ_0_INTA", 0, 4 },
+    { "NV4_PMC_INTR_READ_0_INTA_HIGH", 0x1, 4 },
+    { "NV4_PMC_INTR_READ_0_INTA_LOW", 0x0, 4 },
+    { "NV4_PMC_START", 0x0, 4 },
+    { "NV4_PME_AUD_BUFF0_LENGTH", 0x200350, 4 },
+    { "NV4_PME_AUD_BUFF0_LENGTH_BITS", 10, 4 },
+    { "NV4_PME_AUD_BUFF0_START_PNVM", 0x200348, 4 },
+    { "NV4_PME_AUD_BUFF0_START_PNVM_ADDRESS", 4, 4 },
+    { "NV4_PME_AUD_BUFF0_START_SYS", 0x200340, 4 },
+    { "NV4_PME_AUD_BUFF0_START_SYS_ADDRESS", 4, 4 },
+    { "NV4_PME_AUD_BUFF1_LENGTH", 0x200354, 4 },
+    { "NV4_PME_AUD_BUFF1_LENGTH_BITS", 10, 4 },
+    { "NV4_PME_AUD_BUFF1_START_PNVM", 0x20034c, 4 },
+    { "NV4_PME_AUD_BUFF1_START_PNVM_ADDRESS", 4, 4 },
+    { "NV4_PME_AUD_BUFF1_START_SYS", 0x200344, 4 },
+    { "NV4_PME_AUD_BUFF1_START_SYS_ADDRESS", 4, 4 },
+    { "NV4_PME_AUD_CURRENT", 0x200364, 4 },
+    { "NV4_PME_AUD_CURRENT_POS", 2, 4 },
+    { "NV4_PME_AUD_ME_STATE", 0x200358, 4 },
+    { "NV4_PME_AUD_ME_STATE_BUFF0_INTR_CHAINGAP", 8, 4 },
+    { "NV4_PME_AUD_ME_STATE_BUFF0_INTR_NOTIFY", 0, 4 },
+    { "NV4_PME_AUD_ME_STATE_BUFF0_IN_USE", 16, 4 },
+    { "NV4_PME_AUD_ME_STATE_BUFF1_INTR_CHAINGAP", 12, 4 },
+    { "NV4_PME_AUD_ME_STATE_BUFF1_INTR_NOTIFY", 4, 4 },
+    { "NV4_PME_AUD_ME_STATE_BUFF1_IN_USE", 20, 4 },
+    { "NV4_PME_AUD_ME_STATE_CURRENT_BUFFER", 24, 4 },
+    { "NV4_PME_AUD_ME_STATE_CURRENT_BUFFER_0", 0x0, 4 },
+    { "NV4_PME_AUD_ME_STATE_CURRENT_BUFFER_1", 0x1, 4 },
+    { "NV4_PME_AUD_RM_STATE", 0x200360, 4 },
+    { "NV4_PME_AUD_RM_STATE_BUFF0_INTR_CHAINGAP", 8, 4 },
+    { "NV4_PME_AUD_RM_STATE_BUFF0_INTR_NOTIFY", 0, 4 },
+    { "NV4_PME_AUD_RM_STATE_BUFF1_INTR_CHAINGAP", 12, 4 },
+    { "NV4_PME_AUD_RM_STATE_BUFF1_INTR_NOTIFY", 4, 4 },
+    { "NV4_PME_AUD_SU_STATE", 0x20035c, 4 },
+    { "NV4_PME_AUD_SU_STATE_BUFF0_IN_USE", 16, 4 },
+    { "NV4_PME_AUD_SU_STATE_BUFF1_IN_USE", 20, 4 },
+    { "NV4_PME_CONFIG_0", 0x200200, 4 },
+    { "NV4_PME_CONFIG_0_AUD_CD", 16, 4 },
+    { "NV4_PME_CONFIG_0_AUD_CD_ENABLED", 0x1, 4 },
+    { "NV4_PME_CONFIG_0_BUS_MODE", 0, 4 },
+    { "NV4_PME_CONFIG_0_BUS_MODE_CCIR656", 0x2, 4 },
+    { "NV4_PME_CONFIG_0_BUS_MODE_DISABLED", 0x0, 4 },
+    { "NV4_PME_CONFIG_0_BUS_MODE_VMI", 0x1, 4 },
+    { "NV4_PME_CONFIG_0_IMAGE", 4, 4 },
+    { "NV4_PME_CONFIG_0_IMAGE_ENABLED", 0x1, 4 },
+    { "NV4_PME_CONFIG_0_VBI_MODE", 8, 4 },
+    { "NV4_PME_CONFIG_0_VBI_MODE_1", 0x1, 4 },
+    { "NV4_PME_CONFIG_0_VBI_MODE_2", 0x2, 4 },
+    { "NV4_PME_CONFIG_0_VBI_MODE_DISABLED", 0x0, 4 },
+    { "NV4_PME_CONFIG_0_VID_CD", 12, 4 },
+    { "NV4_PME_CONFIG_0_VID_CD_ENABLED", 0x1, 4 },
+    { "NV4_PME_CONFIG_1", 0x200204, 4 },
+    { "NV4_PME_CONFIG_1_BUFFS", 0, 4 },
+    { "NV4_PME_CONFIG_1_BUFFS_PNVM", 0x0, 4 },
+    { "NV4_PME_CONFIG_1_BUFFS_SYS", 0x1, 4 },
+    { "NV4_PME_CONFIG_1_HOST", 4, 4 },
+    { "NV4_PME_CONFIG_1_HOST_AGP", 0x1, 4 },
+    { "NV4_PME_CONFIG_1_HOST_PCI", 0x0, 4 },
+    { "NV4_PME_DEBUG_0", 0x200080, 4 },
+    { "NV4_PME_DEBUG_0_CAPTURE_00_FF", 4, 4 },
+    { "NV4_PME_DEBUG_0_CAPTURE_00_FF_ENABLED", 0x1, 4 },
+    { "NV4_PME_DEBUG_0_DET_FIELD_SWITCH", 0, 4 },
+    { "NV4_PME_DEBUG_0_DET_FIELD_SWITCH_ENABLED", 0x1, 4 },
+    { "NV4_PME_DEBUG_1", 0x200084, 4 },
+    { "NV4_PME_DEBUG_1_MCLK_SEL", 8, 4 },
+    { "NV4_PME_DEBUG_1_MCLK_SEL_DEFAULT", 0x0, 4 },
+    { "NV4_PME_DEBUG_1_SEL", 0, 4 },
+    { "NV4_PME_DEBUG_1_SEL_GLOB", 0x2, 4 },
+    { "NV4_PME_DEBUG_1_SEL_MCLK", 0x1, 4 },
+    { "NV4_PME_DEBUG_1_SEL_VIPCLK", 0x0, 4 },
+    { "NV4_PME_DEBUG_1_VIPCLK_SEL", 4, 4 },
+    { "NV4_PME_DEBUG_1_VIPCLK_SEL_DEFAULT", 0x0, 4 },
+    { "NV4_PME_EXTERNAL_DATA", 0, 4 },
+    { "NV4_PME_EXTERNAL_SIZE_1", 256, 4 },
+    { "NV4_PME_FIFO_CURRENT", 0x200484, 4 },
+    { "NV4_PME_FIFO_CURRENT_ADDRESS", 2, 4 },
+    { "NV4_PME_FIFO_LINE_START", 0x200480, 4 },
+    { "NV4_PME_FIFO_LINE_START_ADDRESS", 4, 4 },
+    { "NV4_PME_IMAGE_BUFF0_LENGTH", 0x200410, 4 },
+    { "NV4_PME_IMAGE_BUFF0_LENGTH_BITS", 4, 4 },
+    { "NV4_PME_IMAGE_BUFF0_PITCH", 0x200408, 4 },
+    { "NV4_PME_IMAGE_BUFF0_PITCH_VALUE", 4, 4 },
+    { "NV4_PME_IMAGE_BUFF0_SCALE_INCR", 0x200424, 4 },
+    { "NV4_PME_IMAGE_BUFF0_SCALE_INCR_X", 0, 4 },
+    { "NV4_PME_IMAGE_BUFF0_SCALE_INCR_Y", 16, 4 },
+    { "NV4_PME_IMAGE_BUFF0_START", 0x200400, 4 },
+    { "NV4_PME_IMAGE_BUFF0_START_ADDRESS", 4, 4 },
+    { "NV4_PME_IMAGE_BUFF1_LENGTH", 0x200414, 4 },
+    { "NV4_PME_IMAGE_BUFF1_LENGTH_BITS", 4, 4 },
+    { "NV4_PME_IMAGE_BUFF1_PITCH", 0x20040c, 4 },
+    { "NV4_PME_IMAGE_BUFF1_PITCH_VALUE", 4, 4 },
+    { "NV4_PME_IMAGE_BUFF1_SCALE_INCR", 0x200428, 4 },
+    { "NV4_PME_IMAGE_BUFF1_SCALE_INCR_X", 0, 4 },
+    { "NV4_PME_IMAGE_BUFF1_SCALE_INCR_Y", 16, 4 },
+    { "NV4_PME_IMAGE_BUFF1_START", 0x200404, 4 },
+    { "NV4_PME_IMAGE_BUFF1_START_ADDRESS", 4, 4 },
+    { "NV4_PME_IMAGE_ME_STATE", 0x200418, 4 },
+    { "NV4_PME_IMAGE_ME_STATE_BUFF0_ERROR_CODE", 8, 4 },
+    { "NV4_PME_IMAGE_ME_STATE_BUFF0_INTR_NOTIFY", 0, 4 },
+    { "NV4_PME_IMAGE_ME_STATE_BUFF0_IN_USE", 16, 4 },
+    { "NV4_PME_IMAGE_ME_STATE_BUFF1_ERROR_CODE", 12, 4 },
+    { "NV4_PME_IMAGE_ME_STATE_BUFF1_INTR_NOTIFY", 4, 4 },
+    { "NV4_PME_IMAGE_ME_STATE_BUFF1_IN_USE", 20, 4 },
+    { "NV4_PME_IMAGE_ME_STATE_CURRENT_BUFFER", 24, 4 },
+    { "NV4_PME_IMAGE_ME_STATE_CURRENT_BUFFER_0", 0x0, 4 },
+    { "NV4_PME_IMAGE_ME_STATE_CURRENT_BUFFER_1", 0x1, 4 },
+    { "NV4_PME_IMAGE_RM_STATE", 0x200420, 4 },
+    { "NV4_PME_IMAGE_RM_STATE_BUFF0_INTR_NOTIFY", 0, 4 },
+    { "NV4_PME_IMAGE_RM_STATE_BUFF1_INTR_NOTIFY", 4, 4 },
+    { "NV4_PME_IMAGE_SU_STATE", 0x20041c, 4 },
+    { "NV4_PME_IMAGE_SU_STATE_BUFF0_FIELD", 8, 4 },
+    { "NV4_PME_IMAGE_SU_STATE_BUFF0_IN_USE", 16, 4 },
+    { "NV4_PME_IMAGE_SU_STATE_BUFF1_FIELD", 12, 4 },
+    { "NV4_PME_IMAGE_SU_STATE_BUFF1_IN_USE", 20, 4 },
+    { "NV4_PME_IMAGE_Y_CROP", 0x20042c, 4 },
+    { "NV4_PME_IMAGE_Y_CROP_STARTLINE", 0, 4 },
+    { "NV4_PME_INTR_0", 0x200100, 4 },
+    { "NV4_PME_INTR_0_AUD_NOTIFY", 12, 4 },
+    { "NV4_PME_INTR_0_AUD_NOTIFY_NOT_PENDING", 0x0, 4 },
+    { "NV4_PME_INTR_0_AUD_NOTIFY_PENDING", 0x1, 4 },
+    { "NV4_PME_INTR_0_AUD_NOTIFY_RESET", 0x1, 4 },
+    { "NV4_PME_INTR_0_IMAGE_NOTIFY", 0, 4 },
+    { "NV4_PME_INTR_0_IMAGE_NOTIFY_NOT_PENDING", 0x0, 4 },
+    { "NV4_PME_INTR_0_IMAGE_NOTIFY_PENDING", 0x1, 4 },
+    { "NV4_PME_INTR_0_IMAGE_NOTIFY_RESET", 0x1, 4 },
+    { "NV4_PME_INTR_0_VBI_NOTIFY", 4, 4 },
+    { "NV4_PME_INTR_0_VBI_NOTIFY_NOT_PENDING", 0x0, 4 },
+    { "NV4_PME_INTR_0_VBI_NOTIFY_PENDING", 0x1, 4 },
+    { "NV4_PME_INTR_0_VBI_NOTIFY_RESET", 0x1, 4 },
+    { "NV4_PME_INTR_0_VID_NOTIFY", 8, 4 },
+    { "NV4_PME_INTR_0_VID_NOTIFY_NOT_PENDING", 0x0, 4 },
+    { "NV4_PME_INTR_0_VID_NOTIFY_PENDING", 0x1, 4 },
+    { "NV4_PME_INTR_0_VID_NOTIFY_RESET", 0x1, 4 },
+    { "NV4_PME_INTR_0_VMI", 16, 4 },
+    { "NV4_PME_INTR_0_VMI_NOT_PENDING", 0x0, 4 },
+    { "NV4_PME_INTR_0_VMI_PENDING", 0x1, 4 },
+    { "NV4_PME_INTR_0_VMI_RESET", 0x1, 4 },
+    { "NV4_PME_INTR_EN_0", 0x200140, 4 },
+    { "NV4_PME_INTR_EN_0_AUD_NOTIFY", 12, 4 },
+    { "NV4_PME_INTR_EN_0_AUD_NOTIFY_ENABLED", 0x1, 4 },
+    { "NV4_PME_INTR_EN_0_IMAGE_NOTIFY", 0, 4 },
+    { "NV4_PME_INTR_EN_0_IMAGE_NOTIFY_ENABLED", 0x1, 4 },
+    { "NV4_PME_INTR_EN_0_VBI_NOTIFY", 4, 4 },
+    { "NV4_PME_INTR_EN_0_VBI_NOTIFY_ENABLED", 0x1, 4 },
+    { "NV4_PME_INTR_EN_0_VID_NOTIFY", 8, 4 },
+    { "NV4_PME_INTR_EN_0_VID_NOTIFY_ENABLED", 0x1, 4 },
+    { "NV4_PME_INTR_EN_0_VMI", 16, 4 },
+    { "NV4_PME_INTR_EN_0_VMI_ENABLED", 0x1, 4 },
+    { "NV4_PME_NULL_DATA", 0x200208, 4 },
+    { "NV4_PME_NULL_DATA_BYTE", 24, 4 },
+    { "NV4_PME_NULL_DATA_COMPARE", 0, 4 },
+    { "NV4_PME_NULL_DATA_COMPARE_ENABLED", 0x1, 4 },
+    { "NV4_PME_NULL_DATA_LINE_DETECT", 4, 4 },
+    { "NV4_PME_NULL_DATA_LINE_DETECT_ENABLED", 0x1, 4 },
+    { "NV4_PME_VBI", 0x2003a4, 4 },
+    { "NV4_PME_VBI_BUFF0_LENGTH", 0x200390, 4 },
+    { "NV4_PME_VBI_BUFF0_LENGTH_BITS", 4, 4 },
+    { "NV4_PME_VBI_BUFF0_PITCH", 0x200388, 4 },
+    { "NV4_PME_VBI_BUFF0_PITCH_VALUE", 4, 4 },
+    { "NV4_PME_VBI_BUFF0_START", 0x200380, 4 },
+    { "NV4_PME_VBI_BUFF0_START_ADDRESS", 4, 4 },
+    { "NV4_PME_VBI_BUFF1_LENGTH", 0x200394, 4 },
+    { "NV4_PME_VBI_BUFF1_LENGTH_BITS", 4, 4 },
+    { "NV4_PME_VBI_BUFF1_PITCH", 0x20038c, 4 },
+    { "NV4_PME_VBI_BUFF1_PITCH_VALUE", 4, 4 },
+    { "NV4_PME_VBI_BUFF1_START", 0x200384, 4 },
+    { "NV4_PME_VBI_BUFF1_START_ADDRESS", 4, 4 },
+    { "NV4_PME_VBI_ME_STATE", 0x200398, 4 },
+    { "NV4_PME_VBI_ME_STATE_BUFF0_ERROR_CODE", 8, 4 },
+    { "NV4_PME_VBI_ME_STATE_BUFF0_INTR_NOTIFY", 0, 4 },
+    { "NV4_PME_VBI_ME_STATE_BUFF0_IN_USE", 16, 4 },
+    { "NV4_PME_VBI_ME_STATE_BUFF1_ERROR_CODE", 12, 4 },
+    { "NV4_PME_VBI_ME_STATE_BUFF1_INTR_NOTIFY", 4, 4 },
+    { "NV4_PME_VBI_ME_STATE_BUFF1_IN_USE", 20, 4 },
+    { "NV4_PME_VBI_ME_STATE_CURRENT_BUFFER", 24, 4 },
+    { "NV4_PME_VBI_ME_STATE_CURRENT_BUFFER_0", 0x0, 4 },
+    { "NV4_PME_VBI_ME_STATE_CURRENT_BUFFER_1", 0x1, 4 },
+    { "NV4_PME_VBI_NUM_LINES", 16, 4 },
+    { "NV4_PME_VBI_RM_STATE", 0x2003a0, 4 },
+    { "NV4_PME_VBI_RM_STATE_BUFF0_INTR_NOTIFY", 0, 4 },
+    { "NV4_PME_VBI_RM_STATE_BUFF1_INTR_NOTIFY", 4, 4 },
+    { "NV4_PME_VBI_START_LINE", 0, 4 },
+    { "NV4_PME_VBI_SU_STATE", 0x20039c, 4 },
+    { "NV4_PME_VBI_SU_STATE_BUFF0_FIELD", 8, 4 },
+    { "NV4_PME_VBI_SU_STATE_BUFF0_IN_USE", 16, 4 },
+    { "NV4_PME_VBI_SU_STATE_BUFF1_FIELD", 12, 4 },
+    { "NV4_PME_VBI_SU_STATE_BUFF1_IN_USE", 20, 4 },
+    { "NV4_PME_VID_BUFF0_LENGTH", 0x200310, 4 },
+    { "NV4_PME_VID_BUFF0_LENGTH_BITS", 12, 4 },
+    { "NV4_PME_VID_BUFF0_START_PNVM", 0x200308, 4 },
+    { "NV4_PME_VID_BUFF0_START_PNVM_ADDRESS", 4, 4 },
+    { "NV4_PME_VID_BUFF0_START_SYS", 0x200300, 4 },
+    { "NV4_PME_VID_BUFF0_START_SYS_ADDRESS", 4, 4 },
+    { "NV4_PME_VID_BUFF1_LENGTH", 0x200314, 4 },
+    { "NV4_PME_VID_BUFF1_LENGTH_BITS", 12, 4 },
+    { "NV4_PME_VID_BUFF1_START_PNVM", 0x20030c, 4 },
+    { "NV4_PME_VID_BUFF1_START_PNVM_ADDRESS", 4, 4 },
+    { "NV4_PME_VID_BUFF1_START_SYS", 0x200304, 4 },
+    { "NV4_PME_VID_BUFF1_START_SYS_ADDRESS", 4, 4 },
+    { "NV4_PME_VID_CURRENT", 0x200324, 4 },
+    { "NV4_PME_VID_CURRENT_POS", 2, 4 },
+    { "NV4_PME_VID_ME_STATE", 0x200318, 4 },
+    { "NV4_PME_VID_ME_STATE_BUFF0_INTR_CHAINGAP", 8, 4 },
+    { "NV4_PME_VID_ME_STATE_BUFF0_INTR_NOTIFY", 0, 4 },
+    { "NV4_PME_VID_ME_STATE_BUFF0_IN_USE", 16, 4 },
+    { "NV4_PME_VID_ME_STATE_BUFF1_INTR_CHAINGAP", 12, 4 },
+    { "NV4_PME_VID_ME_STATE_BUFF1_INTR_NOTIFY", 4, 4 },
+    { "NV4_PME_VID_ME_STATE_BUFF1_IN_USE", 20, 4 },
+    { "NV4_PME_VID_ME_STATE_CURRENT_BUFFER", 24, 4 },
+    { "NV4_PME_VID_ME_STATE_CURRENT_BUFFER_0", 0x0, 4 },
+    { "NV4_PME_VID_ME_STATE_CURRENT_BUFFER_1", 0x1, 4 },
+    { "NV4_PME_VID_RM_STATE", 0x200320, 4 },
+    { "NV4_PME_VID_RM_STATE_BUFF0_INTR_CHAINGAP", 8, 4 },
+    { "NV4_PME_VID_RM_STATE_BUFF0_INTR_NOTIFY", 0, 4 },
+    { "NV4_PME_VID_RM_STATE_BUFF1_INTR_CHAINGAP", 12, 4 },
+    { "NV4_PME_VID_RM_STATE_BUFF1_INTR_NOTIFY", 4, 4 },
+    { "NV4_PME_VID_SU_STATE", 0x20031c, 4 },
+    { "NV4_PME_VID_SU_STATE_BUFF0_IN_USE", 16, 4 },
+    { "NV4_PME_VID_SU_STATE_BUFF1_IN_USE", 20, 4 },
+    { "NV4_PME_VMI_POLL", 0x200488, 4 },
+    { "NV4_PME_VMI_POLL_AUDCD", 2, 4 },
+    { "NV4_PME_VMI_POLL_AUDCD_NOT_PENDING", 0x0, 4 },
+    { "NV4_PME_VMI_POLL_AUDCD_PENDING", 0x1, 4 },
+    { "NV4_PME_VMI_POLL_CPURDREC", 4, 4 },
+    { "NV4_PME_VMI_POLL_CPURDREC_NOT_PENDING", 0x0, 4 },
+    { "NV4_PME_VMI_POLL_CPURDREC_PENDING", 0x1, 4 },
+    { "NV4_PME_VMI_POLL_INT", 3, 4 },
+    { "NV4_PME_VMI_POLL_INT_NOT_PENDING", 0x0, 4 },
+    { "NV4_PME_VMI_POLL_INT_PENDING", 0x1, 4 },
+    { "NV4_PME_VMI_POLL_UNCD", 0, 4 },
+    { "NV4_PME_VMI_POLL_UNCD_NOT_PENDING", 0x0, 4 },
+    { "NV4_PME_VMI_POLL_UNCD_PENDING", 0x1, 4 },
+    { "NV4_PME_VMI_POLL_VIDCD", 1, 4 },
+    { "NV4_PME_VMI_POLL_VIDCD_NOT_PENDING", 0x0, 4 },
+    { "NV4_PME_VMI_POLL_VIDCD_PENDING", 0x1, 4 },
+    { "NV4_PRAMDAC_BLANK_COLOR", 0x680714, 4 },
+    { "NV4_PRAMDAC_BLANK_COLOR_VAL", 0, 4 },
+    { "NV4_PRAMDAC_CHECKSUM", 0x68060C, 4 },
+    { "NV4_PRAMDAC_CHECKSUM_VALUE", 0, 4 },
+    { "NV4_PRAMDAC_CU_START_POS", 0x680300, 4 },
+    { "NV4_PRAMDAC_CU_START_POS_X", 0, 4 },
+    { "NV4_PRAMDAC_CU_START_POS_Y", 16, 4 },
+    { "NV4_PRAMDAC_END", 0x680FFF, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL", 0x680600, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_ALT_MODE", 12, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_ALT_MODE_15", 0x0, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_ALT_MODE_16", 0x1, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_ALT_MODE_24", 0x0, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_ALT_MODE_30", 0x1, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_ALT_MODE_NOTSEL", 0x0, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_ALT_MODE_SEL", 0x1, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_BLK_PEDSTL", 16, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_BLK_PEDSTL_OFF", 0x0, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_BLK_PEDSTL_ON", 0x1, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_BPC", 20, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_BPC_6BITS", 0x0, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_BPC_8BITS", 0x1, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_DAC_SLEEP", 24, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_DAC_SLEEP_DIS", 0x0, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_DAC_SLEEP_EN", 0x1, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_PALETTE_CLK", 28, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_PALETTE_CLK_DIS", 0x1, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_PALETTE_CLK_EN", 0x0, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_PIXMIX", 4, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_PIXMIX32_BIT", 0, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_PIXMIX32_BIT_24", 0x1, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_PIXMIX32_BIT_31", 0x0, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_PIXMIX_NEG", 0x2, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_PIXMIX_OFF", 0x0, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_PIXMIX_ON", 0x3, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_PIXMIX_POS", 0x1, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_TERMINATION", 17, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_TERMINATION_37OHM", 0x0, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_TERMINATION_75OHM", 0x1, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_VGA_STATE", 8, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_VGA_STATE_NOTSEL", 0x0, 4 },
+    { "NV4_PRAMDAC_GENERAL_CONTROL_VGA_STATE_SEL", 0x1, 4 },
+    { "NV4_PRAMDAC_MPLL_COEFF", 0x680504, 4 },
+    { "NV4_PRAMDAC_MPLL_COEFF_MDIV", 0, 4 },
+    { "NV4_PRAMDAC_MPLL_COEFF_NDIV", 8, 4 },
+    { "NV4_PRAMDAC_MPLL_COEFF_PDIV", 16, 4 },
+    { "NV4_PRAMDAC_NVPLL_COEFF", 0x680500, 4 },
+    { "NV4_PRAMDAC_NVPLL_COEFF_MDIV", 0, 4 },
+    { "NV4_PRAMDAC_NVPLL_COEFF_NDIV", 8, 4 },
+    { "NV4_PRAMDAC_NVPLL_COEFF_PDIV", 16, 4 },
+    { "NV4_PRAMDAC_PALETTE_RECOVERY", 0x680604, 4 },
+    { "NV4_PRAMDAC_PALETTE_RECOVERY_ACTIVE_ADDRESS", 0, 4 },
+    { "NV4_PRAMDAC_PALETTE_RECOVERY_DAC_STATE", 12, 4 },
+    { "NV4_PRAMDAC_PALETTE_RECOVERY_DAC_STATE_READ", 0x3, 4 },
+    { "NV4_PRAMDAC_PALETTE_RECOVERY_DAC_STATE_WRITE", 0x0, 4 },
+    { "NV4_PRAMDAC_PALETTE_RECOVERY_GREEN_DATA", 24, 4 },
+    { "NV4_PRAMDAC_PALETTE_RECOVERY_RED_DATA", 16, 4 },
+    { "NV4_PRAMDAC_PALETTE_RECOVERY_RGB_POINTER", 8, 4 },
+    { "NV4_PRAMDAC_PALETTE_RECOVERY_RGB_POINTER_BLUE", 0x4, 4 },
+    { "NV4_PRAMDAC_PALETTE_RECOVERY_RGB_POINTER_GREEN", 0x2, 4 },
+    { "NV4_PRAMDAC_PALETTE_RECOVERY_RGB_POINTER_RED", 0x1, 4 },
+    { "NV4_PRAMDAC_PALETTE_TEST", 0x680518, 4 },
+    { "NV4_PRAMDAC_PALETTE_TEST_ADDRINC", 28, 4 },
+    { "NV4_PRAMDAC_PALETTE_TEST_ADDRINC_READWRITE", 0x0, 4 },
+    { "NV4_PRAMDAC_PALETTE_TEST_ADDRINC_WRITEONLY", 0x1, 4 },
+    { "NV4_PRAMDAC_PALETTE_TEST_BLUE_DATA", 0, 4 },
+    { "NV4_PRAMDAC_PALETTE_TEST_GREEN_DATA", 8, 4 },
+    { "NV4_PRAMDAC_PALETTE_TEST_MODE", 24, 4 },
+    { "NV4_PRAMDAC_PALETTE_TEST_MODE_24BIT", 0x1, 4 },
+    { "NV4_PRAMDAC_PALETTE_TEST_MODE_8BIT", 0x0, 4 },
+    { "NV4_PRAMDAC_PALETTE_TEST_RED_DATA", 16, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT", 0x68050C, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_SOURCE", 8, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_SOURCE_DEFAULT", 0x0, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_SOURCE_PROG_ALL", 0x7, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_SOURCE_PROG_MPLL", 0x1, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_SOURCE_PROG_NVPLL", 0x4, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_SOURCE_PROG_VPLL", 0x2, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_TVCLK_RATIO", 24, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_TVCLK_RATIO_DB1", 0x0, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_TVCLK_RATIO_DB2", 0x1, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_TVCLK_SOURCE", 20, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_TVCLK_SOURCE_EXT", 0x0, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_TVCLK_SOURCE_VIP", 0x1, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_VCLK_RATIO", 28, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_VCLK_RATIO_DB1", 0x0, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_VCLK_RATIO_DB2", 0x1, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_VPLL_SOURCE", 0, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_VPLL_SOURCE_VIP", 0x1, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_VPLL_SOURCE_XTAL", 0x0, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_VS_PCLK_TV", 16, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_VS_PCLK_TV_BOTH", 0x3, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_VS_PCLK_TV_NONE", 0x0, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_VS_PCLK_TV_PCLK", 0x2, 4 },
+    { "NV4_PRAMDAC_PLL_COEFF_SELECT_VS_PCLK_TV_VSCLK", 0x1, 4 },
+    { "NV4_PRAMDAC_PLL_SETUP_CONTROL", 0x680510, 4 },
+    { "NV4_PRAMDAC_PLL_SETUP_CONTROL_PWRDWN", 12, 4 },
+    { "NV4_PRAMDAC_PLL_SETUP_CONTROL_PWRDWN_MPLL", 0x1, 4 },
+    { "NV4_PRAMDAC_PLL_SETUP_CONTROL_PWRDWN_NVPLL", 0x4, 4 },
+    { "NV4_PRAMDAC_PLL_SETUP_CONTROL_PWRDWN_OFF", 0x7, 4 },
+    { "NV4_PRAMDAC_PLL_SETUP_CONTROL_PWRDWN_ON", 0x0, 4 },
+    { "NV4_PRAMDAC_PLL_SETUP_CONTROL_PWRDWN_VPLL", 0x2, 4 },
+    { "NV4_PRAMDAC_PLL_SETUP_CONTROL_VAL", 0x44E, 4 },
+    { "NV4_PRAMDAC_PLL_SETUP_CONTROL_VALUE", 0, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER", 0x680514, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_ENABLE", 16, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_ENABLE_ASSERTED", 0x1, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_ENABLE_DEASSERTED", 0x0, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_MPLL_LOCK", 30, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_MPLL_LOCKED", 0x1, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_MPLL_NOTLOCKED", 0x0, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_NOOFIPCLKS", 0, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_NVPLL_LOCK", 29, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_NVPLL_LOCKED", 0x1, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_NVPLL_NOTLOCKED", 0x0, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_PDIVRST_ASSERTED", 0x1, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_PDIVRST_DEASSERTED", 0x0, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_PDIV_RST", 28, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_RESET", 20, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_RESET_ASSERTED", 0x1, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_RESET_DEASSERTED", 0x0, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_SOURCE", 24, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_SOURCE_MCLK", 0x2, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_SOURCE_NVCLK", 0x0, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_SOURCE_VCLK", 0x1, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_VALUE", 0, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_VPLL_LOCK", 31, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_VPLL_LOCKED", 0x1, 4 },
+    { "NV4_PRAMDAC_PLL_TEST_COUNTER_VPLL_NOTLOCKED", 0x0, 4 },
+    { "NV4_PRAMDAC_START", 0x680300, 4 },
+    { "NV4_PRAMDAC_TESTPOINT_DATA", 0x680610, 4 },
+    { "NV4_PRAMDAC_TESTPOINT_DATA_BLACK", 30, 4 },
+    { "NV4_PRAMDAC_TESTPOINT_DATA_BLUE", 20, 4 },
+    { "NV4_PRAMDAC_TESTPOINT_DATA_GREEN", 10, 4 },
+    { "NV4_PRAMDAC_TESTPOINT_DATA_NOTBLANK", 31, 4 },
+    { "NV4_PRAMDAC_TESTPOINT_DATA_RED", 0, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL", 0x680608, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_CRC_CHANNEL", 8, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_CRC_CHANNEL_BLUE", 0x0, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_CRC_CHANNEL_GREEN", 0x1, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_CRC_CHANNEL_RED", 0x2, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_CRC_ENABLE", 4, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_CRC_ENABLE_ASSERTED", 0x1, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_CRC_ENABLE_DEASSERTED", 0x0, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_CRC_RESET", 0, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_CRC_RESET_ASSERTED", 0x1, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_CRC_RESET_DEASSERTED", 0x0, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_DACTM", 20, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_DACTM_NORMAL", 0x0, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_DACTM_TEST", 0x1, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_PWRDWN_DAC", 16, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_PWRDWN_DAC_OFF", 0x1, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_PWRDWN_DAC_ON", 0x0, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_SENSEB", 28, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_SENSEB_ALLHI", 0x1, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_SENSEB_SOMELO", 0x0, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_TPATH1", 24, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_TPATH1_CLEAR", 0x0, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_TPATH1_SET", 0x1, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_TPATH31", 25, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_TPATH31_CLEAR", 0x0, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_TPATH31_SET", 0x1, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_TP_INS_EN", 12, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_TP_INS_EN_ASSERTED", 0x1, 4 },
+    { "NV4_PRAMDAC_TEST_CONTROL_TP_INS_EN_DEASSERTED", 0x0, 4 },
+    { "NV4_PRAMDAC_TV_CHECKSUM", 0x680718, 4 },
+    { "NV4_PRAMDAC_TV_CHECKSUM_VAL", 0, 4 },
+    { "NV4_PRAMDAC_TV_HBLANK_END", 0x680710, 4 },
+    { "NV4_PRAMDAC_TV_HBLANK_END_VAL", 0, 4 },
+    { "NV4_PRAMDAC_TV_HBLANK_START", 0x68070C, 4 },
+    { "NV4_PRAMDAC_TV_HBLANK_START_VAL", 0, 4 },
+    { "NV4_PRAMDAC_TV_SETUP", 0x680700, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_COMP_SRC", 12, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_COMP_SRC_NO_SCALER", 0x1, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_COMP_SRC_SCALER", 0x0, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_DATA_SRC", 8, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_DATA_SRC_COMP", 0x0, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_DATA_SRC_SCALER", 0x1, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_DATA_SRC_VIP", 0x2, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_DEV_TYPE", 0, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_DEV_TYPE_MASTER", 0x1, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_DEV_TYPE_SLAVE", 0x0, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_SYNC_POL", 16, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_SYNC_POL_NEG_BOTH", 0x3, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_SYNC_POL_NEG_HSYNC", 0x1, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_SYNC_POL_NEG_NONE", 0x0, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_SYNC_POL_NEG_VSYNC", 0x2, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_VIP_DATAPOS", 24, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_VIP_DATAPOS_11_4", 0x1, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_VIP_DATAPOS_7_0", 0x0, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_VIP_FIELD", 28, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_VIP_FIELD_0", 0x0, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_VIP_FIELD_1", 0x1, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_VIP_VSYNC", 20, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_VIP_VSYNC_LEAD", 0x0, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_VIP_VSYNC_TRAIL", 0x1, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_VS_PIXFMT", 4, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_VS_PIXFMT_101010", 0x3, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_VS_PIXFMT_555", 0x0, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_VS_PIXFMT_565", 0x1, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_VS_PIXFMT_888", 0x2, 4 },
+    { "NV4_PRAMDAC_TV_SETUP_VS_PIXFMT_YUV", 0x4, 4 },
+    { "NV4_PRAMDAC_TV_TEST_CONTROL", 0x68071c, 4 },
+    { "NV4_PRAMDAC_TV_TEST_CONTROL_CRC_CHANNEL", 8, 4 },
+    { "NV4_PRAMDAC_TV_TEST_CONTROL_CRC_CHANNEL_15_8", 0x1, 4 },
+    { "NV4_PRAMDAC_TV_TEST_CONTROL_CRC_CHANNEL_23_16", 0x2, 4 },
+    { "NV4_PRAMDAC_TV_TEST_CONTROL_CRC_CHANNEL_7_0", 0x0, 4 },
+    { "NV4_PRAMDAC_TV_TEST_CONTROL_CRC_ENABLE", 4, 4 },
+    { "NV4_PRAMDAC_TV_TEST_CONTROL_CRC_ENABLE_ASSERTED", 0x1, 4 },
+    { "NV4_PRAMDAC_TV_TEST_CONTROL_CRC_ENABLE_DEASSERTED", 0x0, 4 },
+    { "NV4_PRAMDAC_TV_TEST_CONTROL_CRC_RESET", 0, 4 },
+    { "NV4_PRAMDAC_TV_TEST_CONTROL_CRC_RESET_ASSERTED", 0x1, 4 },
+    { "NV4_PRAMDAC_TV_TEST_CONTROL_CRC_RESET_DEASSERTED", 0x0, 4 },
+    { "NV4_PRAMDAC_TV_VBLANK_END", 0x680708, 4 },
+    { "NV4_PRAMDAC_TV_VBLANK_END_VAL", 0, 4 },
+    { "NV4_PRAMDAC_TV_VBLANK_START", 0x680704, 4 },
+    { "NV4_PRAMDAC_TV_VBLANK_START_VAL", 0, 4 },
+    { "NV4_PRAMDAC_TV_VSYNC", 28, 4 },
+    { "NV4_PRAMDAC_TV_VSYNC_ACTIVE", 0x0, 4 },
+    { "NV4_PRAMDAC_TV_VSYNC_INACTIVE", 0x1, 4 },
+    { "NV4_PRAMDAC_VPLL_COEFF", 0x680508, 4 },
+    { "NV4_PRAMDAC_VPLL_COEFF_MDIV", 0, 4 },
+    { "NV4_PRAMDAC_VPLL_COEFF_NDIV", 8, 4 },
+    { "NV4_PRAMDAC_VPLL_COEFF_PDIV", 16, 4 },
+    { "NV4_PRAMIN_CTX_0_CHROMA_KEY", 12, 4 },
+    { "NV4_PRAMIN_CTX_0_CHROMA_KEY_ENABLE", 0x1, 4 },
+    { "NV4_PRAMIN_CTX_0_CONTEXT_SURFACE", 25, 4 },
+    { "NV4_PRAMIN_CTX_0_CONTEXT_SURFACE_INVALID", 0x0, 4 },
+    { "NV4_PRAMIN_CTX_0_CONTEXT_SURFACE_VALID", 0x1, 4 },
+    { "NV4_PRAMIN_CTX_0_NVCLASS", 0, 4 },
+    { "NV4_PRAMIN_CTX_0_PATCH_CONFIG_BLEND_AND", 0x2, 4 },
+    { "NV4_PRAMIN_CTX_0_PATCH_CONFIG_BLEND_PRE", 0x5, 4 },
+    { "NV4_PRAMIN_CTX_0_PATCH_CONFIG_ROP_AND", 0x1, 4 },
+    { "NV4_PRAMIN_CTX_0_PATCH_CONFIG_SRCCOPY", 0x3, 4 },
+    { "NV4_PRAMIN_CTX_0_PATCH_CONFIG_SRCCOPY_AND", 0x0, 4 },
+    { "NV4_PRAMIN_CTX_0_PATCH_CONFIG_SRCCOPY_PRE", 0x4, 4 },
+    { "NV4_PRAMIN_CTX_0_PATCH_STATUS", 24, 4 },
+    { "NV4_PRAMIN_CTX_0_PATCH_STATUS_INVALID", 0x0, 4 },
+    { "NV4_PRAMIN_CTX_0_PATCH_STATUS_VALID", 0x1, 4 },
+    { "NV4_PRAMIN_CTX_0_SIZE_1", 0x10000, 4 },
+    { "NV4_PRAMIN_CTX_0_SWIZZLE", 14, 4 },
+    { "NV4_PRAMIN_CTX_0_SWIZZLE_ENABLE", 0x1, 4 },
+    { "NV4_PRAMIN_CTX_0_USER_CLIP", 13, 4 },
+    { "NV4_PRAMIN_CTX_0_USER_CLIP_ENABLE", 0x1, 4 },
+    { "NV4_PRAMIN_CTX_1_COLOR_FORMAT", 8, 4 },
+    { "NV4_PRAMIN_CTX_1_COLOR_FORMAT_INVALID", 0x00, 4 },
+    { "NV4_PRAMIN_CTX_1_COLOR_FORMAT_LE_A16R5G6B5", 0x0B, 4 },
+    { "NV4_PRAMIN_CTX_1_COLOR_FORMAT_LE_A16Y16", 0x10, 4 },
+    { "NV4_PRAMIN_CTX_1_COLOR_FORMAT_LE_A1R5G5B5", 0x06, 4 },
+    { "NV4_PRAMIN_CTX_1_COLOR_FORMAT_LE_A8R8G8B8", 0x0D, 4 },
+    { "NV4_PRAMIN_CTX_1_COLOR_FORMAT_LE_R5G6B5", 0x0A, 4 },
+    { "NV4_PRAMIN_CTX_1_COLOR_FORMAT_LE_V8YB8U8YA8", 0x12, 4 },
+    { "NV4_PRAMIN_CTX_1_COLOR_FORMAT_LE_X16A1R5G5B5", 0x08, 4 },
+    { "NV4_PRAMIN_CTX_1_COLOR_FORMAT_LE_X16A8Y8", 0x02, 4 },
+    { "NV4_PRAMIN_CTX_1_COLOR_FORMAT_LE_X16R5G6B5", 0x0C, 4 },
+    { "NV4_PRAMIN_CTX_1_COLOR_FORMAT_LE_X16Y16", 0x11, 4 },
+    { "NV4_PRAMIN_CTX_1_COLOR_FORMAT_LE_X17R5G5B5", 0x09, 4 },
+    { "NV4_PRAMIN_CTX_1_COLOR_FORMAT_LE_X1R5G5B5", 0x07, 4 },
+    { "NV4_PRAMIN_CTX_1_COLOR_FORMAT_LE_X24Y8", 0x03, 4 },
+    { "NV4_PRAMIN_CTX_1_COLOR_FORMAT_LE_X8R8G8B8", 0x0E, 4 },
+    { "NV4_PRAMIN_CTX_1_COLOR_FORMAT_LE_Y16", 0x0F, 4 },
+    { "NV4_PRAMIN_CTX_1_COLOR_FORMAT_LE_Y32", 0x14, 4 },
+    { "NV4_PRAMIN_CTX_1_COLOR_FORMAT_LE_Y8", 0x01, 4 },
+    { "NV4_PRAMIN_CTX_1_COLOR_FORMAT_LE_YB8V8YA8U8", 0x13, 4 },
+    { "NV4_PRAMIN_CTX_1_MONO_FORMAT", 0, 4 },
+    { "NV4_PRAMIN_CTX_1_MONO_FORMAT_CGA6_M1", 0x01, 4 },
+    { "NV4_PRAMIN_CTX_1_MONO_FORMAT_INVALID", 0x00, 4 },
+    { "NV4_PRAMIN_CTX_1_MONO_FORMAT_LE_M1", 0x02, 4 },
+    { "NV4_PRAMIN_CTX_1_NOTIFY_INSTANCE", 16, 4 },
+    { "NV4_PRAMIN_CTX_1_NOTIFY_INSTANCE_INVALID", 0x00, 4 },
+    { "NV4_PRAMIN_CTX_1_SIZE_1", 0x10000, 4 },
+    { "NV4_PRAMIN_CTX_2_DMA_0_INSTANCE", 0, 4 },
+    { "NV4_PRAMIN_CTX_2_DMA_0_INSTANCE_INVALID", 0x00, 4 },
+    { "NV4_PRAMIN_CTX_2_DMA_1_INSTANCE", 16, 4 },
+    { "NV4_PRAMIN_CTX_2_DMA_1_INSTANCE_INVALID", 0x00, 4 },
+    { "NV4_PRAMIN_CTX_2_SIZE_1", 0x10000, 4 },
+    { "NV4_PRAMIN_END", 0x7FFFFF, 4 },
+    { "NV4_PRAMIN_RAMFC_END", 0x7111FF, 4 },
+    { "NV4_PRAMIN_RAMFC_START", 0x711000, 4 },
+    { "NV4_PRAMIN_RAMHT_END", 0x710FFF, 4 },
+    { "NV4_PRAMIN_RAMHT_START", 0x710000, 4 },
+    { "NV4_PRAMIN_RAMRO_END", 0x7113FF, 4 },
+    { "NV4_PRAMIN_RAMRO_START", 0x711200, 4 },
+    { "NV4_PRAMIN_SIZE", 0xFFFFF, 4 },
+    { "NV4_PRAMIN_START", 0x700000, 4 },
+    { "NV4_PRMCIO_ARX", 0x6013c0, 4 },
+    { "NV4_PRMCIO_AR_CSEL_INDEX", 0x14, 4 },
+    { "NV4_PRMCIO_AR_HPP_INDEX", 0x13, 4 },
+    { "NV4_PRMCIO_AR_MODE_INDEX", 0x10, 4 },
+    { "NV4_PRMCIO_AR_OSCAN_INDEX", 0x11, 4 },
+    { "NV4_PRMCIO_AR_PALETTE_READ", 0x6013c1, 4 },
+    { "NV4_PRMCIO_AR_PALETTE_WRITE", 0x6013c0, 4 },
+    { "NV4_PRMCIO_AR_PLANE_INDEX", 0x12, 4 },
+    { "NV4_PRMCIO_AR_READ", 0x6013c1, 4 },
+    { "NV4_PRMCIO_AR_WRITE", 0x6013c0, 4 },
+    { "NV4_PRMCIO_CRE_COLOR", 0x6013d5, 4 },
+    { "NV4_PRMCIO_CRE_MONO", 0x6013b5, 4 },
+    { "NV4_PRMCIO_CRX_COLOR", 0x6013d4, 4 },
+    { "NV4_PRMCIO_CRX_MONO", 0x6013b4, 4 },
+    { "NV4_PRMCIO_CR_COLOR", 0x6013d5, 4 },
+    { "NV4_PRMCIO_CR_MONO", 0x6013b5, 4 },
+    { "NV4_PRMCIO_END", 0x601FFF, 4 },
+    { "NV4_PRMCIO_INP0", 0x6013c2, 4 },
+    { "NV4_PRMCIO_INP0_COLOR", 0x6013da, 4 },
+    { "NV4_PRMCIO_INP0_MONO", 0x6013ba, 4 },
+    { "NV4_PRMCIO_INP0_READ_MONO", 0x6013ca, 4 },
+    { "NV4_PRMCIO_INP0_WRITE_COLOR", 0x6013da, 4 },
+    { "NV4_PRMCIO_INP0_WRITE_MONO", 0x6013ba, 4 },
+    { "NV4_PRMCIO_START", 0x601000, 4 },
+    { "NV4_PRMDIO_END", 0x681FFF, 4 },
+    { "NV4_PRMDIO_START", 0x681000, 4 },
+    { "NV4_PRMIO_END", 0x7FFF, 4 },
+    { "NV4_PRMIO_RMA_DATA", 0x7108, 4 },
+    { "NV4_PRMIO_RMA_DATA32", 0x710C, 4 },
+    { "NV4_PRMIO_RMA_DATA32_BYTE0", 0, 4 },
+    { "NV4_PRMIO_RMA_DATA32_BYTE1", 8, 4 },
+    { "NV4_PRMIO_RMA_DATA32_BYTE2", 16, 4 },
+    { "NV4_PRMIO_RMA_DATA_PORT", 0, 4 },
+    { "NV4_PRMIO_RMA_ID", 0x7100, 4 },
+    { "NV4_PRMIO_RMA_ID_CODE", 0, 4 },
+    { "NV4_PRMIO_RMA_ID_CODE_VALID", 0x2B16D065, 4 },
+    { "NV4_PRMIO_RMA_MODE_MAX", 0x0F, 4 },
+    { "NV4_PRMIO_RMA_PTR", 0x7104, 4 },
+    { "NV4_PRMIO_RMA_PTR_ADDRESS", 2, 4 },
+    { "NV4_PRMIO_START", 0x7000, 4 },
+    { "NV4_PRMVGA", 0xA0000, 4 },
+    { "NV4_PRMVGA_END", 0xBFFFF, 4 },
+    { "NV4_PRMVIO_ADDEN", 0xC46e8, 4 },
+    { "NV4_PRMVIO_END", 0xC7FFF, 4 },
+    { "NV4_PRMVIO_GX_BIT_MASK_INDEX", 0x8, 4 },
+    { "NV4_PRMVIO_GX_CCOMP_INDEX", 0x2, 4 },
+    { "NV4_PRMVIO_GX_DONT_CARE_INDEX", 0x7, 4 },
+    { "NV4_PRMVIO_GX_MISC_BANKED_128K_A0000", 0x00, 4 },
+    { "NV4_PRMVIO_GX_MISC_BANKED_32K_B0000", 0x08, 4 },
+    { "NV4_PRMVIO_GX_MISC_BANKED_32K_B8000", 0x0C, 4 },
+    { "NV4_PRMVIO_GX_MISC_BANKED_64K_A0000", 0x04, 4 },
+    { "NV4_PRMVIO_GX_MISC_INDEX", 0x6, 4 },
+    { "NV4_PRMVIO_GX_MODE_INDEX", 0x5, 4 },
+    { "NV4_PRMVIO_GX_READ_MAP_INDEX", 0x4, 4 },
+    { "NV4_PRMVIO_GX_ROP_INDEX", 0x3, 4 },
+    { "NV4_PRMVIO_GX_SR", 0xC03cf, 4 },
+    { "NV4_PRMVIO_GX_SREN_INDEX", 0x1, 4 },
+    { "NV4_PRMVIO_GX_SR_INDEX", 0x0, 4 },
+    { "NV4_PRMVIO_MBEN", 0xC0094, 4 },
+    { "NV4_PRMVIO_MISC_READ", 0xC03cc, 4 },
+    { "NV4_PRMVIO_MISC_WRITE", 0xC03c2, 4 },
+    { "NV4_PRMVIO_SRX", 0xC03c4, 4 },
+    { "NV4_PRMVIO_SR_CHAR_MAP_INDEX", 0x3, 4 },
+    { "NV4_PRMVIO_SR_CLOCK_INDEX", 0x1, 4 },
+    { "NV4_PRMVIO_SR_MEM_MODE_INDEX", 0x4, 4 },
+    { "NV4_PRMVIO_SR_PLANE_MASK_INDEX", 0x2, 4 },
+    { "NV4_PRMVIO_SR_RESET", 0xC03c5, 4 },
+    { "NV4_PRMVIO_SR_RESET_INDEX", 0x0, 4 },
+    { "NV4_PRMVIO_START", 0xC0000, 4 },
+    { "NV4_PRMVIO_VSE1", 0xC0102, 4 },
+    { "NV4_PRMVIO_VSE2", 0xC03c3, 4 },
+    { "NV4_PRM_IGNORE_0", 0x4320, 4 },
+    { "NV4_PRM_IGNORE_0_FM", 4, 4 },
+    { "NV4_PRM_IGNORE_0_FM_DISABLED", 0x0, 4 },
+    { "NV4_PRM_IGNORE_0_FM_READS", 0x2, 4 },
+    { "NV4_PRM_IGNORE_0_FM_READS_WRITES", 0x3, 4 },
+    { "NV4_PRM_IGNORE_0_FM_WRITES", 0x1, 4 },
+    { "NV4_PRM_IGNORE_0_MPU401", 0, 4 },
+    { "NV4_PRM_IGNORE_0_MPU401_DISABLED", 0x0, 4 },
+    { "NV4_PRM_IGNORE_0_MPU401_READS", 0x2, 4 },
+    { "NV4_PRM_IGNORE_0_MPU401_READS_WRITES", 0x3, 4 },
+    { "NV4_PRM_IGNORE_0_MPU401_WRITES", 0x1, 4 },
+    { "NV4_PRM_IGNORE_0_SB_DIGITAL", 8, 4 },
+    { "NV4_PRM_IGNORE_0_SB_DIGITAL_DISABLED", 0x0, 4 },
+    { "NV4_PRM_IGNORE_0_SB_DIGITAL_READS", 0x2, 4 },
+    { "NV4_PRM_IGNORE_0_SB_DIGITAL_READS_WRITES", 0x3, 4 },
+    { "NV4_PRM_IGNORE_0_SB_DIGITAL_WRITES", 0x1, 4 },
+    { "NV4_PRM_IGNORE_0_SB_MIXER", 12, 4 },
+    { "NV4_PRM_IGNORE_0_SB_MIXER_DISABLED", 0x0, 4 },
+    { "NV4_PRM_IGNORE_0_SB_MIXER_READS", 0x2, 4 },
+    { "NV4_PRM_IGNORE_0_SB_MIXER_READS_WRITES", 0x3, 4 },
+    { "NV4_PRM_IGNORE_0_SB_MIXER_WRITES", 0x1, 4 },
+    { "NV4_PRM_INTR_0", 0x4100, 4 },
+    { "NV4_PRM_INTR_0_TRACE_FM", 4, 4 },
+    { "NV4_PRM_INTR_0_TRACE_FM_NOT_PENDING", 0x0, 4 },
+    { "NV4_PRM_INTR_0_TRACE_FM_PENDING", 0x1, 4 },
+    { "NV4_PRM_INTR_0_TRACE_FM_RESET", 0x1, 4 },
+    { "NV4_PRM_INTR_0_TRACE_MPU401", 0, 4 },
+    { "NV4_PRM_INTR_0_TRACE_MPU401_NOT_PENDING", 0x0, 4 },
+    { "NV4_PRM_INTR_0_TRACE_MPU401_PENDING", 0x1, 4 },
+    { "NV4_PRM_INTR_0_TRACE_MPU401_RESET", 0x1, 4 },
+    { "NV4_PRM_INTR_0_TRACE_OVERFLOW", 16, 4 },
+    { "NV4_PRM_INTR_0_TRACE_OVERFLOW_NOT_PENDING", 0x0, 4 },
+    { "NV4_PRM_INTR_0_TRACE_OVERFLOW_PENDING", 0x1, 4 },
+    { "NV4_PRM_INTR_0_TRACE_OVERFLOW_RESET", 0x1, 4 },
+    { "NV4_PRM_INTR_0_TRACE_SB_DIGITAL", 8, 4 },
+    { "NV4_PRM_INTR_0_TRACE_SB_DIGITAL_NOT_PENDING", 0x0, 4 },
+    { "NV4_PRM_INTR_0_TRACE_SB_DIGITAL_PENDING", 0x1, 4 },
+    { "NV4_PRM_INTR_0_TRACE_SB_DIGITAL_RESET", 0x1, 4 },
+    { "NV4_PRM_INTR_0_TRACE_SB_MIXER", 12, 4 },
+    { "NV4_PRM_INTR_0_TRACE_SB_MIXER_NOT_PENDING", 0x0, 4 },
+    { "NV4_PRM_INTR_0_TRACE_SB_MIXER_PENDING", 0x1, 4 },
+    { "NV4_PRM_INTR_0_TRACE_SB_MIXER_RESET", 0x1, 4 },
+    { "NV4_PRM_INTR_EN_0", 0x4140, 4 },
+    { "NV4_PRM_INTR_EN_0_TRACE_FM", 4, 4 },
+    { "NV4_PRM_INTR_EN_0_TRACE_FM_ENABLED", 0x1, 4 },
+    { "NV4_PRM_INTR_EN_0_TRACE_MPU401", 0, 4 },
+    { "NV4_PRM_INTR_EN_0_TRACE_MPU401_ENABLED", 0x1, 4 },
+    { "NV4_PRM_INTR_EN_0_TRACE_OVERFLOW", 16, 4 },
+    { "NV4_PRM_INTR_EN_0_TRACE_OVERFLOW_ENABLED", 0x1, 4 },
+    { "NV4_PRM_INTR_EN_0_TRACE_SB_DIGITAL", 8, 4 },
+    { "NV4_PRM_INTR_EN_0_TRACE_SB_DIGITAL_ENABLED", 0x1, 4 },
+    { "NV4_PRM_INTR_EN_0_TRACE_SB_MIXER", 12, 4 },
+    { "NV4_PRM_INTR_EN_0_TRACE_SB_MIXER_ENABLED", 0x1, 4 },
+    { "NV4_PRM_RAMRM", 0x4200, 4 },
+    { "NV4_PRM_RAMRM_BASE_ADDRESS", 12, 4 },
+    { "NV4_PRM_RAMRM_BASE_ADDRESS_2000", 0x2000, 4 },
+    { "NV4_PRM_TRACE", 0x4300, 4 },
+    { "NV4_PRM_TRACE_INDEX", 0x4310, 4 },
+    { "NV4_PRM_TRACE_INDEX_ADDRESS", 0, 4 },
+    { "NV4_PRM_TRACE_INDEX_ADDRESS_0", 0x0, 4 },
+    { "NV4_PRM_TRACE_IO_CAPTURE", 0, 4 },
+    { "NV4_PRM_TRACE_IO_CAPTURE_DISABLED", 0x0, 4 },
+    { "NV4_PRM_TRACE_IO_CAPTURE_READS", 0x2, 4 },
+    { "NV4_PRM_TRACE_IO_CAPTURE_READS_WRITES", 0x3, 4 },
+    { "NV4_PRM_TRACE_IO_CAPTURE_WRITES", 0x1, 4 },
+    { "NV4_PRM_TRACE_IO_READ", 5, 4 },
+    { "NV4_PRM_TRACE_IO_READ_NONE", 0x0, 4 },
+    { "NV4_PRM_TRACE_IO_READ_OCCURED", 0x1, 4 },
+    { "NV4_PRM_TRACE_IO_READ_RESET", 0x1, 4 },
+    { "NV4_PRM_TRACE_IO_WRITE", 4, 4 },
+    { "NV4_PRM_TRACE_IO_WRITE_NONE", 0x0, 4 },
+    { "NV4_PRM_TRACE_IO_WRITE_OCCURED", 0x1, 4 },
+    { "NV4_PRM_TRACE_IO_WRITE_RESET", 0x1, 4 },
+    { "NV4_PROM_END", 0x30FFFF, 4 },
+    { "NV4_PROM_ERRATA_END", 0x70FFFF, 4 },
+    { "NV4_PROM_ERRATA_START", 0x700000, 4 },
+    { "NV4_PROM_SIZE", 65536, 4 },
+    { "NV4_PROM_START", 0x300000, 4 },
+    { "NV4_PSTRAPS_BOOT_0", 0x101000, 4 },
+    { "NV4_PTIMER_ALARM", 0x9420, 4 },
+    { "NV4_PTIMER_ALARM_NSEC", 5, 4 },
+    { "NV4_PTIMER_DENOMINATOR", 0x9210, 4 },
+    { "NV4_PTIMER_DENOMINATOR_VALUE", 0, 4 },
+    { "NV4_PTIMER_DENOMINATOR_VALUE_0", 0x0, 4 },
+    { "NV4_PTIMER_END", 0x9FFF, 4 },
+    { "NV4_PTIMER_INTR", 0x9100, 4 },
+    { "NV4_PTIMER_INTR_ALARM", 0, 4 },
+    { "NV4_PTIMER_INTR_ALARM_NOT_PENDING", 0x0, 4 },
+    { "NV4_PTIMER_INTR_ALARM_PENDING", 0x1, 4 },
+    { "NV4_PTIMER_INTR_ALARM_RESET", 0x1, 4 },
+    { "NV4_PTIMER_INTR_EN", 0x9140, 4 },
+    { "NV4_PTIMER_INTR_EN_ALARM", 0, 4 },
+    { "NV4_PTIMER_INTR_EN_ALARM_ENABLED", 0x1, 4 },
+    { "NV4_PTIMER_NUMERATOR", 0x9200, 4 },
+    { "NV4_PTIMER_NUMERATOR_VALUE", 0, 4 },
+    { "NV4_PTIMER_NUMERATOR_VALUE_0", 0x0, 4 },
+    { "NV4_PTIMER_START", 0x9000, 4 },
+    { "NV4_PTIMER_TIME_0", 0x9400, 4 },
+    { "NV4_PTIMER_TIME_0_NSEC", 5, 4 },
+    { "NV4_PTIMER_TIME_1", 0x9410, 4 },
+    { "NV4_PTIMER_TIME_1_NSEC", 0, 4 },
+    { "NV4_PVIDEO_BLUE_CSC", 0x680288, 4 },
+    { "NV4_PVIDEO_BLUE_CSC_OFFSET", 0, 4 },
+    { "NV4_PVIDEO_BUFF0_OFFSET", 0x68021c, 4 },
+    { "NV4_PVIDEO_BUFF0_OFFSET_X", 0, 4 },
+    { "NV4_PVIDEO_BUFF0_OFFSET_Y", 4, 4 },
+    { "NV4_PVIDEO_BUFF0_OFFSET_Y_HALF", 0x2, 4 },
+    { "NV4_PVIDEO_BUFF0_OFFSET_Y_OFF", 0x0, 4 },
+    { "NV4_PVIDEO_BUFF0_OFFSET_Y_QUARTER", 0x1, 4 },
+    { "NV4_PVIDEO_BUFF0_PITCH", 0x680214, 4 },
+    { "NV4_PVIDEO_BUFF0_PITCH_LENGTH", 4, 4 },
+    { "NV4_PVIDEO_BUFF0_START", 0x68020c, 4 },
+    { "NV4_PVIDEO_BUFF0_START_ADDRESS", 2, 4 },
+    { "NV4_PVIDEO_BUFF1_OFFSET", 0x680220, 4 },
+    { "NV4_PVIDEO_BUFF1_OFFSET_X", 0, 4 },
+    { "NV4_PVIDEO_BUFF1_OFFSET_Y", 4, 4 },
+    { "NV4_PVIDEO_BUFF1_OFFSET_Y_HALF", 0x2, 4 },
+    { "NV4_PVIDEO_BUFF1_OFFSET_Y_OFF", 0x0, 4 },
+    { "NV4_PVIDEO_BUFF1_OFFSET_Y_QUARTER", 0x1, 4 },
+    { "NV4_PVIDEO_BUFF1_PITCH", 0x680218, 4 },
+    { "NV4_PVIDEO_BUFF1_PITCH_LENGTH", 4, 4 },
+    { "NV4_PVIDEO_BUFF1_START", 0x680210, 4 },
+    { "NV4_PVIDEO_BUFF1_START_ADDRESS", 2, 4 },
+    { "NV4_PVIDEO_CONTROL_X", 0x680208, 4 },
+    { "NV4_PVIDEO_CONTROL_X_SHARPENING", 4, 4 },
+    { "NV4_PVIDEO_CONTROL_X_SHARPENING_OFF", 0x0, 4 },
+    { "NV4_PVIDEO_CONTROL_X_SHARPENING_ON", 0x1, 4 },
+    { "NV4_PVIDEO_CONTROL_X_SMOOTHING", 8, 4 },
+    { "NV4_PVIDEO_CONTROL_X_SMOOTHING_OFF", 0x0, 4 },
+    { "NV4_PVIDEO_CONTROL_X_SMOOTHING_ON", 0x1, 4 },
+    { "NV4_PVIDEO_CONTROL_X_WEIGHT", 0, 4 },
+    { "NV4_PVIDEO_CONTROL_X_WEIGHT_HEAVY", 0x1, 4 },
+    { "NV4_PVIDEO_CONTROL_X_WEIGHT_LIGHT", 0x0, 4 },
+    { "NV4_PVIDEO_CONTROL_Y", 0x680204, 4 },
+    { "NV4_PVIDEO_CONTROL_Y_BLUR", 0, 4 },
+    { "NV4_PVIDEO_CONTROL_Y_BLUR_OFF", 0x0, 4 },
+    { "NV4_PVIDEO_CONTROL_Y_BLUR_ON", 0x1, 4 },
+    { "NV4_PVIDEO_CONTROL_Y_LINE", 4, 4 },
+    { "NV4_PVIDEO_CONTROL_Y_LINE_FULL", 0x1, 4 },
+    { "NV4_PVIDEO_CONTROL_Y_LINE_HALF", 0x0, 4 },
+    { "NV4_PVIDEO_CSC_ADJUST", 0x68028c, 4 },
+    { "NV4_PVIDEO_CSC_ADJUST_B_FLAG", 0, 4 },
+    { "NV4_PVIDEO_CSC_ADJUST_B_FLAG_OFF", 0x0, 4 },
+    { "NV4_PVIDEO_CSC_ADJUST_B_FLAG_ON", 0x1, 4 },
+    { "NV4_PVIDEO_CSC_ADJUST_CHROMA", 16, 4 },
+    { "NV4_PVIDEO_CSC_ADJUST_CHROMA_OFF", 0x0, 4 },
+    { "NV4_PVIDEO_CSC_ADJUST_CHROMA_ON", 0x1, 4 },
+    { "NV4_PVIDEO_CSC_ADJUST_G_FLAG", 4, 4 },
+    { "NV4_PVIDEO_CSC_ADJUST_G_FLAG_OFF", 0x0, 4 },
+    { "NV4_PVIDEO_CSC_ADJUST_G_FLAG_ON", 0x1, 4 },
+    { "NV4_PVIDEO_CSC_ADJUST_L_FLAG", 12, 4 },
+    { "NV4_PVIDEO_CSC_ADJUST_L_FLAG_OFF", 0x0, 4 },
+    { "NV4_PVIDEO_CSC_ADJUST_L_FLAG_ON", 0x1, 4 },
+    { "NV4_PVIDEO_CSC_ADJUST_R_FLAG", 8, 4 },
+    { "NV4_PVIDEO_CSC_ADJUST_R_FLAG_OFF", 0x0, 4 },
+    { "NV4_PVIDEO_CSC_ADJUST_R_FLAG_ON", 0x1, 4 },
+    { "NV4_PVIDEO_END", 0x6802FF, 4 },
+    { "NV4_PVIDEO_FIFO_BURST", 0x68023c, 4 },
+    { "NV4_PVIDEO_FIFO_BURST_LENGTH", 0, 4 },
+    { "NV4_PVIDEO_FIFO_BURST_LENGTH_128", 0x3, 4 },
+    { "NV4_PVIDEO_FIFO_BURST_LENGTH_32", 0x1, 4 },
+    { "NV4_PVIDEO_FIFO_BURST_LENGTH_64", 0x2, 4 },
+    { "NV4_PVIDEO_FIFO_THRES", 0x680238, 4 },
+    { "NV4_PVIDEO_FIFO_THRES_SIZE", 3, 4 },
+    { "NV4_PVIDEO_GREEN_CSC", 0x680284, 4 },
+    { "NV4_PVIDEO_GREEN_CSC_OFFSET", 0, 4 },
+    { "NV4_PVIDEO_INTR_0", 0x680100, 4 },
+    { "NV4_PVIDEO_INTR_0_NOTIFY", 0, 4 },
+    { "NV4_PVIDEO_INTR_0_NOTIFY_NOT_PENDING", 0x0, 4 },
+    { "NV4_PVIDEO_INTR_0_NOTIFY_PENDING", 0x1, 4 },
+    { "NV4_PVIDEO_INTR_0_NOTIFY_RESET", 0x1, 4 },
+    { "NV4_PVIDEO_INTR_EN_0", 0x680140, 4 },
+    { "NV4_PVIDEO_INTR_EN_0_NOTIFY", 0, 4 },
+    { "NV4_PVIDEO_INTR_EN_0_NOTIFY_ENABLED", 0x1, 4 },
+    { "NV4_PVIDEO_KEY", 0x680240, 4 },
+    { "NV4_PVIDEO_KEY_555", 0, 4 },
+    { "NV4_PVIDEO_KEY_565", 0, 4 },
+    { "NV4_PVIDEO_KEY_888", 0, 4 },
+    { "NV4_PVIDEO_KEY_INDEX", 0, 4 },
+    { "NV4_PVIDEO_KEY_PACK", 24, 4 },
+    { "NV4_PVIDEO_OE_STATE", 0x680224, 4 },
+    { "NV4_PVIDEO_OE_STATE_BUFF0_ERROR", 8, 4 },
+    { "NV4_PVIDEO_OE_STATE_BUFF0_INTR_NOTIFY", 0, 4 },
+    { "NV4_PVIDEO_OE_STATE_BUFF0_IN_USE", 16, 4 },
+    { "NV4_PVIDEO_OE_STATE_BUFF1_ERROR", 12, 4 },
+    { "NV4_PVIDEO_OE_STATE_BUFF1_INTR_NOTIFY", 4, 4 },
+    { "NV4_PVIDEO_OE_STATE_BUFF1_IN_USE", 20, 4 },
+    { "NV4_PVIDEO_OE_STATE_CURRENT_BUFFER", 24, 4 },
+    { "NV4_PVIDEO_OE_STATE_CURRENT_BUFFER_0", 0x0, 4 },
+    { "NV4_PVIDEO_OE_STATE_CURRENT_BUFFER_1", 0x1, 4 },
+    { "NV4_PVIDEO_OVERLAY", 0x680244, 4 },
+    { "NV4_PVIDEO_OVERLAY_FORMAT", 8, 4 },
+    { "NV4_PVIDEO_OVERLAY_FORMAT_CCIR", 0x0, 4 },
+    { "NV4_PVIDEO_OVERLAY_FORMAT_YUY2", 0x1, 4 },
+    { "NV4_PVIDEO_OVERLAY_KEY", 4, 4 },
+    { "NV4_PVIDEO_OVERLAY_KEY_OFF", 0x0, 4 },
+    { "NV4_PVIDEO_OVERLAY_KEY_ON", 0x1, 4 },
+    { "NV4_PVIDEO_OVERLAY_VIDEO", 0, 4 },
+    { "NV4_PVIDEO_OVERLAY_VIDEO_OFF", 0x0, 4 },
+    { "NV4_PVIDEO_OVERLAY_VIDEO_ON", 0x1, 4 },
+    { "NV4_PVIDEO_RED_CSC", 0x680280, 4 },
+    { "NV4_PVIDEO_RED_CSC_OFFSET", 0, 4 },
+    { "NV4_PVIDEO_RM_STATE", 0x68022c, 4 },
+    { "NV4_PVIDEO_RM_STATE_BUFF0_INTR_NOTIFY", 0, 4 },
+    { "NV4_PVIDEO_RM_STATE_BUFF1_INTR_NOTIFY", 4, 4 },
+    { "NV4_PVIDEO_START", 0x680000, 4 },
+    { "NV4_PVIDEO_STEP_SIZE", 0x680200, 4 },
+    { "NV4_PVIDEO_STEP_SIZE_X", 0, 4 },
+    { "NV4_PVIDEO_STEP_SIZE_Y", 16, 4 },
+    { "NV4_PVIDEO_SU_STATE", 0x680228, 4 },
+    { "NV4_PVIDEO_SU_STATE_BUFF0_IN_USE", 16, 4 },
+    { "NV4_PVIDEO_SU_STATE_BUFF1_IN_USE", 20, 4 },
+    { "NV4_PVIDEO_WINDOW_SIZE", 0x680234, 4 },
+    { "NV4_PVIDEO_WINDOW_SIZE_X", 0, 4 },
+    { "NV4_PVIDEO_WINDOW_SIZE_Y", 16, 4 },
+    { "NV4_PVIDEO_WINDOW_START", 0x680230, 4 },
+    { "NV4_PVIDEO_WINDOW_START_X", 0, 4 },
+    { "NV4_PVIDEO_WINDOW_START_Y", 16, 4 },
+    { "NV4_RAMFC_ENGINE_DVD", 0x2, 4 },
+    { "NV4_RAMFC_ENGINE_GRAPHICS", 0x1, 4 },
+    { "NV4_RAMFC_ENGINE_SW", 0x0, 4 },
+    { "NV4_RAMFC_PULL1_ENGINE_DVD", 0x2, 4 },
+    { "NV4_RAMFC_PULL1_ENGINE_GRAPHICS", 0x1, 4 },
+    { "NV4_RAMFC_PULL1_ENGINE_SW", 0x0, 4 },
+    { "NV4_RAMFC_SIZE_0", 0x1FF, 4 },
+    { "NV4_RAMHT_ENGINE_DVD", 0x2, 4 },
+    { "NV4_RAMHT_ENGINE_GRAPHICS", 0x1, 4 },
+    { "NV4_RAMHT_ENGINE_SW", 0x0, 4 },
+    { "NV4_RAMHT_SIZE_0", 0xFFF, 4 },
+    { "NV4_RAMHT_SIZE_1", 0x1FFF, 4 },
+    { "NV4_RAMHT_SIZE_2", 0x3FFF, 4 },
+    { "NV4_RAMHT_SIZE_3", 0x7FFF, 4 },
+    { "NV4_RAMHT_STATUS_INVALID", 0x0, 4 },
+    { "NV4_RAMHT_STATUS_VALID", 0x1, 4 },
+    { "NV4_RAMRO_REASON_CACHE_RAN_OUT", 0x2, 4 },
+    { "NV4_RAMRO_REASON_CAUGHT_LYING", 0x4, 4 },
+    { "NV4_RAMRO_REASON_FREE_COUNT_OVERRUN", 0x3, 4 },
+    { "NV4_RAMRO_REASON_ILLEGAL_ACCESS", 0x0, 4 },
+    { "NV4_RAMRO_REASON_NO_CACHE_AVAILABLE", 0x1, 4 },
+    { "NV4_RAMRO_REASON_RESERVED_ACCESS", 0x5, 4 },
+    { "NV4_RAMRO_SIZE_0", 0x1FF, 4 },
+    { "NV4_RAMRO_SIZE_1", 0x1FFF, 4 },
+    { "NV4_RAMRO_TYPE_READ", 0x1, 4 },
+    { "NV4_RAMRO_TYPE_WRITE", 0x0, 4 },
+    { "NV4_RMA_NUM_REGS", 4, 4 },
+    { "NV4_RMA_REGISTER_END", 0x3D3, 4 },
+    { "NV4_RMA_REGISTER_START", 0x3D0, 4 },
+    { "NV4_SR_LOCK_VALUE", 0x99, 4 },
+    { "NV4_SR_UNLOCK_RO_VALUE", 0x75, 4 },
+    { "NV4_SR_UNLOCK_RW_VALUE", 0x57, 4 },
+    { "NV4_STRAP_BUS_SPEED", 0, 4 },
+    { "NV4_STRAP_BUS_SPEED_33MHZ", 0x0, 4 },
+    { "NV4_STRAP_BUS_SPEED_66MHZ", 0x1, 4 },
+    { "NV4_STRAP_BUS_TYPE", 5, 4 },
+    { "NV4_STRAP_BUS_TYPE_AGP", 0x1, 4 },
+    { "NV4_STRAP_BUS_TYPE_PCI", 0x0, 4 },
+    { "NV4_STRAP_CRYSTAL", 6, 4 },
+    { "NV4_STRAP_CRYSTAL_13500K", 0x0, 4 },
+    { "NV4_STRAP_CRYSTAL_14318180", 0x1, 4 },
+    { "NV4_STRAP_OVERWRITE", 11, 4 },
+    { "NV4_STRAP_OVERWRITE_DISABLED", 0x0, 4 },
+    { "NV4_STRAP_OVERWRITE_ENABLED", 0x1, 4 },
+    { "NV4_STRAP_RAM_TYPE", 2, 4 },
+    { "NV4_STRAP_RAM_TYPE_1024K_2BANK", 0x3, 4 },
+    { "NV4_STRAP_RAM_TYPE_SGRAM_256K", 0x0, 4 },
+    { "NV4_STRAP_RAM_TYPE_SGRAM_512K_2BANK", 0x1, 4 },
+    { "NV4_STRAP_RAM_TYPE_SGRAM_512K_4BANK", 0x2, 4 },
+    { "NV4_STRAP_RAM_WIDTH", 4, 4 },
+    { "NV4_STRAP_RAM_WIDTH_128", 0x1, 4 },
+    { "NV4_STRAP_RAM_WIDTH_64", 0x0, 4 },
+    { "NV4_STRAP_SUB_VENDOR", 1, 4 },
+    { "NV4_STRAP_SUB_VENDOR_BIOS", 0x1, 4 },
+    { "NV4_STRAP_SUB_VENDOR_NO_BIOS", 0x0, 4 },
+    { "NV4_STRAP_TVMODE", 7, 4 },
+    { "NV4_STRAP_TVMODE_DISABLED", 0x3, 4 },
+    { "NV4_STRAP_TVMODE_NTSC", 0x1, 4 },
+    { "NV4_STRAP_TVMODE_PAL", 0x2, 4 },
+    { "NV4_STRAP_TVMODE_SECAM", 0x0, 4 },
+    { "NV4_SUBCHAN_MEMFMT_LINEAR_IN", 0x1, 4 },
+    { "NV4_SUBCHAN_MEMFMT_LINEAR_OUT", 0x0, 4 },
+    { "NV4_TRACE_ACCESS_READ", 0x1, 4 },
+    { "NV4_TRACE_ACCESS_WRITE", 0x0, 4 },
+    { "NV4_TRACE_TYPE_IO", 0x0, 4 },
+    { "NV4_TRACE_TYPE_MEMORY", 0x1, 4 },
+    { "NV4_USER_ADR_CHID", 16, 4 },
+    { "NV4_USER_ADR_METHOD", 0, 4 },
+    { "NV4_USER_ADR_SUBCHID", 13, 4 },
+    { "NV4_USER_DAC_END", 0x681FFF, 4 },
+    { "NV4_USER_DAC_PALETTE_DATA", 0x6813C9, 4 },
+    { "NV4_USER_DAC_PALETTE_DATA_VALUE", 0, 4 },
+    { "NV4_USER_DAC_PALETTE_END", 0x6813C9, 4 },
+    { "NV4_USER_DAC_PALETTE_START", 0x6813C6, 4 },
+    { "NV4_USER_DAC_PIXEL_MASK", 0x6813C6, 4 },
+    { "NV4_USER_DAC_PIXEL_MASK_MASK", 0xFF, 4 },
+    { "NV4_USER_DAC_PIXEL_MASK_VALUE", 0, 4 },
+    { "NV4_USER_DAC_READ_MODE_ADDRESS", 0x6813C7, 4 },
+    { "NV4_USER_DAC_READ_MODE_ADDRESS_RW_STATE", 0, 4 },
+    { "NV4_USER_DAC_READ_MODE_ADDRESS_RW_STATE_READ", 0x3, 4 },
+    { "NV4_USER_DAC_READ_MODE_ADDRESS_RW_STATE_WRITE", 0x0, 4 },
+    { "NV4_USER_DAC_READ_MODE_ADDRESS_VALUE", 0, 4 },
+    { "NV4_USER_DAC_READ_MODE_ADDRESS_WO_VALUE", 0, 4 },
+    { "NV4_USER_DAC_START", 0x681200, 4 },
+    { "NV4_USER_DAC_WRITE_MODE_ADDRESS", 0x6813C8, 4 },
+    { "NV4_USER_DAC_WRITE_MODE_ADDRESS_VALUE", 0, 4 },
+    { "NV4_USER_DEVICE", 16, 4 },
+    { "NV4_USER_DMA_GET_OFFSET", 2, 4 },
+    { "NV4_USER_DMA_PUT_OFFSET", 2, 4 },
+    { "NV4_USER_END", 0xFFFFFF, 4 },
+    { "NV4_USER_FREE016_COUNT", 2, 4 },
+    { "NV4_USER_FREE016_COUNT_HI", 10, 4 },
+    { "NV4_USER_FREE016_COUNT_HI_0", 0x0, 4 },
+    { "NV4_USER_FREE016_COUNT_LO", 0, 4 },
+    { "NV4_USER_FREE016_COUNT_LO_0", 0x0, 4 },
+    { "NV4_USER_FREE016_SIZE_1", 16, 4 },
+    { "NV4_USER_FREE016_SIZE_2", 8, 4 },
+    { "NV4_USER_FREE032_COUNT", 2, 4 },
+    { "NV4_USER_FREE032_COUNT_HI", 10, 4 },
+    { "NV4_USER_FREE032_COUNT_HI_0", 0x0, 4 },
+    { "NV4_USER_FREE032_COUNT_LO", 0, 4 },
+    { "NV4_USER_FREE032_COUNT_LO_0", 0x0, 4 },
+    { "NV4_USER_FREE032_SIZE_1", 16, 4 },
+    { "NV4_USER_FREE032_SIZE_2", 8, 4 },
+    { "NV4_USER_OBJECT_HANDLE", 0, 4 },
+    { "NV4_USER_OBJECT_SIZE_1", 16, 4 },
+    { "NV4_USER_OBJECT_SIZE_2", 8, 4 },
+    { "NV4_USER_START", 0x800000, 4 },
+    { "NV4_USER_ZERO016_COUNT", 0, 4 },
+    { "NV4_USER_ZERO016_COUNT_0", 0x0, 4 },
+    { "NV4_USER_ZERO016_SIZE_1", 16, 4 },
+    { "NV4_USER_ZERO016_SIZE_2", 8, 4 },
+    { "NV4_USER_ZERO016_SIZE_3", 7, 4 },
+    { "NV4_USER_ZERO032_COUNT", 0, 4 },
+    { "NV4_USER_ZERO032_COUNT_0", 0x0, 4 },
+    { "NV4_USER_ZERO032_SIZE_1", 16, 4 },
+    { "NV4_USER_ZERO032_SIZE_2", 8, 4 },
+    { "NV4_USER_ZERO032_SIZE_3", 3, 4 },
+    { "NV4_VIO_ADDEN", 0x46e8, 4 },
+    { "NV4_VIO_GRX", 0x3ce, 4 },
+    { "NV4_VIO_GX_BIT_MASK_INDEX", 0x8, 4 },
+    { "NV4_VIO_GX_CCOMP_INDEX", 0x2, 4 },
+    { "NV4_VIO_GX_DONT_CARE_INDEX", 0x7, 4 },
+    { "NV4_VIO_GX_MISC_INDEX", 0x6, 4 },
+    { "NV4_VIO_GX_MODE_INDEX", 0x5, 4 },
+    { "NV4_VIO_GX_READ_MAP_INDEX", 0x4, 4 },
+    { "NV4_VIO_GX_ROP_INDEX", 0x3, 4 },
+    { "NV4_VIO_GX_SR", 0x3cf, 4 },
+    { "NV4_VIO_GX_SREN_INDEX", 0x1, 4 },
+    { "NV4_VIO_GX_SR_INDEX", 0x0, 4 },
+    { "NV4_VIO_MBEN", 0x94, 4 },
+    { "NV4_VIO_MISC_READ", 0x3cc, 4 },
+    { "NV4_VIO_MISC_WRITE", 0x3c2, 4 },
+    { "NV4_VIO_SR", 0x3c5, 4 },
+    { "NV4_VIO_SRX", 0x3c4, 4 },
+    { "NV4_VIO_SR_CHAR_MAP_INDEX", 0x3, 4 },
+    { "NV4_VIO_SR_CLOCK_INDEX", 0x1, 4 },
+    { "NV4_VIO_SR_MEM_MODE_INDEX", 0x4, 4 },
+    { "NV4_VIO_SR_PLANE_MASK_INDEX", 0x2, 4 },
+    { "NV4_VIO_SR_RESET_INDEX", 0x0, 4 },
+    { "NV4_VIO_VSE1", 0x102, 4 },
+    { "NV4_VIO_VSE2", 0x3c3, 4 },
+    { "NV4_VRAM_SIZE_16MB", 0x1000000, 4 },
+    { "NV4_VRAM_SIZE_2MB", 0x200000, 4 },
+    { "NV4_VRAM_SIZE_4MB", 0x400000, 4 },
+    { "NV4_VRAM_SIZE_8MB", 0x800000, 4 },
+};
@@ -11,6 +11,7 @@
 #include "nvplay.h"
 #include "util/util_ini.h"
 #include <util/util.h>
+#include <architecture/nvidia/kernel/nv_generic.h>
 
 // Functions
 bool Config_Load()
@@ -27,7 +28,36 @@ bool Config_Load()
     if (section_debug)
     {
         nvplay_state.config.key_debug = ini_section_get_int(section_debug, "DebugKeyboard", false);
+        nvplay_state.config.console_fast_scroll = ini_section_get_int(section_debug, "Console_FastScroll", true);
         nvplay_state.config.nv10_always_map_128m = ini_section_get_int(section_debug, "NV10_AlwaysMapFullBAR1", false);
+        nvplay_state.config.mmio_map_probe_writes = ini_section_get_int(section_debug, "MMIOMap_ProbeWrites", false);
+        nvplay_state.config.volatile_samples = ini_section_get_int(section_debug, "Volatile_Samples", NV_VOLATILE_DEFAULT_SAMPLES);
+        nvplay_state.config.volatile_interval_us = ini_section_get_int(section_debug, "Volatile_IntervalUs", NV_VOLATILE_DEFAULT_INTERVAL_US);
+        nvplay_state.config.volatile_range_start = (uint32_t)ini_section_get_hex32(section_debug, "Volatile_RangeStart", 0);
+        nvplay_state.config.volatile_range_end = (uint32_t)ini_section_get_hex32(section_debug, "Volatile_RangeEnd", 0);
+        nvplay_state.config.script_disable_cache = ini_section_get_int(section_debug, "Script_DisableCache", false);
+        nvplay_state.config.script_disable_batching = ini_section_get_int(section_debug, "Script_DisableBatching", false);
+        nvplay_state.config.dry_run_boot_0 = (uint32_t)ini_section_get_hex32(section_debug, "DryRun_Boot0", NV_SHADOW_DEFAULT_BOOT_0);
+        nvplay_state.config.dry_run_vram = (uint32_t)ini_section_get_hex32(section_debug, "DryRun_VRAM", NV_SHADOW_DEFAULT_VRAM);
+
+        Logging_SetSynchronous(ini_section_get_int(section_debug, "Log_Synchronous", false));
+
+        if (ini_section_get_int(section_debug, "Log_Binary", false))
+            Logging_OpenEventLog(LOG_EVENT_FILE_NAME);
+
+        // Log_<channel>=debug, message, warning, error or none
+        for (uint32_t i = 0; i < LOG_NUM_CHANNELS; i++)
+        {
+            char key[MAX_STR] = {0};
+
+            snprintf(key, MAX_STR, "Log_%s", log_channel_names[i]);
+
+            const char* level_name = ini_section_get_string(section_debug, key, NULL);
+
+            if (level_name
+            && !Logging_ParseLevel(level_name, &log_settings.channel_levels[i]))
+                Logging_Write(LOG_LEVEL_WARNING, "%s=%s isn't a log level (debug, message, warning, error or none)\n", key, level_name);
+        }
     }
 
     ini_section_t section_tests = ini_find_section(nvplay_state.config.ini_file, "Tests");
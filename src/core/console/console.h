@@ -19,16 +19,102 @@
 
 #define MAX_REASONABLE_LOG_LENGTH   1024
 
+// Output is drawn at most once a frame, not on every line (console_core.c)
+#define CONSOLE_FRAME_MS            33          // ~30Hz
+#define CONSOLE_FAST_SCROLL_MS      250         // Frame time while more than a screenful scrolls by between frames (Console_FastScroll)
+
+// Where console output goes. PDCurses is only started for the REPL
+typedef enum console_backend_e
+{
+    CONSOLE_BACKEND_STDOUT = 0,                     // Redirected to a file, or not in text mode
+    CONSOLE_BACKEND_TEXT = 1,                       // Straight into text mode VRAM (console_text.c)
+    CONSOLE_BACKEND_CURSES = 2,                     // PDCurses (REPL)
+} console_backend_t;
+
+extern console_backend_t console_backend;
+
 void Console_Init();
 void Console_Clear();
 void Console_PushChar(char ch);
 void Console_PopChar();
 void Console_GetPosition(int32_t* cx, int32_t* cy);
 void Console_PushLine(char const* buf);
+void Console_Present();
+void Console_PresentIfDue();
 // need to set this so we don't have to withdraw the screen and it's just a sliding buffer
 void Console_Update();
 void Console_Shutdown();
 
+// Scrollback (console_scrollback.c). DEFAULT_CONSOLE_SIZE and CONSOLE_SCROLLBACK_MAX_LINES must be powers of two
+#define CONSOLE_SCROLLBACK_MAX_LINES    4096
+
+void Console_ScrollbackAppend(const char* text);
+void Console_ScrollbackPopChar();
+uint32_t Console_ScrollbackNumLines();
+uint32_t Console_ScrollbackGetLine(uint32_t line, char* buf, uint32_t size);
+int32_t Console_ScrollbackFind(int32_t start, const char* text, bool backwards);
+void Console_ScrollbackView();
+
+// Text mode VRAM console (console_text.c)
+#define CONSOLE_TEXT_MAX_COLUMNS        132
+#define CONSOLE_TEXT_MAX_ROWS           60          // Dirty rows are a 64-bit mask
+#define CONSOLE_TEXT_DEFAULT_ATTRIBUTE  0x07        // Light grey on black
+
+typedef struct console_text_s
+{
+    bool active;
+    bool visible;                                   // The VGA was in text mode at our address last frame
+    uint32_t vram_base;                             // Linear address of the text buffer
+    uint32_t page;
+    uint32_t page_offset;                           // Of the active page in the text buffer
+    uint16_t crtc_port;
+    uint32_t columns;
+    uint32_t rows;
+    uint32_t x;
+    uint32_t y;
+    uint8_t attribute;
+    uint8_t escape_state;                           // Where we are in an ANSI colour sequence (the help text has them)
+    uint32_t escape_param;
+    bool cursor_moved;
+    uint64_t dirty_rows;                            // Rows that changed since the last frame
+    uint16_t cells[CONSOLE_TEXT_MAX_COLUMNS * CONSOLE_TEXT_MAX_ROWS];     // Character | attribute << 8, as in VRAM
+} console_text_t;
+
+extern console_text_t console_text;
+
+bool Console_TextInit();
+void Console_TextPushChar(char ch);
+void Console_TextWrite(const char* text);
+void Console_TextPopChar();
+void Console_TextResync();
+void Console_TextPresent();
+void Console_TextShutdown();
+
+// Idle loop and background ticks (console_idle.c)
+#define CONSOLE_MAX_TICKS           16
+#define CONSOLE_HOST_IDLE_MS        10          // Longest poll() when not built for DOS (DOS sleeps until the next timer interrupt)
+
+typedef void (*console_tick_function_t)(void* context);
+
+typedef struct console_tick_s
+{
+    const char* name;
+    console_tick_function_t function;
+    void* context;
+    uint32_t interval_ms;
+    uint32_t next_ms;                           // Console_NowMs() when it should run next
+} console_tick_t;
+
+bool Console_RegisterTick(const char* name, console_tick_function_t fn, void* context, uint32_t interval_ms);
+void Console_UnregisterTick(console_tick_function_t fn, void* context);
+void Console_RunTicks();
+uint32_t Console_NowMs();
+bool Console_KeyAvailable();
+void Console_Idle();
+void Console_WaitForInput();
+int32_t Console_WaitKey(WINDOW* window);
+void Console_IdleShutdown();
+
 
 // Input
 
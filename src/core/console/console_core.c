@@ -16,11 +16,27 @@
 #include <string.h>
 #include <core/console/console.h>
 
+console_backend_t console_backend = CONSOLE_BACKEND_STDOUT;
+
+// Frame state. Lines are added to stdscr as they come, but only drawn by Console_Present
+bool console_dirty = false;
+uint32_t console_lines_since_frame = 0;
+uint32_t console_last_frame_ms = 0;
 
 void Console_Init()
 {
-    if (nvplay_state.config.dumb_console)
+    // Nothing but the REPL is interactive, so everything else writes straight into the screen instead of going through curses
+    if (nvplay_state.config.dumb_console
+    || nvplay_state.run_mode != NVPLAY_MODE_REPL)
+    {
+        console_backend = Console_TextInit() ? CONSOLE_BACKEND_TEXT : CONSOLE_BACKEND_STDOUT;
+
+        // NVPlay_Shutdown doesn't shut the console down, so the last frame would never be drawn
+        if (console_backend == CONSOLE_BACKEND_TEXT)
+            atexit(Console_TextShutdown);
+
         return;
+    }
 
     // Initialise PDcurses
     initscr();
@@ -33,6 +49,8 @@ void Console_Init()
     scrollok(stdscr, true);
     keypad(stdscr, true);
     timeout(0);
+
+    console_backend = CONSOLE_BACKEND_CURSES;
 }
 
 void Console_Clear()
@@ -82,7 +100,16 @@ void Console_ScrollIfNeeded(bool force)
 
 void Console_PushChar(char ch)
 {
+    char text[2] = { ch, '\0' };
+
+    if (console_backend != CONSOLE_BACKEND_CURSES)
+    {
+        Console_PushLine(text);
+        return;
+    }
+
     addch(ch);
+    Console_ScrollbackAppend(text);
 
     //is this needed
     Console_ScrollIfNeeded(true);
@@ -92,7 +119,14 @@ void Console_PushChar(char ch)
 void Console_PopChar()
 {
     int32_t x, y;
-    
+
+    if (console_backend != CONSOLE_BACKEND_CURSES)
+    {
+        Console_TextPopChar();
+        console_dirty = true;
+        return;
+    }
+
     Console_GetPosition(&x, &y);
     
     if (x > 0)
@@ -101,6 +135,7 @@ void Console_PopChar()
         move(y - 1, COLS);
 
     delch();
+    Console_ScrollbackPopChar();
     Console_ScrollIfNeeded(true);
 }
 
@@ -122,12 +157,67 @@ void Console_PushLine(char const* buf)
         return;
     }
 
-    if (nvplay_state.config.dumb_console)
-        fputs(buf, stdout);
-    else
-        printw(buf);  
-    
-    Console_ScrollIfNeeded(false);
+    switch (console_backend)
+    {
+        case CONSOLE_BACKEND_STDOUT:
+            fputs(buf, stdout);
+            return;
+        case CONSOLE_BACKEND_TEXT:
+            Console_TextWrite(buf);
+            break;
+        case CONSOLE_BACKEND_CURSES:
+            // Not printw, the line has already been formatted (and may have a % in it)
+            addstr(buf);
+            Console_ScrollbackAppend(buf);
+            break;
+    }
+
+    for (const char* newline = strchr(buf, '\n'); newline; newline = strchr(newline + 1, '\n'))
+        console_lines_since_frame++;
+
+    console_dirty = true;
+
+    if (console_backend == CONSOLE_BACKEND_CURSES)
+        Console_ScrollIfNeeded(false);
+
+    Console_PresentIfDue();
+}
+
+/* Draw everything printed since the last frame */
+void Console_Present()
+{
+    if (!console_dirty)
+        return;
+
+    if (console_backend == CONSOLE_BACKEND_CURSES)
+        refresh();
+    else if (console_backend == CONSOLE_BACKEND_TEXT)
+        Console_TextPresent();
+
+    console_dirty = false;
+    console_lines_since_frame = 0;
+    console_last_frame_ms = Console_NowMs();
+}
+
+/*
+    Draw a frame if the last one was long enough ago. When more than a screenful has scrolled by since the last frame, nobody can read the
+    lines in between anyway, so with fast scroll on frames are only drawn every CONSOLE_FAST_SCROLL_MS until the output slows down.
+    Anything that waits a long time without printing should call this, or the last lines may not be shown until it's done
+*/
+void Console_PresentIfDue()
+{
+    if (!console_dirty)
+        return;
+
+    uint32_t frame_ms = CONSOLE_FRAME_MS;
+    uint32_t rows = (console_backend == CONSOLE_BACKEND_CURSES) ? (uint32_t)LINES : console_text.rows;
+
+    if (nvplay_state.config.console_fast_scroll
+    && console_lines_since_frame >= rows)
+        frame_ms = CONSOLE_FAST_SCROLL_MS;
+
+    if (Console_NowMs() - console_last_frame_ms >= frame_ms)
+        Console_Present();
 }
 
 
@@ -154,7 +244,15 @@ void Console_Update()
 
 void Console_Shutdown()
 {
-    Console_Clear();
+    Console_Present();
+    Console_IdleShutdown();
+
+    if (console_backend != CONSOLE_BACKEND_CURSES)
+        return;
 
+    Console_Clear();
     endwin();
+
+    // Anything logged after this still has to go somewhere
+    console_backend = Console_TextInit() ? CONSOLE_BACKEND_TEXT : CONSOLE_BACKEND_STDOUT;
 }
\ No newline at end of file
@@ -0,0 +1,195 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    console_idle.c: Waiting for a key without spinning, and background work while we wait
+
+    The REPL used to poll curses in a loop, which kept the CPU at 100% (and made timing anything from the REPL unreliable). Now it waits here: the
+    keyboard is checked with INT 16h (which doesn't take the key, so curses still gets it), any registered tick that is due is run, and then the CPU
+    sleeps until the next interrupt. That is the timer (18.2Hz) or the keyboard, so ticks can't run more often than every 55ms.
+
+    Sleeping is a HLT. Protected mode code can't run one, so it is done in a 3 byte real mode routine. Under Windows the time slice is given back
+    with INT 2Fh/1680h instead, so the other VMs get it. Built for anything but DOS, it waits in poll() on stdin.
+*/
+
+#include <nvplay.h>
+#include "core/console/console.h"
+#include "util/util.h"
+
+#ifdef __DJGPP__
+#include <bios.h>
+#include <dpmi.h>
+#include <sys/movedata.h>
+#else
+#include <poll.h>
+#endif
+
+console_tick_t console_ticks[CONSOLE_MAX_TICKS] = {0};
+uint32_t console_num_ticks = 0;
+
+#ifdef __DJGPP__
+int32_t idle_routine_segment = -1;                  // -1 = not allocated yet, 0 = couldn't be allocated
+int idle_routine_selector = 0;
+
+// sti; hlt; retf
+const uint8_t idle_routine[] = { 0xFB, 0xF4, 0xCB };
+#endif
+
+uint32_t Console_NowMs()
+{
+#ifdef __DJGPP__
+    return (uint32_t)(((uint64_t)uclock() * 1000) / UCLOCKS_PER_SEC);
+#else
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000 + now.tv_nsec / 1000000);
+#endif
+}
+
+/* Run fn(context) every interval_ms while waiting for input. Returns false if there are too many */
+bool Console_RegisterTick(const char* name, console_tick_function_t fn, void* context, uint32_t interval_ms)
+{
+    if (console_num_ticks >= CONSOLE_MAX_TICKS)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "Can't run %s in the background: there are already %d background tasks\n", name, CONSOLE_MAX_TICKS);
+        return false;
+    }
+
+    console_tick_t* tick = &console_ticks[console_num_ticks++];
+
+    tick->name = name;
+    tick->function = fn;
+    tick->context = context;
+    tick->interval_ms = interval_ms;
+    tick->next_ms = Console_NowMs() + interval_ms;
+    return true;
+}
+
+void Console_UnregisterTick(console_tick_function_t fn, void* context)
+{
+    for (uint32_t i = 0; i < console_num_ticks; i++)
+    {
+        if (console_ticks[i].function != fn
+        || console_ticks[i].context != context)
+            continue;
+
+        memmove(&console_ticks[i], &console_ticks[i + 1], (console_num_ticks - i - 1) * sizeof(console_tick_t));
+        console_num_ticks--;
+        return;
+    }
+}
+
+/* Run the ticks that are due. Each runs at most once per call, so one that falls behind doesn't run several times in a row */
+void Console_RunTicks()
+{
+    uint32_t now = Console_NowMs();
+
+    for (uint32_t i = 0; i < console_num_ticks; i++)
+    {
+        console_tick_t* tick = &console_ticks[i];
+
+        if ((int32_t)(now - tick->next_ms) < 0)
+            continue;
+
+        tick->next_ms = now + tick->interval_ms;
+        tick->function(tick->context);
+    }
+}
+
+bool Console_KeyAvailable()
+{
+#ifdef __DJGPP__
+    // Enhanced keyboard status. Doesn't remove the key
+    return (bioskey(0x11) != 0);
+#else
+    struct pollfd stdin_poll = { 0, POLLIN, 0 };
+
+    return (poll(&stdin_poll, 1, 0) > 0);
+#endif
+}
+
+/* Sleep until the next interrupt */
+void Console_Idle()
+{
+#ifdef __DJGPP__
+    if (nvplay_state.os_level != NVPLAY_OS_DOS)
+    {
+        __dpmi_yield();
+        return;
+    }
+
+    if (idle_routine_segment < 0)
+    {
+        idle_routine_segment = __dpmi_allocate_dos_memory(1, &idle_routine_selector);
+
+        if (idle_routine_segment < 0)
+        {
+            Logging_Write(LOG_LEVEL_WARNING, "Couldn't allocate DOS memory for the idle routine. The REPL will busy-wait\n");
+            idle_routine_segment = 0;
+        }
+        else
+            dosmemput(idle_routine, sizeof(idle_routine), idle_routine_segment << 4);
+    }
+
+    if (!idle_routine_segment)
+        return;
+
+    // The DPMI host provides a stack if ss:sp is 0
+    __dpmi_regs regs = {0};
+
+    regs.x.cs = idle_routine_segment;
+    __dpmi_simulate_real_mode_procedure_retf(&regs);
+#else
+    struct pollfd stdin_poll = { 0, POLLIN, 0 };
+
+    poll(&stdin_poll, 1, CONSOLE_HOST_IDLE_MS);
+#endif
+}
+
+/* Block until a key is pressed, running background ticks in the meantime */
+void Console_WaitForInput()
+{
+    // Whatever was printed last has to be on screen before we ask for anything
+    Console_Present();
+
+    while (true)
+    {
+        Console_RunTicks();
+
+        if (Console_KeyAvailable())
+            return;
+
+        Console_Idle();
+    }
+}
+
+/* Wait for a key in a full screen view that reads keys itself. window has to be in nodelay mode. Ticks run in the meantime, like at the prompt */
+int32_t Console_WaitKey(WINDOW* window)
+{
+    while (true)
+    {
+        int32_t key = wgetch(window);
+
+        if (key != ERR)
+            return key;
+
+        Console_RunTicks();
+        Console_Idle();
+    }
+}
+
+void Console_IdleShutdown()
+{
+    console_num_ticks = 0;
+
+#ifdef __DJGPP__
+    if (idle_routine_segment > 0)
+        __dpmi_free_dos_memory(idle_routine_selector);
+
+    idle_routine_segment = -1;
+#endif
+}
@@ -0,0 +1,349 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    console_scrollback.c: Console scrollback
+
+    Everything the console prints is also kept here, in a DEFAULT_CONSOLE_SIZE ring of text plus a ring of where each line starts, so PageUp in the
+    REPL can show what scrolled off the screen. Both are fixed size: when either is full the oldest line is dropped, so adding text never
+    allocates or waits, whatever a test prints. Lines are numbered from the oldest one still kept (0) to the one being printed now.
+*/
+
+#include <nvplay.h>
+#include "core/console/console.h"
+#include "util/util.h"
+
+#define SCROLLBACK_KEY_ESCAPE       0x1B
+#define SCROLLBACK_KEY_BACKSPACE    0x08                        // keypad mode doesn't turn it into KEY_BACKSPACE on DOS
+
+typedef struct console_line_s
+{
+    uint32_t start;                                             // Offset in scrollback_text
+    uint32_t length;
+} console_line_t;
+
+char scrollback_text[DEFAULT_CONSOLE_SIZE];
+console_line_t scrollback_lines[CONSOLE_SCROLLBACK_MAX_LINES];
+
+uint32_t scrollback_first = 0;                                  // scrollback_lines index of line 0
+uint32_t scrollback_num_lines = 0;                              // Including the one being printed now
+uint32_t scrollback_head = 0;                                   // Where the next character goes
+uint32_t scrollback_used = 0;                                   // Characters in use
+
+static inline console_line_t* Console_ScrollbackLine(uint32_t line)
+{
+    return &scrollback_lines[(scrollback_first + line) & (CONSOLE_SCROLLBACK_MAX_LINES - 1)];
+}
+
+static void Console_ScrollbackDropOldest()
+{
+    scrollback_used -= Console_ScrollbackLine(0)->length;
+    scrollback_first = (scrollback_first + 1) & (CONSOLE_SCROLLBACK_MAX_LINES - 1);
+    scrollback_num_lines--;
+}
+
+static void Console_ScrollbackNewLine()
+{
+    if (scrollback_num_lines == CONSOLE_SCROLLBACK_MAX_LINES)
+        Console_ScrollbackDropOldest();
+
+    console_line_t* line = Console_ScrollbackLine(scrollback_num_lines++);
+
+    line->start = scrollback_head;
+    line->length = 0;
+}
+
+/* Add text to the end of the scrollback */
+void Console_ScrollbackAppend(const char* text)
+{
+    if (!scrollback_num_lines)
+        Console_ScrollbackNewLine();
+
+    for (; *text; text++)
+    {
+        if (*text == '\n')
+        {
+            Console_ScrollbackNewLine();
+            continue;
+        }
+
+        if (*text == '\r')
+            continue;
+
+        // Make room. A single line as big as the whole buffer is cut off
+        if (scrollback_used == DEFAULT_CONSOLE_SIZE)
+        {
+            if (scrollback_num_lines == 1)
+                return;
+
+            Console_ScrollbackDropOldest();
+        }
+
+        scrollback_text[scrollback_head] = *text;
+        scrollback_head = (scrollback_head + 1) & (DEFAULT_CONSOLE_SIZE - 1);
+        scrollback_used++;
+        Console_ScrollbackLine(scrollback_num_lines - 1)->length++;
+    }
+}
+
+/* Take back the last character of the line being printed (backspace at the prompt) */
+void Console_ScrollbackPopChar()
+{
+    if (!scrollback_num_lines)
+        return;
+
+    console_line_t* line = Console_ScrollbackLine(scrollback_num_lines - 1);
+
+    if (!line->length)
+        return;
+
+    line->length--;
+    scrollback_head = (scrollback_head - 1) & (DEFAULT_CONSOLE_SIZE - 1);
+    scrollback_used--;
+}
+
+uint32_t Console_ScrollbackNumLines()
+{
+    return scrollback_num_lines;
+}
+
+/* Copy line (0 = oldest) into buf, cut off at size - 1 characters. Returns its length, or 0 if there is no such line */
+uint32_t Console_ScrollbackGetLine(uint32_t line, char* buf, uint32_t size)
+{
+    buf[0] = '\0';
+
+    if (line >= scrollback_num_lines
+    || !size)
+        return 0;
+
+    console_line_t* entry = Console_ScrollbackLine(line);
+    uint32_t length = (entry->length < size - 1) ? entry->length : size - 1;
+    uint32_t first_part = DEFAULT_CONSOLE_SIZE - entry->start;
+
+    // It may wrap around the end of the ring
+    if (first_part > length)
+        first_part = length;
+
+    memcpy(buf, &scrollback_text[entry->start], first_part);
+    memcpy(&buf[first_part], scrollback_text, length - first_part);
+    buf[length] = '\0';
+    return length;
+}
+
+static bool Console_ScrollbackContains(const char* line, const char* text)
+{
+    size_t text_length = strlen(text);
+
+    for (; *line; line++)
+    {
+        if (!strncasecmp(line, text, text_length))
+            return true;
+    }
+
+    return false;
+}
+
+/* Find the nearest line before (backwards) or after start (not including it) containing text, ignoring case. Returns -1 if there isn't one */
+int32_t Console_ScrollbackFind(int32_t start, const char* text, bool backwards)
+{
+    char line[MAX_REASONABLE_LOG_LENGTH];
+    int32_t step = backwards ? -1 : 1;
+
+    // start may be past the end, e.g. the bottom of a screen that isn't full yet
+    if (start > (int32_t)scrollback_num_lines)
+        start = scrollback_num_lines;
+    else if (start < -1)
+        start = -1;
+
+    for (int32_t i = start + step; i >= 0 && i < (int32_t)scrollback_num_lines; i += step)
+    {
+        Console_ScrollbackGetLine(i, line, sizeof(line));
+
+        if (Console_ScrollbackContains(line, text))
+            return i;
+    }
+
+    return -1;
+}
+
+//
+// Viewer
+//
+
+WINDOW* scrollback_window = NULL;
+
+static void Console_ScrollbackDraw(int32_t top, int32_t match, const char* status)
+{
+    char line[MAX_REASONABLE_LOG_LENGTH];
+    int32_t rows = LINES - 1;
+
+    werase(scrollback_window);
+
+    for (int32_t row = 0; row < rows; row++)
+    {
+        if (!Console_ScrollbackGetLine(top + row, line, sizeof(line)))
+            continue;
+
+        if (top + row == match)
+            wattron(scrollback_window, A_REVERSE);
+
+        mvwaddnstr(scrollback_window, row, 0, line, COLS);
+        wattroff(scrollback_window, A_REVERSE);
+    }
+
+    wattron(scrollback_window, A_REVERSE);
+    mvwprintw(scrollback_window, rows, 0, "%-*.*s", COLS - 1, COLS - 1, status);
+    wattroff(scrollback_window, A_REVERSE);
+    wrefresh(scrollback_window);
+}
+
+/* Ask for the text to search for on the status line. Returns false if Esc was pressed */
+static bool Console_ScrollbackPrompt(int32_t top, char* buf, uint32_t n)
+{
+    char status[MAX_STR];
+    uint32_t length = strlen(buf);
+
+    while (true)
+    {
+        snprintf(status, MAX_STR, "Find: %s_", buf);
+        Console_ScrollbackDraw(top, -1, status);
+
+        int32_t key = Console_WaitKey(scrollback_window);
+
+        if (key == '\n'
+        || key == '\r')
+            return (length > 0);
+        else if (key == SCROLLBACK_KEY_ESCAPE)
+            return false;
+        else if (key == SCROLLBACK_KEY_BACKSPACE
+        || key == KEY_BACKSPACE)
+        {
+            if (length)
+                buf[--length] = '\0';
+        }
+        else if (key < 0x100
+        && isprint(key)
+        && length < n - 1)
+        {
+            buf[length++] = key;
+            buf[length] = '\0';
+        }
+    }
+}
+
+/* Show the scrollback, starting a page up from the end. Returns when Esc or q is pressed */
+void Console_ScrollbackView()
+{
+    static char search[MAX_STR] = {0};
+    char status[MAX_STR] = {0};
+    int32_t rows = LINES - 1;
+    int32_t match = -1;
+
+    if (console_backend != CONSOLE_BACKEND_CURSES)
+        return;
+
+    scrollback_window = newwin(LINES, COLS, 0, 0);
+
+    if (!scrollback_window)
+        return;
+
+    keypad(scrollback_window, true);
+    nodelay(scrollback_window, true);
+
+    int32_t last_top = (int32_t)scrollback_num_lines - rows;
+
+    if (last_top < 0)
+        last_top = 0;
+
+    int32_t top = last_top - rows;
+    bool running = true;
+
+    while (running)
+    {
+        if (top > last_top)
+            top = last_top;
+
+        if (top < 0)
+            top = 0;
+
+        if (!status[0])
+        {
+            snprintf(status, MAX_STR, "Lines %ld-%ld of %lu  PgUp/PgDn Up/Down Home/End  / find  n/N next/previous  Esc back", top + 1,
+                (top + rows < (int32_t)scrollback_num_lines) ? top + rows : (int32_t)scrollback_num_lines, scrollback_num_lines);
+        }
+
+        Console_ScrollbackDraw(top, match, status);
+        status[0] = '\0';
+
+        int32_t key = Console_WaitKey(scrollback_window);
+        int32_t found = -1;
+
+        switch (key)
+        {
+            case KEY_UP:
+                top--;
+                break;
+            case KEY_DOWN:
+                top++;
+                break;
+            case KEY_PPAGE:
+                top -= rows;
+                break;
+            case KEY_NPAGE:
+                top += rows;
+                break;
+            case KEY_HOME:
+                top = 0;
+                break;
+            case KEY_END:
+                top = last_top;
+                break;
+            case '/':
+                if (!Console_ScrollbackPrompt(top, search, MAX_STR))
+                    break;
+
+                // Newest first, from the bottom of the screen, since that's where what you're looking for usually just scrolled off
+                match = top + rows;
+                // fall through
+            case 'n':
+            case 'N':
+                if (!search[0])
+                    break;
+
+                if (match < 0)
+                    match = top + rows;
+
+                found = Console_ScrollbackFind(match, search, (key != 'N'));
+
+                if (found < 0)
+                {
+                    snprintf(status, MAX_STR, "\"%s\" not found", search);
+                    break;
+                }
+
+                match = found;
+
+                // Keep the match on screen, a third of the way down
+                if (match < top
+                || match >= top + rows)
+                    top = match - rows / 3;
+
+                break;
+            case 'q':
+            case 'Q':
+            case SCROLLBACK_KEY_ESCAPE:
+                running = false;
+                break;
+        }
+    }
+
+    delwin(scrollback_window);
+    scrollback_window = NULL;
+
+    // Put the REPL back
+    touchwin(stdscr);
+    wrefresh(stdscr);
+}
@@ -0,0 +1,395 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    console_text.c: Console that writes straight into text mode VRAM
+
+    Used for everything but the REPL (scripts, tests, -dumbconsole), where there is no need for PDCurses, and after it has been shut down. Characters
+    and attributes go into a copy of the screen, and the rows that changed are copied into B800:0000 (B000:0000 in mode 7) with one movedata per run
+    of rows when a frame is drawn (Console_Present), so nothing goes through the BIOS or DOS. Scrolling is a block move of the copy.
+
+    It only draws while the VGA is actually in text mode with its memory at our address, so a test that sets a graphics mode behind the BIOS'
+    back doesn't get text written over its framebuffer; the whole screen is drawn again once text mode is back.
+*/
+
+#include <nvplay.h>
+#include "core/console/console.h"
+#include "core/gpu/gpu.h"
+#include "util/util.h"
+
+#include <unistd.h>
+
+#ifdef __DJGPP__
+#include <go32.h>
+#include <pc.h>
+#include <sys/farptr.h>
+#include <sys/movedata.h>
+#include <sys/segments.h>
+#endif
+
+// BIOS data area
+#define TEXT_BIOS_VIDEO_MODE        0x449
+#define TEXT_BIOS_COLUMNS           0x44A
+#define TEXT_BIOS_PAGE_OFFSET       0x44E
+#define TEXT_BIOS_CURSOR            0x450       // Column, row for each of the 8 pages
+#define TEXT_BIOS_ACTIVE_PAGE       0x462
+#define TEXT_BIOS_CRTC_PORT         0x463
+#define TEXT_BIOS_ROWS              0x484       // Rows - 1 (EGA+, 0 before that)
+
+#define TEXT_VRAM_COLOR             0xB8000
+#define TEXT_VRAM_MONO              0xB0000
+
+#define TEXT_CRTC_CURSOR_HIGH       0x0E
+#define TEXT_CRTC_CURSOR_LOW        0x0F
+
+#define TEXT_GR_MISC                0x06        // Bit 0 = graphics mode, bits 3:2 = where the VGA's memory appears
+#define TEXT_GR_MISC_GRAPHICS       (1 << 0)
+#define TEXT_GR_MISC_MAP_SHIFT      2
+
+#define TEXT_TAB_SIZE               8
+
+#define TEXT_ESCAPE                 0x1B
+#define TEXT_ESCAPE_NONE            0
+#define TEXT_ESCAPE_STARTED         1           // Had ESC
+#define TEXT_ESCAPE_PARAMS          2           // Had ESC [
+
+// ANSI colours are in RGB bit order, VGA attributes in BGR
+const uint8_t text_ansi_colors[8] = { 0, 4, 2, 6, 1, 5, 3, 7 };
+
+console_text_t console_text = {0};
+
+#ifdef __DJGPP__
+
+/*
+    Is the VGA in text mode, with its memory at base? This runs from the middle of scripts, which may have selected a graphics controller
+    register and not written it yet, so the index is put back
+*/
+static bool Console_TextIsVisible()
+{
+    uint8_t index = inportb(VGA_PORT_GRAPHICS_INDEX);
+
+    outportb(VGA_PORT_GRAPHICS_INDEX, TEXT_GR_MISC);
+
+    uint8_t misc = inportb(VGA_PORT_GRAPHICS);
+    uint8_t map = (misc >> TEXT_GR_MISC_MAP_SHIFT) & 0x03;
+
+    outportb(VGA_PORT_GRAPHICS_INDEX, index);
+
+    if (misc & TEXT_GR_MISC_GRAPHICS)
+        return false;
+
+    // 2 = B0000-B7FFF, 3 = B8000-BFFFF. Anything else puts the start of VRAM somewhere else
+    return ((map == 2 && console_text.vram_base == TEXT_VRAM_MONO)
+    || (map == 3 && console_text.vram_base == TEXT_VRAM_COLOR));
+}
+
+/* Copy rows [first, first + count) to the screen */
+static void Console_TextCopyRows(uint32_t first, uint32_t count)
+{
+    uint32_t offset = first * console_text.columns;
+
+    movedata(_my_ds(), (unsigned)&console_text.cells[offset], _dos_ds, console_text.vram_base + console_text.page_offset + (offset << 1),
+        (count * console_text.columns) << 1);
+}
+
+/* Move the hardware cursor, and tell the BIOS where it is so DOS carries on from there */
+static void Console_TextMoveCursor()
+{
+    uint32_t position = (console_text.page_offset >> 1) + console_text.y * console_text.columns + console_text.x;
+    uint8_t index = inportb(console_text.crtc_port);
+
+    // Same as the graphics controller: put back whatever CRTC register was selected
+    outportb(console_text.crtc_port, TEXT_CRTC_CURSOR_HIGH);
+    outportb(console_text.crtc_port + 1, (position >> 8) & 0xFF);
+    outportb(console_text.crtc_port, TEXT_CRTC_CURSOR_LOW);
+    outportb(console_text.crtc_port + 1, position & 0xFF);
+    outportb(console_text.crtc_port, index);
+
+    _farpokeb(_dos_ds, TEXT_BIOS_CURSOR + (console_text.page << 1), console_text.x);
+    _farpokeb(_dos_ds, TEXT_BIOS_CURSOR + (console_text.page << 1) + 1, console_text.y);
+}
+
+/* Read the screen and the cursor position into console_text, e.g. after DOS has echoed something */
+void Console_TextResync()
+{
+    if (!console_text.active)
+        return;
+
+    console_text.x = _farpeekb(_dos_ds, TEXT_BIOS_CURSOR + (console_text.page << 1));
+    console_text.y = _farpeekb(_dos_ds, TEXT_BIOS_CURSOR + (console_text.page << 1) + 1);
+
+    if (console_text.x >= console_text.columns)
+        console_text.x = console_text.columns - 1;
+
+    if (console_text.y >= console_text.rows)
+        console_text.y = console_text.rows - 1;
+
+    movedata(_dos_ds, console_text.vram_base + console_text.page_offset, _my_ds(), (unsigned)console_text.cells,
+        (console_text.rows * console_text.columns) << 1);
+
+    console_text.dirty_rows = 0;
+    console_text.cursor_moved = false;
+}
+
+/* Start drawing into the screen if it's in text mode and stdout isn't redirected. Returns false if it can't be used */
+bool Console_TextInit()
+{
+    uint8_t mode = _farpeekb(_dos_ds, TEXT_BIOS_VIDEO_MODE) & 0x7F;         // Bit 7 = don't clear VRAM on the mode set
+
+    memset(&console_text, 0, sizeof(console_text_t));
+
+    // Output going to a file has to go through DOS
+    if (!isatty(fileno(stdout)))
+        return false;
+
+    if (mode > UNACCEL_VIDEO_TEXT_80_COLOR
+    && mode != UNACCEL_VIDEO_TEXT_MDA)
+        return false;
+
+    console_text.vram_base = (mode == UNACCEL_VIDEO_TEXT_MDA) ? TEXT_VRAM_MONO : TEXT_VRAM_COLOR;
+    console_text.page = _farpeekb(_dos_ds, TEXT_BIOS_ACTIVE_PAGE);
+    console_text.page_offset = _farpeekw(_dos_ds, TEXT_BIOS_PAGE_OFFSET);
+    console_text.crtc_port = _farpeekw(_dos_ds, TEXT_BIOS_CRTC_PORT);
+    console_text.columns = _farpeekw(_dos_ds, TEXT_BIOS_COLUMNS);
+    console_text.rows = _farpeekb(_dos_ds, TEXT_BIOS_ROWS) + 1;
+
+    // Pre-EGA BIOSes leave the row count at 0
+    if (console_text.rows == 1)
+        console_text.rows = DEFAULT_CONSOLE_ROWS;
+
+    if (!console_text.columns
+    || console_text.columns > CONSOLE_TEXT_MAX_COLUMNS
+    || console_text.rows > CONSOLE_TEXT_MAX_ROWS
+    || console_text.page >= 8)
+        return false;
+
+    console_text.attribute = CONSOLE_TEXT_DEFAULT_ATTRIBUTE;
+    console_text.visible = true;
+    console_text.active = true;
+
+    // Carry on from whatever DOS left on the screen
+    Console_TextResync();
+    return true;
+}
+
+#else
+
+// Nothing to draw into, so output goes to stdout
+bool Console_TextInit()
+{
+    memset(&console_text, 0, sizeof(console_text_t));
+    return false;
+}
+
+void Console_TextResync()
+{
+}
+
+#endif
+
+static inline void Console_TextMarkDirty(uint32_t row)
+{
+    console_text.dirty_rows |= (1ULL << row);
+}
+
+static inline void Console_TextMarkAllDirty()
+{
+    console_text.dirty_rows = (1ULL << console_text.rows) - 1;
+}
+
+/* Scroll everything up one row */
+static void Console_TextScroll()
+{
+    uint32_t row_size = console_text.columns;
+    uint16_t blank = ' ' | (console_text.attribute << 8);
+
+    memmove(console_text.cells, &console_text.cells[row_size], (console_text.rows - 1) * row_size * sizeof(uint16_t));
+
+    for (uint32_t i = 0; i < row_size; i++)
+        console_text.cells[(console_text.rows - 1) * row_size + i] = blank;
+
+    // Every row changed
+    Console_TextMarkAllDirty();
+}
+
+static void Console_TextNewLine()
+{
+    console_text.x = 0;
+
+    if (++console_text.y < console_text.rows)
+        return;
+
+    Console_TextScroll();
+    console_text.y = console_text.rows - 1;
+}
+
+/* Apply one parameter of ESC [ ... m. Only the ones DOS' ANSI.SYS knows about */
+static void Console_TextSetGraphicsMode(uint32_t param)
+{
+    if (param == 0)
+        console_text.attribute = CONSOLE_TEXT_DEFAULT_ATTRIBUTE;
+    else if (param == 1)
+        console_text.attribute |= 0x08;
+    else if (param >= 30 && param <= 37)
+        console_text.attribute = (console_text.attribute & 0xF8) | text_ansi_colors[param - 30];
+    else if (param >= 40 && param <= 47)
+        console_text.attribute = (console_text.attribute & 0x8F) | (text_ansi_colors[param - 40] << 4);
+}
+
+/* Returns true if ch was part of an escape sequence */
+static bool Console_TextEscape(char ch)
+{
+    switch (console_text.escape_state)
+    {
+        case TEXT_ESCAPE_NONE:
+            if (ch != TEXT_ESCAPE)
+                return false;
+
+            console_text.escape_state = TEXT_ESCAPE_STARTED;
+            return true;
+        case TEXT_ESCAPE_STARTED:
+            console_text.escape_state = (ch == '[') ? TEXT_ESCAPE_PARAMS : TEXT_ESCAPE_NONE;
+            console_text.escape_param = 0;
+            return true;
+        default:
+            if (ch >= '0' && ch <= '9')
+            {
+                console_text.escape_param = console_text.escape_param * 10 + (ch - '0');
+                return true;
+            }
+
+            // Anything but colours (cursor movement etc.) is ignored
+            if (ch == ';'
+            || ch == 'm')
+                Console_TextSetGraphicsMode(console_text.escape_param);
+
+            console_text.escape_param = 0;
+
+            if (ch != ';')
+                console_text.escape_state = TEXT_ESCAPE_NONE;
+
+            return true;
+    }
+}
+
+void Console_TextPushChar(char ch)
+{
+    if (!console_text.active
+    || Console_TextEscape(ch))
+        return;
+
+    console_text.cursor_moved = true;
+
+    switch (ch)
+    {
+        case '\n':
+            Console_TextNewLine();
+            return;
+        case '\r':
+            console_text.x = 0;
+            return;
+        case '\b':
+            if (console_text.x)
+                console_text.x--;
+
+            return;
+        case '\t':
+            console_text.x = (console_text.x + TEXT_TAB_SIZE) & ~(TEXT_TAB_SIZE - 1);
+
+            if (console_text.x >= console_text.columns)
+                Console_TextNewLine();
+
+            return;
+    }
+
+    console_text.cells[console_text.y * console_text.columns + console_text.x] = (uint8_t)ch | (console_text.attribute << 8);
+    Console_TextMarkDirty(console_text.y);
+
+    if (++console_text.x >= console_text.columns)
+        Console_TextNewLine();
+}
+
+void Console_TextWrite(const char* text)
+{
+    for (; *text; text++)
+        Console_TextPushChar(*text);
+}
+
+/* Delete the character before the cursor (backspace at the prompt) */
+void Console_TextPopChar()
+{
+    if (!console_text.active)
+        return;
+
+    if (console_text.x)
+        console_text.x--;
+    else if (console_text.y)
+    {
+        console_text.y--;
+        console_text.x = console_text.columns - 1;
+    }
+
+    console_text.cells[console_text.y * console_text.columns + console_text.x] = ' ' | (console_text.attribute << 8);
+    Console_TextMarkDirty(console_text.y);
+    console_text.cursor_moved = true;
+}
+
+/* Copy the rows that changed since the last frame to the screen */
+void Console_TextPresent()
+{
+    if (!console_text.active)
+        return;
+
+#ifdef __DJGPP__
+    bool visible = Console_TextIsVisible();
+
+    // Back in text mode after a graphics test. Whatever it drew is still in VRAM, so draw all of it
+    if (visible
+    && !console_text.visible)
+    {
+        Console_TextMarkAllDirty();
+        console_text.cursor_moved = true;
+    }
+
+    console_text.visible = visible;
+
+    if (!visible)
+        return;
+
+    uint32_t row = 0;
+
+    while (row < console_text.rows)
+    {
+        if (!(console_text.dirty_rows & (1ULL << row)))
+        {
+            row++;
+            continue;
+        }
+
+        uint32_t run = 1;
+
+        while (row + run < console_text.rows
+        && (console_text.dirty_rows & (1ULL << (row + run))))
+            run++;
+
+        Console_TextCopyRows(row, run);
+        row += run;
+    }
+
+    if (console_text.cursor_moved)
+        Console_TextMoveCursor();
+#endif
+
+    console_text.dirty_rows = 0;
+    console_text.cursor_moved = false;
+}
+
+/* Draw anything left. Run at exit, since NVPlay_Shutdown doesn't shut the console down */
+void Console_TextShutdown()
+{
+    Console_TextPresent();
+    console_text.active = false;
+}
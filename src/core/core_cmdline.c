@@ -11,6 +11,7 @@
 #include "nvplay.h"
 #include <string.h>
 #include <util/util.h>
+#include "core/remote/remote.h"
 
 // cOMMAND LINE OPTIONS
 #define COMMAND_LINE_RUN_TEST_INI               "-t"
@@ -26,6 +27,9 @@
 #define COMMAND_LINE_DUMBCONSOLE                "-d"
 #define COMMAND_LINE_DUMBCONSOLE_FULL           "-dumbconsole"
 #define COMMAND_LINE_KERNEL_TEST                "-kerneltest"
+#define COMMAND_LINE_PROFILE                    "-profile"
+#define COMMAND_LINE_DRYRUN                     "-dryrun"
+#define COMMAND_LINE_REMOTE                     "-remote"
 
 // C23 constexpr pls
 #define ARG_LEFT    argc - i < 1
@@ -94,6 +98,44 @@ bool NVPlay_ParseCmdline(int argc, char** argv)
         {
             nvplay_state.run_mode = NVPLAY_MODE_KERNEL_TEST;
         }
+        else if (!strcasecmp(current_arg, COMMAND_LINE_DRYRUN))
+        {
+            if (ARG_LEFT)
+            {
+                printf("-dryrun provided, but no script file provided!\n");
+                return false;
+            }
+
+            nvplay_state.run_mode = NVPLAY_MODE_DRYRUN;
+            strncpy(nvplay_state.reg_script_file, next_arg, MAX_STR);
+            i++;
+        }
+        else if (!strcasecmp(current_arg, COMMAND_LINE_REMOTE))
+        {
+            if (ARG_LEFT)
+            {
+                printf("-remote provided, but no serial port provided!\n");
+                return false;
+            }
+
+            nvplay_state.run_mode = NVPLAY_MODE_REMOTE;
+            strncpy(nvplay_state.remote_port, next_arg, MAX_STR);
+            nvplay_state.remote_baud = REMOTE_DEFAULT_BAUD;
+            i++;
+
+            // Optional baud rate (decimal)
+            if (i + 1 < argc
+            && (isdigit((unsigned char)argv[i + 1][0]) || argv[i + 1][0] == '#'))
+            {
+                nvplay_state.remote_baud = Remote_ParseBaud(argv[i + 1]);
+                i++;
+            }
+        }
+        else if (!strcasecmp(current_arg, COMMAND_LINE_PROFILE))
+        {
+            // Can't time anything until logging is up, NVPlay_Run turns the profiler on
+            nvplay_state.config.profile_scripts = true;
+        }
     }
 
     return true; 
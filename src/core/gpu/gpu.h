@@ -284,6 +284,8 @@ uint8_t NV_ReadMMIO8(uint32_t offset);
 uint32_t NV_ReadMMIO32(uint32_t offset); 
 void NV_WriteMMIO8(uint32_t offset, uint8_t val);
 void NV_WriteMMIO32(uint32_t offset, uint32_t val);
+void NV_ReadBlock32(uint16_t selector, uint32_t offset, uint32_t* buffer, uint32_t count);
+void NV_WriteBlock32(uint16_t selector, uint32_t offset, const uint32_t* buffer, uint32_t count);
 
 /* Requires some special dispensations if the bus size is 64-bit and there is only 2 MB of VRAM */
 uint8_t NV_ReadDfb8(uint32_t offset); 
@@ -297,6 +299,161 @@ void NV_WriteDfb32(uint32_t offset, uint32_t val);
 uint32_t NV_ReadRamin32(uint32_t offset); 
 void NV_WriteRamin32(uint32_t offset, uint32_t val);
 
+// Whole apertures addressed by offset (hex editor, remote protocol). The values are part of the remote protocol, don't reorder them
+typedef enum nv_space_e
+{
+	NV_SPACE_MMIO = 0,
+	NV_SPACE_VRAM = 1,
+	NV_SPACE_RAMIN = 2,
+	NV_SPACE_PCI = 3,
+
+	NV_NUM_SPACES,
+} nv_space_t;
+
+extern const char* nv_space_names[NV_NUM_SPACES];
+
+bool NV_ParseSpace(const char* name, nv_space_t* space);
+bool NV_GetSpaceMapping(nv_space_t space, uint16_t* selector, uint32_t* base, uint32_t* size);
+void NV_ReadSpaceBlock32(nv_space_t space, uint32_t offset, uint32_t* buffer, uint32_t count);
+void NV_WriteSpaceBlock32(nv_space_t space, uint32_t offset, const uint32_t* buffer, uint32_t count);
+
+// Hex editor (gpu_hexedit.c)
+bool NVPlay_HexEdit(nv_space_t space, uint32_t offset);
+
+// Register polling (gpu_wait.c)
+#define NV_WAIT_MAX_SITES					64
+#define NV_WAIT_MAX_SITE_NAME				48
+#define NV_WAIT_BACKOFF_MIN_US				1			// First delay between reads. Doubles every read after that...
+#define NV_WAIT_BACKOFF_MAX_US				1000		// ...up to this
+#define NV_WAIT_DEFAULT_TIMEOUT_US			100000		// 100ms. Anything the driver waits on should be much faster than this
+
+// Latency of every wait done from one call site
+typedef struct nv_wait_site_s
+{
+	char name[NV_WAIT_MAX_SITE_NAME];
+	uint32_t count;
+	uint32_t timeouts;
+	uint32_t min_us;
+	uint32_t max_us;
+	uint64_t total_us;
+} nv_wait_site_t;
+
+bool NV_WaitMMIO32(const char* site_name, uint32_t offset, uint32_t mask, uint32_t value, uint32_t timeout_us, uint32_t* elapsed_us);
+void NV_RecordWait(const char* site_name, uint32_t elapsed_us, bool timed_out);
+void NV_LogWaitStatistics();
+
+// Submitting methods through the USER aperture (gpu_user.c)
+#define NV_USER_START						0x800000
+#define NV_USER_END							0xFFFFFF
+#define NV_USER_SUBCHANNEL_MASK				0xFFE000	// Channel (bits 22:16) and subchannel (bits 15:13) of a USER address
+#define NV_USER_METHOD_MASK					0x1FFF
+#define NV_USER_FREE						0x0010		// Read: bytes free in CACHE1
+#define NV_USER_FREE_MASK					0x1FFC
+
+bool NV_SubmitUserMethods(uint32_t subchannel_base, const uint32_t* methods, const uint32_t* values, uint32_t count);
+
+// Loading files into VRAM/RAMIN (gpu_blob.c)
+#define NV_BLOB_CHUNK_SIZE					65536
+#define NV_BLOB_BMP_HEADER_SIZE				54			// BITMAPFILEHEADER + BITMAPINFOHEADER
+#define NV_BLOB_NV1_RAMIN_SIZE				0x100000
+
+bool NV_GetRaminMapping(uint16_t* selector, uint32_t* base, uint32_t* size);
+bool NV_LoadFileVRAM(const char* file_name, uint32_t offset);
+bool NV_LoadFileRamin(const char* file_name, uint32_t offset);
+bool NV_SaveFileVRAM(const char* file_name, uint32_t offset, uint32_t size);
+
+// Dry run: a model of the GPU's registers that the I/O functions use instead of the hardware (gpu_shadow.c)
+#define NV_SHADOW_PAGE_SIZE					4096
+#define NV_SHADOW_DEFAULT_BOOT_0			NV_PMC_BOOT_NV3_B00		// GPU to pretend to be, if DryRun_Boot0 isn't set
+#define NV_SHADOW_DEFAULT_VRAM				0x400000
+#define NV_SHADOW_SELECTOR_BAR0				1			// Fake selectors, so code that picks a BAR by selector still works
+#define NV_SHADOW_SELECTOR_BAR1				2
+#define NV_SHADOW_MAX_WARNINGS				64			// Out of bounds/read-only/side effect warnings logged before going quiet
+#define NV_SHADOW_REPORT_MAX_RUN			8			// Longer runs of written dwords are reported as a range
+
+// Flags for each dword of a shadow page
+#define NV_SHADOW_DWORD_WRITTEN				0x01
+#define NV_SHADOW_DWORD_READ				0x02
+#define NV_SHADOW_DWORD_WARNED				0x04		// Only warn about a register once
+
+// Flags for registers in the model
+#define NV_SHADOW_REG_READ_ONLY				0x01		// Writes are ignored
+#define NV_SHADOW_REG_SIDE_EFFECT			0x02		// Writes do something besides store a value
+#define NV_SHADOW_REG_WRITE_1_CLEAR			0x04		// Writing 1 to a bit clears it (interrupt status)
+
+#define NV_SHADOW_GEN_NV1					0x01
+#define NV_SHADOW_GEN_NV3					0x02
+#define NV_SHADOW_GEN_NV4					0x04		// and later
+#define NV_SHADOW_GEN_ALL					0x07
+
+typedef enum nv_shadow_space_e
+{
+	NV_SHADOW_SPACE_BAR0 = 0,
+	NV_SHADOW_SPACE_BAR1 = 1,
+	NV_SHADOW_NUM_SPACES = 2,
+} nv_shadow_space_t;
+
+typedef enum nv_shadow_vga_e
+{
+	NV_SHADOW_VGA_CRTC = 0,
+	NV_SHADOW_VGA_SEQUENCER = 1,
+	NV_SHADOW_VGA_GRAPHICS = 2,
+	NV_SHADOW_VGA_ATTRIBUTE = 3,
+	NV_SHADOW_NUM_VGA = 4,
+} nv_shadow_vga_t;
+
+typedef struct nv_shadow_page_s
+{
+	uint8_t data[NV_SHADOW_PAGE_SIZE];
+	uint8_t flags[NV_SHADOW_PAGE_SIZE >> 2];
+	uint16_t writes[NV_SHADOW_PAGE_SIZE >> 2];	// Saturates
+} nv_shadow_page_t;
+
+typedef struct nv_shadow_register_s
+{
+	uint32_t generations;
+	uint32_t start;
+	uint32_t end;
+	uint32_t flags;
+	const char* name;
+	const char* effect;							// What a write does, for side effect warnings
+} nv_shadow_register_t;
+
+typedef struct nv_shadow_state_s
+{
+	bool enabled;
+	uint32_t generation;
+	nv_shadow_page_t** pages[NV_SHADOW_NUM_SPACES];	// Allocated on first write
+	uint32_t size[NV_SHADOW_NUM_SPACES];
+
+	uint8_t vga[NV_SHADOW_NUM_VGA][256];
+	bool vga_written[NV_SHADOW_NUM_VGA][256];
+	uint8_t pci[256];
+	bool pci_written[256];
+
+	uint32_t reads;
+	uint32_t writes;
+	uint32_t out_of_bounds;
+	uint32_t read_only_writes;
+	uint32_t side_effect_writes;
+	uint32_t warnings;
+} nv_shadow_state_t;
+
+extern nv_shadow_state_t shadow_state;
+
+bool NV_ShadowInit();
+uint32_t NV_ShadowRead(nv_shadow_space_t space, uint32_t offset, uint32_t size);
+void NV_ShadowWrite(nv_shadow_space_t space, uint32_t offset, uint32_t value, uint32_t size);
+uint32_t NV_ShadowReadRamin32(uint32_t offset);
+void NV_ShadowWriteRamin32(uint32_t offset, uint32_t value);
+bool NV_ShadowCopy(int32_t selector, uint32_t offset, void* buffer, uint32_t size, bool to_shadow);
+uint8_t NV_ShadowReadVGA(nv_shadow_vga_t vga, uint8_t index);
+void NV_ShadowWriteVGA(nv_shadow_vga_t vga, uint8_t index, uint8_t value);
+uint32_t NV_ShadowReadPCI(uint32_t offset, uint32_t size);
+void NV_ShadowWritePCI(uint32_t offset, uint32_t value, uint32_t size);
+void NV_ShadowReport();
+bool NV_ShadowRefuse(const char* what);
+
 // NV-VGA
 void NV_CRTCLockExtendedRegisters();
 void NV_CRTCUnlockExtendedRegisters();
@@ -0,0 +1,304 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    gpu_blob.c: Loading files into VRAM/RAMIN and saving VRAM to files
+
+    Files are read in NV_BLOB_CHUNK_SIZE chunks and copied into the BAR with movedata, rather than one _farpokel per dword. Files starting with "BM"
+    are treated as uncompressed BMPs: the pixels are written top-down with no row padding (pitch = width * bytes per pixel), and 24bpp is expanded to
+    32bpp since nothing can scan it out. Anything else is copied as-is.
+*/
+
+#include <nvplay.h>
+#include <architecture/nvidia/nv1/nv1_ref.h>
+#include <architecture/nvidia/nv3/nv3_ref.h>
+#include <architecture/nvidia/nv4/nv4_ref.h>
+#include "core/gpu/gpu.h"
+#include "util/util.h"
+#include <sys/movedata.h>
+#include <sys/segments.h>
+
+/* Find out where RAMIN is on this GPU. See NV_ReadRamin32 for why it is where it is */
+bool NV_GetRaminMapping(uint16_t* selector, uint32_t* base, uint32_t* size)
+{
+    switch (current_device.real_device_id)
+    {
+        case PCI_DEVICE_NV1_NV:
+            *selector = current_device.bus_info.bar0_selector;
+            *base = NV1_RAMIN_START;
+            *size = NV_BLOB_NV1_RAMIN_SIZE;
+            return true;
+        case PCI_DEVICE_NV3:
+        case PCI_DEVICE_NV3T_ACPI:
+            *selector = current_device.bus_info.bar1_selector;
+            *base = NV3_RAMIN_START;
+            *size = NV3_RAMIN_SIZE;
+            return true;
+        case PCI_DEVICE_NV4 ... PCI_DEVICE_NV1F:
+            *selector = current_device.bus_info.bar0_selector;
+            *base = NV4_PRAMIN_START;
+            *size = NV4_PRAMIN_SIZE + 1;
+            return true;
+    }
+
+    Logging_Write(LOG_LEVEL_ERROR, "NV_GetRaminMapping: Unsupported GPU\n");
+    return false;
+}
+
+static inline uint32_t NV_BlobRead16(uint8_t* buf) { return buf[0] | (buf[1] << 8); }
+static inline uint32_t NV_BlobRead32(uint8_t* buf) { return buf[0] | (buf[1] << 8) | (buf[2] << 16) | ((uint32_t)buf[3] << 24); }
+
+/* movedata into/out of an aperture, or the dry run model. Each chunk counts as I/O time, the same as NV_ReadBlock32 */
+static inline void NV_BlobCopyIn(uint16_t selector, uint32_t offset, void* buffer, uint32_t size)
+{
+    if (shadow_state.enabled)
+    {
+        NV_ShadowCopy(selector, offset, buffer, size, true);
+        return;
+    }
+
+    uint64_t profile_start = Profile_IOStart();
+    movedata(_my_ds(), (unsigned)buffer, selector, offset, size);
+    Profile_IOEnd(profile_start);
+}
+
+static inline void NV_BlobCopyOut(uint16_t selector, uint32_t offset, void* buffer, uint32_t size)
+{
+    if (shadow_state.enabled)
+    {
+        NV_ShadowCopy(selector, offset, buffer, size, false);
+        return;
+    }
+
+    uint64_t profile_start = Profile_IOStart();
+    movedata(selector, offset, _my_ds(), (unsigned)buffer, size);
+    Profile_IOEnd(profile_start);
+}
+
+/* Copy an uncompressed BMP into the aperture. The header has already been read into header. */
+bool NV_LoadBlobBMP(FILE* stream, uint8_t* header, const char* file_name, uint16_t selector, uint32_t base, uint32_t offset, uint32_t limit)
+{
+    uint32_t data_offset = NV_BlobRead32(&header[10]);
+    int32_t width = (int32_t)NV_BlobRead32(&header[18]);
+    int32_t height = (int32_t)NV_BlobRead32(&header[22]);
+    uint32_t bpp = NV_BlobRead16(&header[28]);
+    uint32_t compression = NV_BlobRead32(&header[30]);
+    bool top_down = (height < 0);
+
+    if (top_down)
+        height = -height;
+
+    // BI_RGB or BI_BITFIELDS. We don't look at the bitfields, 16bpp is whatever the GPU is set to
+    if ((compression != 0 && compression != 3)
+    || (bpp != 8 && bpp != 16 && bpp != 24 && bpp != 32)
+    || width <= 0
+    || height == 0)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "%s: Only uncompressed 8/16/24/32bpp BMPs are supported\n", file_name);
+        return false;
+    }
+
+    uint32_t file_pitch = (((uint32_t)width * bpp + 31) / 32) * 4;
+    uint32_t out_bytes_per_pixel = (bpp == 24) ? 4 : (bpp >> 3);
+    uint32_t pitch = (uint32_t)width * out_bytes_per_pixel;
+
+    if ((uint64_t)offset + (uint64_t)pitch * height > limit)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "%s: %ldx%ld image at %08lX doesn't fit (limit %08lX)\n", file_name, width, height, offset, limit);
+        return false;
+    }
+
+    if (bpp == 8)
+        Logging_Write(LOG_LEVEL_WARNING, "%s: 8bpp BMP, only the indices are loaded (not the palette)\n", file_name);
+
+    uint8_t* file_row = malloc(file_pitch);
+    uint8_t* row = malloc(pitch);
+
+    if (!file_row || !row)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "%s: Out of memory\n", file_name);
+        free(file_row);
+        free(row);
+        return false;
+    }
+
+    fseek(stream, data_offset, SEEK_SET);
+
+    bool success = true;
+
+    // Rows are read in file order, so the only difference for bottom-up files is where they go
+    for (int32_t file_y = 0; file_y < height; file_y++)
+    {
+        if (fread(file_row, 1, file_pitch, stream) != file_pitch)
+        {
+            Logging_Write(LOG_LEVEL_ERROR, "%s: File ends at row %ld of %ld\n", file_name, file_y, height);
+            success = false;
+            break;
+        }
+
+        uint8_t* out = file_row;
+
+        if (bpp == 24)
+        {
+            for (int32_t x = 0; x < width; x++)
+            {
+                row[x * 4 + 0] = file_row[x * 3 + 0];
+                row[x * 4 + 1] = file_row[x * 3 + 1];
+                row[x * 4 + 2] = file_row[x * 3 + 2];
+                row[x * 4 + 3] = 0;
+            }
+
+            out = row;
+        }
+
+        uint32_t y = top_down ? (uint32_t)file_y : (uint32_t)(height - 1 - file_y);
+
+        NV_BlobCopyIn(selector, base + offset + y * pitch, out, pitch);
+    }
+
+    free(file_row);
+    free(row);
+
+    if (success)
+        Logging_Write(LOG_LEVEL_MESSAGE, "Loaded %s (%ldx%ld, %lubpp) at %08lX, pitch %lu\n", file_name, width, height, bpp, offset, pitch);
+
+    return success;
+}
+
+/* Copy a file into an aperture at base + offset. limit is the size of the area (RAMIN or VRAM) offset is relative to. */
+bool NV_LoadBlob(const char* file_name, uint16_t selector, uint32_t base, uint32_t offset, uint32_t limit)
+{
+    FILE* stream = fopen(file_name, "rb");
+
+    if (!stream)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "Failed to open %s!\n", file_name);
+        return false;
+    }
+
+    uint8_t header[NV_BLOB_BMP_HEADER_SIZE] = {0};
+    uint32_t header_size = fread(header, 1, NV_BLOB_BMP_HEADER_SIZE, stream);
+
+    if (header_size == NV_BLOB_BMP_HEADER_SIZE
+    && header[0] == 'B'
+    && header[1] == 'M')
+    {
+        bool success = NV_LoadBlobBMP(stream, header, file_name, selector, base, offset, limit);
+        fclose(stream);
+        return success;
+    }
+
+    fseek(stream, 0, SEEK_END);
+    uint32_t size = ftell(stream);
+    fseek(stream, 0, SEEK_SET);
+
+    if ((uint64_t)offset + size > limit)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "%s: %lu bytes at %08lX doesn't fit (limit %08lX)\n", file_name, size, offset, limit);
+        fclose(stream);
+        return false;
+    }
+
+    uint8_t* buffer = malloc(NV_BLOB_CHUNK_SIZE);
+
+    if (!buffer)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "%s: Out of memory\n", file_name);
+        fclose(stream);
+        return false;
+    }
+
+    uclock_t start_clock = uclock();
+    uint32_t position = 0;
+    uint32_t chunk_size = 0;
+
+    while ((chunk_size = fread(buffer, 1, NV_BLOB_CHUNK_SIZE, stream)) > 0)
+    {
+        NV_BlobCopyIn(selector, base + offset + position, buffer, chunk_size);
+        position += chunk_size;
+    }
+
+    double elapsed = (double)(uclock() - start_clock) / UCLOCKS_PER_SEC;
+
+    free(buffer);
+    fclose(stream);
+
+    Logging_Write(LOG_LEVEL_MESSAGE, "Loaded %s (%lu bytes) at %08lX (%.2f MB/s)\n", file_name, position, offset,
+        (elapsed > 0) ? (position / 1048576.0) / elapsed : 0.0);
+
+    return true;
+}
+
+bool NV_LoadFileVRAM(const char* file_name, uint32_t offset)
+{
+    return NV_LoadBlob(file_name, current_device.bus_info.bar1_selector, 0, offset, current_device.vram_amount);
+}
+
+bool NV_LoadFileRamin(const char* file_name, uint32_t offset)
+{
+    uint16_t selector = 0;
+    uint32_t base = 0, size = 0;
+
+    if (!NV_GetRaminMapping(&selector, &base, &size))
+        return false;
+
+    return NV_LoadBlob(file_name, selector, base, offset, size);
+}
+
+/* Save size bytes of VRAM starting at offset as a raw file */
+bool NV_SaveFileVRAM(const char* file_name, uint32_t offset, uint32_t size)
+{
+    if ((uint64_t)offset + size > current_device.vram_amount)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "NV_SaveFileVRAM: %08lX-%08lX is out of bounds (VRAM size %08lX)\n", offset, offset + size,
+            current_device.vram_amount);
+        return false;
+    }
+
+    FILE* stream = fopen(file_name, "wb");
+
+    if (!stream)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "Failed to open %s!\n", file_name);
+        return false;
+    }
+
+    uint8_t* buffer = malloc(NV_BLOB_CHUNK_SIZE);
+
+    if (!buffer)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "%s: Out of memory\n", file_name);
+        fclose(stream);
+        return false;
+    }
+
+    bool success = true;
+
+    for (uint32_t position = 0; position < size; position += NV_BLOB_CHUNK_SIZE)
+    {
+        uint32_t chunk_size = size - position;
+
+        if (chunk_size > NV_BLOB_CHUNK_SIZE)
+            chunk_size = NV_BLOB_CHUNK_SIZE;
+
+        NV_BlobCopyOut(current_device.bus_info.bar1_selector, offset + position, buffer, chunk_size);
+
+        if (fwrite(buffer, 1, chunk_size, stream) != chunk_size)
+        {
+            Logging_Write(LOG_LEVEL_ERROR, "%s: Write failed (disk full?)\n", file_name);
+            success = false;
+            break;
+        }
+    }
+
+    free(buffer);
+    fclose(stream);
+
+    if (success)
+        Logging_Write(LOG_LEVEL_MESSAGE, "Saved VRAM %08lX-%08lX to %s\n", offset, offset + size, file_name);
+
+    return success;
+}
@@ -0,0 +1,534 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    gpu_hexedit.c: Full screen hex editor over MMIO, VRAM, RAMIN and PCI configuration space
+
+    Only the page on screen is read, with one block read, and it is kept until the page changes, something is written, or the refresh tick runs
+    (every HEXEDIT_REFRESH_MS while waiting for a key, along with the other background ticks). Keypresses that only move the cursor redraw from the copy. Bytes that changed since the
+    last read of the same page are highlighted. Everything is shown as dwords, because that is how most of the GPU wants to be accessed.
+
+    MMIO areas the dump skips (the ones that crash an NV3, and whatever nvmap.txt says is unmapped or a mirror) are never read or written here
+    either. They are shown as dashes and finding steps over them.
+*/
+
+#include "gpu_repl.h"
+#include "curses.h"
+#include "core/console/console.h"
+#include "core/gpu/gpu.h"
+#include "architecture/nvidia/kernel/nv_generic.h"
+#include "architecture/nvidia/nv3/nv3.h"
+#include "core/script/script.h"
+#include "util/util.h"
+#include <nvplay.h>
+
+#define HEXEDIT_MAX_ROWS            60                          // Enough for 80x60 text mode
+#define HEXEDIT_DWORDS_PER_ROW      4
+#define HEXEDIT_BYTES_PER_ROW       (HEXEDIT_DWORDS_PER_ROW << 2)
+#define HEXEDIT_REFRESH_MS          500
+#define HEXEDIT_SEARCH_CHUNK        4096                        // Bytes per block read when searching
+#define HEXEDIT_MAX_INPUT           64
+#define HEXEDIT_KEY_ESCAPE          0x1B
+#define HEXEDIT_KEY_BACKSPACE       0x08                        // keypad mode doesn't turn it into KEY_BACKSPACE on DOS
+
+typedef struct hexedit_state_s
+{
+    nv_space_t space;
+    uint32_t size;
+    uint32_t rows;                                              // Rows on screen
+    uint32_t page_offset;                                       // First byte on screen
+    uint32_t cursor;                                            // Offset of the selected dword
+    uint32_t page[HEXEDIT_MAX_ROWS * HEXEDIT_DWORDS_PER_ROW];   // What was read for the page on screen
+    uint32_t previous[HEXEDIT_MAX_ROWS * HEXEDIT_DWORDS_PER_ROW];
+    bool excluded[HEXEDIT_MAX_ROWS * HEXEDIT_DWORDS_PER_ROW];  // Not read, see NVPlay_HexEditIsExcluded
+    uint32_t page_dwords;                                       // Dwords in page (less at the end of the space)
+    bool has_previous;                                          // previous holds the last read of the same page
+    bool has_search;
+    uint32_t search_value;
+    char status[MAX_STR];
+} hexedit_state_t;
+
+hexedit_state_t hexedit_state = {0};
+WINDOW* hexedit_window = NULL;
+
+static bool NVPlay_HexEditSetSpace(nv_space_t space)
+{
+    uint16_t selector = 0;
+    uint32_t base = 0;
+
+    hexedit_state.space = space;
+    hexedit_state.has_previous = false;
+    return NV_GetSpaceMapping(space, &selector, &base, &hexedit_state.size);
+}
+
+/* True if offset is in an MMIO area that must not be touched. Both lists are in whole pages, so this only has to be asked once per page */
+static bool NVPlay_HexEditIsExcluded(uint32_t offset)
+{
+    if (hexedit_state.space != NV_SPACE_MMIO)
+        return false;
+
+    return ((GPU_IsNV3() && NV3_MMIOAreaIsExcluded(offset))
+    || NVGeneric_MMIOMapCanSkip(offset));
+}
+
+/* Dwords from offset to the end of its page, at most max */
+static uint32_t NVPlay_HexEditPageRun(uint32_t offset, uint32_t max)
+{
+    uint32_t run = (NV_FINGERPRINT_PAGE_SIZE - (offset & (NV_FINGERPRINT_PAGE_SIZE - 1))) >> 2;
+
+    return (run < max) ? run : max;
+}
+
+/* Read the page on screen. If it is the same page as last time, the last read is kept to highlight what changed */
+static void NVPlay_HexEditReadPage(bool same_page)
+{
+    uint32_t dwords = hexedit_state.rows * HEXEDIT_DWORDS_PER_ROW;
+    uint32_t remaining = (hexedit_state.size - hexedit_state.page_offset) >> 2;
+
+    if (dwords > remaining)
+        dwords = remaining;
+
+    hexedit_state.has_previous = same_page;
+
+    if (same_page)
+        memcpy(hexedit_state.previous, hexedit_state.page, sizeof(hexedit_state.page));
+
+    // One block read per page, so the excluded ones can be left out
+    for (uint32_t i = 0; i < dwords;)
+    {
+        uint32_t offset = hexedit_state.page_offset + (i << 2);
+        uint32_t run = NVPlay_HexEditPageRun(offset, dwords - i);
+        bool excluded = NVPlay_HexEditIsExcluded(offset);
+
+        if (excluded)
+            memset(&hexedit_state.page[i], 0, run * sizeof(uint32_t));
+        else
+            NV_ReadSpaceBlock32(hexedit_state.space, offset, &hexedit_state.page[i], run);
+
+        for (uint32_t j = i; j < i + run; j++)
+            hexedit_state.excluded[j] = excluded;
+
+        i += run;
+    }
+
+    hexedit_state.page_dwords = dwords;
+}
+
+static void NVPlay_HexEditDrawDword(uint32_t index)
+{
+    uint32_t value = hexedit_state.page[index];
+    uint32_t changed = hexedit_state.has_previous ? (value ^ hexedit_state.previous[index]) : 0;
+    bool selected = (hexedit_state.page_offset + (index << 2) == hexedit_state.cursor);
+
+    if (hexedit_state.excluded[index])
+    {
+        wattrset(hexedit_window, selected ? (A_BOLD | A_UNDERLINE) : 0);
+        wprintw(hexedit_window, "--------");
+        wattrset(hexedit_window, 0);
+        waddch(hexedit_window, ' ');
+        return;
+    }
+
+    // Most significant byte first, like everywhere else numbers are printed
+    for (int32_t byte = 3; byte >= 0; byte--)
+    {
+        chtype attributes = selected ? (A_BOLD | A_UNDERLINE) : 0;
+
+        if ((changed >> (byte << 3)) & 0xFF)
+            attributes |= A_REVERSE;
+
+        wattrset(hexedit_window, attributes);
+        wprintw(hexedit_window, "%02lX", (value >> (byte << 3)) & 0xFF);
+    }
+
+    wattrset(hexedit_window, 0);
+    waddch(hexedit_window, ' ');
+}
+
+static void NVPlay_HexEditDraw()
+{
+    wattrset(hexedit_window, A_REVERSE);
+    mvwprintw(hexedit_window, 0, 0, " %s %08lX-%08lX  g:goto e:edit /:find n:next r:reread Tab:space q:quit",
+        nv_space_names[hexedit_state.space], hexedit_state.page_offset,
+        hexedit_state.page_offset + (hexedit_state.page_dwords << 2) - 1);
+    wclrtoeol(hexedit_window);
+    wattrset(hexedit_window, 0);
+
+    for (uint32_t row = 0; row < hexedit_state.rows; row++)
+    {
+        uint32_t first = row * HEXEDIT_DWORDS_PER_ROW;
+
+        wmove(hexedit_window, row + 1, 0);
+
+        if (first >= hexedit_state.page_dwords)
+        {
+            wclrtoeol(hexedit_window);
+            continue;
+        }
+
+        wprintw(hexedit_window, "%08lX  ", hexedit_state.page_offset + (first << 2));
+
+        for (uint32_t dword = first; dword < first + HEXEDIT_DWORDS_PER_ROW; dword++)
+        {
+            if (dword < hexedit_state.page_dwords)
+                NVPlay_HexEditDrawDword(dword);
+            else
+                wprintw(hexedit_window, "%9s", "");
+        }
+
+        waddch(hexedit_window, ' ');
+
+        // Bytes in memory order
+        for (uint32_t dword = first; dword < first + HEXEDIT_DWORDS_PER_ROW && dword < hexedit_state.page_dwords; dword++)
+        {
+            for (uint32_t byte = 0; byte < 4; byte++)
+            {
+                uint8_t ch = (hexedit_state.page[dword] >> (byte << 3)) & 0xFF;
+
+                if (hexedit_state.excluded[dword])
+                    waddch(hexedit_window, '-');
+                else
+                    waddch(hexedit_window, isprint(ch) ? ch : '.');
+            }
+        }
+
+        wclrtoeol(hexedit_window);
+    }
+
+    mvwprintw(hexedit_window, hexedit_state.rows + 1, 0, "%08lX: %s", hexedit_state.cursor, hexedit_state.status);
+    wclrtoeol(hexedit_window);
+    wrefresh(hexedit_window);
+}
+
+/* Move the cursor, and the page if the cursor leaves it. Only reads if the page changed */
+static void NVPlay_HexEditMoveTo(int64_t offset)
+{
+    uint32_t page_size = hexedit_state.rows * HEXEDIT_BYTES_PER_ROW;
+
+    if (offset < 0)
+        offset = 0;
+    else if (offset > hexedit_state.size - 4)
+        offset = hexedit_state.size - 4;
+
+    hexedit_state.cursor = (uint32_t)offset & ~3;
+
+    uint32_t page_offset = hexedit_state.page_offset;
+
+    if (hexedit_state.cursor < page_offset)
+        page_offset = hexedit_state.cursor & ~(HEXEDIT_BYTES_PER_ROW - 1);
+    else if (hexedit_state.cursor >= page_offset + page_size)
+        page_offset = (hexedit_state.cursor & ~(HEXEDIT_BYTES_PER_ROW - 1)) - page_size + HEXEDIT_BYTES_PER_ROW;
+
+    if (page_offset != hexedit_state.page_offset)
+    {
+        hexedit_state.page_offset = page_offset;
+        NVPlay_HexEditReadPage(false);
+    }
+}
+
+/* Read the page again while waiting for a key, to show what changed by itself */
+static void NVPlay_HexEditRefreshTick(void* context)
+{
+    NVPlay_HexEditReadPage(true);
+    NVPlay_HexEditDraw();
+}
+
+/* Ask for a line of input on the status line. Returns false if Esc was pressed */
+static bool NVPlay_HexEditPrompt(const char* prompt, char* buf, uint32_t n)
+{
+    uint32_t length = 0;
+
+    buf[0] = '\0';
+
+    while (true)
+    {
+        snprintf(hexedit_state.status, MAX_STR, "%s%s_", prompt, buf);
+        NVPlay_HexEditDraw();
+
+        int32_t key = Console_WaitKey(hexedit_window);
+
+        if (key == '\n'
+        || key == '\r')
+            break;
+        else if (key == HEXEDIT_KEY_ESCAPE)
+        {
+            hexedit_state.status[0] = '\0';
+            return false;
+        }
+        else if (key == HEXEDIT_KEY_BACKSPACE
+        || key == KEY_BACKSPACE)
+        {
+            if (length)
+                buf[--length] = '\0';
+        }
+        else if (key < 0x100
+        && isprint(key)
+        && length < n - 1)
+        {
+            buf[length++] = key;
+            buf[length] = '\0';
+        }
+    }
+
+    hexedit_state.status[0] = '\0';
+    return true;
+}
+
+/* A hex number or a register name from the reference headers */
+static bool NVPlay_HexEditParseValue(const char* str, uint32_t* value)
+{
+    uint32_t length = Script_RegisterNameLength(str);
+
+    if (length
+    && length == strlen(str))
+    {
+        const script_register_t* reg = Script_FindRegister(str, length);
+
+        if (!reg
+        || reg->generation != Script_RegisterGeneration())
+        {
+            snprintf(hexedit_state.status, MAX_STR, "%s isn't a register on this GPU", str);
+            return false;
+        }
+
+        *value = reg->value;
+        return true;
+    }
+
+    char* end = NULL;
+
+    *value = strtoul(str, &end, 16);
+
+    if (!str[0]
+    || *end)
+    {
+        snprintf(hexedit_state.status, MAX_STR, "%s isn't a hex number or register name", str);
+        return false;
+    }
+
+    return true;
+}
+
+/*
+    Find the next dword equal to the search value after the cursor, reading HEXEDIT_SEARCH_CHUNK at a time. Excluded pages are stepped over.
+    Any key stops it
+*/
+static void NVPlay_HexEditFindNext()
+{
+    static uint32_t chunk[HEXEDIT_SEARCH_CHUNK >> 2];
+    uint32_t offset = hexedit_state.cursor + 4;
+
+    if (!hexedit_state.has_search)
+    {
+        snprintf(hexedit_state.status, MAX_STR, "Nothing to find yet (use /)");
+        return;
+    }
+
+    snprintf(hexedit_state.status, MAX_STR, "Finding %08lX...", hexedit_state.search_value);
+    NVPlay_HexEditDraw();
+
+    while (offset < hexedit_state.size)
+    {
+        uint32_t dwords = (hexedit_state.size - offset) >> 2;
+
+        if (dwords > (HEXEDIT_SEARCH_CHUNK >> 2))
+            dwords = HEXEDIT_SEARCH_CHUNK >> 2;
+
+        // Chunks never cross a page, so a page is either read whole or skipped whole
+        dwords = NVPlay_HexEditPageRun(offset, dwords);
+
+        if (NVPlay_HexEditIsExcluded(offset))
+        {
+            offset += dwords << 2;
+            continue;
+        }
+
+        NV_ReadSpaceBlock32(hexedit_state.space, offset, chunk, dwords);
+
+        for (uint32_t i = 0; i < dwords; i++)
+        {
+            if (chunk[i] != hexedit_state.search_value)
+                continue;
+
+            NVPlay_HexEditMoveTo(offset + (i << 2));
+            snprintf(hexedit_state.status, MAX_STR, "Found %08lX", hexedit_state.search_value);
+            return;
+        }
+
+        offset += dwords << 2;
+
+        if (wgetch(hexedit_window) != ERR)
+        {
+            snprintf(hexedit_state.status, MAX_STR, "Stopped finding %08lX at %08lX", hexedit_state.search_value, offset);
+            return;
+        }
+    }
+
+    snprintf(hexedit_state.status, MAX_STR, "%08lX not found after %08lX", hexedit_state.search_value, hexedit_state.cursor);
+}
+
+/* Open the editor on offset in space. Returns when q or Esc is pressed */
+bool NVPlay_HexEdit(nv_space_t space, uint32_t offset)
+{
+    char input[HEXEDIT_MAX_INPUT] = {0};
+    uint32_t value = 0;
+
+    if (console_backend != CONSOLE_BACKEND_CURSES)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "The hex editor needs the curses console (only in the REPL, without -dumbconsole)\n");
+        return false;
+    }
+
+    if (!NVPlay_HexEditSetSpace(space))
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "Can't edit %s on this GPU\n", nv_space_names[space]);
+        return false;
+    }
+
+    if (offset >= hexedit_state.size)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "%08lX is past the end of %s (%08lX)\n", offset, nv_space_names[space], hexedit_state.size);
+        return false;
+    }
+
+    hexedit_window = newwin(LINES, COLS, 0, 0);
+
+    if (!hexedit_window)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "Couldn't create the hex editor window\n");
+        return false;
+    }
+
+    keypad(hexedit_window, true);
+    nodelay(hexedit_window, true);
+
+    // Unmapped and mirrored areas are left alone if NV_DiscoverMMIOMap has been run on this card
+    NVGeneric_LoadMMIOMap(NV_MMIO_MAP_FILE);
+
+    // Title and status line
+    hexedit_state.rows = LINES - 2;
+
+    if (hexedit_state.rows > HEXEDIT_MAX_ROWS)
+        hexedit_state.rows = HEXEDIT_MAX_ROWS;
+
+    hexedit_state.status[0] = '\0';
+    hexedit_state.page_offset = offset & ~(HEXEDIT_BYTES_PER_ROW - 1);
+    hexedit_state.cursor = offset & ~3;
+    NVPlay_HexEditReadPage(false);
+
+    Console_RegisterTick("Hex editor", NVPlay_HexEditRefreshTick, NULL, HEXEDIT_REFRESH_MS);
+
+    bool running = true;
+
+    while (running)
+    {
+        uint32_t page_size = hexedit_state.rows * HEXEDIT_BYTES_PER_ROW;
+
+        NVPlay_HexEditDraw();
+
+        int32_t key = Console_WaitKey(hexedit_window);
+
+        // The last message stays up until a key is pressed
+        hexedit_state.status[0] = '\0';
+
+        switch (key)
+        {
+            case KEY_UP:
+                NVPlay_HexEditMoveTo((int64_t)hexedit_state.cursor - HEXEDIT_BYTES_PER_ROW);
+                break;
+            case KEY_DOWN:
+                NVPlay_HexEditMoveTo((int64_t)hexedit_state.cursor + HEXEDIT_BYTES_PER_ROW);
+                break;
+            case KEY_LEFT:
+                NVPlay_HexEditMoveTo((int64_t)hexedit_state.cursor - 4);
+                break;
+            case KEY_RIGHT:
+                NVPlay_HexEditMoveTo((int64_t)hexedit_state.cursor + 4);
+                break;
+            case KEY_PPAGE:
+                NVPlay_HexEditMoveTo((int64_t)hexedit_state.cursor - page_size);
+                break;
+            case KEY_NPAGE:
+                NVPlay_HexEditMoveTo((int64_t)hexedit_state.cursor + page_size);
+                break;
+            case KEY_HOME:
+                NVPlay_HexEditMoveTo(0);
+                break;
+            case KEY_END:
+                NVPlay_HexEditMoveTo(hexedit_state.size - 4);
+                break;
+            case 'g':
+            case 'G':
+                if (NVPlay_HexEditPrompt("Go to (hex or register name): ", input, HEXEDIT_MAX_INPUT)
+                && NVPlay_HexEditParseValue(input, &value))
+                {
+                    if (value >= hexedit_state.size)
+                        snprintf(hexedit_state.status, MAX_STR, "%08lX is past the end of %s", value, nv_space_names[hexedit_state.space]);
+                    else
+                        NVPlay_HexEditMoveTo(value);
+                }
+                break;
+            case 'e':
+            case 'E':
+            case '\n':
+            case '\r':
+                if (NVPlay_HexEditIsExcluded(hexedit_state.cursor))
+                    snprintf(hexedit_state.status, MAX_STR, "%08lX is in an area that isn't safe to touch", hexedit_state.cursor);
+                else if (NVPlay_HexEditPrompt("New value: ", input, HEXEDIT_MAX_INPUT)
+                && NVPlay_HexEditParseValue(input, &value))
+                {
+                    NV_WriteSpaceBlock32(hexedit_state.space, hexedit_state.cursor, &value, 1);
+
+                    // Read it back, the register may not keep what was written
+                    NVPlay_HexEditReadPage(true);
+                    snprintf(hexedit_state.status, MAX_STR, "Wrote %08lX", value);
+                }
+                break;
+            case '/':
+                if (NVPlay_HexEditPrompt("Find dword (hex or register name): ", input, HEXEDIT_MAX_INPUT)
+                && NVPlay_HexEditParseValue(input, &value))
+                {
+                    hexedit_state.search_value = value;
+                    hexedit_state.has_search = true;
+                    NVPlay_HexEditFindNext();
+                }
+                break;
+            case 'n':
+            case 'N':
+                NVPlay_HexEditFindNext();
+                break;
+            case 'r':
+            case 'R':
+                NVPlay_HexEditReadPage(true);
+                break;
+            case '\t':
+                for (uint32_t next = 1; next < NV_NUM_SPACES; next++)
+                {
+                    if (NVPlay_HexEditSetSpace((hexedit_state.space + next) % NV_NUM_SPACES))
+                        break;
+                }
+
+                hexedit_state.page_offset = 0;
+                hexedit_state.cursor = 0;
+                NVPlay_HexEditReadPage(false);
+                break;
+            case 'q':
+            case 'Q':
+            case HEXEDIT_KEY_ESCAPE:
+                running = false;
+                break;
+        }
+    }
+
+    Console_UnregisterTick(NVPlay_HexEditRefreshTick, NULL);
+    delwin(hexedit_window);
+    hexedit_window = NULL;
+
+    // Put the REPL back
+    touchwin(stdscr);
+    wrefresh(stdscr);
+    return true;
+}
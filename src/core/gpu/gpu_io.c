@@ -17,6 +17,8 @@
 #include "core/gpu/gpu.h"
 #include "pc.h"
 #include "sys/farptr.h"
+#include <sys/movedata.h>
+#include <sys/segments.h>
 #include "util/util.h"
 #include <stdint.h>
 #include <time.h>
@@ -28,23 +30,81 @@
 /* Read 8-bit value from the MMIO */
 uint8_t NV_ReadMMIO8(uint32_t offset)
 {
-    return _farpeekb(current_device.bus_info.bar0_selector, offset);
+    if (shadow_state.enabled)
+        return NV_ShadowRead(NV_SHADOW_SPACE_BAR0, offset, 1);
+
+    uint64_t profile_start = Profile_IOStart();
+    uint8_t value = _farpeekb(current_device.bus_info.bar0_selector, offset);
+
+    Profile_IOEnd(profile_start);
+    return value;
 }
 
 /* Read 32-bit value from the MMIO */
 uint32_t NV_ReadMMIO32(uint32_t offset)
 {
-    return _farpeekl(current_device.bus_info.bar0_selector, offset);
+    if (shadow_state.enabled)
+        return NV_ShadowRead(NV_SHADOW_SPACE_BAR0, offset, 4);
+
+    uint64_t profile_start = Profile_IOStart();
+    uint32_t value = _farpeekl(current_device.bus_info.bar0_selector, offset);
+
+    Profile_IOEnd(profile_start);
+    return value;
 }
 
 void NV_WriteMMIO8(uint32_t offset, uint8_t val)
 {
+    if (shadow_state.enabled)
+    {
+        NV_ShadowWrite(NV_SHADOW_SPACE_BAR0, offset, val, 1);
+        return;
+    }
+
+    uint64_t profile_start = Profile_IOStart();
     _farpokeb(current_device.bus_info.bar0_selector, offset, val);
+    Profile_IOEnd(profile_start);
 }
 
 void NV_WriteMMIO32(uint32_t offset, uint32_t val)
 {
+    if (shadow_state.enabled)
+    {
+        NV_ShadowWrite(NV_SHADOW_SPACE_BAR0, offset, val, 4);
+        return;
+    }
+
+    uint64_t profile_start = Profile_IOStart();
     _farpokel(current_device.bus_info.bar0_selector, offset, val);
+    Profile_IOEnd(profile_start);
+}
+
+/* Read count dwords starting at offset in the BAR behind selector with one copy (rep movsl), e.g. several registers next to each other */
+void NV_ReadBlock32(uint16_t selector, uint32_t offset, uint32_t* buffer, uint32_t count)
+{
+    if (shadow_state.enabled)
+    {
+        NV_ShadowCopy(selector, offset, buffer, count << 2, false);
+        return;
+    }
+
+    uint64_t profile_start = Profile_IOStart();
+    movedata(selector, offset, _my_ds(), (unsigned)buffer, count << 2);
+    Profile_IOEnd(profile_start);
+}
+
+/* Write count dwords starting at offset in the BAR behind selector with one copy */
+void NV_WriteBlock32(uint16_t selector, uint32_t offset, const uint32_t* buffer, uint32_t count)
+{
+    if (shadow_state.enabled)
+    {
+        NV_ShadowCopy(selector, offset, (void*)buffer, count << 2, true);
+        return;
+    }
+
+    uint64_t profile_start = Profile_IOStart();
+    movedata(_my_ds(), (unsigned)buffer, selector, offset, count << 2);
+    Profile_IOEnd(profile_start);
 }
 
 //
@@ -54,73 +114,136 @@ void NV_WriteMMIO32(uint32_t offset, uint32_t val)
 /* Read 8-bit value from the DFB */
 uint8_t NV_ReadDfb8(uint32_t offset)
 {
-    return _farpeekb(current_device.bus_info.bar1_selector, offset);
+    if (shadow_state.enabled)
+        return NV_ShadowRead(NV_SHADOW_SPACE_BAR1, offset, 1);
+
+    uint64_t profile_start = Profile_IOStart();
+    uint8_t value = _farpeekb(current_device.bus_info.bar1_selector, offset);
+
+    Profile_IOEnd(profile_start);
+    return value;
 }
 
 /* Read 16-bit value from the DFB */
 uint16_t NV_ReadDfb16(uint32_t offset)
 {
-    return _farpeekw(current_device.bus_info.bar1_selector, offset);
+    if (shadow_state.enabled)
+        return NV_ShadowRead(NV_SHADOW_SPACE_BAR1, offset, 2);
+
+    uint64_t profile_start = Profile_IOStart();
+    uint16_t value = _farpeekw(current_device.bus_info.bar1_selector, offset);
+
+    Profile_IOEnd(profile_start);
+    return value;
 }
 
 /* Read 32-bit value from the DFB */
 uint32_t NV_ReadDfb32(uint32_t offset)
 {
-    return _farpeekl(current_device.bus_info.bar1_selector, offset);
+    if (shadow_state.enabled)
+        return NV_ShadowRead(NV_SHADOW_SPACE_BAR1, offset, 4);
+
+    uint64_t profile_start = Profile_IOStart();
+    uint32_t value = _farpeekl(current_device.bus_info.bar1_selector, offset);
+
+    Profile_IOEnd(profile_start);
+    return value;
 }
 
 /* Write 8-bit value to the DFB */
 void NV_WriteDfb8(uint32_t offset, uint8_t val)
 {
+    if (shadow_state.enabled)
+    {
+        NV_ShadowWrite(NV_SHADOW_SPACE_BAR1, offset, val, 1);
+        return;
+    }
+
+    uint64_t profile_start = Profile_IOStart();
     _farpokeb(current_device.bus_info.bar1_selector, offset, val);
+    Profile_IOEnd(profile_start);
 }
 
 /* Write 16-bit value to the DFB */
 void NV_WriteDfb16(uint32_t offset, uint16_t val)
 {
+    if (shadow_state.enabled)
+    {
+        NV_ShadowWrite(NV_SHADOW_SPACE_BAR1, offset, val, 2);
+        return;
+    }
+
+    uint64_t profile_start = Profile_IOStart();
     _farpokew(current_device.bus_info.bar1_selector, offset, val);
+    Profile_IOEnd(profile_start);
 }
 
 void NV_WriteDfb32(uint32_t offset, uint32_t val)
 {
+    if (shadow_state.enabled)
+    {
+        NV_ShadowWrite(NV_SHADOW_SPACE_BAR1, offset, val, 4);
+        return;
+    }
+
+    uint64_t profile_start = Profile_IOStart();
     _farpokel(current_device.bus_info.bar1_selector, offset, val);
+    Profile_IOEnd(profile_start);
 }
 
 /* Read 32-bit value from RAMIN */
 uint32_t NV_ReadRamin32(uint32_t offset)
 {
+    if (shadow_state.enabled)
+        return NV_ShadowReadRamin32(offset);
+
     // I considered having this be a GPU-specific function, but RAMIN mapping did not change much after NV4 until NV40
     // and direct RAMIN writes are fairly rare.
     //
     // If it turns out to be too slow we can change it
+    uint64_t profile_start = Profile_IOStart();
+    uint32_t value = 0x00;
 
     switch (current_device.real_device_id) // temp
     {
         // RAMIN not usable on NV1 with CONFIG=2 due to hardware errata, see envytools
         case PCI_DEVICE_NV1_NV:
-            return _farpeekl(current_device.bus_info.bar0_selector, NV1_RAMIN_START + offset);
+            value = _farpeekl(current_device.bus_info.bar0_selector, NV1_RAMIN_START + offset);
+            break;
         case PCI_DEVICE_NV3:
         case PCI_DEVICE_NV3T_ACPI:
-            return _farpeekl(current_device.bus_info.bar1_selector, NV3_RAMIN_START + offset);
+            value = _farpeekl(current_device.bus_info.bar1_selector, NV3_RAMIN_START + offset);
+            break;
         // WARNING! WARNING! WARNING!
         // 
         // NV4 MMIO dumps show *PROM* (VBIOS mirror) at 0x700000 unlike 0x300000 as indicated by NV drivers. 
         // RAMIN RAMFC RAMHT RAMRO structures always start at 0x10000 so NVIDIA never had to deal with this issue (for all practical purposes RAMIN starts at 710000)
         // Therefore, it may not be possible, due to hardware errata, to write to RAMIN address below 0x10000!
         case PCI_DEVICE_NV4 ... PCI_DEVICE_NV1F: // all NV1xsa re the same
-            return _farpeekl(current_device.bus_info.bar0_selector, NV4_PRAMIN_START + offset);
+            value = _farpeekl(current_device.bus_info.bar0_selector, NV4_PRAMIN_START + offset);
+            break;
+        default:
+            Logging_Write(LOG_LEVEL_ERROR, "NV_ReadRamin32: Somehow reached here with an unsupported gpu\n");
+            break;
     }
 
-    Logging_Write(LOG_LEVEL_ERROR, "NV_ReadRamin32: Somehow reached here with an unsupported gpu\n");
-    return 0x00;
+    Profile_IOEnd(profile_start);
+    return value;
 }
 
 void NV_WriteRamin32(uint32_t offset, uint32_t val)
 {
+    if (shadow_state.enabled)
+    {
+        NV_ShadowWriteRamin32(offset, val);
+        return;
+    }
+
     // I considered having this be a GPU-specific function, but RAMIN mapping did not change much after NV4 until NV40
     // and direct RAMIN writes are fairly rare.
     //
     // If it turns out to be too slow we can change it
+    uint64_t profile_start = Profile_IOStart();
 
     switch (current_device.real_device_id)
     {
@@ -142,6 +265,101 @@ void NV_WriteRamin32(uint32_t offset, uint32_t val)
             break;
     }
 
+    Profile_IOEnd(profile_start);
+}
+
+//
+// Spaces (whole apertures addressed by offset, for the hex editor and the remote protocol)
+//
+
+const char* nv_space_names[NV_NUM_SPACES] =
+{
+    "mmio",
+    "vram",
+    "ramin",
+    "pci",
+};
+
+bool NV_ParseSpace(const char* name, nv_space_t* space)
+{
+    for (uint32_t i = 0; i < NV_NUM_SPACES; i++)
+    {
+        if (!strcasecmp(name, nv_space_names[i]))
+        {
+            *space = (nv_space_t)i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* Where a space is and how big it is. PCI configuration space has no selector; it is accessed with config cycles */
+bool NV_GetSpaceMapping(nv_space_t space, uint16_t* selector, uint32_t* base, uint32_t* size)
+{
+    *selector = current_device.bus_info.bar0_selector;
+    *base = 0;
+
+    switch (space)
+    {
+        case NV_SPACE_MMIO:
+            *size = GPU_IsNV1() ? NV1_PCI_BAR0_SIZE : NV4_MMIO_SIZE;
+            break;
+        case NV_SPACE_VRAM:
+            *selector = current_device.bus_info.bar1_selector;
+            *size = current_device.vram_amount;
+            break;
+        case NV_SPACE_RAMIN:
+            if (!NV_GetRaminMapping(selector, base, size))
+                return false;
+            break;
+        case NV_SPACE_PCI:
+            *selector = 0;
+            *size = 0x100;
+            break;
+        default:
+            return false;
+    }
+
+    // Whole dwords only
+    *size &= ~3;
+    return (*size != 0);
+}
+
+/* Read count dwords at offset in space. The caller checks the bounds */
+void NV_ReadSpaceBlock32(nv_space_t space, uint32_t offset, uint32_t* buffer, uint32_t count)
+{
+    uint16_t selector = 0;
+    uint32_t base = 0, size = 0;
+
+    if (space == NV_SPACE_PCI)
+    {
+        // No block reads through config cycles
+        for (uint32_t i = 0; i < count; i++)
+            buffer[i] = PCI_ReadConfig32(current_device.bus_info.bus_number, current_device.bus_info.function_number, offset + (i << 2));
+
+        return;
+    }
+
+    if (NV_GetSpaceMapping(space, &selector, &base, &size))
+        NV_ReadBlock32(selector, base + offset, buffer, count);
+}
+
+void NV_WriteSpaceBlock32(nv_space_t space, uint32_t offset, const uint32_t* buffer, uint32_t count)
+{
+    uint16_t selector = 0;
+    uint32_t base = 0, size = 0;
+
+    if (space == NV_SPACE_PCI)
+    {
+        for (uint32_t i = 0; i < count; i++)
+            PCI_WriteConfig32(current_device.bus_info.bus_number, current_device.bus_info.function_number, offset + (i << 2), buffer[i]);
+
+        return;
+    }
+
+    if (NV_GetSpaceMapping(space, &selector, &base, &size))
+        NV_WriteBlock32(selector, base + offset, buffer, count);
 }
 
 /* Accelerated nVIDIA VGA functions */
@@ -173,32 +391,57 @@ void NV_CRTCUnlockExtendedRegisters()
 
 uint8_t VGA_ReadCRTC(uint8_t index)
 {
+    if (shadow_state.enabled)
+        return NV_ShadowReadVGA(NV_SHADOW_VGA_CRTC, index);
+
+    uint64_t profile_start = Profile_IOStart();
     uint8_t miscout = inportb(VGA_PORT_MISCOUT);
+    uint8_t value = 0;
 
     if (!(miscout & 1))
-        return inportb(VGA_PORT_MONO_CRTC_INDEX);
+        value = inportb(VGA_PORT_MONO_CRTC_INDEX);
     else
-        return inportb(VGA_PORT_COLOR_CRTC_INDEX);
+        value = inportb(VGA_PORT_COLOR_CRTC_INDEX);
+
+    Profile_IOEnd(profile_start);
+    return value;
 }
 
 uint8_t VGA_ReadGDC(uint8_t index)
 {
+    if (shadow_state.enabled)
+        return NV_ShadowReadVGA(NV_SHADOW_VGA_GRAPHICS, index);
+
+    uint64_t profile_start = Profile_IOStart();
     outportb(VGA_PORT_GRAPHICS_INDEX, index);
 
-    return inportb(VGA_PORT_GRAPHICS);
+    uint8_t value = inportb(VGA_PORT_GRAPHICS);
+    Profile_IOEnd(profile_start);
+    return value;
 }
 
 // Read a byte from the VGA sequencer register with index index.
 uint8_t VGA_ReadSequencer(uint8_t index)
 {
+    if (shadow_state.enabled)
+        return NV_ShadowReadVGA(NV_SHADOW_VGA_SEQUENCER, index);
+
+    uint64_t profile_start = Profile_IOStart();
     outportb(VGA_PORT_SEQUENCER_INDEX, index);
 
-    return inportb(VGA_PORT_SEQUENCER);
+    uint8_t value = inportb(VGA_PORT_SEQUENCER);
+    Profile_IOEnd(profile_start);
+    return value;
 }
 
 // Read a VGA attribute register.
 uint8_t VGA_ReadAttribute(uint8_t index)
 {
+    if (shadow_state.enabled)
+        return NV_ShadowReadVGA(NV_SHADOW_VGA_ATTRIBUTE, index);
+
+    uint64_t profile_start = Profile_IOStart();
+
     // figure out if this is colour or mono
     uint8_t miscout = inportb(VGA_PORT_MISCOUT);
 
@@ -211,26 +454,50 @@ uint8_t VGA_ReadAttribute(uint8_t index)
 
     // write to 3c0. writing to the data is 3c1, but reading is 3c0. what.
     outportb(VGA_PORT_ATTRIBUTE_REGISTER, index);
-    return inportb(VGA_PORT_ATTRIBUTE_DATA_WRITE);
+
+    uint8_t value = inportb(VGA_PORT_ATTRIBUTE_DATA_WRITE);
+    Profile_IOEnd(profile_start);
+    return value;
 }
 
 // Read a VGA graphics register.
 uint8_t VGA_ReadGraphics(uint8_t index)
 {
+    if (shadow_state.enabled)
+        return NV_ShadowReadVGA(NV_SHADOW_VGA_GRAPHICS, index);
+
+    uint64_t profile_start = Profile_IOStart();
     outportb(VGA_PORT_GRAPHICS_INDEX, index);
 
-    return inportb(VGA_PORT_GRAPHICS);
+    uint8_t value = inportb(VGA_PORT_GRAPHICS);
+    Profile_IOEnd(profile_start);
+    return value;
 }
 
 // Write a VGA graphics register.
 void VGA_WriteGraphics(uint8_t index, uint8_t value)
 {
+    if (shadow_state.enabled)
+    {
+        NV_ShadowWriteVGA(NV_SHADOW_VGA_GRAPHICS, index, value);
+        return;
+    }
+
+    uint64_t profile_start = Profile_IOStart();
     outportb(VGA_PORT_COLOR_CRTC_INDEX, index);
     outportb(VGA_PORT_COLOR_CRTC, value);
+    Profile_IOEnd(profile_start);
 }
 
 void VGA_WriteCRTC(uint8_t index, uint8_t value)
 {
+    if (shadow_state.enabled)
+    {
+        NV_ShadowWriteVGA(NV_SHADOW_VGA_CRTC, index, value);
+        return;
+    }
+
+    uint64_t profile_start = Profile_IOStart();
     uint8_t miscout = inportb(VGA_PORT_MISCOUT);
 
     if (!(miscout & 1))
@@ -243,16 +510,34 @@ void VGA_WriteCRTC(uint8_t index, uint8_t value)
         outportb(VGA_PORT_COLOR_CRTC_INDEX, value);
         outportb(VGA_PORT_COLOR_CRTC, value);
     }
+
+    Profile_IOEnd(profile_start);
 }
 
 void VGA_WriteSequencer(uint8_t index, uint8_t value)
 {
+    if (shadow_state.enabled)
+    {
+        NV_ShadowWriteVGA(NV_SHADOW_VGA_SEQUENCER, index, value);
+        return;
+    }
+
+    uint64_t profile_start = Profile_IOStart();
     outportb(VGA_PORT_SEQUENCER_INDEX, index);
     outportb(VGA_PORT_SEQUENCER, value);
+    Profile_IOEnd(profile_start);
 }
 
 void VGA_WriteAttribute(uint8_t index, uint8_t value)
 {
+    if (shadow_state.enabled)
+    {
+        NV_ShadowWriteVGA(NV_SHADOW_VGA_ATTRIBUTE, index, value);
+        return;
+    }
+
+    uint64_t profile_start = Profile_IOStart();
+
     // figure out if this is colour or mono
     uint8_t miscout = inportb(VGA_PORT_MISCOUT);
 
@@ -267,6 +552,7 @@ void VGA_WriteAttribute(uint8_t index, uint8_t value)
     outportb(VGA_PORT_ATTRIBUTE_REGISTER, index);
     outportb(VGA_PORT_ATTRIBUTE_REGISTER, value);
 
+    Profile_IOEnd(profile_start);
 
     // figure out what is being written next
 }
@@ -13,6 +13,7 @@
 #include "core/console/console.h"
 #include "util/util.h"
 #include <nvplay.h>
+#include <unistd.h>
 
 // Commands
 #define COMMAND_EXIT            "q"
@@ -113,11 +114,13 @@ void NVPlay_Repl()
 
         Logging_Write(LOG_LEVEL_MESSAGE, "GPU>");
 
-        if (!nvplay_state.config.dumb_console)
+        if (console_backend == CONSOLE_BACKEND_CURSES)
         {
-            // TODO: Better input handling
             while (!input_recv)
             {
+                // Sleeps (and runs background ticks) until there is a key, so getch doesn't have to be polled
+                Console_WaitForInput();
+
                 int32_t last_char = -1;
                 input_recv = Input_GetStringAndChar(repl_string, MAX_STR, &last_char);
 
@@ -130,12 +133,25 @@ void NVPlay_Repl()
                     case KEY_DOWN:
                         NVPlay_ReplIncrementCommandHistory();
                         break; 
+                    case KEY_PPAGE:
+                        Console_ScrollbackView();
+                        break;
                 }
             }
         }
         else
+        {
+            // Still run background ticks until something is typed. Redirected input is always ready
+            if (isatty(fileno(stdin)))
+                Console_WaitForInput();
+
+            Console_Present();
             fgets(repl_string, MAX_STR, stdin);
 
+            // DOS echoed what was typed
+            Console_TextResync();
+        }
+
         // get rid of the newline (could call String_GetRTrim(String_GetLTrim) but that does a lot of unnecessary stuff we don't need yet)
         repl_string[strcspn(repl_string, "\r\n")] = '\0';
         
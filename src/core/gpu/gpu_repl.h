@@ -26,4 +26,40 @@ extern const char* not_really_funny_messages[];
 
 // It's a good idea to increase this or use C++
 #define FUNNY_MESSAGE_COUNT         21
-void NVPlay_Repl(); 
\ No newline at end of file
+void NVPlay_Repl(); 
+
+// Watch panel (gpu_watch.c)
+#define WATCH_MAX_ENTRIES           32
+#define WATCH_LABEL_LENGTH          18
+#define WATCH_PANEL_WIDTH           (WATCH_LABEL_LENGTH + 13)  // box, label, space, 8 digits, spaces
+#define WATCH_DEFAULT_INTERVAL_MS   250
+#define WATCH_MIN_INTERVAL_MS       55                          // One timer tick. The REPL can't wake up more often than this
+
+typedef enum watch_space_e
+{
+    WATCH_SPACE_MMIO = 0,
+    WATCH_SPACE_RAMIN = 1,
+    WATCH_SPACE_PCI = 2,
+    WATCH_SPACE_CRTC = 3,
+    WATCH_SPACE_SR = 4,
+    WATCH_SPACE_GR = 5,
+    WATCH_SPACE_AR = 6,
+
+    WATCH_NUM_SPACES,
+} watch_space_t;
+
+typedef struct watch_entry_s
+{
+    watch_space_t space;
+    uint32_t offset;
+    char label[WATCH_LABEL_LENGTH + 1];
+    uint32_t value;
+    uint32_t flipped;                   // Bits that changed in the last sample (highlighted)
+    bool sampled;                       // value is valid
+    bool dirty;                         // Needs to be drawn again
+} watch_entry_t;
+
+bool NVPlay_WatchParseSpace(const char* name, watch_space_t* space);
+bool NVPlay_WatchAdd(watch_space_t space, uint32_t offset, const char* name, uint32_t interval_ms);
+bool NVPlay_WatchRemove(watch_space_t space, uint32_t offset);
+void NVPlay_WatchClear();
@@ -0,0 +1,574 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    gpu_shadow.c: Dry run (-dryrun) register model
+
+    With -dryrun, the I/O functions in gpu_io.c and pci.c read and write this model instead of the GPU, so a script can be checked without a card
+    (or a reboot when it goes wrong). BAR0 and BAR1 are kept as 4KB pages that are only allocated when written; anything never written reads as 0,
+    except NV_PMC_BOOT_0, which reads as DryRun_Boot0 from nvplay.ini.
+
+    Accesses outside the BARs, writes to read-only registers and writes to registers that do something besides store a value (reset an engine,
+    reprogram a PLL, submit a method...) are counted and logged against the script line that did them. The write set and the final value of
+    every written register is logged on exit.
+*/
+
+#include <nvplay.h>
+#include <architecture/nvidia/nv1/nv1_ref.h>
+#include <architecture/nvidia/nv3/nv3_ref.h>
+#include <architecture/nvidia/nv4/nv4_ref.h>
+#include <architecture/nvidia/kernel/nv_generic.h>
+#include "core/gpu/gpu.h"
+#include "util/util.h"
+
+/* Set by the executor in script_compiler.c */
+extern gpu_script_op_t* current_op;
+
+nv_shadow_state_t shadow_state = {0};
+
+const char* shadow_space_names[NV_SHADOW_NUM_SPACES] = { "BAR0", "BAR1" };
+const char* shadow_vga_names[NV_SHADOW_NUM_VGA] = { "CRTC", "SR", "GR", "AR" };
+
+// First match wins, so single registers go before the areas they are in
+nv_shadow_register_t shadow_registers[] =
+{
+    { NV_SHADOW_GEN_ALL, NV_PMC_BOOT, NV_PMC_BOOT + 3, NV_SHADOW_REG_READ_ONLY, "PMC_BOOT_0", NULL },
+    { NV_SHADOW_GEN_NV3 | NV_SHADOW_GEN_NV4, NV4_PMC_INTR_0, NV4_PMC_INTR_0 + 3, NV_SHADOW_REG_SIDE_EFFECT, "PMC_INTR_0", "raises a software interrupt" },
+    { NV_SHADOW_GEN_NV3 | NV_SHADOW_GEN_NV4, NV4_PMC_ENABLE, NV4_PMC_ENABLE + 3, NV_SHADOW_REG_SIDE_EFFECT, "PMC_ENABLE", "resets engines" },
+    { NV_SHADOW_GEN_NV3 | NV_SHADOW_GEN_NV4, NV4_PBUS_INTR_0, NV4_PBUS_INTR_0 + 3, NV_SHADOW_REG_WRITE_1_CLEAR, "PBUS_INTR_0", NULL },
+    { NV_SHADOW_GEN_NV3 | NV_SHADOW_GEN_NV4, NV4_PFIFO_INTR_0, NV4_PFIFO_INTR_0 + 3, NV_SHADOW_REG_WRITE_1_CLEAR, "PFIFO_INTR_0", NULL },
+    { NV_SHADOW_GEN_NV3 | NV_SHADOW_GEN_NV4, NV4_PTIMER_INTR, NV4_PTIMER_INTR + 3, NV_SHADOW_REG_WRITE_1_CLEAR, "PTIMER_INTR_0", NULL },
+    { NV_SHADOW_GEN_NV3 | NV_SHADOW_GEN_NV4, NV4_PTIMER_TIME_0, NV4_PTIMER_TIME_0 + 3, NV_SHADOW_REG_SIDE_EFFECT, "PTIMER_TIME_0", "sets the GPU timer" },
+    { NV_SHADOW_GEN_NV3 | NV_SHADOW_GEN_NV4, NV4_PTIMER_TIME_1, NV4_PTIMER_TIME_1 + 3, NV_SHADOW_REG_SIDE_EFFECT, "PTIMER_TIME_1", "sets the GPU timer" },
+    { NV_SHADOW_GEN_NV3 | NV_SHADOW_GEN_NV4, NV4_PFB_BOOT_0, NV4_PFB_BOOT_0 + 3, NV_SHADOW_REG_SIDE_EFFECT, "PFB_BOOT_0", "changes the memory configuration" },
+    { NV_SHADOW_GEN_NV3 | NV_SHADOW_GEN_NV4, NV4_PSTRAPS_BOOT_0, NV4_PSTRAPS_BOOT_0 + 3, NV_SHADOW_REG_SIDE_EFFECT, "PSTRAPS", "overrides the board straps" },
+    { NV_SHADOW_GEN_NV3, NV3_PROM_START, NV3_PROM_END, NV_SHADOW_REG_READ_ONLY, "PROM", NULL },
+    { NV_SHADOW_GEN_NV4, NV4_PROM_START, NV4_PROM_END, NV_SHADOW_REG_READ_ONLY, "PROM", NULL },
+    { NV_SHADOW_GEN_NV3 | NV_SHADOW_GEN_NV4, NV4_PGRAPH_INTR, NV4_PGRAPH_INTR + 3, NV_SHADOW_REG_WRITE_1_CLEAR, "PGRAPH_INTR_0", NULL },
+    { NV_SHADOW_GEN_NV3, NV3_PGRAPH_INTR_1, NV3_PGRAPH_INTR_1 + 3, NV_SHADOW_REG_WRITE_1_CLEAR, "PGRAPH_INTR_1", NULL },
+    { NV_SHADOW_GEN_NV3 | NV_SHADOW_GEN_NV4, NV4_PCRTC_INTR_0, NV4_PCRTC_INTR_0 + 3, NV_SHADOW_REG_WRITE_1_CLEAR, "PCRTC_INTR_0", NULL },
+    { NV_SHADOW_GEN_NV3 | NV_SHADOW_GEN_NV4, NV4_PRAMDAC_NVPLL_COEFF, NV4_PRAMDAC_PLL_COEFF_SELECT + 3, NV_SHADOW_REG_SIDE_EFFECT, "PRAMDAC_PLL", "reprograms a PLL" },
+    { NV_SHADOW_GEN_ALL, NV4_USER_START, NV4_USER_END, NV_SHADOW_REG_SIDE_EFFECT, "USER", "submits a method to PFIFO" },
+
+    // Just names for the report
+    { NV_SHADOW_GEN_NV3 | NV_SHADOW_GEN_NV4, NV4_PMC_START, NV4_PMC_END, 0, "PMC", NULL },
+    { NV_SHADOW_GEN_NV3 | NV_SHADOW_GEN_NV4, NV4_PBUS_START, NV4_PBUS_END, 0, "PBUS", NULL },
+    { NV_SHADOW_GEN_NV3 | NV_SHADOW_GEN_NV4, NV4_PFIFO_START, NV4_PFIFO_END, 0, "PFIFO", NULL },
+    { NV_SHADOW_GEN_NV3 | NV_SHADOW_GEN_NV4, NV4_PTIMER_START, NV4_PTIMER_END, 0, "PTIMER", NULL },
+    { NV_SHADOW_GEN_NV3 | NV_SHADOW_GEN_NV4, NV4_PFB_START, NV4_PFB_END, 0, "PFB", NULL },
+    { NV_SHADOW_GEN_NV3 | NV_SHADOW_GEN_NV4, NV3_PEXTDEV_START, NV3_PEXTDEV_END, 0, "PEXTDEV", NULL },
+    { NV_SHADOW_GEN_NV3 | NV_SHADOW_GEN_NV4, NV4_PGRAPH_START, NV4_PGRAPH_END, 0, "PGRAPH", NULL },
+    { NV_SHADOW_GEN_NV3 | NV_SHADOW_GEN_NV4, NV4_PCRTC_INTR_0, NV4_PRMCIO_END, 0, "PCRTC", NULL },
+    { NV_SHADOW_GEN_NV3 | NV_SHADOW_GEN_NV4, NV4_PDAC_START, NV4_PRMDIO_END, 0, "PRAMDAC", NULL },
+    { NV_SHADOW_GEN_NV4, NV4_PRAMIN_START, NV4_PRAMIN_END, 0, "PRAMIN", NULL },
+    { 0, 0, 0, 0, NULL, NULL },
+};
+
+nv_shadow_register_t* NV_ShadowFindRegister(uint32_t offset)
+{
+    for (nv_shadow_register_t* reg = shadow_registers; reg->name; reg++)
+    {
+        if ((reg->generations & shadow_state.generation)
+        && offset >= reg->start
+        && offset <= reg->end)
+            return reg;
+    }
+
+    return NULL;
+}
+
+void NV_ShadowWarn(const char* fmt, ...)
+{
+    char message[MAX_STR] = {0};
+    va_list args;
+
+    if (shadow_state.warnings++ >= NV_SHADOW_MAX_WARNINGS)
+        return;
+
+    va_start(args, fmt);
+    vsnprintf(message, sizeof(message), fmt, args);
+    va_end(args);
+
+    if (current_op)
+        Logging_Write(LOG_LEVEL_WARNING, "Dry run: line %lu: %s\n", current_op->line_number, message);
+    else
+        Logging_Write(LOG_LEVEL_WARNING, "Dry run: %s\n", message);
+
+    if (shadow_state.warnings == NV_SHADOW_MAX_WARNINGS)
+        Logging_Write(LOG_LEVEL_WARNING, "Dry run: Too many warnings, the rest are only counted\n");
+}
+
+nv_shadow_page_t* NV_ShadowGetPage(nv_shadow_space_t space, uint32_t offset, bool create)
+{
+    nv_shadow_page_t** page = &shadow_state.pages[space][offset / NV_SHADOW_PAGE_SIZE];
+
+    if (!*page
+    && create)
+        *page = calloc(1, sizeof(nv_shadow_page_t));
+
+    return *page;
+}
+
+/* Pretend to be the GPU in DryRun_Boot0, without touching any hardware */
+bool NV_ShadowInit()
+{
+    current_device.nv_pmc_boot_0 = nvplay_state.config.dry_run_boot_0 ? nvplay_state.config.dry_run_boot_0 : NV_SHADOW_DEFAULT_BOOT_0;
+    current_device.vram_amount = nvplay_state.config.dry_run_vram ? nvplay_state.config.dry_run_vram : NV_SHADOW_DEFAULT_VRAM;
+    current_device.bus_info.bar0_selector = NV_SHADOW_SELECTOR_BAR0;
+    current_device.bus_info.bar1_selector = NV_SHADOW_SELECTOR_BAR1;
+    current_device.device_info.name = "Dry run";
+
+    // The I/O functions pick the RAMIN mapping by device ID
+    if (GPU_IsNV1())
+    {
+        shadow_state.generation = NV_SHADOW_GEN_NV1;
+        current_device.real_device_id = PCI_DEVICE_NV1_NV;
+        current_device.device_info.vendor_id = PCI_VENDOR_NV;
+    }
+    else if (GPU_IsNV3())
+    {
+        shadow_state.generation = NV_SHADOW_GEN_NV3;
+        current_device.real_device_id = PCI_DEVICE_NV3;
+        current_device.device_info.vendor_id = PCI_VENDOR_SGS_NV;
+    }
+    else if (GPU_IsNV4orBetter())
+    {
+        shadow_state.generation = NV_SHADOW_GEN_NV4;
+        current_device.real_device_id = GPU_IsNV10() ? PCI_DEVICE_NV10 : PCI_DEVICE_NV4;
+        current_device.device_info.vendor_id = PCI_VENDOR_NV;
+    }
+    else
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "Dry run: DryRun_Boot0=%08lX isn't a GPU NVPlay supports\n", current_device.nv_pmc_boot_0);
+        return false;
+    }
+
+    current_device.device_info.device_id_start = current_device.device_info.device_id_end = current_device.real_device_id;
+
+    // NV3 has VRAM and RAMIN in one 16MB BAR1, everything else just VRAM
+    shadow_state.size[NV_SHADOW_SPACE_BAR0] = GPU_IsNV1() ? NV1_PCI_BAR0_SIZE + 1 : NV_MMIO_SIZE;
+    shadow_state.size[NV_SHADOW_SPACE_BAR1] = GPU_IsNV3() ? NV_MMIO_SIZE : current_device.vram_amount;
+
+    for (uint32_t space = 0; space < NV_SHADOW_NUM_SPACES; space++)
+    {
+        shadow_state.pages[space] = calloc(shadow_state.size[space] / NV_SHADOW_PAGE_SIZE, sizeof(nv_shadow_page_t*));
+
+        if (!shadow_state.pages[space])
+        {
+            Logging_Write(LOG_LEVEL_ERROR, "Dry run: Out of memory\n");
+            return false;
+        }
+    }
+
+    shadow_state.pci[0] = current_device.device_info.vendor_id & 0xFF;
+    shadow_state.pci[1] = current_device.device_info.vendor_id >> 8;
+    shadow_state.pci[2] = current_device.real_device_id & 0xFF;
+    shadow_state.pci[3] = current_device.real_device_id >> 8;
+
+    // Straight into the page, it's read-only and shouldn't show up as written
+    nv_shadow_page_t* boot_page = NV_ShadowGetPage(NV_SHADOW_SPACE_BAR0, NV_PMC_BOOT, true);
+
+    if (!boot_page)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "Dry run: Out of memory\n");
+        return false;
+    }
+
+    memcpy(&boot_page->data[NV_PMC_BOOT % NV_SHADOW_PAGE_SIZE], &current_device.nv_pmc_boot_0, sizeof(uint32_t));
+    shadow_state.enabled = true;
+
+    Logging_Write(LOG_LEVEL_MESSAGE, "Dry run: Pretending to be a GPU with NV_PMC_BOOT_0=%08lX and %lu MB of VRAM. Nothing will touch the hardware\n",
+        current_device.nv_pmc_boot_0, current_device.vram_amount >> 20);
+
+    return true;
+}
+
+/*
+    Code that reads the BARs with _farpeekl or calls into the HAL (the dump tests, fingerprint, the MMIO map, the kernel) can't be modelled: the
+    BAR selectors are fake and there is no HAL. Returns true, and says so, if what has to be refused because this is a dry run
+*/
+bool NV_ShadowRefuse(const char* what)
+{
+    if (!shadow_state.enabled)
+        return false;
+
+    Logging_Write(LOG_LEVEL_ERROR, "Dry run: %s needs the real GPU, skipping it\n", what);
+    return true;
+}
+
+bool NV_ShadowCheckBounds(nv_shadow_space_t space, uint32_t offset, uint32_t size, const char* access)
+{
+    uint32_t limit = shadow_state.size[space];
+
+    // NV3 BAR1 has a hole between the end of VRAM and RAMIN
+    bool in_nv3_hole = (space == NV_SHADOW_SPACE_BAR1
+    && shadow_state.generation == NV_SHADOW_GEN_NV3
+    && offset + size > current_device.vram_amount
+    && offset < NV3_RAMIN_START);
+
+    if ((uint64_t)offset + size <= limit
+    && !in_nv3_hole)
+        return true;
+
+    shadow_state.out_of_bounds++;
+
+    if (in_nv3_hole)
+        NV_ShadowWarn("%lu-byte %s of %s %08lX is past the end of VRAM (%08lX)", size, access, shadow_space_names[space], offset, current_device.vram_amount);
+    else
+        NV_ShadowWarn("%lu-byte %s of %s %08lX is out of bounds (size %08lX)", size, access, shadow_space_names[space], offset, limit);
+
+    return false;
+}
+
+uint32_t NV_ShadowRead(nv_shadow_space_t space, uint32_t offset, uint32_t size)
+{
+    shadow_state.reads++;
+
+    // Real hardware would fault. Return what an empty bus does
+    if (!NV_ShadowCheckBounds(space, offset, size, "read"))
+        return 0xFFFFFFFF >> (32 - size * 8);
+
+    uint32_t value = 0;
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        nv_shadow_page_t* page = NV_ShadowGetPage(space, offset + i, false);
+        uint32_t page_offset = (offset + i) % NV_SHADOW_PAGE_SIZE;
+
+        if (!page)
+            continue;
+
+        value |= (uint32_t)page->data[page_offset] << (i * 8);
+        page->flags[page_offset >> 2] |= NV_SHADOW_DWORD_READ;
+    }
+
+    return value;
+}
+
+void NV_ShadowWrite(nv_shadow_space_t space, uint32_t offset, uint32_t value, uint32_t size)
+{
+    shadow_state.writes++;
+
+    if (!NV_ShadowCheckBounds(space, offset, size, "write"))
+        return;
+
+    nv_shadow_page_t* page = NV_ShadowGetPage(space, offset, true);
+    uint32_t page_offset = offset % NV_SHADOW_PAGE_SIZE;
+
+    if (!page)
+    {
+        NV_ShadowWarn("Out of memory, write to %s %08lX dropped", shadow_space_names[space], offset);
+        return;
+    }
+
+    nv_shadow_register_t* reg = (space == NV_SHADOW_SPACE_BAR0) ? NV_ShadowFindRegister(offset) : NULL;
+    uint8_t* flags = &page->flags[page_offset >> 2];
+
+    if (reg
+    && (reg->flags & NV_SHADOW_REG_READ_ONLY))
+    {
+        shadow_state.read_only_writes++;
+
+        if (!(*flags & NV_SHADOW_DWORD_WARNED))
+            NV_ShadowWarn("Write of %08lX to read-only register %s (%08lX) is ignored", value, reg->name, offset);
+
+        *flags |= NV_SHADOW_DWORD_WARNED;
+        return;
+    }
+
+    if (reg
+    && (reg->flags & (NV_SHADOW_REG_SIDE_EFFECT | NV_SHADOW_REG_WRITE_1_CLEAR)))
+    {
+        shadow_state.side_effect_writes++;
+
+        // Acknowledging interrupts is normal, so those aren't worth a warning
+        if (!(*flags & NV_SHADOW_DWORD_WARNED)
+        && (reg->flags & NV_SHADOW_REG_SIDE_EFFECT))
+            NV_ShadowWarn("Write of %08lX to %s (%08lX) %s on real hardware", value, reg->name, offset, reg->effect);
+
+        *flags |= NV_SHADOW_DWORD_WARNED;
+    }
+
+    // Registers never cross a page, but VRAM writes can
+    if (page_offset + size > NV_SHADOW_PAGE_SIZE)
+    {
+        for (uint32_t i = 0; i < size; i++)
+            NV_ShadowWrite(space, offset + i, (value >> (i * 8)) & 0xFF, 1);
+
+        shadow_state.writes -= size;
+        return;
+    }
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        uint8_t byte = (value >> (i * 8)) & 0xFF;
+
+        if (reg
+        && (reg->flags & NV_SHADOW_REG_WRITE_1_CLEAR))
+            page->data[page_offset + i] &= ~byte;
+        else
+            page->data[page_offset + i] = byte;
+    }
+
+    *flags |= NV_SHADOW_DWORD_WRITTEN;
+
+    if (page->writes[page_offset >> 2] < 0xFFFF)
+        page->writes[page_offset >> 2]++;
+}
+
+nv_shadow_space_t NV_ShadowSpaceFromSelector(int32_t selector)
+{
+    return (selector == NV_SHADOW_SELECTOR_BAR1) ? NV_SHADOW_SPACE_BAR1 : NV_SHADOW_SPACE_BAR0;
+}
+
+uint32_t NV_ShadowReadRamin32(uint32_t offset)
+{
+    uint16_t selector = 0;
+    uint32_t base = 0, size = 0;
+
+    if (!NV_GetRaminMapping(&selector, &base, &size))
+        return 0;
+
+    if (offset + sizeof(uint32_t) > size)
+    {
+        shadow_state.reads++;
+        shadow_state.out_of_bounds++;
+        NV_ShadowWarn("Read of RAMIN %08lX is out of bounds (size %08lX)", offset, size);
+        return 0xFFFFFFFF;
+    }
+
+    return NV_ShadowRead(NV_ShadowSpaceFromSelector(selector), base + offset, sizeof(uint32_t));
+}
+
+void NV_ShadowWriteRamin32(uint32_t offset, uint32_t value)
+{
+    uint16_t selector = 0;
+    uint32_t base = 0, size = 0;
+
+    if (!NV_GetRaminMapping(&selector, &base, &size))
+        return;
+
+    if (offset + sizeof(uint32_t) > size)
+    {
+        shadow_state.writes++;
+        shadow_state.out_of_bounds++;
+        NV_ShadowWarn("Write to RAMIN %08lX is out of bounds (size %08lX)", offset, size);
+        return;
+    }
+
+    NV_ShadowWrite(NV_ShadowSpaceFromSelector(selector), base + offset, value, sizeof(uint32_t));
+}
+
+/* movedata for the shadow: copies a block to (to_shadow) or from a BAR. The blob loader uses this, so it skips the register checks */
+bool NV_ShadowCopy(int32_t selector, uint32_t offset, void* buffer, uint32_t size, bool to_shadow)
+{
+    nv_shadow_space_t space = NV_ShadowSpaceFromSelector(selector);
+    uint8_t* bytes = buffer;
+
+    if (to_shadow)
+        shadow_state.writes++;
+    else
+        shadow_state.reads++;
+
+    if (!NV_ShadowCheckBounds(space, offset, size, to_shadow ? "block write" : "block read"))
+    {
+        if (!to_shadow)
+            memset(buffer, 0xFF, size);
+
+        return false;
+    }
+
+    while (size)
+    {
+        uint32_t page_offset = offset % NV_SHADOW_PAGE_SIZE;
+        uint32_t chunk_size = NV_SHADOW_PAGE_SIZE - page_offset;
+        nv_shadow_page_t* page = NV_ShadowGetPage(space, offset, to_shadow);
+        if (chunk_size > size)
+            chunk_size = size;
+
+        if (to_shadow)
+        {
+            if (!page)
+            {
+                NV_ShadowWarn("Out of memory, block write to %s %08lX dropped", shadow_space_names[space], offset);
+                return false;
+            }
+
+            memcpy(&page->data[page_offset], bytes, chunk_size);
+
+            for (uint32_t dword = page_offset >> 2; dword <= (page_offset + chunk_size - 1) >> 2; dword++)
+            {
+                page->flags[dword] |= NV_SHADOW_DWORD_WRITTEN;
+
+                if (page->writes[dword] < 0xFFFF)
+                    page->writes[dword]++;
+            }
+        }
+        else if (page)
+            memcpy(bytes, &page->data[page_offset], chunk_size);
+        else
+            memset(bytes, 0, chunk_size);
+
+        offset += chunk_size;
+        bytes += chunk_size;
+        size -= chunk_size;
+    }
+
+    return true;
+}
+
+uint8_t NV_ShadowReadVGA(nv_shadow_vga_t vga, uint8_t index)
+{
+    shadow_state.reads++;
+    return shadow_state.vga[vga][index];
+}
+
+void NV_ShadowWriteVGA(nv_shadow_vga_t vga, uint8_t index, uint8_t value)
+{
+    shadow_state.writes++;
+    shadow_state.vga[vga][index] = value;
+    shadow_state.vga_written[vga][index] = true;
+}
+
+uint32_t NV_ShadowReadPCI(uint32_t offset, uint32_t size)
+{
+    uint32_t value = 0;
+
+    shadow_state.reads++;
+
+    for (uint32_t i = 0; i < size; i++)
+        value |= (uint32_t)shadow_state.pci[(offset + i) & 0xFF] << (i * 8);
+
+    return value;
+}
+
+void NV_ShadowWritePCI(uint32_t offset, uint32_t value, uint32_t size)
+{
+    shadow_state.writes++;
+
+    // Vendor and device ID
+    if (offset < 4)
+    {
+        shadow_state.read_only_writes++;
+        NV_ShadowWarn("Write of %08lX to PCI config %02lX (vendor/device ID) is ignored", value, offset);
+        return;
+    }
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        shadow_state.pci[(offset + i) & 0xFF] = (value >> (i * 8)) & 0xFF;
+        shadow_state.pci_written[(offset + i) & 0xFF] = true;
+    }
+}
+
+const char* NV_ShadowAreaName(nv_shadow_space_t space, uint32_t offset)
+{
+    if (space == NV_SHADOW_SPACE_BAR1)
+        return (shadow_state.generation == NV_SHADOW_GEN_NV3 && offset >= NV3_RAMIN_START) ? "RAMIN" : "VRAM";
+
+    nv_shadow_register_t* reg = NV_ShadowFindRegister(offset);
+    return reg ? reg->name : "";
+}
+
+/* Log one run of written dwords. Short runs get every value, long ones (e.g. a file loaded into VRAM) are summarised */
+void NV_ShadowReportRun(nv_shadow_space_t space, uint32_t start, uint32_t end)
+{
+    uint32_t dwords = ((end - start) >> 2) + 1;
+
+    if (dwords > NV_SHADOW_REPORT_MAX_RUN)
+    {
+        Logging_Write(LOG_LEVEL_MESSAGE, "%s %08lX-%08lX: %lu dwords written %s\n", shadow_space_names[space], start, end + 3, dwords,
+            NV_ShadowAreaName(space, start));
+        return;
+    }
+
+    for (uint32_t offset = start; offset <= end; offset += 4)
+    {
+        nv_shadow_page_t* page = NV_ShadowGetPage(space, offset, false);
+        uint32_t page_offset = offset % NV_SHADOW_PAGE_SIZE;
+        uint32_t value = page->data[page_offset] | (page->data[page_offset + 1] << 8) | (page->data[page_offset + 2] << 16)
+        | ((uint32_t)page->data[page_offset + 3] << 24);
+
+        Logging_Write(LOG_LEVEL_MESSAGE, "%s %08lX = %08lX (%u writes%s) %s\n", shadow_space_names[space], offset, value,
+            page->writes[page_offset >> 2], (page->flags[page_offset >> 2] & NV_SHADOW_DWORD_READ) ? ", read back" : "",
+            NV_ShadowAreaName(space, offset));
+    }
+}
+
+void NV_ShadowReport()
+{
+    if (!shadow_state.enabled)
+        return;
+
+    Logging_Write(LOG_LEVEL_MESSAGE, "Dry run finished: %lu reads, %lu writes, %lu out of bounds, %lu to read-only registers, %lu with side effects\n",
+        shadow_state.reads, shadow_state.writes, shadow_state.out_of_bounds, shadow_state.read_only_writes, shadow_state.side_effect_writes);
+
+    Logging_Write(LOG_LEVEL_MESSAGE, "Written registers and their final values:\n");
+
+    for (uint32_t space = 0; space < NV_SHADOW_NUM_SPACES; space++)
+    {
+        bool in_run = false;
+        uint32_t run_start = 0;
+        uint32_t num_pages = shadow_state.size[space] / NV_SHADOW_PAGE_SIZE;
+
+        for (uint32_t page_id = 0; page_id < num_pages; page_id++)
+        {
+            nv_shadow_page_t* page = shadow_state.pages[space][page_id];
+
+            for (uint32_t dword = 0; dword < (NV_SHADOW_PAGE_SIZE >> 2); dword++)
+            {
+                uint32_t offset = page_id * NV_SHADOW_PAGE_SIZE + (dword << 2);
+                bool written = (page && (page->flags[dword] & NV_SHADOW_DWORD_WRITTEN));
+
+                if (written
+                && !in_run)
+                {
+                    in_run = true;
+                    run_start = offset;
+                }
+                else if (!written
+                && in_run)
+                {
+                    in_run = false;
+                    NV_ShadowReportRun(space, run_start, offset - 4);
+                }
+
+                // Nothing to see in an empty page
+                if (!page)
+                    break;
+            }
+        }
+
+        if (in_run)
+            NV_ShadowReportRun(space, run_start, shadow_state.size[space] - 4);
+    }
+
+    for (uint32_t vga = 0; vga < NV_SHADOW_NUM_VGA; vga++)
+    {
+        for (uint32_t index = 0; index < 256; index++)
+        {
+            if (shadow_state.vga_written[vga][index])
+                Logging_Write(LOG_LEVEL_MESSAGE, "VGA %s %02lX = %02X\n", shadow_vga_names[vga], index, shadow_state.vga[vga][index]);
+        }
+    }
+
+    for (uint32_t offset = 0; offset < 256; offset++)
+    {
+        if (shadow_state.pci_written[offset])
+            Logging_Write(LOG_LEVEL_MESSAGE, "PCI %02lX = %02X\n", offset, shadow_state.pci[offset]);
+    }
+
+    for (uint32_t space = 0; space < NV_SHADOW_NUM_SPACES; space++)
+    {
+        for (uint32_t page_id = 0; page_id < shadow_state.size[space] / NV_SHADOW_PAGE_SIZE; page_id++)
+            free(shadow_state.pages[space][page_id]);
+
+        free(shadow_state.pages[space]);
+        shadow_state.pages[space] = NULL;
+    }
+
+    shadow_state.enabled = false;
+}
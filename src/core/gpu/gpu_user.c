@@ -0,0 +1,98 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    gpu_user.c: Submitting methods to PFIFO through the USER aperture
+
+    Every method written to USER goes into CACHE1, and writes to a full CACHE1 are dropped. Reading offset 0x10 of any subchannel returns the bytes
+    free in CACHE1 (NV3_SUBCHANNEL_PIO_IS_PFIFO_FREE on NV3, USER_FREE032 on NV4), so we write as many methods as there is room for, then read it
+    again. Runs of consecutive methods (e.g. a rectangle's point and size) are written with one movedata, which is a rep movsl.
+*/
+
+#include <nvplay.h>
+#include "core/gpu/gpu.h"
+#include "util/util.h"
+#include <sys/movedata.h>
+#include <sys/segments.h>
+
+// Number of methods CACHE1 can take right now
+static inline uint32_t NV_UserGetFree(uint32_t subchannel_base)
+{
+    return (NV_ReadMMIO32(subchannel_base + NV_USER_FREE) & NV_USER_FREE_MASK) >> 2;
+}
+
+/* Write count methods starting at methods[0], which go to consecutive addresses */
+static inline void NV_UserWriteRun(uint32_t subchannel_base, const uint32_t* methods, const uint32_t* values, uint32_t count)
+{
+    // The dry run model wants to see each write
+    if (shadow_state.enabled
+    || count == 1)
+    {
+        for (uint32_t i = 0; i < count; i++)
+            NV_WriteMMIO32(subchannel_base + methods[i], values[i]);
+
+        return;
+    }
+
+    uint64_t profile_start = Profile_IOStart();
+    movedata(_my_ds(), (unsigned)values, current_device.bus_info.bar0_selector, subchannel_base + methods[0], count << 2);
+    Profile_IOEnd(profile_start);
+}
+
+/*
+    Submit count methods to the channel and subchannel at subchannel_base (a BAR0 offset in USER). methods are offsets within the subchannel.
+    Waits for CACHE1 to have room when it fills up. Returns false if it stays full for NV_WAIT_DEFAULT_TIMEOUT_US (PFIFO isn't running).
+*/
+bool NV_SubmitUserMethods(uint32_t subchannel_base, const uint32_t* methods, const uint32_t* values, uint32_t count)
+{
+    uint32_t submitted = 0;
+
+    while (submitted < count)
+    {
+        uint32_t free_methods = shadow_state.enabled ? count : NV_UserGetFree(subchannel_base);
+
+        if (!free_methods)
+        {
+            uclock_t start_clock = uclock();
+            uclock_t timeout_clock = ((uclock_t)NV_WAIT_DEFAULT_TIMEOUT_US * UCLOCKS_PER_SEC) / 1000000;
+
+            while (!free_methods
+            && uclock() - start_clock < timeout_clock)
+                free_methods = NV_UserGetFree(subchannel_base);
+
+            uint32_t elapsed_us = (uint32_t)(((uclock() - start_clock) * 1000000) / UCLOCKS_PER_SEC);
+
+            NV_RecordWait("PFIFO CACHE1 free", elapsed_us, !free_methods);
+
+            if (!free_methods)
+            {
+                Logging_WriteTo(LOG_CHANNEL_FIFO, LOG_LEVEL_ERROR, "PFIFO CACHE1 stayed full for %lums with %lu of %lu methods for %06lX submitted. Is PFIFO running?\n",
+                    elapsed_us / 1000, submitted, count, subchannel_base);
+                return false;
+            }
+        }
+
+        uint32_t end = submitted + free_methods;
+
+        if (end > count)
+            end = count;
+
+        // Split what fits into runs of consecutive methods
+        while (submitted < end)
+        {
+            uint32_t run = 1;
+
+            while (submitted + run < end
+            && methods[submitted + run] == methods[submitted + run - 1] + 4)
+                run++;
+
+            NV_UserWriteRun(subchannel_base, &methods[submitted], &values[submitted], run);
+            submitted += run;
+        }
+    }
+
+    return true;
+}
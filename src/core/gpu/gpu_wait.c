@@ -0,0 +1,159 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    gpu_wait.c: Polling a register until it reaches a value, with a timeout
+
+    Used instead of fixed delays. Each wait backs off exponentially between reads (so a long wait doesn't hammer the bus) and records how long
+    it took against the name of its call site, so timeouts can be tuned from real numbers. The min/avg/max for every call site is logged on exit.
+*/
+
+#include <nvplay.h>
+#include "core/gpu/gpu.h"
+#include "util/util.h"
+
+nv_wait_site_t wait_sites[NV_WAIT_MAX_SITES] = {0};
+uint32_t wait_num_sites = 0;
+
+static inline uint32_t NV_UclockToUs(uclock_t ticks)
+{
+    return (uint32_t)((ticks * 1000000) / UCLOCKS_PER_SEC);
+}
+
+nv_wait_site_t* NV_GetWaitSite(const char* site_name)
+{
+    for (uint32_t i = 0; i < wait_num_sites; i++)
+    {
+        if (!strncmp(wait_sites[i].name, site_name, NV_WAIT_MAX_SITE_NAME - 1))
+            return &wait_sites[i];
+    }
+
+    // Still do the wait if we run out, just don't record it
+    if (wait_num_sites >= NV_WAIT_MAX_SITES)
+        return NULL;
+
+    nv_wait_site_t* site = &wait_sites[wait_num_sites++];
+
+    strncpy(site->name, site_name, NV_WAIT_MAX_SITE_NAME - 1);
+    site->min_us = 0xFFFFFFFF;
+    return site;
+}
+
+void NV_RecordWait(const char* site_name, uint32_t elapsed_us, bool timed_out)
+{
+    nv_wait_site_t* site = NV_GetWaitSite(site_name);
+
+    if (!site)
+        return;
+
+    site->count++;
+    site->total_us += elapsed_us;
+
+    if (timed_out)
+        site->timeouts++;
+
+    if (elapsed_us < site->min_us)
+        site->min_us = elapsed_us;
+
+    if (elapsed_us > site->max_us)
+        site->max_us = elapsed_us;
+}
+
+/*
+    Wait until (BAR0[offset] & mask) == value, or timeout_us passes. Returns false on timeout.
+    elapsed_us is optional.
+*/
+bool NV_WaitMMIO32(const char* site_name, uint32_t offset, uint32_t mask, uint32_t value, uint32_t timeout_us, uint32_t* elapsed_us)
+{
+    // Nothing in the dry run model changes by itself, so there's no point polling it
+    if (shadow_state.enabled)
+    {
+        bool met = ((NV_ReadMMIO32(offset) & mask) == value);
+
+        NV_RecordWait(site_name, 0, !met);
+
+        if (elapsed_us)
+            *elapsed_us = 0;
+
+        if (!met)
+        {
+            Logging_Write(LOG_LEVEL_WARNING, "%s: Dry run: (%06lX & %08lX) != %08lX (model has %08lX). Real hardware may get there by itself\n",
+                site_name, offset, mask, value, NV_ReadMMIO32(offset));
+        }
+
+        return met;
+    }
+
+    uclock_t start_clock = uclock();
+    uclock_t timeout_clock = ((uclock_t)timeout_us * UCLOCKS_PER_SEC) / 1000000;
+    uclock_t backoff_clock = ((uclock_t)NV_WAIT_BACKOFF_MIN_US * UCLOCKS_PER_SEC) / 1000000;
+    uclock_t backoff_max_clock = ((uclock_t)NV_WAIT_BACKOFF_MAX_US * UCLOCKS_PER_SEC) / 1000000;
+    uclock_t now = start_clock;
+    bool success = false;
+
+    while (true)
+    {
+        if ((NV_ReadMMIO32(offset) & mask) == value)
+        {
+            success = true;
+            break;
+        }
+
+        now = uclock();
+
+        if (now - start_clock >= timeout_clock)
+            break;
+
+        // Don't back off past the timeout
+        uclock_t wait_until = now + backoff_clock;
+
+        if (wait_until - start_clock > timeout_clock)
+            wait_until = start_clock + timeout_clock;
+
+        while (uclock() < wait_until)
+            ;
+
+        backoff_clock <<= 1;
+
+        // A long wait. Show whatever was printed before it
+        if (backoff_clock > backoff_max_clock)
+        {
+            backoff_clock = backoff_max_clock;
+            Console_PresentIfDue();
+        }
+    }
+
+    uint32_t elapsed = NV_UclockToUs(uclock() - start_clock);
+
+    NV_RecordWait(site_name, elapsed, !success);
+
+    if (elapsed_us)
+        *elapsed_us = elapsed;
+
+    if (!success)
+    {
+        Logging_Write(LOG_LEVEL_WARNING, "%s: Timed out after %lu us waiting for (%06lX & %08lX) == %08lX (last value %08lX)\n",
+            site_name, elapsed, offset, mask, value, NV_ReadMMIO32(offset));
+    }
+
+    return success;
+}
+
+void NV_LogWaitStatistics()
+{
+    if (!wait_num_sites)
+        return;
+
+    Logging_Write(LOG_LEVEL_DEBUG, "Register wait statistics (us):\n");
+
+    for (uint32_t i = 0; i < wait_num_sites; i++)
+    {
+        nv_wait_site_t* site = &wait_sites[i];
+
+        Logging_Write(LOG_LEVEL_DEBUG, "%-40s %6lu waits, %4lu timeouts, min %lu avg %lu max %lu\n", site->name, site->count, site->timeouts,
+            site->min_us, (uint32_t)(site->total_us / site->count), site->max_us);
+    }
+}
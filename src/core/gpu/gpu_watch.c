@@ -0,0 +1,338 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    gpu_watch.c: Live register watch panel for the REPL
+
+    Watched registers are kept sorted by space and offset and sampled from a console tick while the REPL waits for input. Dwords right next to each
+    other in MMIO or RAMIN are read with one block read. Gaps are never read across, because reading some registers has side effects (e.g. popping
+    a FIFO). Only rows whose value changed are drawn again, with the hex digits containing bits that flipped in reverse video until the next sample.
+*/
+
+#include "gpu_repl.h"
+#include "curses.h"
+#include "core/console/console.h"
+#include "core/gpu/gpu.h"
+#include "core/pci/pci.h"
+#include "util/util.h"
+#include <nvplay.h>
+
+watch_entry_t watch_entries[WATCH_MAX_ENTRIES] = {0};
+uint32_t watch_num_entries = 0;
+uint32_t watch_interval_ms = WATCH_DEFAULT_INTERVAL_MS;
+
+WINDOW* watch_window = NULL;
+
+const char* watch_space_names[WATCH_NUM_SPACES] =
+{
+    "mmio",
+    "ramin",
+    "pci",
+    "crtc",
+    "sr",
+    "gr",
+    "ar",
+};
+
+bool NVPlay_WatchParseSpace(const char* name, watch_space_t* space)
+{
+    for (uint32_t i = 0; i < WATCH_NUM_SPACES; i++)
+    {
+        if (!strcasecmp(name, watch_space_names[i]))
+        {
+            *space = (watch_space_t)i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static inline bool NVPlay_WatchIs8Bit(watch_space_t space)
+{
+    return (space >= WATCH_SPACE_CRTC);
+}
+
+/* Read entries [first, first + count), which are consecutive dwords in one aperture */
+static void NVPlay_WatchReadBlock(uint32_t first, uint32_t count)
+{
+    static uint32_t block[WATCH_MAX_ENTRIES];
+    watch_entry_t* entry = &watch_entries[first];
+    uint16_t selector = current_device.bus_info.bar0_selector;
+    uint32_t base = 0, size = 0;
+
+    if (entry->space == WATCH_SPACE_RAMIN
+    && !NV_GetRaminMapping(&selector, &base, &size))
+        return;
+
+    NV_ReadBlock32(selector, base + entry->offset, block, count);
+
+    for (uint32_t i = 0; i < count; i++)
+        watch_entries[first + i].value = block[i];
+}
+
+static uint32_t NVPlay_WatchReadOne(watch_entry_t* entry)
+{
+    switch (entry->space)
+    {
+        case WATCH_SPACE_PCI:
+            return PCI_ReadConfig32(current_device.bus_info.bus_number, current_device.bus_info.function_number, entry->offset);
+        case WATCH_SPACE_CRTC:
+            return VGA_ReadCRTC(entry->offset);
+        case WATCH_SPACE_SR:
+            return VGA_ReadSequencer(entry->offset);
+        case WATCH_SPACE_GR:
+            return VGA_ReadGraphics(entry->offset);
+        case WATCH_SPACE_AR:
+            return VGA_ReadAttribute(entry->offset);
+        default:
+            return 0;
+    }
+}
+
+/* Sample every entry and mark the ones that changed (or stopped being highlighted) as dirty */
+static void NVPlay_WatchSample()
+{
+    uint32_t previous[WATCH_MAX_ENTRIES];
+
+    for (uint32_t i = 0; i < watch_num_entries; i++)
+        previous[i] = watch_entries[i].value;
+
+    uint32_t i = 0;
+
+    while (i < watch_num_entries)
+    {
+        watch_entry_t* entry = &watch_entries[i];
+
+        if (entry->space != WATCH_SPACE_MMIO
+        && entry->space != WATCH_SPACE_RAMIN)
+        {
+            entry->value = NVPlay_WatchReadOne(entry);
+            i++;
+            continue;
+        }
+
+        uint32_t run = 1;
+
+        while (i + run < watch_num_entries
+        && watch_entries[i + run].space == entry->space
+        && watch_entries[i + run].offset == watch_entries[i + run - 1].offset + 4)
+            run++;
+
+        NVPlay_WatchReadBlock(i, run);
+        i += run;
+    }
+
+    for (i = 0; i < watch_num_entries; i++)
+    {
+        watch_entry_t* entry = &watch_entries[i];
+        uint32_t flipped = entry->sampled ? (entry->value ^ previous[i]) : 0;
+
+        if (!entry->sampled
+        || flipped != entry->flipped)
+            entry->dirty = true;
+
+        entry->flipped = flipped;
+        entry->sampled = true;
+    }
+}
+
+static void NVPlay_WatchDrawRow(uint32_t row)
+{
+    static const char hex_digits[] = "0123456789ABCDEF";
+    watch_entry_t* entry = &watch_entries[row];
+    int32_t digits = NVPlay_WatchIs8Bit(entry->space) ? 2 : 8;
+
+    mvwprintw(watch_window, row + 1, 1, " %-*.*s %*s", WATCH_LABEL_LENGTH, WATCH_LABEL_LENGTH, entry->label, 8 - digits, "");
+
+    for (int32_t digit = digits - 1; digit >= 0; digit--)
+    {
+        uint32_t shift = digit << 2;
+        chtype ch = hex_digits[(entry->value >> shift) & 0x0F];
+
+        if ((entry->flipped >> shift) & 0x0F)
+            ch |= A_REVERSE;
+
+        waddch(watch_window, ch);
+    }
+
+    waddch(watch_window, ' ');
+    entry->dirty = false;
+}
+
+static void NVPlay_WatchDraw()
+{
+    if (!watch_window)
+        return;
+
+    for (uint32_t i = 0; i < watch_num_entries; i++)
+    {
+        if (watch_entries[i].dirty)
+            NVPlay_WatchDrawRow(i);
+    }
+
+    // Anything printed since the last tick may have scrolled over the panel. Curses only sends the characters that differ from the screen
+    touchwin(watch_window);
+    wrefresh(watch_window);
+}
+
+/* (Re)create the panel for the current number of entries, or remove it if there are none */
+static void NVPlay_WatchResize()
+{
+    if (watch_window)
+    {
+        delwin(watch_window);
+        watch_window = NULL;
+
+        // Put back whatever the panel covered
+        touchwin(stdscr);
+        wrefresh(stdscr);
+    }
+
+    if (!watch_num_entries)
+        return;
+
+    watch_window = newwin(watch_num_entries + 2, WATCH_PANEL_WIDTH, 0, COLS - WATCH_PANEL_WIDTH);
+
+    if (!watch_window)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "Couldn't create the watch panel\n");
+        return;
+    }
+
+    // Don't take the cursor away from the prompt
+    leaveok(watch_window, true);
+    box(watch_window, 0, 0);
+    mvwprintw(watch_window, 0, 2, " Watch %lums ", watch_interval_ms);
+
+    for (uint32_t i = 0; i < watch_num_entries; i++)
+        watch_entries[i].dirty = true;
+
+    NVPlay_WatchDraw();
+}
+
+static void NVPlay_WatchTick(void* context)
+{
+    NVPlay_WatchSample();
+    NVPlay_WatchDraw();
+}
+
+/* Label for the panel: the register name without NVx_ if one was typed, otherwise the offset. Anything outside MMIO gets its space in front */
+static void NVPlay_WatchMakeLabel(watch_entry_t* entry, const char* name)
+{
+    const char* prefix = (entry->space == WATCH_SPACE_MMIO) ? "" : watch_space_names[entry->space];
+    const char* separator = (entry->space == WATCH_SPACE_MMIO) ? "" : " ";
+
+    if (name
+    && toupper((unsigned char)name[0]) == 'N'
+    && toupper((unsigned char)name[1]) == 'V'
+    && strchr(name, '_'))
+    {
+        snprintf(entry->label, sizeof(entry->label), "%s%s%s", prefix, separator, strchr(name, '_') + 1);
+    }
+    else if (NVPlay_WatchIs8Bit(entry->space))
+        snprintf(entry->label, sizeof(entry->label), "%s[%02lX]", prefix, entry->offset);
+    else
+        snprintf(entry->label, sizeof(entry->label), "%s%s%06lX", prefix, separator, entry->offset);
+}
+
+/*
+    Watch the register at offset in space. name is the register name it was given as, or NULL. The caller checks that offset is valid.
+    interval_ms (0 = leave it as it is) changes how often the whole panel is refreshed.
+*/
+bool NVPlay_WatchAdd(watch_space_t space, uint32_t offset, const char* name, uint32_t interval_ms)
+{
+    if (console_backend != CONSOLE_BACKEND_CURSES)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "The watch panel needs the curses console (only in the REPL, without -dumbconsole)\n");
+        return false;
+    }
+
+    if (interval_ms
+    && interval_ms < WATCH_MIN_INTERVAL_MS)
+    {
+        Logging_Write(LOG_LEVEL_WARNING, "Watch interval %lums is shorter than a timer tick, using %dms\n", interval_ms, WATCH_MIN_INTERVAL_MS);
+        interval_ms = WATCH_MIN_INTERVAL_MS;
+    }
+
+    uint32_t position = 0;
+
+    // Keep them sorted, so consecutive registers end up next to each other
+    while (position < watch_num_entries
+    && (watch_entries[position].space < space
+    || (watch_entries[position].space == space && watch_entries[position].offset < offset)))
+        position++;
+
+    bool exists = (position < watch_num_entries
+        && watch_entries[position].space == space
+        && watch_entries[position].offset == offset);
+
+    if (!exists)
+    {
+        if (watch_num_entries >= WATCH_MAX_ENTRIES
+        || watch_num_entries + 2 >= (uint32_t)LINES)
+        {
+            Logging_Write(LOG_LEVEL_ERROR, "Can't watch any more registers (the panel is full)\n");
+            return false;
+        }
+
+        memmove(&watch_entries[position + 1], &watch_entries[position], (watch_num_entries - position) * sizeof(watch_entry_t));
+        memset(&watch_entries[position], 0, sizeof(watch_entry_t));
+        watch_entries[position].space = space;
+        watch_entries[position].offset = offset;
+        NVPlay_WatchMakeLabel(&watch_entries[position], name);
+        watch_num_entries++;
+    }
+
+    if (interval_ms
+    || watch_num_entries == 1)
+    {
+        if (interval_ms)
+            watch_interval_ms = interval_ms;
+
+        Console_UnregisterTick(NVPlay_WatchTick, NULL);
+
+        if (!Console_RegisterTick("Watch panel", NVPlay_WatchTick, NULL, watch_interval_ms))
+        {
+            NVPlay_WatchClear();
+            return false;
+        }
+    }
+
+    NVPlay_WatchSample();
+    NVPlay_WatchResize();
+    return true;
+}
+
+/* Stop watching one register. Returns false if it wasn't being watched */
+bool NVPlay_WatchRemove(watch_space_t space, uint32_t offset)
+{
+    for (uint32_t i = 0; i < watch_num_entries; i++)
+    {
+        if (watch_entries[i].space != space
+        || watch_entries[i].offset != offset)
+            continue;
+
+        memmove(&watch_entries[i], &watch_entries[i + 1], (watch_num_entries - i - 1) * sizeof(watch_entry_t));
+        watch_num_entries--;
+
+        if (!watch_num_entries)
+            Console_UnregisterTick(NVPlay_WatchTick, NULL);
+
+        NVPlay_WatchResize();
+        return true;
+    }
+
+    Logging_Write(LOG_LEVEL_WARNING, "%s %06lX isn't being watched\n", watch_space_names[space], offset);
+    return false;
+}
+
+void NVPlay_WatchClear()
+{
+    watch_num_entries = 0;
+    Console_UnregisterTick(NVPlay_WatchTick, NULL);
+    NVPlay_WatchResize();
+}
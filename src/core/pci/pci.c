@@ -27,11 +27,11 @@ bool PCI_BiosIsPresent(void)
 
   if (regs.d.edx != PCI_BIOS_MAGIC) // "PCI "
   {
-    Logging_Write(LOG_LEVEL_ERROR, "PCI BIOS not found, or PCI BIOS specification was below version 2.0c\n");
+    Logging_WriteTo(LOG_CHANNEL_PCI, LOG_LEVEL_ERROR, "PCI BIOS not found, or PCI BIOS specification was below version 2.0c\n");
     return false;
   }
 
-  Logging_Write(LOG_LEVEL_MESSAGE, "Found PCI BIOS, specification version %x.%x\n", regs.h.bh, regs.h.bl); // %x as a cheap way of printing it as BCD
+  Logging_WriteTo(LOG_CHANNEL_PCI, LOG_LEVEL_MESSAGE, "Found PCI BIOS, specification version %x.%x\n", regs.h.bh, regs.h.bl); // %x as a cheap way of printing it as BCD
   return true; 
 }
 
@@ -51,10 +51,10 @@ bool PCI_DevicePresent(uint32_t device_id, uint32_t vendor_id)
         switch (regs.h.ah)
         {
             case PCI_ERROR_UNSUPPORTED_FUNCTION:
-                Logging_Write(LOG_LEVEL_ERROR, "PCI BIOS was not specification level 2.0c or higher compatible after all\n");
+                Logging_WriteTo(LOG_CHANNEL_PCI, LOG_LEVEL_ERROR, "PCI BIOS was not specification level 2.0c or higher compatible after all\n");
                 break;
             case PCI_ERROR_BAD_VENDOR_ID:
-                Logging_Write(LOG_LEVEL_ERROR, "[BUG] BAD vendor id %08lX", vendor_id);
+                Logging_WriteTo(LOG_CHANNEL_PCI, LOG_LEVEL_ERROR, "[BUG] BAD vendor id %08lX", vendor_id);
                 break; 
         }
 
@@ -70,6 +70,9 @@ bool PCI_DevicePresent(uint32_t device_id, uint32_t vendor_id)
 
 uint8_t PCI_ReadConfig8(uint32_t bus_number, uint32_t function_number, uint32_t offset)
 {
+    if (shadow_state.enabled)
+        return NV_ShadowReadPCI(offset, 1);
+
     __dpmi_regs regs = {0};
 
     regs.h.ah = PCI_FUNCTION_ID_BASE;
@@ -78,14 +81,17 @@ uint8_t PCI_ReadConfig8(uint32_t bus_number, uint32_t function_number, uint32_t
     regs.h.bl = function_number;
     regs.x.di = offset;
 
+    uint64_t profile_start = Profile_IOStart();
     __dpmi_int(INT_PCI_BIOS, &regs);
+    Profile_IOEnd(profile_start);
 
     if (!regs.h.ah)
         return regs.h.cl;
     else 
     {
         //todo fatal error code
-        Logging_Write(LOG_LEVEL_ERROR, "FAILED to read PCI bus %lu function %lu offset %08lX info (8bit)\n", bus_number, function_number, offset);
+        Logging_WriteTo(LOG_CHANNEL_PCI, LOG_LEVEL_ERROR, "FAILED to read PCI bus %lu function %lu offset %08lX info (8bit)\n",
+            bus_number, function_number, offset);
         return 0x00;
     }
 }
@@ -95,10 +101,13 @@ uint16_t PCI_ReadConfig16(uint32_t bus_number, uint32_t function_number, uint32_
     /* Offset must be dword aligned */
     if (offset % 0x02)
     {
-        Logging_Write(LOG_LEVEL_ERROR, "BUG: PCI_ReadConfig16 called with unaligned address");
+        Logging_WriteTo(LOG_CHANNEL_PCI, LOG_LEVEL_ERROR, "BUG: PCI_ReadConfig16 called with unaligned address");
         return 0x00; // it's not happening (TODO: error code)
     }
         
+    if (shadow_state.enabled)
+        return NV_ShadowReadPCI(offset, 2);
+
     __dpmi_regs regs = {0};
 
     regs.h.ah = PCI_FUNCTION_ID_BASE;
@@ -107,13 +116,16 @@ uint16_t PCI_ReadConfig16(uint32_t bus_number, uint32_t function_number, uint32_
     regs.h.bl = function_number;
     regs.x.di = offset;
 
+    uint64_t profile_start = Profile_IOStart();
     __dpmi_int(INT_PCI_BIOS, &regs);
+    Profile_IOEnd(profile_start);
 
     if (!regs.h.ah)
         return regs.x.cx;
     else 
     {
-        Logging_Write(LOG_LEVEL_ERROR, "FAILED to read PCI bus %lu function %lu offset %08lX info (16bit)\n", bus_number, function_number, offset);
+        Logging_WriteTo(LOG_CHANNEL_PCI, LOG_LEVEL_ERROR, "FAILED to read PCI bus %lu function %lu offset %08lX info (16bit)\n",
+            bus_number, function_number, offset);
         return 0x00;
     }
 }
@@ -124,10 +136,13 @@ uint32_t PCI_ReadConfig32(uint32_t bus_number, uint32_t function_number, uint32_
     /* Offset must be dword aligned. AND fucks up with 0x10 so just use mod */
     if (offset % 0x04)
     {
-        Logging_Write(LOG_LEVEL_ERROR, "BUG: PCI_ReadConfig32 called with unaligned address");
+        Logging_WriteTo(LOG_CHANNEL_PCI, LOG_LEVEL_ERROR, "BUG: PCI_ReadConfig32 called with unaligned address");
         return 0x00; // it's not happening (TODO: error code)
     }
         
+    if (shadow_state.enabled)
+        return NV_ShadowReadPCI(offset, 4);
+
     __dpmi_regs regs = {0};
 
     regs.h.ah = PCI_FUNCTION_ID_BASE;
@@ -136,19 +151,28 @@ uint32_t PCI_ReadConfig32(uint32_t bus_number, uint32_t function_number, uint32_
     regs.h.bl = function_number;
     regs.x.di = offset;
 
+    uint64_t profile_start = Profile_IOStart();
     __dpmi_int(INT_PCI_BIOS, &regs);
+    Profile_IOEnd(profile_start);
 
     if (!regs.h.ah)
         return regs.d.ecx;
     else 
     {
-        Logging_Write(LOG_LEVEL_ERROR, "FAILED to read PCI bus %lu function %lu offset %08lX info (32bit)\n", bus_number, function_number, offset);
+        Logging_WriteTo(LOG_CHANNEL_PCI, LOG_LEVEL_ERROR, "FAILED to read PCI bus %lu function %lu offset %08lX info (32bit)\n",
+            bus_number, function_number, offset);
         return 0x00;
     } 
 }
 
 bool PCI_WriteConfig8(uint32_t bus_number, uint32_t function_number, uint32_t offset, uint8_t value)
 {
+    if (shadow_state.enabled)
+    {
+        NV_ShadowWritePCI(offset, value, 1);
+        return false;
+    }
+
     __dpmi_regs regs = {0};
 
     regs.h.ah = PCI_FUNCTION_ID_BASE;
@@ -158,14 +182,17 @@ bool PCI_WriteConfig8(uint32_t bus_number, uint32_t function_number, uint32_t of
     regs.h.cl = value;
     regs.x.di = offset;
 
+    uint64_t profile_start = Profile_IOStart();
     __dpmi_int(INT_PCI_BIOS, &regs);
+    Profile_IOEnd(profile_start);
 
     if (!regs.h.ah)
         return false;
     else 
     {
         //todo fatal error code
-        Logging_Write(LOG_LEVEL_ERROR, "FAILED to write PCI bus %lu function %lu offset %08lX info (8bit)\n", bus_number, function_number, offset);
+        Logging_WriteTo(LOG_CHANNEL_PCI, LOG_LEVEL_ERROR, "FAILED to write PCI bus %lu function %lu offset %08lX info (8bit)\n",
+            bus_number, function_number, offset);
         return true;
     }
     
@@ -178,10 +205,16 @@ bool PCI_WriteConfig16(uint32_t bus_number, uint32_t function_number, uint32_t o
     /* Offset must be dword aligned */
     if (offset % 0x02)
     {
-        Logging_Write(LOG_LEVEL_ERROR, "BUG: PCI_WriteConfig16 called with unaligned address!\n");
+        Logging_WriteTo(LOG_CHANNEL_PCI, LOG_LEVEL_ERROR, "BUG: PCI_WriteConfig16 called with unaligned address!\n");
         return 0x00; // it's not happening (TODO: error code)
     }
         
+    if (shadow_state.enabled)
+    {
+        NV_ShadowWritePCI(offset, value, 2);
+        return false;
+    }
+
     __dpmi_regs regs = {0};
 
     regs.h.ah = PCI_FUNCTION_ID_BASE;
@@ -192,13 +225,16 @@ bool PCI_WriteConfig16(uint32_t bus_number, uint32_t function_number, uint32_t o
 
     regs.x.di = offset;
 
+    uint64_t profile_start = Profile_IOStart();
     __dpmi_int(INT_PCI_BIOS, &regs);
+    Profile_IOEnd(profile_start);
 
     if (!regs.h.ah)
         return false; 
     else 
     {
-        Logging_Write(LOG_LEVEL_ERROR, "FAILED to write PCI bus %lu function %lu offset %08lX info (16bit)\n", bus_number, function_number, offset);
+        Logging_WriteTo(LOG_CHANNEL_PCI, LOG_LEVEL_ERROR, "FAILED to write PCI bus %lu function %lu offset %08lX info (16bit)\n",
+            bus_number, function_number, offset);
         return true;
     }
 
@@ -211,10 +247,16 @@ bool PCI_WriteConfig32(uint32_t bus_number, uint32_t function_number, uint32_t o
     /* Offset must be dword aligned. AND fucks up with 0x10 so just use mod */
     if (offset % 0x04)
     {
-        Logging_Write(LOG_LEVEL_ERROR, "BUG: PCI_WriteConfig32 called with unaligned address!\n");
+        Logging_WriteTo(LOG_CHANNEL_PCI, LOG_LEVEL_ERROR, "BUG: PCI_WriteConfig32 called with unaligned address!\n");
         return 0x00; // it's not happening (TODO: error code)
     }
         
+    if (shadow_state.enabled)
+    {
+        NV_ShadowWritePCI(offset, value, 4);
+        return false;
+    }
+
     __dpmi_regs regs = {0};
 
     regs.h.ah = PCI_FUNCTION_ID_BASE;
@@ -224,13 +266,16 @@ bool PCI_WriteConfig32(uint32_t bus_number, uint32_t function_number, uint32_t o
     regs.x.di = offset;
     regs.d.ecx = value; 
 
+    uint64_t profile_start = Profile_IOStart();
     __dpmi_int(INT_PCI_BIOS, &regs);
+    Profile_IOEnd(profile_start);
 
     if (!regs.h.ah)
         return false;
     else 
     {
-        Logging_Write(LOG_LEVEL_ERROR, "FAILED to write PCI bus %lu function %lu offset %08lX info (32bit)\n", bus_number, function_number, offset);
+        Logging_WriteTo(LOG_CHANNEL_PCI, LOG_LEVEL_ERROR, "FAILED to write PCI bus %lu function %lu offset %08lX info (32bit)\n",
+            bus_number, function_number, offset);
         return true;
     }
 
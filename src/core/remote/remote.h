@@ -0,0 +1,101 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    remote.h: Remote REPL over a serial port
+
+    The server (remote_server.c) only knows the protocol. It reaches the GPU and the script engine through a remote_backend_t, and the line
+    through the Remote_Serial functions, so it builds on the host too: there remote_serial_host.c is a tty/pty instead of a UART and
+    tools/nvremote/nvremote_test.c supplies a fake GPU. Under DOS the transport is remote_serial.c and the backend is remote_backend.c.
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "core/remote/remote_protocol.h"
+
+#define REMOTE_RX_BUFFER_SIZE       8192        // Must hold REMOTE_WINDOW_SIZE bytes of requests. Power of 2
+#define REMOTE_UART_CLOCK           115200      // Divisor 1
+#define REMOTE_MAX_PORTS            4           // COM1-COM4
+
+// 8250/16550 registers, from the port's base
+#define UART_DATA                   0           // RBR/THR (DLL with LCR_DLAB)
+#define UART_IER                    1           // (DLM with LCR_DLAB)
+#define UART_FCR                    2           // Write only. Reads are IIR
+#define UART_IIR                    2
+#define UART_LCR                    3
+#define UART_MCR                    4
+#define UART_LSR                    5
+
+#define UART_FCR_ENABLE_14          0xC7        // FIFOs on, both cleared, RX trigger at 14 bytes
+#define UART_IIR_FIFO_MASK          0xC0        // Both set on a 16550A with working FIFOs
+#define UART_LCR_8N1                0x03
+#define UART_LCR_DLAB               0x80
+#define UART_MCR_DTR                0x01
+#define UART_MCR_DTR_RTS            0x03
+#define UART_LSR_DATA_READY         0x01
+#define UART_LSR_OVERRUN            0x02
+#define UART_LSR_THR_EMPTY          0x20
+
+#define UART_FIFO_SIZE              16
+
+typedef struct remote_port_s
+{
+    uint16_t io_base;
+    int fd;                                     // Host transport only
+    bool has_fifo;                              // 16550A. An 8250/16450 has one byte of buffering and will drop bytes at high rates
+    uint8_t rx_buffer[REMOTE_RX_BUFFER_SIZE];
+    uint32_t rx_head;                           // Next byte to read
+    uint32_t rx_tail;                           // Next free byte
+    uint32_t overruns;                          // Bytes the UART or rx_buffer lost
+} remote_port_t;
+
+/* What the server runs requests on */
+typedef struct remote_backend_s
+{
+    uint32_t (*boot_0)();                                                               // For REMOTE_OP_HELLO
+    uint32_t (*vram_amount)();
+    bool (*space_size)(uint8_t space, uint32_t* size);                                  // False if the space doesn't exist
+    void (*read_block)(uint8_t space, uint32_t offset, uint32_t* data, uint32_t count);
+    void (*write_block)(uint8_t space, uint32_t offset, const uint32_t* data, uint32_t count);
+    bool (*run_script)(const char* source, uint32_t size);
+    bool (*stop_requested)();                                                           // Checked whenever the line is idle
+} remote_backend_t;
+
+/* Queue a received byte. Used by the transports */
+static inline void Remote_SerialPush(remote_port_t* port, uint8_t byte)
+{
+    uint32_t next_tail = (port->rx_tail + 1) & (REMOTE_RX_BUFFER_SIZE - 1);
+
+    if (next_tail == port->rx_head)
+    {
+        port->overruns++;
+        return;
+    }
+
+    port->rx_buffer[port->rx_tail] = byte;
+    port->rx_tail = next_tail;
+}
+
+// remote_serial.c (DOS) or remote_serial_host.c
+bool Remote_SerialOpen(remote_port_t* port, const char* name, uint32_t baud);
+void Remote_SerialClose(remote_port_t* port);
+void Remote_SerialPoll(remote_port_t* port);
+void Remote_SerialWrite(remote_port_t* port, const uint8_t* data, uint32_t size);
+void Remote_SerialHold(remote_port_t* port, bool hold);
+
+// remote_server.c
+extern remote_port_t remote_port;
+extern uint32_t remote_frames;
+extern uint32_t remote_bad_frames;
+
+bool Remote_SerialReadByte(remote_port_t* port, uint8_t* byte);
+void Remote_Run(const remote_backend_t* backend);
+
+// remote_backend.c
+uint32_t Remote_ParseBaud(const char* text);
+bool Remote_Serve(const char* port_name, uint32_t baud);
@@ -0,0 +1,114 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    remote_backend.c: What the remote REPL runs requests on
+
+    Register access goes through the same space functions as the hex editor, so block reads are one movedata, and scripts go through the normal
+    compiler. A key pressed on this machine stops the server.
+*/
+
+#include <nvplay.h>
+#include "core/console/console.h"
+#include "core/gpu/gpu.h"
+#include "core/remote/remote.h"
+#include "core/script/script.h"
+#include "util/util.h"
+
+static uint32_t Remote_BackendBoot0()
+{
+    return current_device.nv_pmc_boot_0;
+}
+
+static uint32_t Remote_BackendVRAMAmount()
+{
+    return current_device.vram_amount;
+}
+
+static bool Remote_BackendSpaceSize(uint8_t space, uint32_t* size)
+{
+    uint16_t selector = 0;
+    uint32_t base = 0;
+
+    return NV_GetSpaceMapping((nv_space_t)space, &selector, &base, size);
+}
+
+static void Remote_BackendReadBlock(uint8_t space, uint32_t offset, uint32_t* data, uint32_t count)
+{
+    NV_ReadSpaceBlock32((nv_space_t)space, offset, data, count);
+}
+
+static void Remote_BackendWriteBlock(uint8_t space, uint32_t offset, const uint32_t* data, uint32_t count)
+{
+    NV_WriteSpaceBlock32((nv_space_t)space, offset, data, count);
+}
+
+/* Compile and run script source the way a script file is run */
+static bool Remote_BackendRunScript(const char* source, uint32_t size)
+{
+    gpu_script_program_t program = {0};
+    uint32_t version[3] = {0};
+
+    if (!Script_CompileSource("(remote)", source, size, &program, version))
+        return false;
+
+    Script_BatchUserWrites(&program);
+
+    bool success = Script_Execute(&program);
+
+    Script_Free(&program);
+    return success;
+}
+
+static bool Remote_BackendStopRequested()
+{
+    if (!Console_KeyAvailable())
+        return false;
+
+    bioskey(0x10);
+    return true;
+}
+
+const remote_backend_t remote_backend_nvplay =
+{
+    Remote_BackendBoot0,
+    Remote_BackendVRAMAmount,
+    Remote_BackendSpaceSize,
+    Remote_BackendReadBlock,
+    Remote_BackendWriteBlock,
+    Remote_BackendRunScript,
+    Remote_BackendStopRequested,
+};
+
+/* Baud rates are always decimal, with or without the # scripts use for decimal numbers. Returns 0 if text isn't a number */
+uint32_t Remote_ParseBaud(const char* text)
+{
+    char* end = NULL;
+
+    if (text[0] == '#')
+        text++;
+
+    uint32_t baud = strtoul(text, &end, 10);
+
+    return (end != text && !*end) ? baud : 0;
+}
+
+/* Serve requests on port_name until the client closes the connection or a key is pressed. Returns false if the port couldn't be opened */
+bool Remote_Serve(const char* port_name, uint32_t baud)
+{
+    if (!Remote_SerialOpen(&remote_port, port_name, baud))
+        return false;
+
+    Logging_Write(LOG_LEVEL_MESSAGE, "Remote: Waiting for requests. Press any key to stop\n");
+
+    Remote_Run(&remote_backend_nvplay);
+
+    Logging_Write(LOG_LEVEL_MESSAGE, "Remote: Stopped after %lu requests (%lu bad frames, %lu bytes lost)\n", remote_frames, remote_bad_frames,
+        remote_port.overruns);
+
+    Remote_SerialClose(&remote_port);
+    return true;
+}
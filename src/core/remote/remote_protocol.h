@@ -0,0 +1,190 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    remote_protocol.h: The serial remote protocol, shared by the server (remote_server.c) and the host client (tools/nvremote)
+
+    Only depends on the C standard library, so the client can include it without the rest of NVPlay.
+
+    Every request and reply is one frame:
+
+        'N' 'V' opcode sequence length_lo length_hi payload... crc_lo crc_hi
+
+    The CRC is CRC-16/CCITT-FALSE over everything from the opcode to the end of the payload. A reply has the opcode of its request | 0x80 and the
+    same sequence number, and its payload starts with a status byte. Requests can be sent without waiting for the replies to the earlier ones; they
+    are run in order, and the client matches replies up by sequence number. The client must not have more than REMOTE_WINDOW_SIZE bytes of requests
+    in flight, so the server never has more buffered than it can hold while it is busy. The line needs RTS/CTS flow control: the server drops RTS
+    while it runs a request. Numbers are little endian.
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define REMOTE_PROTOCOL_VERSION     1
+
+#define REMOTE_FRAME_SYNC_0         'N'
+#define REMOTE_FRAME_SYNC_1         'V'
+#define REMOTE_FRAME_HEADER_SIZE    6           // Sync, opcode, sequence, length
+#define REMOTE_FRAME_CRC_SIZE       2
+#define REMOTE_MAX_PAYLOAD          4112        // A 4KB block and its header
+#define REMOTE_MAX_FRAME            (REMOTE_FRAME_HEADER_SIZE + REMOTE_MAX_PAYLOAD + REMOTE_FRAME_CRC_SIZE)
+#define REMOTE_MAX_BLOCK_DWORDS     1024        // Most dwords in one block read or write
+#define REMOTE_WINDOW_SIZE          6144        // Most bytes of requests the client can have in flight
+
+#define REMOTE_DEFAULT_BAUD         115200
+
+typedef enum remote_opcode_e
+{
+    // No payload. Reply: version (1), max block dwords (2), NV_PMC_BOOT_0 (4), VRAM size (4)
+    REMOTE_OP_HELLO = 0x01,
+
+    // space (1), offset (4). Reply: value (4)
+    REMOTE_OP_READ32 = 0x02,
+
+    // space (1), offset (4), value (4)
+    REMOTE_OP_WRITE32 = 0x03,
+
+    // space (1), offset (4), count (2). Reply: count dwords
+    REMOTE_OP_READ_BLOCK = 0x04,
+
+    // space (1), offset (4), dwords...
+    REMOTE_OP_WRITE_BLOCK = 0x05,
+
+    // Script source: one REPL command, or a whole script (no terminator). Reply: status only
+    REMOTE_OP_RUN_SCRIPT = 0x06,
+
+    // No payload. The server replies, then stops
+    REMOTE_OP_CLOSE = 0x07,
+
+    REMOTE_OP_REPLY = 0x80,
+
+    // The server's reply to a frame it couldn't use (status BAD_FRAME), with the sequence number it read
+    REMOTE_OP_ERROR = 0xFF,
+} remote_opcode_t;
+
+typedef enum remote_status_e
+{
+    REMOTE_STATUS_OK = 0,
+    REMOTE_STATUS_BAD_FRAME = 1,                // CRC mismatch or too long
+    REMOTE_STATUS_BAD_REQUEST = 2,              // Wrong payload length for the opcode
+    REMOTE_STATUS_UNKNOWN_OPCODE = 3,
+    REMOTE_STATUS_BAD_SPACE = 4,
+    REMOTE_STATUS_OUT_OF_BOUNDS = 5,
+    REMOTE_STATUS_FAILED = 6,                   // The command or script failed
+} remote_status_t;
+
+// Same values as nv_space_t
+typedef enum remote_space_e
+{
+    REMOTE_SPACE_MMIO = 0,
+    REMOTE_SPACE_VRAM = 1,
+    REMOTE_SPACE_RAMIN = 2,
+    REMOTE_SPACE_PCI = 3,
+
+    REMOTE_NUM_SPACES,
+} remote_space_t;
+
+/* CRC-16/CCITT-FALSE. Bitwise, because even a 386 does this faster than 115200 baud can deliver bytes */
+static inline uint16_t Remote_Crc16(uint16_t crc, const uint8_t* data, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++)
+    {
+        crc ^= (uint16_t)data[i] << 8;
+
+        for (uint32_t bit = 0; bit < 8; bit++)
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    }
+
+    return crc;
+}
+
+static inline void Remote_Put16(uint8_t* buf, uint32_t value)
+{
+    buf[0] = value & 0xFF;
+    buf[1] = (value >> 8) & 0xFF;
+}
+
+static inline void Remote_Put32(uint8_t* buf, uint32_t value)
+{
+    buf[0] = value & 0xFF;
+    buf[1] = (value >> 8) & 0xFF;
+    buf[2] = (value >> 16) & 0xFF;
+    buf[3] = (value >> 24) & 0xFF;
+}
+
+static inline uint32_t Remote_Get16(const uint8_t* buf)
+{
+    return buf[0] | (buf[1] << 8);
+}
+
+static inline uint32_t Remote_Get32(const uint8_t* buf)
+{
+    return buf[0] | (buf[1] << 8) | (buf[2] << 16) | ((uint32_t)buf[3] << 24);
+}
+
+/* Build a frame in frame (at least REMOTE_MAX_FRAME bytes). Returns its size */
+static inline uint32_t Remote_BuildFrame(uint8_t* frame, uint8_t opcode, uint8_t sequence, const uint8_t* payload, uint32_t length)
+{
+    frame[0] = REMOTE_FRAME_SYNC_0;
+    frame[1] = REMOTE_FRAME_SYNC_1;
+    frame[2] = opcode;
+    frame[3] = sequence;
+    Remote_Put16(&frame[4], length);
+
+    for (uint32_t i = 0; i < length; i++)
+        frame[REMOTE_FRAME_HEADER_SIZE + i] = payload[i];
+
+    Remote_Put16(&frame[REMOTE_FRAME_HEADER_SIZE + length], Remote_Crc16(0xFFFF, &frame[2], length + 4));
+    return REMOTE_FRAME_HEADER_SIZE + length + REMOTE_FRAME_CRC_SIZE;
+}
+
+/*
+    Frame parser. Feed it one byte at a time; it returns true when a whole frame is in it. crc_ok says whether it can be used.
+    Bytes before the sync are skipped, so it finds the next frame after line noise.
+*/
+typedef struct remote_parser_s
+{
+    uint8_t frame[REMOTE_MAX_FRAME];
+    uint32_t size;                              // Bytes in frame
+    uint32_t length;                            // Payload length from the header
+    bool crc_ok;
+} remote_parser_t;
+
+static inline bool Remote_ParseByte(remote_parser_t* parser, uint8_t byte)
+{
+    if ((parser->size == 0 && byte != REMOTE_FRAME_SYNC_0)
+    || (parser->size == 1 && byte != REMOTE_FRAME_SYNC_1))
+    {
+        parser->size = (byte == REMOTE_FRAME_SYNC_0) ? 1 : 0;
+        return false;
+    }
+
+    parser->frame[parser->size++] = byte;
+
+    if (parser->size == REMOTE_FRAME_HEADER_SIZE)
+    {
+        parser->length = Remote_Get16(&parser->frame[4]);
+
+        // Can't be a real frame. Start looking for the next one
+        if (parser->length > REMOTE_MAX_PAYLOAD)
+        {
+            parser->size = 0;
+            return false;
+        }
+    }
+
+    if (parser->size < REMOTE_FRAME_HEADER_SIZE
+    || parser->size < REMOTE_FRAME_HEADER_SIZE + parser->length + REMOTE_FRAME_CRC_SIZE)
+        return false;
+
+    uint16_t crc = Remote_Crc16(0xFFFF, &parser->frame[2], parser->length + 4);
+
+    parser->crc_ok = (crc == Remote_Get16(&parser->frame[REMOTE_FRAME_HEADER_SIZE + parser->length]));
+    parser->size = 0;
+    return true;
+}
@@ -0,0 +1,132 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    remote_serial.c: Polled serial port for the remote REPL
+
+    This drives the 8250/16550 directly. There are no interrupts: the UART is polled whenever the server isn't doing anything else, and
+    while it is sending, so received bytes go into rx_buffer before the UART's FIFO (16 bytes, or 1 on an 8250) can overflow. While a request runs
+    nothing polls it, so RTS is dropped (Remote_SerialHold) and the client, which uses RTS/CTS flow control, stops sending until it is done. The
+    base address comes from the BIOS data area, so COM ports the BIOS moved around still work. remote_serial_host.c is the same thing over a tty.
+*/
+
+#include <nvplay.h>
+#include "core/remote/remote.h"
+#include "util/util.h"
+
+#include <go32.h>
+#include <pc.h>
+#include <sys/farptr.h>
+
+#define REMOTE_BIOS_COM_PORTS       0x400       // Base address of COM1-COM4 in the BIOS data area
+
+bool Remote_SerialOpen(remote_port_t* port, const char* name, uint32_t baud)
+{
+    uint32_t com_number = 0;
+
+    memset(port, 0, sizeof(remote_port_t));
+
+    if (strncasecmp(name, "COM", 3)
+    || (com_number = strtoul(name + 3, NULL, 10)) < 1
+    || com_number > REMOTE_MAX_PORTS)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "Remote: %s isn't a serial port (COM1-COM%d)\n", name, REMOTE_MAX_PORTS);
+        return false;
+    }
+
+    if (!baud
+    || baud > REMOTE_UART_CLOCK
+    || REMOTE_UART_CLOCK % baud)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "Remote: The UART can't do %lu baud (use 115200 divided by a whole number)\n", baud);
+        return false;
+    }
+
+    port->io_base = _farpeekw(_dos_ds, REMOTE_BIOS_COM_PORTS + ((com_number - 1) << 1));
+
+    if (!port->io_base)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "Remote: The BIOS doesn't know about COM%lu\n", com_number);
+        return false;
+    }
+
+    uint32_t divisor = REMOTE_UART_CLOCK / baud;
+
+    // No interrupts, we poll
+    outportb(port->io_base + UART_IER, 0);
+    outportb(port->io_base + UART_LCR, UART_LCR_DLAB);
+    outportb(port->io_base + UART_DATA, divisor & 0xFF);
+    outportb(port->io_base + UART_IER, (divisor >> 8) & 0xFF);
+    outportb(port->io_base + UART_LCR, UART_LCR_8N1);
+    outportb(port->io_base + UART_FCR, UART_FCR_ENABLE_14);
+    outportb(port->io_base + UART_MCR, UART_MCR_DTR_RTS);
+
+    port->has_fifo = ((inportb(port->io_base + UART_IIR) & UART_IIR_FIFO_MASK) == UART_IIR_FIFO_MASK);
+
+    // Throw away anything left over from before
+    while (inportb(port->io_base + UART_LSR) & UART_LSR_DATA_READY)
+        inportb(port->io_base + UART_DATA);
+
+    Logging_Write(LOG_LEVEL_MESSAGE, "Remote: COM%lu (%03X), %lu baud, 8N1\n", com_number, port->io_base, baud);
+
+    if (!port->has_fifo)
+        Logging_Write(LOG_LEVEL_WARNING, "Remote: COM%lu has no FIFO (not a 16550A). Bytes may be lost at high baud rates\n", com_number);
+
+    return true;
+}
+
+void Remote_SerialClose(remote_port_t* port)
+{
+    if (!port->io_base)
+        return;
+
+    outportb(port->io_base + UART_MCR, 0);
+    outportb(port->io_base + UART_FCR, 0);
+    port->io_base = 0;
+}
+
+/* Move everything the UART has received into rx_buffer */
+void Remote_SerialPoll(remote_port_t* port)
+{
+    uint8_t status;
+
+    while ((status = inportb(port->io_base + UART_LSR)) & UART_LSR_DATA_READY)
+    {
+        if (status & UART_LSR_OVERRUN)
+            port->overruns++;
+
+        Remote_SerialPush(port, inportb(port->io_base + UART_DATA));
+    }
+}
+
+void Remote_SerialWrite(remote_port_t* port, const uint8_t* data, uint32_t size)
+{
+    uint32_t burst_size = port->has_fifo ? UART_FIFO_SIZE : 1;
+    uint32_t written = 0;
+
+    while (written < size)
+    {
+        // Keep receiving while we send, the client may already be sending the next requests
+        Remote_SerialPoll(port);
+
+        if (!(inportb(port->io_base + UART_LSR) & UART_LSR_THR_EMPTY))
+            continue;
+
+        // An empty THR on a 16550A means the whole transmit FIFO is empty
+        for (uint32_t i = 0; i < burst_size && written < size; i++)
+            outportb(port->io_base + UART_DATA, data[written++]);
+    }
+}
+
+/*
+    Drop RTS (hold = true) so the other end stops sending while we're busy, or raise it again. A host UART without automatic CTS handling may
+    still send what is in its transmit FIFO, so whatever has arrived is moved out of ours first to make room for it
+*/
+void Remote_SerialHold(remote_port_t* port, bool hold)
+{
+    outportb(port->io_base + UART_MCR, hold ? UART_MCR_DTR : UART_MCR_DTR_RTS);
+    Remote_SerialPoll(port);
+}
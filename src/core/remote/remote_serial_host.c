@@ -0,0 +1,124 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    remote_serial_host.c: The remote REPL's serial port on a POSIX host
+
+    Not part of the DOS build. The port name is a tty device (a real serial port, or one end of a pty pair), so remote_server.c can be run
+    against tools/nvremote without a DOS machine; tools/nvremote/nvremote_test.c does exactly that. The kernel buffers what arrives, so unlike
+    the UART nothing is lost while a request runs and holding the line is only a poll.
+*/
+
+#include "core/remote/remote.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+static speed_t Remote_SerialSpeed(uint32_t baud)
+{
+    switch (baud)
+    {
+        case 9600:
+            return B9600;
+        case 19200:
+            return B19200;
+        case 38400:
+            return B38400;
+        case 57600:
+            return B57600;
+        case 115200:
+            return B115200;
+        default:
+            return B0;
+    }
+}
+
+bool Remote_SerialOpen(remote_port_t* port, const char* name, uint32_t baud)
+{
+    struct termios settings;
+    speed_t speed = Remote_SerialSpeed(baud);
+
+    memset(port, 0, sizeof(remote_port_t));
+    port->fd = -1;
+
+    if (speed == B0)
+    {
+        fprintf(stderr, "Remote: Unsupported baud rate %u\n", baud);
+        return false;
+    }
+
+    port->fd = open(name, O_RDWR | O_NOCTTY | O_NONBLOCK);
+
+    if (port->fd < 0)
+    {
+        fprintf(stderr, "Remote: Couldn't open %s: %s\n", name, strerror(errno));
+        return false;
+    }
+
+    if (!tcgetattr(port->fd, &settings))
+    {
+        cfmakeraw(&settings);
+        cfsetispeed(&settings, speed);
+        cfsetospeed(&settings, speed);
+        tcsetattr(port->fd, TCSANOW, &settings);
+    }
+
+    return true;
+}
+
+void Remote_SerialClose(remote_port_t* port)
+{
+    if (port->fd < 0)
+        return;
+
+    close(port->fd);
+    port->fd = -1;
+}
+
+/* Move everything the kernel has received into rx_buffer */
+void Remote_SerialPoll(remote_port_t* port)
+{
+    uint8_t buffer[256];
+    ssize_t size;
+
+    while ((size = read(port->fd, buffer, sizeof(buffer))) > 0)
+    {
+        for (ssize_t i = 0; i < size; i++)
+            Remote_SerialPush(port, buffer[i]);
+    }
+}
+
+void Remote_SerialWrite(remote_port_t* port, const uint8_t* data, uint32_t size)
+{
+    while (size)
+    {
+        ssize_t written = write(port->fd, data, size);
+
+        if (written > 0)
+        {
+            data += written;
+            size -= written;
+            continue;
+        }
+
+        if (written < 0
+        && errno != EAGAIN)
+            return;
+
+        // The other end isn't reading. Keep taking what it sends so neither side waits on the other
+        Remote_SerialPoll(port);
+        usleep(1000);
+    }
+}
+
+void Remote_SerialHold(remote_port_t* port, bool hold)
+{
+    Remote_SerialPoll(port);
+}
@@ -0,0 +1,219 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    remote_server.c: Remote REPL over a serial port
+
+    Runs requests from the host (tools/nvremote) until it sends REMOTE_OP_CLOSE or the backend asks to stop. See remote_protocol.h for the
+    frames. Requests are run in the order they arrive; the client pipelines them, so the serial port is never idle waiting for a round trip.
+    RTS is dropped while each one runs, so the requests behind it wait in the client instead of overflowing the UART.
+
+    Only the C library, remote.h and the transport are used here, so this builds on the host for tools/nvremote/nvremote_test.c.
+*/
+
+#include <string.h>
+#include "core/remote/remote.h"
+
+remote_port_t remote_port = {0};
+remote_parser_t remote_parser = {0};
+const remote_backend_t* remote_backend = NULL;
+bool remote_running = false;
+
+// Replies are built here
+uint8_t remote_reply_payload[REMOTE_MAX_PAYLOAD];
+uint8_t remote_reply_frame[REMOTE_MAX_FRAME];
+uint32_t remote_block[REMOTE_MAX_BLOCK_DWORDS];
+
+// Statistics, logged when the server stops
+uint32_t remote_frames = 0;
+uint32_t remote_bad_frames = 0;
+
+/* Take the next received byte. Returns false if there isn't one */
+bool Remote_SerialReadByte(remote_port_t* port, uint8_t* byte)
+{
+    if (port->rx_head == port->rx_tail)
+        Remote_SerialPoll(port);
+
+    if (port->rx_head == port->rx_tail)
+        return false;
+
+    *byte = port->rx_buffer[port->rx_head];
+    port->rx_head = (port->rx_head + 1) & (REMOTE_RX_BUFFER_SIZE - 1);
+    return true;
+}
+
+static void Remote_SendReply(uint8_t opcode, uint8_t sequence, remote_status_t status, const uint8_t* data, uint32_t size)
+{
+    remote_reply_payload[0] = status;
+
+    if (size)
+        memcpy(&remote_reply_payload[1], data, size);
+
+    uint32_t frame_size = Remote_BuildFrame(remote_reply_frame, opcode, sequence, remote_reply_payload, size + 1);
+
+    Remote_SerialWrite(&remote_port, remote_reply_frame, frame_size);
+}
+
+/* Check that count dwords at offset are inside space */
+static remote_status_t Remote_CheckAccess(uint8_t space, uint32_t offset, uint32_t count)
+{
+    uint32_t size = 0;
+
+    if (space >= REMOTE_NUM_SPACES
+    || !remote_backend->space_size(space, &size))
+        return REMOTE_STATUS_BAD_SPACE;
+
+    if ((offset & 3)
+    || !count
+    || count > REMOTE_MAX_BLOCK_DWORDS
+    || offset >= size
+    || count > (size - offset) >> 2)
+        return REMOTE_STATUS_OUT_OF_BOUNDS;
+
+    return REMOTE_STATUS_OK;
+}
+
+static void Remote_HandleFrame()
+{
+    uint8_t opcode = remote_parser.frame[2];
+    uint8_t sequence = remote_parser.frame[3];
+    uint32_t length = remote_parser.length;
+    const uint8_t* payload = &remote_parser.frame[REMOTE_FRAME_HEADER_SIZE];
+    uint8_t reply_opcode = opcode | REMOTE_OP_REPLY;
+    uint8_t data[11];
+    remote_status_t status = REMOTE_STATUS_OK;
+    uint32_t offset = (length >= 5) ? Remote_Get32(&payload[1]) : 0;
+
+    remote_frames++;
+
+    if (!remote_parser.crc_ok)
+    {
+        remote_bad_frames++;
+        Remote_SendReply(REMOTE_OP_ERROR, sequence, REMOTE_STATUS_BAD_FRAME, NULL, 0);
+        return;
+    }
+
+    switch (opcode)
+    {
+        case REMOTE_OP_HELLO:
+            data[0] = REMOTE_PROTOCOL_VERSION;
+            Remote_Put16(&data[1], REMOTE_MAX_BLOCK_DWORDS);
+            Remote_Put32(&data[3], remote_backend->boot_0());
+            Remote_Put32(&data[7], remote_backend->vram_amount());
+            Remote_SendReply(reply_opcode, sequence, REMOTE_STATUS_OK, data, 11);
+            return;
+        case REMOTE_OP_READ32:
+            if (length != 5)
+                break;
+
+            if ((status = Remote_CheckAccess(payload[0], offset, 1)) != REMOTE_STATUS_OK)
+                break;
+
+            remote_backend->read_block(payload[0], offset, remote_block, 1);
+            Remote_Put32(data, remote_block[0]);
+            Remote_SendReply(reply_opcode, sequence, REMOTE_STATUS_OK, data, 4);
+            return;
+        case REMOTE_OP_WRITE32:
+            if (length != 9)
+                break;
+
+            if ((status = Remote_CheckAccess(payload[0], offset, 1)) != REMOTE_STATUS_OK)
+                break;
+
+            remote_block[0] = Remote_Get32(&payload[5]);
+            remote_backend->write_block(payload[0], offset, remote_block, 1);
+            Remote_SendReply(reply_opcode, sequence, REMOTE_STATUS_OK, NULL, 0);
+            return;
+        case REMOTE_OP_READ_BLOCK:
+        {
+            if (length != 7)
+                break;
+
+            uint32_t count = Remote_Get16(&payload[5]);
+
+            if ((status = Remote_CheckAccess(payload[0], offset, count)) != REMOTE_STATUS_OK)
+                break;
+
+            remote_backend->read_block(payload[0], offset, remote_block, count);
+
+            // Into the reply as it is on the wire (little endian), after the status byte
+            for (uint32_t i = 0; i < count; i++)
+                Remote_Put32(&remote_reply_payload[1 + (i << 2)], remote_block[i]);
+
+            remote_reply_payload[0] = REMOTE_STATUS_OK;
+            Remote_SerialWrite(&remote_port, remote_reply_frame,
+                Remote_BuildFrame(remote_reply_frame, reply_opcode, sequence, remote_reply_payload, (count << 2) + 1));
+            return;
+        }
+        case REMOTE_OP_WRITE_BLOCK:
+        {
+            if (length < 9
+            || (length - 5) & 3)
+                break;
+
+            uint32_t count = (length - 5) >> 2;
+
+            if ((status = Remote_CheckAccess(payload[0], offset, count)) != REMOTE_STATUS_OK)
+                break;
+
+            for (uint32_t i = 0; i < count; i++)
+                remote_block[i] = Remote_Get32(&payload[5 + (i << 2)]);
+
+            remote_backend->write_block(payload[0], offset, remote_block, count);
+            Remote_SendReply(reply_opcode, sequence, REMOTE_STATUS_OK, NULL, 0);
+            return;
+        }
+        case REMOTE_OP_RUN_SCRIPT:
+            status = remote_backend->run_script((const char*)payload, length) ? REMOTE_STATUS_OK : REMOTE_STATUS_FAILED;
+            Remote_SendReply(reply_opcode, sequence, status, NULL, 0);
+            return;
+        case REMOTE_OP_CLOSE:
+            Remote_SendReply(reply_opcode, sequence, REMOTE_STATUS_OK, NULL, 0);
+            remote_running = false;
+            return;
+        default:
+            status = REMOTE_STATUS_UNKNOWN_OPCODE;
+            break;
+    }
+
+    // Anything that broke out of the switch had the wrong length, unless it set a status
+    if (status == REMOTE_STATUS_OK)
+        status = REMOTE_STATUS_BAD_REQUEST;
+
+    Remote_SendReply(reply_opcode, sequence, status, NULL, 0);
+}
+
+/* Serve requests on remote_port (already open) until the client closes the connection or backend->stop_requested says to stop */
+void Remote_Run(const remote_backend_t* backend)
+{
+    uint8_t byte = 0;
+
+    memset(&remote_parser, 0, sizeof(remote_parser_t));
+    remote_backend = backend;
+    remote_frames = 0;
+    remote_bad_frames = 0;
+    remote_running = true;
+
+    while (remote_running)
+    {
+        // No sleeping: the UART doesn't interrupt, so waiting for the next timer tick could leave 600 bytes at 115200 baud for a FIFO that holds 16
+        while (remote_running
+        && Remote_SerialReadByte(&remote_port, &byte))
+        {
+            if (!Remote_ParseByte(&remote_parser, byte))
+                continue;
+
+            // Scripts can take a long time, and nothing reads the UART while they run
+            Remote_SerialHold(&remote_port, true);
+            Remote_HandleFrame();
+            Remote_SerialHold(&remote_port, false);
+        }
+
+        if (remote_running
+        && backend->stop_requested())
+            break;
+    }
+}
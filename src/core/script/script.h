@@ -13,6 +13,28 @@
 
 #define AUTOEXEC_FILENAME               "autoexec.nvs"
 #define KEYWORD_SCRIPT                  "MINIMUM_VERSION"
+#define SCRIPT_MAX_ARGS                 8               // Not including the command name
+#define SCRIPT_INITIAL_CAPACITY         64              // Ops allocated for a new program (doubles as it grows)
+#define SCRIPT_HASH_MAX_NAMES           256             // Command names (short + long) the command hash can hold
+#define SCRIPT_HASH_MAX_SEED            65536           // Give up building the command hash after this many tries per bucket
+#define SCRIPT_MAX_VARIABLES            64
+#define SCRIPT_MAX_VARIABLE_NAME        32
+#define SCRIPT_MAX_EXPR_TOKENS          64              // RPN tokens in one compiled expression
+#define SCRIPT_MAX_EXPR_STACK           32
+#define SCRIPT_MAX_NESTING              16              // if/while/for blocks inside each other
+#define SCRIPT_CACHE_EXTENSION          ".nvc"          // Compiled script cache, written next to the source
+#define SCRIPT_CACHE_MAGIC              "NVC\x1A"
+#define SCRIPT_CACHE_FORMAT_VERSION     2               // Bump if the layout of script_cache.c's structures changes
+#define SCRIPT_CACHE_NO_COMMAND         0xFFFFFFFF
+#define SCRIPT_MEMCACHE_SIZE            8               // Compiled scripts kept in memory (script_memcache.c)
+#define SCRIPT_PROFILE_BUCKETS          256             // Hash buckets for profiled lines
+#define SCRIPT_PROFILE_MAX_FILES        32
+#define SCRIPT_PROFILE_MAX_FILE_NAME    64
+#define SCRIPT_PROFILE_REPORT_LINES     20              // Hottest lines logged on exit (all of them go in the CSV)
+#define SCRIPT_PROFILE_CSV_FILE         "nvprof.csv"
+#define SCRIPT_PROFILE_CONSOLE_NAME     "<console>"     // File name used for lines typed into the REPL
+#define SCRIPT_PROFILE_OPTION           "-profile"      // rs file -profile
+#define SCRIPT_MAX_REGISTER_NAME        64              // Including the .VALUE of a field
 
 void NVPlay_RunScript(const char* filename);
 void NVPlay_RunScriptCommand(char* line_buf);
@@ -28,6 +50,172 @@ typedef struct gpu_script_command_s
 
 extern gpu_script_command_t commands[];
 
+//
+// Expressions
+//
+
+typedef enum script_expr_token_type_e
+{
+	SCRIPT_EXPR_CONSTANT = 0,
+	SCRIPT_EXPR_VARIABLE = 1,
+	SCRIPT_EXPR_UNARY = 2,
+	SCRIPT_EXPR_BINARY = 3,
+	SCRIPT_EXPR_READ = 4,								// Register read function, e.g. rm32(addr)
+} script_expr_token_type_t;
+
+typedef struct script_expr_token_s
+{
+	script_expr_token_type_t type;
+	uint32_t value;										// Constant, variable index, operator or read function index
+} script_expr_token_t;
+
+// Compiled to RPN so evaluating it is a single pass with a small stack
+typedef struct script_expr_s
+{
+	uint32_t num_tokens;
+	script_expr_token_t tokens[];						// Allocated to fit
+} script_expr_t;
+
+typedef enum script_variable_type_e
+{
+	SCRIPT_VARIABLE_U32 = 0,
+	SCRIPT_VARIABLE_U16 = 1,
+	SCRIPT_VARIABLE_U8 = 2,
+} script_variable_type_t;
+
+typedef struct script_variable_s
+{
+	char name[SCRIPT_MAX_VARIABLE_NAME];				// Including the $
+	script_variable_type_t type;						// Values are truncated to this on assignment
+	uint32_t value;
+} script_variable_t;
+
+extern script_variable_t script_variables[SCRIPT_MAX_VARIABLES];
+extern uint32_t script_num_variables;
+
+script_expr_t* Script_CompileExpression(const char* str, uint32_t line_number);
+uint32_t Script_Evaluate(script_expr_t* expr);
+int32_t Script_FindVariable(const char* name, bool create);
+void Script_SetVariable(uint32_t variable, uint32_t value);
+
+//
+// Register names (NV3_PGRAPH_DEBUG_0, or NV4_PMC_ENABLE_PFIFO.ENABLED for a field value), replaced by their value when the script is compiled
+//
+
+typedef struct script_register_s
+{
+	const char* name;
+	uint32_t value;
+	uint32_t generation;								// 1, 3 or 4 (NV5 uses NV4's)
+} script_register_t;
+
+extern uint32_t script_register_errors;
+
+uint32_t Script_RegisterGeneration();
+uint32_t Script_RegisterNameLength(const char* str);
+const script_register_t* Script_FindRegister(const char* name, uint32_t length);
+bool Script_ResolveRegister(const char* name, uint32_t length, uint32_t line_number, uint32_t* value);
+
+//
+// Compiled scripts
+//
+
+typedef enum gpu_script_op_type_e
+{
+	SCRIPT_OP_COMMAND = 0,								// Run a command from commands[]
+	SCRIPT_OP_SET = 1,									// variable = exprs[0]
+	SCRIPT_OP_BRANCH_FALSE = 2,							// if/while: go to target if exprs[0] is 0
+	SCRIPT_OP_JUMP = 3,									// else/endwhile: go to target
+	SCRIPT_OP_FOR_CHECK = 4,							// for: go to target if variable >= exprs[0]
+	SCRIPT_OP_FOR_STEP = 5,								// endfor: variable += exprs[0] (or 1), go to target
+	SCRIPT_OP_USER_BATCH = 6,							// wm32s to one USER subchannel, merged by Script_BatchUserWrites
+} gpu_script_op_type_t;
+
+// A single compiled script line. Everything that used to be done every time the line ran (trimming, comment skipping, tokenising, command lookup
+// and hex decoding) is done once, when the script is compiled.
+typedef struct gpu_script_op_s
+{
+	gpu_script_op_type_t type;
+	gpu_script_command_t* command;
+	uint32_t line_number;					// Source line, for errors
+	uint32_t argc;							// Not including the command name
+	const char* argv[SCRIPT_MAX_ARGS + 1];	// argv[0] is the command name. Points into line_storage
+	uint32_t argv_hex[SCRIPT_MAX_ARGS + 1];	// Each argument pre-decoded as hex, or decimal after a # (0 if it isn't a number)
+	script_expr_t* exprs[SCRIPT_MAX_ARGS + 1];	// Arguments that are expressions ($var or (...)), evaluated into argv_hex when the op runs
+	bool has_exprs;
+	uint32_t variable;						// SET/FOR_CHECK/FOR_STEP
+	uint32_t target;						// Op to go to for branches
+	uint32_t batch_count;					// USER_BATCH: methods in the batch
+	uint32_t* batch_methods;				// USER_BATCH: method offsets within the subchannel in argv_hex[1]
+	uint32_t* batch_values;					// USER_BATCH: value for each method
+	char* line_storage;						// Tokenised copy of the source line
+} gpu_script_op_t;
+
+typedef struct gpu_script_block_s
+{
+	const char* keyword;					// if/else/while/for
+	uint32_t op;							// The op that opened the block
+} gpu_script_block_t;
+
+typedef struct gpu_script_program_s
+{
+	const char* filename;					// NULL for the REPL
+	uint32_t num_ops;
+	uint32_t capacity;
+	gpu_script_op_t* ops;
+
+	// Compile time only
+	uint32_t block_depth;
+	gpu_script_block_t blocks[SCRIPT_MAX_NESTING];
+} gpu_script_program_t;
+
+gpu_script_command_t* Script_FindCommand(const char* name);
+gpu_script_op_t* Script_AllocOp(gpu_script_program_t* program, uint32_t line_number);
+void Script_FreeOp(gpu_script_op_t* op);
+bool Script_CompileSource(const char* filename, const char* source, uint32_t source_size, gpu_script_program_t* program, uint32_t* version);
+bool Script_CompileFile(const char* filename, gpu_script_program_t* program);
+bool Script_CompileLine(gpu_script_program_t* program, const char* line_buf, uint32_t line_number);
+bool Script_FinishCompile(gpu_script_program_t* program);
+void Script_BatchUserWrites(gpu_script_program_t* program);
+bool Script_Execute(gpu_script_program_t* program);
+void Script_Free(gpu_script_program_t* program);
+
+uint32_t Script_HashData(const uint8_t* data, uint32_t size);
+bool Script_SaveCache(const char* filename, gpu_script_program_t* program, uint32_t source_hash, uint32_t source_size, uint32_t* min_version);
+bool Script_LoadCache(const char* filename, gpu_script_program_t* program, uint32_t source_hash, uint32_t source_size, uint32_t* min_version);
+
+gpu_script_program_t* Script_AcquireProgram(const char* filename);
+void Script_ReleaseProgram(gpu_script_program_t* program);
+void Script_LogMemcacheStatistics();
+void Script_FreeMemcache();
+
+// Counter values taken around one op while profiling. command_end is 0 if the op didn't run a command
+typedef struct script_profile_sample_s
+{
+	uint64_t start;
+	uint64_t io;
+	uint64_t log;
+	uint64_t command_start;
+	uint64_t command_io;
+	uint64_t command_log;
+	uint64_t command_end;
+	uint64_t command_end_io;
+	uint64_t command_end_log;
+} script_profile_sample_t;
+
+void Script_ProfileEnable();
+void Script_ProfileCompile(const char* filename, uint64_t ticks);
+int32_t* Script_ProfileResolve(gpu_script_program_t* program);
+void Script_ProfileBegin(script_profile_sample_t* sample);
+void Script_ProfileCommandBegin(script_profile_sample_t* sample);
+void Script_ProfileCommandEnd(script_profile_sample_t* sample);
+void Script_ProfileEnd(int32_t entry, script_profile_sample_t* sample);
+void Script_ProfileReport();
+
 /* Command utility stuff */
 const char* Command_Argv(uint32_t argv);
+uint32_t Command_ArgHex(uint32_t argv);
 uint32_t Command_Argc();
+bool Command_MMIOBoundsCheck(uint32_t addr);
+bool Command_VRAMBoundsCheck(uint32_t addr);
+bool Command_WriteMMIO32();
@@ -0,0 +1,432 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    script_cache.c: On-disk cache of compiled scripts (.nvc)
+
+    A compiled program is written next to its source (autoexec.nvs -> autoexec.nvc). It is only reused if the hash and size of the source, the build
+    number, the script's MINIMUM_VERSION and the GPU generation register names were resolved for all match, so there is nothing to invalidate by
+    hand. Commands are stored as their index in commands[] (fine, since a different build never uses the file) and variables by name, because
+    variable numbers depend on what has run before.
+*/
+
+#include "core/script/script.h"
+#include "util/util.h"
+#include <nvplay.h>
+#include <cmake/nvplay_version.h>
+
+typedef struct script_cache_header_s
+{
+	char magic[4];
+	uint32_t format_version;
+	uint32_t app_build;
+	uint32_t source_hash;
+	uint32_t source_size;
+	uint32_t min_version[3];					// MINIMUM_VERSION of the script (0.0.0 if it doesn't have one)
+	uint32_t register_generation;				// Register names were resolved for this generation of GPU
+	uint32_t num_variables;
+	uint32_t num_ops;
+} script_cache_header_t;
+
+typedef struct script_cache_variable_s
+{
+	char name[SCRIPT_MAX_VARIABLE_NAME];
+	uint32_t type;
+} script_cache_variable_t;
+
+// The parts of an op that aren't pointers
+typedef struct script_cache_op_s
+{
+	uint32_t type;
+	uint32_t command;							// Index into commands[], SCRIPT_CACHE_NO_COMMAND if none
+	uint32_t line_number;
+	uint32_t argc;
+	uint32_t variable;							// Index into the variable list in the file
+	uint32_t target;
+	uint32_t expr_mask;							// Bit n set = exprs[n] follows
+	uint32_t line_storage_size;
+	uint32_t argv_offsets[SCRIPT_MAX_ARGS + 1];	// Into line_storage
+	uint32_t argv_hex[SCRIPT_MAX_ARGS + 1];
+} script_cache_op_t;
+
+// FNV-1a over the whole source
+uint32_t Script_HashData(const uint8_t* data, uint32_t size)
+{
+	uint32_t hash = 0x811C9DC5;
+
+	for (uint32_t i = 0; i < size; i++)
+	{
+		hash ^= data[i];
+		hash *= 0x01000193;
+	}
+
+	return hash;
+}
+
+// autoexec.nvs -> autoexec.nvc
+void Script_GetCacheFileName(const char* filename, char* cache_filename, uint32_t max)
+{
+	strncpy(cache_filename, filename, max - 1);
+	cache_filename[max - 1] = '\0';
+
+	char* extension = strrchr(cache_filename, '.');
+	char* separator = strrchr(cache_filename, '\\');
+	char* separator_unix = strrchr(cache_filename, '/');
+
+	if (separator_unix > separator)
+		separator = separator_unix;
+
+	// Don't mistake a dot in a directory name for the extension
+	if (extension
+	&& (!separator || extension > separator))
+		*extension = '\0';
+
+	if (strlen(cache_filename) + strlen(SCRIPT_CACHE_EXTENSION) < max)
+		strcat(cache_filename, SCRIPT_CACHE_EXTENSION);
+}
+
+bool Script_WriteCacheExpr(FILE* stream, script_expr_t* expr)
+{
+	return fwrite(&expr->num_tokens, sizeof(uint32_t), 1, stream) == 1
+	&& fwrite(expr->tokens, sizeof(script_expr_token_t), expr->num_tokens, stream) == expr->num_tokens;
+}
+
+script_expr_t* Script_ReadCacheExpr(FILE* stream)
+{
+	uint32_t num_tokens = 0;
+
+	if (fread(&num_tokens, sizeof(uint32_t), 1, stream) != 1
+	|| num_tokens > SCRIPT_MAX_EXPR_TOKENS)
+		return NULL;
+
+	script_expr_t* expr = malloc(sizeof(script_expr_t) + num_tokens * sizeof(script_expr_token_t));
+
+	if (!expr)
+		return NULL;
+
+	expr->num_tokens = num_tokens;
+
+	if (fread(expr->tokens, sizeof(script_expr_token_t), num_tokens, stream) != num_tokens)
+	{
+		free(expr);
+		return NULL;
+	}
+
+	return expr;
+}
+
+// Calls function on every variable number used by the op, so both directions of the variable mapping can share one walk
+void Script_ForEachCacheVariable(gpu_script_op_t* op, void (*function)(uint32_t* variable, void* context), void* context)
+{
+	if (op->type == SCRIPT_OP_SET
+	|| op->type == SCRIPT_OP_FOR_CHECK
+	|| op->type == SCRIPT_OP_FOR_STEP)
+		function(&op->variable, context);
+
+	for (uint32_t i = 0; i <= SCRIPT_MAX_ARGS; i++)
+	{
+		if (!op->exprs[i])
+			continue;
+
+		for (uint32_t token = 0; token < op->exprs[i]->num_tokens; token++)
+		{
+			if (op->exprs[i]->tokens[token].type == SCRIPT_EXPR_VARIABLE)
+				function(&op->exprs[i]->tokens[token].value, context);
+		}
+	}
+}
+
+typedef struct script_cache_variable_map_s
+{
+	int32_t map[SCRIPT_MAX_VARIABLES];			// Global variable -> file variable when saving, file variable -> global variable when loading
+	uint32_t num_variables;
+	bool valid;
+} script_cache_variable_map_t;
+
+void Script_CacheCollectVariable(uint32_t* variable, void* context)
+{
+	script_cache_variable_map_t* map = (script_cache_variable_map_t*)context;
+
+	if (map->map[*variable] < 0)
+		map->map[*variable] = map->num_variables++;
+}
+
+void Script_CacheRemapVariable(uint32_t* variable, void* context)
+{
+	script_cache_variable_map_t* map = (script_cache_variable_map_t*)context;
+
+	if (*variable >= map->num_variables)
+	{
+		map->valid = false;
+		return;
+	}
+
+	*variable = map->map[*variable];
+}
+
+/* Write a compiled program to the cache. Failing is not an error, it just means the script gets compiled again next time */
+bool Script_SaveCache(const char* filename, gpu_script_program_t* program, uint32_t source_hash, uint32_t source_size, uint32_t* min_version)
+{
+	char cache_filename[MAX_STR] = {0};
+	script_cache_variable_map_t map = {0};
+
+	Script_GetCacheFileName(filename, cache_filename, MAX_STR);
+
+	// Only the variables this script uses go in the file, renumbered from 0
+	memset(map.map, 0xFF, sizeof(map.map));
+
+	for (uint32_t op_id = 0; op_id < program->num_ops; op_id++)
+		Script_ForEachCacheVariable(&program->ops[op_id], Script_CacheCollectVariable, &map);
+
+	FILE* stream = fopen(cache_filename, "wb");
+
+	if (!stream)
+	{
+		Logging_WriteTo(LOG_CHANNEL_SCRIPT, LOG_LEVEL_DEBUG, "Couldn't write script cache %s (read-only disk?)\n", cache_filename);
+		return false;
+	}
+
+	script_cache_header_t header = {0};
+
+	memcpy(header.magic, SCRIPT_CACHE_MAGIC, sizeof(header.magic));
+	header.format_version = SCRIPT_CACHE_FORMAT_VERSION;
+	header.app_build = APP_BUILD;
+	header.source_hash = source_hash;
+	header.source_size = source_size;
+	memcpy(header.min_version, min_version, sizeof(header.min_version));
+	header.register_generation = Script_RegisterGeneration();
+	header.num_variables = map.num_variables;
+	header.num_ops = program->num_ops;
+
+	// Variables in file order, so the loader can index them directly
+	script_cache_variable_t cache_variables[SCRIPT_MAX_VARIABLES] = {0};
+
+	for (uint32_t variable = 0; variable < SCRIPT_MAX_VARIABLES; variable++)
+	{
+		if (map.map[variable] < 0)
+			continue;
+
+		strncpy(cache_variables[map.map[variable]].name, script_variables[variable].name, SCRIPT_MAX_VARIABLE_NAME - 1);
+		cache_variables[map.map[variable]].type = script_variables[variable].type;
+	}
+
+	bool success = (fwrite(&header, sizeof(header), 1, stream) == 1)
+	&& fwrite(cache_variables, sizeof(script_cache_variable_t), map.num_variables, stream) == map.num_variables;
+
+	for (uint32_t op_id = 0; op_id < program->num_ops && success; op_id++)
+	{
+		gpu_script_op_t* op = &program->ops[op_id];
+		script_cache_op_t cache_op = {0};
+
+		cache_op.type = op->type;
+		cache_op.command = op->command ? (uint32_t)(op->command - commands) : SCRIPT_CACHE_NO_COMMAND;
+		cache_op.line_number = op->line_number;
+		cache_op.argc = op->argc;
+		cache_op.variable = (map.map[op->variable] >= 0) ? (uint32_t)map.map[op->variable] : 0;
+		cache_op.target = op->target;
+
+		// Tokenising left NULs all through line_storage, so work out its size from the last token
+		if (op->line_storage)
+		{
+			for (uint32_t i = 0; i <= op->argc; i++)
+				cache_op.argv_offsets[i] = op->argv[i] - op->line_storage;
+
+			cache_op.line_storage_size = cache_op.argv_offsets[op->argc] + strlen(op->argv[op->argc]) + 1;
+		}
+
+		memcpy(cache_op.argv_hex, op->argv_hex, sizeof(cache_op.argv_hex));
+
+		for (uint32_t i = 0; i <= SCRIPT_MAX_ARGS; i++)
+		{
+			if (op->exprs[i])
+				cache_op.expr_mask |= (1 << i);
+		}
+
+		success = (fwrite(&cache_op, sizeof(cache_op), 1, stream) == 1)
+		&& fwrite(op->line_storage, 1, cache_op.line_storage_size, stream) == cache_op.line_storage_size;
+
+		for (uint32_t i = 0; i <= SCRIPT_MAX_ARGS && success; i++)
+		{
+			if (!op->exprs[i])
+				continue;
+
+			// Written with file variable numbers
+			uint32_t expr_size = sizeof(script_expr_t) + op->exprs[i]->num_tokens * sizeof(script_expr_token_t);
+			script_expr_t* expr = malloc(expr_size);
+
+			if (!expr)
+			{
+				success = false;
+				break;
+			}
+
+			memcpy(expr, op->exprs[i], expr_size);
+
+			for (uint32_t token = 0; token < expr->num_tokens; token++)
+			{
+				if (expr->tokens[token].type == SCRIPT_EXPR_VARIABLE)
+					expr->tokens[token].value = map.map[expr->tokens[token].value];
+			}
+
+			success = Script_WriteCacheExpr(stream, expr);
+			free(expr);
+		}
+	}
+
+	fclose(stream);
+
+	if (!success)
+	{
+		Logging_WriteTo(LOG_CHANNEL_SCRIPT, LOG_LEVEL_DEBUG, "Failed writing script cache %s\n", cache_filename);
+		remove(cache_filename);
+		return false;
+	}
+
+	Logging_WriteTo(LOG_CHANNEL_SCRIPT, LOG_LEVEL_DEBUG, "Wrote script cache %s (%lu ops)\n", cache_filename, program->num_ops);
+	return true;
+}
+
+/* Load a compiled program if there is a cache for this exact source. min_version is filled in from the cache so the caller can check it */
+bool Script_LoadCache(const char* filename, gpu_script_program_t* program, uint32_t source_hash, uint32_t source_size, uint32_t* min_version)
+{
+	char cache_filename[MAX_STR] = {0};
+	script_cache_header_t header = {0};
+
+	Script_GetCacheFileName(filename, cache_filename, MAX_STR);
+
+	FILE* stream = fopen(cache_filename, "rb");
+
+	if (!stream)
+		return false;
+
+	if (fread(&header, sizeof(header), 1, stream) != 1
+	|| memcmp(header.magic, SCRIPT_CACHE_MAGIC, sizeof(header.magic))
+	|| header.format_version != SCRIPT_CACHE_FORMAT_VERSION
+	|| header.app_build != APP_BUILD
+	|| header.source_hash != source_hash
+	|| header.source_size != source_size
+	|| header.register_generation != Script_RegisterGeneration()
+	|| header.num_variables > SCRIPT_MAX_VARIABLES)
+	{
+		Logging_WriteTo(LOG_CHANNEL_SCRIPT, LOG_LEVEL_DEBUG, "Script cache %s is out of date\n", cache_filename);
+		fclose(stream);
+		return false;
+	}
+
+	memset(program, 0, sizeof(gpu_script_program_t));
+	memcpy(min_version, header.min_version, sizeof(header.min_version));
+
+	script_cache_variable_map_t map = {0};
+	map.num_variables = header.num_variables;
+	map.valid = true;
+
+	for (uint32_t variable = 0; variable < header.num_variables; variable++)
+	{
+		script_cache_variable_t cache_variable = {0};
+
+		if (fread(&cache_variable, sizeof(cache_variable), 1, stream) != 1)
+		{
+			fclose(stream);
+			return false;
+		}
+
+		cache_variable.name[SCRIPT_MAX_VARIABLE_NAME - 1] = '\0';
+		map.map[variable] = Script_FindVariable(cache_variable.name, true);
+
+		if (map.map[variable] < 0)
+		{
+			fclose(stream);
+			return false;
+		}
+
+		script_variables[map.map[variable]].type = cache_variable.type;
+	}
+
+	uint32_t num_commands = 0;
+
+	while (commands[num_commands].name_abbrev)
+		num_commands++;
+
+	bool success = true;
+
+	for (uint32_t op_id = 0; op_id < header.num_ops && success; op_id++)
+	{
+		script_cache_op_t cache_op = {0};
+
+		success = (fread(&cache_op, sizeof(cache_op), 1, stream) == 1)
+		&& cache_op.type <= SCRIPT_OP_FOR_STEP
+		&& cache_op.argc <= SCRIPT_MAX_ARGS
+		&& cache_op.line_storage_size < MAX_STR
+		&& (cache_op.command == SCRIPT_CACHE_NO_COMMAND || cache_op.command < num_commands);
+
+		if (!success)
+			break;
+
+		gpu_script_op_t* op = Script_AllocOp(program, cache_op.line_number);
+
+		if (!op)
+		{
+			success = false;
+			break;
+		}
+
+		// Counted straight away so Script_Free cleans up a half-loaded op too
+		program->num_ops++;
+
+		op->type = cache_op.type;
+		op->command = (cache_op.command != SCRIPT_CACHE_NO_COMMAND) ? &commands[cache_op.command] : NULL;
+		op->argc = cache_op.argc;
+		op->variable = cache_op.variable;
+		op->target = cache_op.target;
+		op->has_exprs = (op->type == SCRIPT_OP_COMMAND && cache_op.expr_mask);
+		memcpy(op->argv_hex, cache_op.argv_hex, sizeof(op->argv_hex));
+
+		if (cache_op.line_storage_size)
+		{
+			op->line_storage = malloc(cache_op.line_storage_size);
+
+			if (!op->line_storage
+			|| fread(op->line_storage, 1, cache_op.line_storage_size, stream) != cache_op.line_storage_size)
+			{
+				success = false;
+				break;
+			}
+
+			op->line_storage[cache_op.line_storage_size - 1] = '\0';
+
+			for (uint32_t i = 0; i <= op->argc; i++)
+				op->argv[i] = op->line_storage + (cache_op.argv_offsets[i] % cache_op.line_storage_size);
+		}
+
+		for (uint32_t i = 0; i <= SCRIPT_MAX_ARGS && success; i++)
+		{
+			if (!(cache_op.expr_mask & (1 << i)))
+				continue;
+
+			op->exprs[i] = Script_ReadCacheExpr(stream);
+			success = (op->exprs[i] != NULL);
+		}
+
+		if (success)
+			Script_ForEachCacheVariable(op, Script_CacheRemapVariable, &map);
+
+		success = success
+		&& map.valid
+		&& (op->type != SCRIPT_OP_COMMAND || op->command);
+	}
+
+	fclose(stream);
+
+	if (!success)
+	{
+		Logging_Write(LOG_LEVEL_WARNING, "Script cache %s is damaged, recompiling\n", cache_filename);
+		Script_Free(program);
+		return false;
+	}
+
+	Logging_WriteTo(LOG_CHANNEL_SCRIPT, LOG_LEVEL_DEBUG, "Loaded script cache %s (%lu ops)\n", cache_filename, program->num_ops);
+	return true;
+}
@@ -7,8 +7,8 @@
 
     gpu_script_commands.c: Implements the commands for the GPUScript parser
     Currently a basic command system with no real lexer or parser.
-    Basically, you can't read anything because that would require somewhere to put i.e. variables = a full interpreted language. Not yet. So the stopgap is that we at least allow to print to the console (which doesn't have any side effects requiring a variable system)
-    Although I might add a basic variable system to read to one of 10 variables as an intermediate step
+    Reads into variables, expressions and control flow live in script_expr.c and script_compiler.c. The *console read commands here are for
+    printing; use set $x rm32(offset) etc. to read without logging.
     
     HEX notation only. Because it's easier...
 */
@@ -20,6 +20,8 @@
 #include <architecture/nvidia/nv3/nv3_ref.h>
 #include <architecture/nvidia/nv4/nv4.h>
 #include "core/gpu/gpu.h"
+#include "core/gpu/gpu_repl.h"
+#include "core/remote/remote.h"
 #include "core/script/script.h"
 #include "script.h"
 #include "util/util.h"
@@ -30,10 +32,9 @@
 #define MSG_OUT_OF_BOUNDS           "Error: Address %lx out of bounds!\n"
 #define MSG_OUT_OF_BOUNDS_RANGE     "Error: Address %lx-%lx range is at least partially out of bounds!\n"
 
-// bad
-char** cmd_endptr;
+extern gpu_script_op_t* current_op;
 
-/* We don't implement these checks inside the NV_* functions because these functions need to be as fast as possible */
+/* We don't implement these checks inside the NV_* functions because these functions need to be as fast as possible. Returns true if addr is in bounds */
 bool Command_MMIOBoundsCheck(uint32_t addr)
 {
     uint32_t mmio_max = 0;
@@ -43,19 +44,18 @@ bool Command_MMIOBoundsCheck(uint32_t addr)
     else
         mmio_max = NV4_MMIO_SIZE;
 
-    return (addr >= mmio_max);
-
+    return (addr < mmio_max);
 }
 
 bool Command_VRAMBoundsCheck(uint32_t addr)
 {
-    return (addr >= current_device.vram_amount);
+    return (addr < current_device.vram_amount);
 }
 
 bool Command_WriteMMIO8()
 {
-    uint32_t offset = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t value = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint32_t offset = Command_ArgHex(1);
+    uint32_t value = Command_ArgHex(2);
 
     if (!Command_MMIOBoundsCheck(offset))
     {
@@ -69,9 +69,9 @@ bool Command_WriteMMIO8()
 
 bool Command_WriteMMIORange8()
 {
-    uint32_t offset_start = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t offset_end = strtol(Command_Argv(2), cmd_endptr, 16);
-    uint32_t value = strtol(Command_Argv(3), cmd_endptr, 16);
+    uint32_t offset_start = Command_ArgHex(1);
+    uint32_t offset_end = Command_ArgHex(2);
+    uint32_t value = Command_ArgHex(3);
 
     if (!Command_MMIOBoundsCheck(offset_start)
     || !Command_MMIOBoundsCheck(offset_end))
@@ -89,8 +89,7 @@ bool Command_WriteMMIORange8()
 
 bool Command_ReadMMIOConsole8()
 {
-    uint32_t offset = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t value = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint32_t offset = Command_ArgHex(1);
 
     if (!Command_MMIOBoundsCheck(offset))
     {
@@ -98,6 +97,8 @@ bool Command_ReadMMIOConsole8()
         return false; 
     }
 
+    uint8_t value = NV_ReadMMIO8(offset);
+
     Logging_Write(LOG_LEVEL_MESSAGE, "Command_ReadMMIOConsole8: %02x = %02x\n", offset, value);
     return true; 
 }
@@ -105,8 +106,8 @@ bool Command_ReadMMIOConsole8()
 
 bool Command_WriteMMIO32()
 {
-    uint32_t offset = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t value = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint32_t offset = Command_ArgHex(1);
+    uint32_t value = Command_ArgHex(2);
 
     if (!Command_MMIOBoundsCheck(offset))
     {
@@ -114,7 +115,7 @@ bool Command_WriteMMIO32()
         return false; 
     }
      
-    Logging_Write(LOG_LEVEL_DEBUG, "Command_WriteMMIO32 %s:%08x %s:%08x\n", Command_Argv(1), offset, Command_Argv(2), value);
+    Logging_WriteTo(LOG_CHANNEL_SCRIPT, LOG_LEVEL_DEBUG, "Command_WriteMMIO32 %s:%08x %s:%08x\n", Command_Argv(1), offset, Command_Argv(2), value);
 
     NV_WriteMMIO32(offset, value);
     return true; 
@@ -122,7 +123,7 @@ bool Command_WriteMMIO32()
 
 bool Command_ReadMMIOConsole32()
 {
-    uint32_t offset = strtol(Command_Argv(1), cmd_endptr, 16);
+    uint32_t offset = Command_ArgHex(1);
     uint32_t value = NV_ReadMMIO32(offset);
 
     if (!Command_MMIOBoundsCheck(offset))
@@ -137,9 +138,9 @@ bool Command_ReadMMIOConsole32()
 
 bool Command_WriteMMIORange32()
 {
-    uint32_t offset_start = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t offset_end = strtol(Command_Argv(2), cmd_endptr, 16);
-    uint32_t value = strtol(Command_Argv(3), cmd_endptr, 16);
+    uint32_t offset_start = Command_ArgHex(1);
+    uint32_t offset_end = Command_ArgHex(2);
+    uint32_t value = Command_ArgHex(3);
 
     if (!Command_MMIOBoundsCheck(offset_start)
     || !Command_MMIOBoundsCheck(offset_end))
@@ -157,8 +158,8 @@ bool Command_WriteMMIORange32()
 
 bool Command_WriteVRAM8()
 {
-    uint32_t offset = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t value = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint32_t offset = Command_ArgHex(1);
+    uint32_t value = Command_ArgHex(2);
 
     if (!Command_VRAMBoundsCheck(offset))
     {
@@ -172,9 +173,9 @@ bool Command_WriteVRAM8()
 
 bool Command_WriteVRAMRange8()
 {
-    uint32_t offset_start = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t offset_end = strtol(Command_Argv(2), cmd_endptr, 16);
-    uint32_t value = strtol(Command_Argv(3), cmd_endptr, 16);
+    uint32_t offset_start = Command_ArgHex(1);
+    uint32_t offset_end = Command_ArgHex(2);
+    uint32_t value = Command_ArgHex(3);
 
     if (!Command_VRAMBoundsCheck(offset_start)
     || !Command_VRAMBoundsCheck(offset_end))
@@ -192,7 +193,7 @@ bool Command_WriteVRAMRange8()
 
 bool Command_ReadVRAMConsole8()
 {
-    uint32_t offset = strtol(Command_Argv(1), cmd_endptr, 16);
+    uint32_t offset = Command_ArgHex(1);
 
     if (!Command_VRAMBoundsCheck(offset))
     {
@@ -208,8 +209,8 @@ bool Command_ReadVRAMConsole8()
 
 bool Command_WriteVRAM16()
 {
-    uint32_t offset = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t value = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint32_t offset = Command_ArgHex(1);
+    uint32_t value = Command_ArgHex(2);
 
     if (!Command_VRAMBoundsCheck(offset))
     {
@@ -223,9 +224,9 @@ bool Command_WriteVRAM16()
 
 bool Command_WriteVRAMRange16()
 {
-    uint32_t offset_start = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t offset_end = strtol(Command_Argv(2), cmd_endptr, 16);
-    uint32_t value = strtol(Command_Argv(3), cmd_endptr, 16);
+    uint32_t offset_start = Command_ArgHex(1);
+    uint32_t offset_end = Command_ArgHex(2);
+    uint32_t value = Command_ArgHex(3);
 
     if (!Command_VRAMBoundsCheck(offset_start)
     || !Command_VRAMBoundsCheck(offset_end))
@@ -243,7 +244,7 @@ bool Command_WriteVRAMRange16()
 
 bool Command_ReadVRAMConsole16()
 {
-    uint32_t offset = strtol(Command_Argv(1), cmd_endptr, 16);
+    uint32_t offset = Command_ArgHex(1);
 
     if (!Command_VRAMBoundsCheck(offset))
     {
@@ -259,8 +260,8 @@ bool Command_ReadVRAMConsole16()
 
 bool Command_WriteVRAM32()
 {   
-    uint32_t offset = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t value = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint32_t offset = Command_ArgHex(1);
+    uint32_t value = Command_ArgHex(2);
 
     if (!Command_VRAMBoundsCheck(offset))
     {
@@ -274,9 +275,9 @@ bool Command_WriteVRAM32()
 
 bool Command_WriteVRAMRange32()
 {
-    uint32_t offset_start = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t offset_end = strtol(Command_Argv(2), cmd_endptr, 16);
-    uint32_t value = strtol(Command_Argv(3), cmd_endptr, 16);
+    uint32_t offset_start = Command_ArgHex(1);
+    uint32_t offset_end = Command_ArgHex(2);
+    uint32_t value = Command_ArgHex(3);
 
     if (!Command_VRAMBoundsCheck(offset_start)
     || !Command_VRAMBoundsCheck(offset_end))
@@ -294,7 +295,7 @@ bool Command_WriteVRAMRange32()
 
 bool Command_ReadVRAMConsole32()
 {
-    uint32_t offset = strtol(Command_Argv(1), cmd_endptr, 16);
+    uint32_t offset = Command_ArgHex(1);
 
     if (!Command_VRAMBoundsCheck(offset))
     {
@@ -310,8 +311,8 @@ bool Command_ReadVRAMConsole32()
 
 bool Command_WriteRamin32()
 {
-    uint32_t offset = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t value = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint32_t offset = Command_ArgHex(1);
+    uint32_t value = Command_ArgHex(2);
 
     NV_WriteRamin32(offset, value);
 
@@ -320,9 +321,9 @@ bool Command_WriteRamin32()
 
 bool Command_WriteRaminRange32()
 {
-    uint32_t offset_start = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t offset_end = strtol(Command_Argv(2), cmd_endptr, 16);
-    uint32_t value = strtol(Command_Argv(3), cmd_endptr, 16);
+    uint32_t offset_start = Command_ArgHex(1);
+    uint32_t offset_end = Command_ArgHex(2);
+    uint32_t value = Command_ArgHex(3);
 
     for (uint32_t offset = offset_start; offset < offset_end; offset += 4)
         NV_WriteRamin32(offset, value);
@@ -332,7 +333,7 @@ bool Command_WriteRaminRange32()
 
 bool Command_ReadRaminConsole32()
 {
-    uint32_t offset = strtol(Command_Argv(1), cmd_endptr, 16);
+    uint32_t offset = Command_ArgHex(1);
     uint32_t value = NV_ReadRamin32(offset);
 
     Logging_Write(LOG_LEVEL_MESSAGE, "Command_ReadRaminConsole32: %08x = %08x\n", offset, value);
@@ -341,8 +342,8 @@ bool Command_ReadRaminConsole32()
 
 bool Command_WritePCI8()
 {
-    uint32_t offset = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t value = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint32_t offset = Command_ArgHex(1);
+    uint32_t value = Command_ArgHex(2);
 
     PCI_WriteConfig8(current_device.bus_info.bus_number, current_device.bus_info.function_number, offset, value);
     return true; 
@@ -350,9 +351,9 @@ bool Command_WritePCI8()
 
 bool Command_WritePCIRange8()
 {
-    uint32_t offset_start = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t offset_end = strtol(Command_Argv(2), cmd_endptr, 16);
-    uint32_t value = strtol(Command_Argv(3), cmd_endptr, 16);
+    uint32_t offset_start = Command_ArgHex(1);
+    uint32_t offset_end = Command_ArgHex(2);
+    uint32_t value = Command_ArgHex(3);
 
     for (uint32_t offset = offset_start; offset < offset_end; offset++)
         PCI_WriteConfig8(current_device.bus_info.bus_number, current_device.bus_info.function_number, offset, value);
@@ -362,7 +363,7 @@ bool Command_WritePCIRange8()
 
 bool Command_ReadPCIConsole8()
 {
-    uint32_t offset = strtol(Command_Argv(1), cmd_endptr, 16);
+    uint32_t offset = Command_ArgHex(1);
     uint8_t value = PCI_ReadConfig8(current_device.bus_info.bus_number, current_device.bus_info.function_number, offset);
 
     Logging_Write(LOG_LEVEL_MESSAGE, "Command_ReadPCIConsole8: %03x = %02x\n", offset, value);
@@ -371,8 +372,8 @@ bool Command_ReadPCIConsole8()
 
 bool Command_WritePCI16()
 {
-    uint32_t offset = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t value = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint32_t offset = Command_ArgHex(1);
+    uint32_t value = Command_ArgHex(2);
 
     PCI_WriteConfig16(current_device.bus_info.bus_number, current_device.bus_info.function_number, offset, value);
     return true; 
@@ -380,9 +381,9 @@ bool Command_WritePCI16()
 
 bool Command_WritePCIRange16()
 {
-    uint32_t offset_start = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t offset_end = strtol(Command_Argv(2), cmd_endptr, 16);
-    uint32_t value = strtol(Command_Argv(3), cmd_endptr, 16);
+    uint32_t offset_start = Command_ArgHex(1);
+    uint32_t offset_end = Command_ArgHex(2);
+    uint32_t value = Command_ArgHex(3);
 
     for (uint32_t offset = offset_start; offset < offset_end; offset += 2)
         PCI_WriteConfig16(current_device.bus_info.bus_number, current_device.bus_info.function_number, offset, value);
@@ -392,7 +393,7 @@ bool Command_WritePCIRange16()
 
 bool Command_ReadPCIConsole16()
 {
-    uint32_t offset = strtol(Command_Argv(1), cmd_endptr, 16);
+    uint32_t offset = Command_ArgHex(1);
     uint16_t value = PCI_ReadConfig16(current_device.bus_info.bus_number, current_device.bus_info.function_number, offset);
 
     Logging_Write(LOG_LEVEL_MESSAGE, "Command_ReadPCIConsole16: %04x = %04x\n", offset, value);
@@ -401,8 +402,8 @@ bool Command_ReadPCIConsole16()
 
 bool Command_WritePCI32()
 {   
-    uint32_t offset = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t value = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint32_t offset = Command_ArgHex(1);
+    uint32_t value = Command_ArgHex(2);
 
     PCI_WriteConfig32(current_device.bus_info.bus_number, current_device.bus_info.function_number, offset, value);
 
@@ -411,9 +412,9 @@ bool Command_WritePCI32()
 
 bool Command_WritePCIRange32()
 {
-    uint32_t offset_start = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t offset_end = strtol(Command_Argv(2), cmd_endptr, 16);
-    uint32_t value = strtol(Command_Argv(3), cmd_endptr, 16);
+    uint32_t offset_start = Command_ArgHex(1);
+    uint32_t offset_end = Command_ArgHex(2);
+    uint32_t value = Command_ArgHex(3);
 
     for (uint32_t offset = offset_start; offset < offset_end; offset += 4)
         PCI_WriteConfig32(current_device.bus_info.bus_number, current_device.bus_info.function_number, offset, value);
@@ -423,7 +424,7 @@ bool Command_WritePCIRange32()
 
 bool Command_ReadPCIConsole32()
 {
-    uint32_t offset = strtol(Command_Argv(1), cmd_endptr, 16);
+    uint32_t offset = Command_ArgHex(1);
     uint32_t value = PCI_ReadConfig32(current_device.bus_info.bus_number, current_device.bus_info.function_number, offset);
 
     Logging_Write(LOG_LEVEL_MESSAGE, "Command_ReadPCIConsole32: %08x = %08x\n", offset, value);
@@ -433,7 +434,7 @@ bool Command_ReadPCIConsole32()
 // Read a single CRTC register and print it to the console.
 bool Command_ReadCrtcConsole()
 {
-    uint32_t index = strtol(Command_Argv(1), cmd_endptr, 16);
+    uint32_t index = Command_ArgHex(1);
 
     if (index > NV3_CRTC_REGISTER_NVIDIA_END)  
     {
@@ -450,7 +451,7 @@ bool Command_ReadCrtcConsole()
 // Write a CRTC register.
 bool Command_WriteCrtc()
 {
-    uint32_t index = strtol(Command_Argv(1), cmd_endptr, 16);
+    uint32_t index = Command_ArgHex(1);
 
     if (index > NV3_CRTC_REGISTER_NVIDIA_END)  
     {
@@ -458,7 +459,7 @@ bool Command_WriteCrtc()
         return false; 
     }
 
-    uint32_t value = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint32_t value = Command_ArgHex(2);
 
     VGA_WriteCRTC(index, value);
     return true; 
@@ -467,8 +468,8 @@ bool Command_WriteCrtc()
 // Write a range of CRTC registers.
 bool Command_WriteCrtcRange()
 {
-    uint32_t index_start = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t index_end = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint32_t index_start = Command_ArgHex(1);
+    uint32_t index_end = Command_ArgHex(2);
 
     if (index_start > NV3_CRTC_REGISTER_NVIDIA_END
         || index_end > NV3_CRTC_REGISTER_NVIDIA_END)  
@@ -477,7 +478,7 @@ bool Command_WriteCrtcRange()
         return false; 
     }
 
-    uint32_t value = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint32_t value = Command_ArgHex(3);
 
     for (uint32_t index = index_start; index < index_end; index++)
         VGA_WriteCRTC(index, value);
@@ -488,7 +489,7 @@ bool Command_WriteCrtcRange()
 // Read a single CRTC register and print it to the console.
 bool Command_ReadSRConsole()
 {
-    uint32_t index = strtol(Command_Argv(1), cmd_endptr, 16);
+    uint32_t index = Command_ArgHex(1);
 
     if (index > NV3_PRMVIO_SR_INDEX_END)  
     {
@@ -505,7 +506,7 @@ bool Command_ReadSRConsole()
 // Write a CRTC register.
 bool Command_WriteSR()
 {
-    uint32_t index = strtol(Command_Argv(1), cmd_endptr, 16);
+    uint32_t index = Command_ArgHex(1);
 
     if (index > NV3_PRMVIO_SR_INDEX_END)  
     {
@@ -513,7 +514,7 @@ bool Command_WriteSR()
         return false; 
     }
 
-    uint32_t value = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint32_t value = Command_ArgHex(2);
 
     VGA_WriteSequencer(index, value);
     return true; 
@@ -522,8 +523,8 @@ bool Command_WriteSR()
 // Write a range of CRTC registers.
 bool Command_WriteSRRange()
 {
-    uint32_t index_start = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t index_end = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint32_t index_start = Command_ArgHex(1);
+    uint32_t index_end = Command_ArgHex(2);
 
     // uint, can't be below 0
     if (index_start > NV3_PRMVIO_SR_INDEX_END
@@ -532,7 +533,7 @@ bool Command_WriteSRRange()
         Logging_Write(LOG_LEVEL_WARNING, "Command_WriteSRRange: Ignoring invalid indexes [range is 0-%d]\n", index_start, NV3_PRMVIO_SR_INDEX_END);
     }
 
-    uint32_t value = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint32_t value = Command_ArgHex(3);
 
     for (uint32_t index = index_start; index < index_end; index++)
         VGA_WriteSequencer(index, value);
@@ -543,7 +544,7 @@ bool Command_WriteSRRange()
 // Read a single CRTC register and print it to the console.
 bool Command_ReadGRConsole()
 {
-    uint32_t index = strtol(Command_Argv(1), cmd_endptr, 16);
+    uint32_t index = Command_ArgHex(1);
 
     if (index > NV3_PRMVIO_GR_INDEX_END)  
     {
@@ -560,7 +561,7 @@ bool Command_ReadGRConsole()
 // Write a VGA graphics  register.
 bool Command_WriteGR()
 {
-    uint32_t index = strtol(Command_Argv(1), cmd_endptr, 16);
+    uint32_t index = Command_ArgHex(1);
 
     if (index > NV3_PRMVIO_GR_INDEX_END)  
     {
@@ -568,7 +569,7 @@ bool Command_WriteGR()
         return false; 
     }
 
-    uint32_t value = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint32_t value = Command_ArgHex(2);
 
     VGA_WriteGraphics(index, value);
     return true; 
@@ -577,8 +578,8 @@ bool Command_WriteGR()
 // Write a range of VGA graphics registers.
 bool Command_WriteGRRange()
 {
-    uint32_t index_start = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t index_end = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint32_t index_start = Command_ArgHex(1);
+    uint32_t index_end = Command_ArgHex(2);
 
     // uint, can't be below 0
     if (index_start > NV3_PRMVIO_GR_INDEX_END
@@ -588,7 +589,7 @@ bool Command_WriteGRRange()
         return false; 
     }
 
-    uint32_t value = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint32_t value = Command_ArgHex(3);
 
     for (uint32_t index = index_start; index < index_end; index++)
         VGA_WriteGraphics(index, value);
@@ -600,7 +601,7 @@ bool Command_WriteGRRange()
 // Read a single CRTC register and print it to the console.
 bool Command_ReadARConsole()
 {
-    uint32_t index = strtol(Command_Argv(1), cmd_endptr, 16);
+    uint32_t index = Command_ArgHex(1);
 
     if (index > NV3_PRMVIO_AR_INDEX_END)  
     {
@@ -617,7 +618,7 @@ bool Command_ReadARConsole()
 // Write a VGA attribute register.
 bool Command_WriteAR()
 {
-    uint32_t index = strtol(Command_Argv(1), cmd_endptr, 16);
+    uint32_t index = Command_ArgHex(1);
 
     if (index > NV3_PRMVIO_AR_INDEX_END)  
     {
@@ -625,7 +626,7 @@ bool Command_WriteAR()
         return false; 
     }
 
-    uint32_t value = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint32_t value = Command_ArgHex(2);
 
     VGA_WriteAttribute(index, value);
     return true; 
@@ -634,8 +635,8 @@ bool Command_WriteAR()
 // Write a range of VGA attribute registers.
 bool Command_WriteARRange()
 {
-    uint32_t index_start = strtol(Command_Argv(1), cmd_endptr, 16);
-    uint32_t index_end = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint32_t index_start = Command_ArgHex(1);
+    uint32_t index_end = Command_ArgHex(2);
 
     // uint, can't be below 0
     if (index_start > NV3_PRMVIO_AR_INDEX_END
@@ -645,7 +646,7 @@ bool Command_WriteARRange()
         return false; 
     }
 
-    uint32_t value = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint32_t value = Command_ArgHex(3);
 
     for (uint32_t index = index_start; index < index_end; index++)
         VGA_WriteAttribute(index, value);
@@ -669,7 +670,7 @@ bool Command_NV3Explode()
         uint32_t pme_debug_0 = NV_ReadMMIO32(NV3_PME_DEBUG_0);
         NV_WriteMMIO32(NV3_PME_INTR, 0x11111111);
 
-        Logging_Write(LOG_LEVEL_DEBUG, "Mediaport is alive (NV3Explode succeeded) NV3_PME_DEBUG_0=%08x\n", pme_debug_0);
+        Logging_WriteTo(LOG_CHANNEL_SCRIPT, LOG_LEVEL_DEBUG, "Mediaport is alive (NV3Explode succeeded) NV3_PME_DEBUG_0=%08x\n", pme_debug_0);
     }
 
     return true; 
@@ -679,6 +680,10 @@ bool Command_RunTest()
 {
     const char* test_name = Command_Argv(1);
 
+    // Tests go straight to the hardware
+    if (NV_ShadowRefuse(test_name))
+        return false;
+
     nv_config_test_entry_t* test_entry = Test_Get(test_name);
 
     if (test_entry)
@@ -692,8 +697,13 @@ bool Command_RunTest()
     return false; //shutup compiler even though this line cannot be reached under any circumstances
 }
 
+// rs file -profile turns the profiler on first (it stays on until exit)
 bool Command_RunScript()
 {
+    if (Command_Argc() >= 2
+    && !strcasecmp(Command_Argv(2), SCRIPT_PROFILE_OPTION))
+        Script_ProfileEnable();
+
     NVPlay_RunScript(Command_Argv(1));
     return true; 
 }
@@ -708,7 +718,7 @@ bool Command_Print()
 // Prints a message on debug builds only.
 bool Command_PrintDebug()
 {
-    Logging_Write(LOG_LEVEL_DEBUG, Command_Argv(1));
+    Logging_WriteTo(LOG_CHANNEL_SCRIPT, LOG_LEVEL_DEBUG, Command_Argv(1));
     return true; 
 }
 
@@ -726,12 +736,200 @@ bool Command_PrintError()
     return true; 
 }
 
+bool Command_LoadVRAM()
+{
+    return NV_LoadFileVRAM(Command_Argv(1), Command_ArgHex(2));
+}
+
+bool Command_LoadRamin()
+{
+    return NV_LoadFileRamin(Command_Argv(1), Command_ArgHex(2));
+}
+
+bool Command_SaveVRAM()
+{
+    return NV_SaveFileVRAM(Command_Argv(1), Command_ArgHex(2), Command_ArgHex(3));
+}
+
+/* waitfor offset mask value timeout_us. Fails the line if it times out, so that scripts don't carry on with the GPU in the wrong state */
+bool Command_WaitFor()
+{
+    uint32_t offset = Command_ArgHex(1);
+    uint32_t mask = Command_ArgHex(2);
+    uint32_t value = Command_ArgHex(3);
+    uint32_t timeout_us = Command_ArgHex(4);
+    uint32_t elapsed_us = 0;
+    char site_name[NV_WAIT_MAX_SITE_NAME] = {0};
+
+    if (!Command_MMIOBoundsCheck(offset))
+    {
+        Logging_Write(LOG_LEVEL_ERROR, MSG_OUT_OF_BOUNDS, offset);
+        return false; 
+    }
+
+    // Each script line is its own call site
+    snprintf(site_name, NV_WAIT_MAX_SITE_NAME, "Script line %lu (%06lX)", current_op ? current_op->line_number : 0, offset);
+
+    bool success = NV_WaitMMIO32(site_name, offset, mask, value, timeout_us, &elapsed_us);
+
+    if (success)
+        Logging_Event(LOG_EVENT_SCRIPT_WAIT_DONE, offset, mask, value, elapsed_us);
+
+    return success;
+}
+
+/* Parse [space] offset starting at parameter first. Returns the number of parameters used, or 0 (and logs why) if the register can't be watched */
+uint32_t Command_WatchParseTarget(uint32_t first, watch_space_t* space, uint32_t* offset)
+{
+    uint32_t used = 1;
+
+    *space = WATCH_SPACE_MMIO;
+
+    if (NVPlay_WatchParseSpace(Command_Argv(first), space))
+    {
+        if (Command_Argc() < first + 1)
+        {
+            Logging_Write(LOG_LEVEL_ERROR, "No offset given for %s\n", Command_Argv(first));
+            return 0;
+        }
+
+        first++;
+        used++;
+    }
+
+    *offset = Command_ArgHex(first);
+
+    switch (*space)
+    {
+        case WATCH_SPACE_MMIO:
+            if (!Command_MMIOBoundsCheck(*offset))
+            {
+                Logging_Write(LOG_LEVEL_ERROR, MSG_OUT_OF_BOUNDS, *offset);
+                return 0;
+            }
+            break;
+        case WATCH_SPACE_RAMIN:
+        {
+            uint16_t selector = 0;
+            uint32_t base = 0, size = 0;
+
+            if (!NV_GetRaminMapping(&selector, &base, &size))
+                return 0;
+
+            if (*offset > size - 4)
+            {
+                Logging_Write(LOG_LEVEL_ERROR, MSG_OUT_OF_BOUNDS, *offset);
+                return 0;
+            }
+            break;
+        }
+        case WATCH_SPACE_PCI:
+            if (*offset > 0xFC)
+            {
+                Logging_Write(LOG_LEVEL_ERROR, MSG_OUT_OF_BOUNDS, *offset);
+                return 0;
+            }
+            break;
+        default:
+            if (*offset > 0xFF)
+            {
+                Logging_Write(LOG_LEVEL_ERROR, "Error: VGA index %lx out of bounds!\n", *offset);
+                return 0;
+            }
+            return used;
+    }
+
+    if (*offset & 3)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "Error: Can only watch dwords, %lx isn't aligned\n", *offset);
+        return 0;
+    }
+
+    return used;
+}
+
+bool Command_Watch()
+{
+    watch_space_t space = WATCH_SPACE_MMIO;
+    uint32_t offset = 0;
+    uint32_t used = Command_WatchParseTarget(1, &space, &offset);
+
+    if (!used)
+        return false;
+
+    const char* name = Command_Argv(used);
+    uint32_t interval_ms = (Command_Argc() > used) ? Command_ArgHex(used + 1) : 0;
+
+    // Only label it with the name if one was typed, not e.g. a variable
+    if (Script_RegisterNameLength(name) != strlen(name))
+        name = NULL;
+
+    return NVPlay_WatchAdd(space, offset, name, interval_ms);
+}
+
+bool Command_Unwatch()
+{
+    watch_space_t space = WATCH_SPACE_MMIO;
+    uint32_t offset = 0;
+
+    if (!Command_Argc())
+    {
+        NVPlay_WatchClear();
+        return true;
+    }
+
+    if (!Command_WatchParseTarget(1, &space, &offset))
+        return false;
+
+    return NVPlay_WatchRemove(space, offset);
+}
+
+bool Command_HexEdit()
+{
+    nv_space_t space = NV_SPACE_MMIO;
+    uint32_t offset_arg = 1;
+
+    if (Command_Argc() >= 1
+    && NV_ParseSpace(Command_Argv(1), &space))
+        offset_arg++;
+
+    uint32_t offset = (Command_Argc() >= offset_arg) ? Command_ArgHex(offset_arg) : 0;
+
+    return NVPlay_HexEdit(space, offset);
+}
+
+bool Command_Remote()
+{
+    uint32_t baud = (Command_Argc() >= 2) ? Remote_ParseBaud(Command_Argv(2)) : REMOTE_DEFAULT_BAUD;
+
+    return Remote_Serve(Command_Argv(1), baud);
+}
+
+// Prints the value of each parameter. Mostly useful for variables and expressions ($x, ($x & 0xFF))
+bool Command_PrintVariable()
+{
+    for (uint32_t i = 1; i <= Command_Argc(); i++)
+        Logging_Write(LOG_LEVEL_MESSAGE, "%s = %08lX\n", Command_Argv(i), Command_ArgHex(i));
+
+    return true; 
+}
+
 bool Command_PrintVersion()
 {
    	Logging_Write(LOG_LEVEL_MESSAGE, APP_SIGNON_STRING);
     return true; 
 }
 
+// logsync 1 writes every log line to disk as it's logged, logsync 0 goes back to buffering
+bool Command_LogSync()
+{
+    if (Command_Argc() >= 1)
+        Logging_SetSynchronous(Command_ArgHex(1) != 0);
+
+    Logging_Write(LOG_LEVEL_MESSAGE, "Log file: %s\n", log_settings.flush_on_line ? "every line written immediately" : "buffered");
+    return true;
+}
+
 //
 // Super dangerous commands that will explode your computer
 //
@@ -744,7 +942,7 @@ bool Command_Intx86()
 
 bool Command_IOx86Read8()
 {
-    uint8_t index = (uint8_t)strtol(Command_Argv(1), cmd_endptr, 16) & 0xFF;
+    uint8_t index = (uint8_t)Command_ArgHex(1) & 0xFF;
     uint8_t value = inportb(index);
 
     Logging_Write(LOG_LEVEL_MESSAGE, "Command_IOx86Read8: %08x <- port %08x\n", value, index);
@@ -754,7 +952,7 @@ bool Command_IOx86Read8()
 
 bool Command_IOx86Read16()
 {
-    uint16_t index = (uint16_t)strtol(Command_Argv(1), cmd_endptr, 16) & 0xFFFF;
+    uint16_t index = (uint16_t)Command_ArgHex(1) & 0xFFFF;
     uint16_t value = inportw(index);
     
     Logging_Write(LOG_LEVEL_MESSAGE, "Command_IOx86Read16: %08x <- port %08x\n", value, index);
@@ -764,7 +962,7 @@ bool Command_IOx86Read16()
 
 bool Command_IOx86Read32()
 {
-    uint16_t index = (uint16_t)strtol(Command_Argv(1), cmd_endptr, 16) & 0xFFFF; // limited to 64kb
+    uint16_t index = (uint16_t)Command_ArgHex(1) & 0xFFFF; // limited to 64kb
     uint32_t value = inportl(index);
 
     Logging_Write(LOG_LEVEL_MESSAGE, "Command_IOx86Read32: %08x <- port %08x\n", value, index);
@@ -774,8 +972,8 @@ bool Command_IOx86Read32()
 
 bool Command_IOx86Write8()
 {
-    uint8_t index = (uint8_t)strtol(Command_Argv(1), cmd_endptr, 16) & 0xFF;
-    uint8_t value = (uint8_t)strtol(Command_Argv(2), cmd_endptr, 16) & 0xFF;
+    uint8_t index = (uint8_t)Command_ArgHex(1) & 0xFF;
+    uint8_t value = (uint8_t)Command_ArgHex(2) & 0xFF;
 
     outportb(index, value);
 
@@ -785,8 +983,8 @@ bool Command_IOx86Write8()
 
 bool Command_IOx86Write16()
 {
-    uint16_t index = (uint16_t)strtol(Command_Argv(1), cmd_endptr, 16) & 0xFFFF;
-    uint16_t value = (uint16_t)strtol(Command_Argv(2), cmd_endptr, 16) & 0xFFFF;
+    uint16_t index = (uint16_t)Command_ArgHex(1) & 0xFFFF;
+    uint16_t value = (uint16_t)Command_ArgHex(2) & 0xFFFF;
 
     outportw(index, value);
 
@@ -796,8 +994,8 @@ bool Command_IOx86Write16()
 
 bool Command_IOx86Write32()
 {
-    uint16_t index = (uint16_t)strtol(Command_Argv(1), cmd_endptr, 16) & 0xFFFF; // limited to 64kb
-    uint32_t value = strtol(Command_Argv(2), cmd_endptr, 16);
+    uint16_t index = (uint16_t)Command_ArgHex(1) & 0xFFFF; // limited to 64kb
+    uint32_t value = Command_ArgHex(2);
 
     outportl(index, value);
 
@@ -809,8 +1007,8 @@ bool Command_IOx86Write32()
 gpu_script_command_t commands[] =
 {    
     { "wm8", "writemmio8", Command_WriteMMIO8, 2 },
-    { "rmc8", "readmmioconsole8", Command_ReadMMIOConsole8, 3 },
-    { "wmrange8", "writemmiorange8", Command_WriteMMIORange8, 2 },
+    { "rmc8", "readmmioconsole8", Command_ReadMMIOConsole8, 1 },
+    { "wmrange8", "writemmiorange8", Command_WriteMMIORange8, 3 },
     { "wm32", "writemmio32", Command_WriteMMIO32, 2},
     { "wmrange32", "writemmiorange32", Command_WriteMMIORange32, 3 },
     { "rmc32", "readmmioconsole32", Command_ReadMMIOConsole32, 1 },
@@ -833,7 +1031,7 @@ gpu_script_command_t commands[] =
     { "rpc32", "readpciconsole32", Command_ReadPCIConsole32, 1 },
     { "wprange32", "writepcirange32", Command_WritePCIRange32, 3 },
     { "wr32", "writeramin32", Command_WriteRamin32, 2 },
-    { "rrc32", "readraminconsole32", Command_ReadRaminConsole32 },
+    { "rrc32", "readraminconsole32", Command_ReadRaminConsole32, 1 },
     { "wrrange32", "writeraminrange32", Command_WriteRaminRange32, 3 },
     { "rcrtcc", "readcrtcconsole", Command_ReadCrtcConsole, 1 },
     { "wcrtc", "writecrtc", Command_WriteCrtc, 2 },
@@ -855,6 +1053,16 @@ gpu_script_command_t commands[] =
     { "printwarning", "printwarning", Command_PrintWarning, 1 },
     { "printerror", "printerror", Command_PrintError, 1 },
     { "printversion", "printversion", Command_PrintVersion, 0 },
+    { "logsync", "logsync", Command_LogSync, 0 },
+    { "pv", "printvar", Command_PrintVariable, 1 },
+    { "waitfor", "waitfor", Command_WaitFor, 4 },
+    { "watch", "watch", Command_Watch, 1 },
+    { "unwatch", "unwatch", Command_Unwatch, 0 },
+    { "he", "hexedit", Command_HexEdit, 0 },
+    { "remote", "remote", Command_Remote, 1 },
+    { "lv", "loadvram", Command_LoadVRAM, 2 },
+    { "lr", "loadramin", Command_LoadRamin, 2 },
+    { "sv", "savevram", Command_SaveVRAM, 3 },
     
     // These commands are even riskier than the previous commands.
     { "int", "intx86", Command_Intx86, 1 }, 
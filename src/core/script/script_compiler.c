@@ -0,0 +1,863 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    script_compiler.c: Compiles scripts into a list of ops and executes them
+
+    Every line is trimmed, tokenised, looked up (see script_hash.c) and has its arguments decoded exactly once. Comments, blank lines and the
+    MINIMUM_VERSION line never make it into the program, so executing a script is just a loop over function pointers.
+*/
+
+#include "core/script/script.h"
+#include "util/util.h"
+#include <nvplay.h>
+#include <cmake/nvplay_version.h>
+
+/* The op the running command gets its arguments from */
+gpu_script_op_t* current_op = NULL;
+
+// Returns false if the line is a comment or blank
+bool Script_IsCode(const char* line_buf)
+{
+	while (isspace((unsigned char)*line_buf))
+		line_buf++;
+
+	if (!*line_buf)
+		return false;
+
+	return !(line_buf[0] == '/' && line_buf[1] == '/');
+}
+
+// Get a new op at the end of the program. Returns NULL if out of memory. The pointer is only valid until the next call
+gpu_script_op_t* Script_AllocOp(gpu_script_program_t* program, uint32_t line_number)
+{
+	if (program->num_ops >= program->capacity)
+	{
+		uint32_t new_capacity = program->capacity ? program->capacity << 1 : SCRIPT_INITIAL_CAPACITY;
+		gpu_script_op_t* new_ops = realloc(program->ops, new_capacity * sizeof(gpu_script_op_t));
+
+		if (!new_ops)
+		{
+			Logging_Write(LOG_LEVEL_ERROR, "Out of memory compiling script line %lu\n", line_number);
+			return NULL;
+		}
+
+		program->ops = new_ops;
+		program->capacity = new_capacity;
+	}
+
+	gpu_script_op_t* op = &program->ops[program->num_ops];
+	memset(op, 0, sizeof(gpu_script_op_t));
+
+	op->line_number = line_number;
+	return op;
+}
+
+// Free whatever a (possibly half-compiled) op owns
+void Script_FreeOp(gpu_script_op_t* op)
+{
+	for (uint32_t i = 0; i <= SCRIPT_MAX_ARGS; i++)
+		free(op->exprs[i]);
+
+	// batch_values is part of the same allocation
+	free(op->batch_methods);
+
+	free(op->line_storage);
+	memset(op, 0, sizeof(gpu_script_op_t));
+}
+
+// Everything after the first skip_tokens tokens of the original line, for keywords that take a whole expression
+const char* Script_LineRemainder(const char* line_buf, uint32_t skip_tokens)
+{
+	for (uint32_t i = 0; i < skip_tokens; i++)
+	{
+		while (isspace((unsigned char)*line_buf))
+			line_buf++;
+
+		while (*line_buf && !isspace((unsigned char)*line_buf))
+			line_buf++;
+	}
+
+	return line_buf;
+}
+
+bool Script_PushBlock(gpu_script_program_t* program, const char* keyword, uint32_t op_id, uint32_t line_number)
+{
+	if (program->block_depth >= SCRIPT_MAX_NESTING)
+	{
+		Logging_Write(LOG_LEVEL_ERROR, "Line %lu: Blocks nested too deeply (max %d)\n", line_number, SCRIPT_MAX_NESTING);
+		return false;
+	}
+
+	program->blocks[program->block_depth].keyword = keyword;
+	program->blocks[program->block_depth].op = op_id;
+	program->block_depth++;
+	return true;
+}
+
+// Returns the block on top of the stack if it was opened by one of the given keywords, otherwise NULL
+gpu_script_block_t* Script_TopBlock(gpu_script_program_t* program, const char* keyword, const char* keyword_alt, const char* closer, uint32_t line_number)
+{
+	if (program->block_depth)
+	{
+		gpu_script_block_t* block = &program->blocks[program->block_depth - 1];
+
+		if (!strcmp(block->keyword, keyword)
+		|| (keyword_alt && !strcmp(block->keyword, keyword_alt)))
+			return block;
+	}
+
+	Logging_Write(LOG_LEVEL_ERROR, "Line %lu: %s without %s\n", line_number, closer, keyword);
+	return NULL;
+}
+
+int32_t Script_CompileVariableName(const char* name, uint32_t line_number)
+{
+	if (!name
+	|| name[0] != '$'
+	|| !name[1])
+	{
+		Logging_Write(LOG_LEVEL_ERROR, "Line %lu: Expected a variable name ($name)\n", line_number);
+		return -1;
+	}
+
+	return Script_FindVariable(name, true);
+}
+
+/*
+	Control flow and variables. op has already been tokenised. Returns false if the line was not a keyword, otherwise sets success.
+
+	var $name [u8/u16/u32]		declare a variable with a type (values are truncated to it)
+	set $name expr				assign
+	if expr / else / endif
+	while expr / endwhile
+	for $name start end [step] / endfor		counted loop, end is exclusive
+*/
+bool Script_CompileKeyword(gpu_script_program_t* program, gpu_script_op_t* op, const char* line_buf, bool* success)
+{
+	const char* keyword = op->argv[0];
+	uint32_t line_number = op->line_number;
+	uint32_t op_id = program->num_ops;
+	bool adds_op = true;
+
+	*success = false;
+
+	if (!strcasecmp(keyword, "var"))
+	{
+		int32_t variable = Script_CompileVariableName(op->argv[1], line_number);
+
+		if (variable < 0)
+			return true;
+
+		const char* type = (op->argc >= 2) ? op->argv[2] : "u32";
+
+		if (!strcasecmp(type, "u8"))
+			script_variables[variable].type = SCRIPT_VARIABLE_U8;
+		else if (!strcasecmp(type, "u16"))
+			script_variables[variable].type = SCRIPT_VARIABLE_U16;
+		else if (!strcasecmp(type, "u32"))
+			script_variables[variable].type = SCRIPT_VARIABLE_U32;
+		else
+		{
+			Logging_Write(LOG_LEVEL_ERROR, "Line %lu: Unknown type %s (must be u8, u16 or u32)\n", line_number, type);
+			return true;
+		}
+
+		// Declarations don't need an op
+		Script_FreeOp(op);
+		adds_op = false;
+		*success = true;
+	}
+	else if (!strcasecmp(keyword, "set"))
+	{
+		int32_t variable = Script_CompileVariableName(op->argv[1], line_number);
+
+		if (variable < 0)
+			return true;
+
+		op->type = SCRIPT_OP_SET;
+		op->variable = variable;
+		op->exprs[0] = Script_CompileExpression(Script_LineRemainder(line_buf, 2), line_number);
+
+		*success = (op->exprs[0] != NULL);
+	}
+	else if (!strcasecmp(keyword, "if")
+	|| !strcasecmp(keyword, "while"))
+	{
+		op->type = SCRIPT_OP_BRANCH_FALSE;
+		op->exprs[0] = Script_CompileExpression(Script_LineRemainder(line_buf, 1), line_number);
+
+		*success = (op->exprs[0] != NULL)
+		&& Script_PushBlock(program, !strcasecmp(keyword, "if") ? "if" : "while", op_id, line_number);
+	}
+	else if (!strcasecmp(keyword, "else"))
+	{
+		gpu_script_block_t* block = Script_TopBlock(program, "if", NULL, "else", line_number);
+
+		if (!block)
+			return true;
+
+		// the if skips to just after this op, and this op skips over the else part when the if part ran
+		op->type = SCRIPT_OP_JUMP;
+		program->ops[block->op].target = op_id + 1;
+
+		block->keyword = "else";
+		block->op = op_id;
+		*success = true;
+	}
+	else if (!strcasecmp(keyword, "endif"))
+	{
+		gpu_script_block_t* block = Script_TopBlock(program, "if", "else", "endif", line_number);
+
+		if (!block)
+			return true;
+
+		program->ops[block->op].target = op_id;
+		program->block_depth--;
+
+		Script_FreeOp(op);
+		adds_op = false;
+		*success = true;
+	}
+	else if (!strcasecmp(keyword, "endwhile"))
+	{
+		gpu_script_block_t* block = Script_TopBlock(program, "while", NULL, "endwhile", line_number);
+
+		if (!block)
+			return true;
+
+		op->type = SCRIPT_OP_JUMP;
+		op->target = block->op;
+		program->ops[block->op].target = op_id + 1;
+		program->block_depth--;
+		*success = true;
+	}
+	else if (!strcasecmp(keyword, "for"))
+	{
+		if (op->argc < 3)
+		{
+			Logging_Write(LOG_LEVEL_ERROR, "Line %lu: for needs a variable, start and end\n", line_number);
+			return true;
+		}
+
+		int32_t variable = Script_CompileVariableName(op->argv[1], line_number);
+
+		if (variable < 0)
+			return true;
+
+		// This op sets the start value, a second op checks the end
+		op->type = SCRIPT_OP_SET;
+		op->variable = variable;
+		op->exprs[0] = Script_CompileExpression(op->argv[2], line_number);
+
+		script_expr_t* end = Script_CompileExpression(op->argv[3], line_number);
+		script_expr_t* step = (op->argc >= 4) ? Script_CompileExpression(op->argv[4], line_number) : NULL;
+
+		if (!op->exprs[0] || !end
+		|| (op->argc >= 4 && !step))
+		{
+			free(end);
+			free(step);
+			return true;
+		}
+
+		program->num_ops++;
+
+		gpu_script_op_t* check_op = Script_AllocOp(program, line_number);
+
+		if (!check_op)
+		{
+			free(end);
+			free(step);
+			return true;
+		}
+
+		// endfor takes the step expression from here
+		check_op->type = SCRIPT_OP_FOR_CHECK;
+		check_op->variable = variable;
+		check_op->exprs[0] = end;
+		check_op->exprs[1] = step;
+
+		*success = Script_PushBlock(program, "for", op_id + 1, line_number);
+	}
+	else if (!strcasecmp(keyword, "endfor"))
+	{
+		gpu_script_block_t* block = Script_TopBlock(program, "for", NULL, "endfor", line_number);
+
+		if (!block)
+			return true;
+
+		gpu_script_op_t* check_op = &program->ops[block->op];
+
+		op->type = SCRIPT_OP_FOR_STEP;
+		op->variable = check_op->variable;
+		op->exprs[0] = check_op->exprs[1];
+		op->target = block->op;
+
+		check_op->exprs[1] = NULL;
+		check_op->target = op_id + 1;
+		program->block_depth--;
+		*success = true;
+	}
+	else
+		return false;
+
+	// Keywords that compiled to an op (for has already added its first one)
+	if (*success
+	&& adds_op)
+		program->num_ops++;
+
+	return true;
+}
+
+// Compile a single line and append it to the program. Comments and blank lines compile to nothing.
+bool Script_CompileLine(gpu_script_program_t* program, const char* line_buf, uint32_t line_number)
+{
+	if (!Script_IsCode(line_buf))
+		return true;
+
+	gpu_script_op_t* op = Script_AllocOp(program, line_number);
+
+	if (!op)
+		return false;
+
+	op->line_storage = strdup(line_buf);
+
+	if (!op->line_storage)
+	{
+		Logging_Write(LOG_LEVEL_ERROR, "Out of memory compiling script line %lu\n", line_number);
+		return false;
+	}
+
+	// Split on whitespace in place (except inside brackets, so expressions can have spaces). This also gets rid of the trailing newline
+	uint32_t num_tokens = 0;
+	bool too_many_tokens = false;
+	char* str = op->line_storage;
+
+	while (*str)
+	{
+		while (isspace((unsigned char)*str))
+			*str++ = '\0';
+
+		if (!*str)
+			break;
+
+		// set/if/while take the rest of the line as one expression, so only warn about this for commands (below)
+		if (num_tokens > SCRIPT_MAX_ARGS)
+		{
+			too_many_tokens = true;
+			break;
+		}
+
+		// Numbers are hex unless they start with #, the same as in expressions
+		op->argv[num_tokens] = str;
+
+		if (*str == '#')
+			op->argv_hex[num_tokens] = (uint32_t)strtoul(str + 1, NULL, 10);
+		else
+			op->argv_hex[num_tokens] = (uint32_t)strtoul(str, NULL, 16);
+
+		num_tokens++;
+
+		int32_t depth = 0;
+
+		while (*str && (depth > 0 || !isspace((unsigned char)*str)))
+		{
+			if (*str == '(')
+				depth++;
+			else if (*str == ')')
+				depth--;
+
+			str++;
+		}
+	}
+
+	op->argc = num_tokens - 1;
+
+	bool success = false;
+
+	// Control flow errors leave the program in a state we can't run, so stop compiling
+	if (Script_CompileKeyword(program, op, line_buf, &success))
+	{
+		if (!success
+		&& program->num_ops < program->capacity)
+			Script_FreeOp(&program->ops[program->num_ops]);
+
+		return success;
+	}
+
+	op->type = SCRIPT_OP_COMMAND;
+	op->command = Script_FindCommand(op->argv[0]);
+
+	// Same checks as before, they just happen once now. The line is dropped but the rest of the script still compiles
+	if (!op->command)
+	{
+		Logging_Write(LOG_LEVEL_WARNING, "Line %lu: Unknown command %s\n", line_number, op->argv[0]);
+		Script_FreeOp(op);
+		return true;
+	}
+
+	if (!op->command->function)
+	{
+		Logging_Write(LOG_LEVEL_WARNING, "Line %lu: Command %s has no function!\n", line_number, op->command->name_full);
+		Script_FreeOp(op);
+		return true;
+	}
+
+	if (too_many_tokens)
+		Logging_Write(LOG_LEVEL_WARNING, "Line %lu: Too many parameters, only %d are used\n", line_number, SCRIPT_MAX_ARGS);
+
+	if (op->argc < op->command->num_parameters)
+	{
+		Logging_Write(LOG_LEVEL_WARNING, "Line %lu: Command %s does not have enough parameters!\n", line_number, op->command->name_full);
+		Script_FreeOp(op);
+		return true;
+	}
+
+	// Register names are looked up now, so they cost nothing when the op runs. NV3_LOGO.BMP is a file name, not a field
+	for (uint32_t i = 1; i <= op->argc; i++)
+	{
+		uint32_t length = Script_RegisterNameLength(op->argv[i]);
+		const char* dot = strchr(op->argv[i], '.');
+
+		if (!length
+		|| op->argv[i][length]
+		|| (dot && !Script_FindRegister(op->argv[i], dot - op->argv[i])))
+			continue;
+
+		if (!Script_ResolveRegister(op->argv[i], length, line_number, &op->argv_hex[i]))
+		{
+			Script_FreeOp(op);
+			return true;
+		}
+	}
+
+	// $var and (...) arguments are evaluated every time the op runs
+	for (uint32_t i = 1; i <= op->argc; i++)
+	{
+		if (op->argv[i][0] != '$'
+		&& op->argv[i][0] != '(')
+			continue;
+
+		op->exprs[i] = Script_CompileExpression(op->argv[i], line_number);
+
+		if (!op->exprs[i])
+		{
+			Script_FreeOp(op);
+			return true;
+		}
+
+		op->has_exprs = true;
+	}
+
+	program->num_ops++;
+	return true;
+}
+
+// Make sure every block was closed
+bool Script_FinishCompile(gpu_script_program_t* program)
+{
+	if (!program->block_depth)
+		return true;
+
+	gpu_script_block_t* block = &program->blocks[program->block_depth - 1];
+
+	Logging_Write(LOG_LEVEL_ERROR, "Line %lu: %s is never closed\n", program->ops[block->op].line_number, block->keyword);
+	return false;
+}
+
+// A wm32 to a constant USER address, which can go in a batch
+bool Script_IsUserWrite(gpu_script_op_t* op)
+{
+	return (op->type == SCRIPT_OP_COMMAND
+	&& op->command->function == Command_WriteMMIO32
+	&& !op->has_exprs
+	&& op->argv_hex[1] >= NV_USER_START
+	&& op->argv_hex[1] <= NV_USER_END
+	&& !(op->argv_hex[1] & 3));
+}
+
+/*
+	Merge runs of wm32s to the same channel and subchannel in USER into one SCRIPT_OP_USER_BATCH, which NV_SubmitUserMethods writes as fast as
+	CACHE1 takes them. A run stops at anything else (including a wm32 with an expression) and at any op a branch goes to, so loops still work.
+	Done after the .nvc cache is written or read, so the cache never has batches in it. If we run out of memory the program just isn't batched.
+*/
+void Script_BatchUserWrites(gpu_script_program_t* program)
+{
+	if (nvplay_state.config.script_disable_batching
+	|| program->num_ops < 2)
+		return;
+
+	bool* is_target = calloc(program->num_ops + 1, sizeof(bool));
+	uint32_t* new_op_ids = calloc(program->num_ops + 1, sizeof(uint32_t));
+
+	if (!is_target
+	|| !new_op_ids)
+	{
+		free(is_target);
+		free(new_op_ids);
+		return;
+	}
+
+	for (uint32_t op_id = 0; op_id < program->num_ops; op_id++)
+	{
+		if (program->ops[op_id].type != SCRIPT_OP_COMMAND
+		&& program->ops[op_id].type != SCRIPT_OP_SET)
+			is_target[program->ops[op_id].target] = true;
+	}
+
+	uint32_t op_id = 0, new_num_ops = 0, num_batches = 0, num_batched = 0;
+
+	while (op_id < program->num_ops)
+	{
+		gpu_script_op_t* op = &program->ops[op_id];
+		uint32_t end = op_id + 1;
+
+		if (Script_IsUserWrite(op))
+		{
+			uint32_t subchannel_base = op->argv_hex[1] & NV_USER_SUBCHANNEL_MASK;
+
+			while (end < program->num_ops
+			&& !is_target[end]
+			&& Script_IsUserWrite(&program->ops[end])
+			&& (program->ops[end].argv_hex[1] & NV_USER_SUBCHANNEL_MASK) == subchannel_base)
+				end++;
+		}
+
+		uint32_t count = end - op_id;
+		uint32_t* batch = (count > 1) ? malloc(count * 2 * sizeof(uint32_t)) : NULL;
+
+		if (batch)
+		{
+			for (uint32_t i = 0; i < count; i++)
+			{
+				batch[i] = program->ops[op_id + i].argv_hex[1] & NV_USER_METHOD_MASK;
+				batch[count + i] = program->ops[op_id + i].argv_hex[2];
+
+				// The first op becomes the batch, so it keeps its line for errors and the profiler
+				if (i)
+					Script_FreeOp(&program->ops[op_id + i]);
+			}
+
+			op->type = SCRIPT_OP_USER_BATCH;
+			op->batch_count = count;
+			op->batch_methods = batch;
+			op->batch_values = &batch[count];
+			num_batches++;
+			num_batched += count;
+		}
+		else
+			end = op_id + 1;
+
+		for (uint32_t i = op_id; i < end; i++)
+			new_op_ids[i] = new_num_ops;
+
+		program->ops[new_num_ops++] = *op;
+		op_id = end;
+	}
+
+	new_op_ids[program->num_ops] = new_num_ops;
+
+	for (op_id = 0; op_id < new_num_ops; op_id++)
+	{
+		gpu_script_op_t* op = &program->ops[op_id];
+
+		if (op->type != SCRIPT_OP_COMMAND
+		&& op->type != SCRIPT_OP_SET
+		&& op->type != SCRIPT_OP_USER_BATCH)
+			op->target = new_op_ids[op->target];
+	}
+
+	if (num_batches)
+		Logging_WriteTo(LOG_CHANNEL_SCRIPT, LOG_LEVEL_DEBUG, "Batched %lu USER writes into %lu PFIFO submissions\n", num_batched, num_batches);
+
+	program->num_ops = new_num_ops;
+	free(is_target);
+	free(new_op_ids);
+}
+
+// Returns false if this build is too old to run a script that needs version major.minor.revision
+bool Script_VersionIsSupported(uint32_t* version)
+{
+	// Older scripts are supported, newer ones aren't
+	bool is_supported_version = (version[0] < APP_MAJOR)
+	|| (version[0] == APP_MAJOR && version[1] < APP_MINOR)
+	|| (version[0] == APP_MAJOR && version[1] == APP_MINOR && version[2] <= APP_REVISION);
+
+	if (!is_supported_version)
+	{
+		Logging_Write(LOG_LEVEL_ERROR, "This script requires NVPlay version %lu.%lu.%lu but you have version %d.%d.%d. Please update to use this script.\n",
+		version[0], version[1], version[2], APP_MAJOR, APP_MINOR, APP_REVISION);
+	}
+
+	return is_supported_version;
+}
+
+// Parses "MINIMUM_VERSION x.y.z" into version
+void Script_ParseVersion(const char* line_buf, uint32_t* version)
+{
+	int script_major = 0, script_minor = 0, script_revision = 0;
+
+	sscanf(line_buf + strlen(KEYWORD_SCRIPT), "%d.%d.%d", &script_major, &script_minor, &script_revision);
+
+	version[0] = script_major;
+	version[1] = script_minor;
+	version[2] = script_revision;
+}
+
+// Get the next line out of source the same way fgets would. Returns false at the end
+bool Script_ReadLine(const char* source, uint32_t source_size, uint32_t* position, char* line_buf)
+{
+	if (*position >= source_size)
+		return false;
+
+	uint32_t length = 0;
+
+	while (*position < source_size
+	&& length < MAX_STR - 1)
+	{
+		char c = source[(*position)++];
+		line_buf[length++] = c;
+
+		if (c == '\n')
+			break;
+	}
+
+	line_buf[length] = '\0';
+	return true;
+}
+
+// Compile source (the whole file) into program. version gets the script's MINIMUM_VERSION
+bool Script_CompileSource(const char* filename, const char* source, uint32_t source_size, gpu_script_program_t* program, uint32_t* version)
+{
+	char line_buf[MAX_STR] = {0};
+	uint32_t line_number = 0;
+	uint32_t position = 0;
+	bool first_line = true;
+	uint32_t register_errors = script_register_errors;
+
+	while (Script_ReadLine(source, source_size, &position, line_buf))
+	{
+		line_number++;
+
+		if (!Script_IsCode(line_buf))
+			continue;
+
+		// The version check has to be the first real line
+		if (first_line)
+		{
+			first_line = false;
+
+			char* trimmed = String_LTrim(line_buf, MAX_STR);
+
+			if (!strncmp(trimmed, KEYWORD_SCRIPT, strlen(KEYWORD_SCRIPT)))
+			{
+				Script_ParseVersion(trimmed, version);
+
+				if (!Script_VersionIsSupported(version))
+				{
+					Script_Free(program);
+					return false;
+				}
+
+				continue;
+			}
+		}
+
+		if (!Script_CompileLine(program, line_buf, line_number))
+		{
+			Script_Free(program);
+			return false;
+		}
+	}
+
+	if (!Script_FinishCompile(program))
+	{
+		Script_Free(program);
+		return false;
+	}
+
+	// Lines with bad register names were left out. Running what's left could do anything
+	if (script_register_errors != register_errors)
+	{
+		Logging_Write(LOG_LEVEL_ERROR, "Not running script file %s: %lu register names couldn't be used\n", filename, script_register_errors - register_errors);
+		Script_Free(program);
+		return false;
+	}
+
+	Logging_WriteTo(LOG_CHANNEL_SCRIPT, LOG_LEVEL_DEBUG, "Compiled script file %s (%lu lines, %lu ops)\n", filename, line_number, program->num_ops);
+	return true;
+}
+
+/*
+	Compile a script file, or load it from its .nvc cache if the cache was made from exactly this source by this build. The source is read in one
+	go either way since the cache is keyed by its hash.
+*/
+bool Script_CompileFile(const char* filename, gpu_script_program_t* program)
+{
+	FILE* script_file = fopen(filename, "rb");
+
+	memset(program, 0, sizeof(gpu_script_program_t));
+
+	if (!script_file)
+	{
+		// Don't log if the script is autoexec.nvs, it's optional
+		if (strcasecmp(filename, AUTOEXEC_FILENAME))
+			Logging_Write(LOG_LEVEL_ERROR, "Couldn't open script file %s\n", filename);
+
+		return false;
+	}
+
+	fseek(script_file, 0, SEEK_END);
+	uint32_t source_size = ftell(script_file);
+	fseek(script_file, 0, SEEK_SET);
+
+	char* source = malloc(source_size + 1);
+
+	if (!source
+	|| fread(source, 1, source_size, script_file) != source_size)
+	{
+		Logging_Write(LOG_LEVEL_ERROR, "Couldn't read script file %s\n", filename);
+		free(source);
+		fclose(script_file);
+		return false;
+	}
+
+	fclose(script_file);
+
+	uint32_t source_hash = Script_HashData((uint8_t*)source, source_size);
+	uint32_t version[3] = {0};
+	bool use_cache = !nvplay_state.config.script_disable_cache;
+
+	if (use_cache
+	&& Script_LoadCache(filename, program, source_hash, source_size, version))
+	{
+		free(source);
+
+		if (!Script_VersionIsSupported(version))
+		{
+			Script_Free(program);
+			return false;
+		}
+
+		Script_BatchUserWrites(program);
+		return true;
+	}
+
+	bool success = Script_CompileSource(filename, source, source_size, program, version);
+
+	free(source);
+
+	if (success
+	&& use_cache)
+		Script_SaveCache(filename, program, source_hash, source_size, version);
+
+	if (success)
+		Script_BatchUserWrites(program);
+
+	return success;
+}
+
+bool Script_Execute(gpu_script_program_t* program)
+{
+	// runscript can run a script from inside a script, so put the caller's op back when we're done
+	gpu_script_op_t* last_op = current_op;
+	bool success = true;
+	uint32_t op_id = 0;
+
+	// Only look at the profiler's state once per run, so the loop costs nothing extra when it's off
+	int32_t* profile_entries = profile_state.enabled ? Script_ProfileResolve(program) : NULL;
+	script_profile_sample_t profile_sample;
+
+	while (op_id < program->num_ops)
+	{
+		uint32_t this_op = op_id;
+		gpu_script_op_t* op = &program->ops[op_id++];
+
+		// Commands need this for their arguments. Everything else (e.g. the dry run model) just wants the line number
+		current_op = op;
+
+		if (profile_entries)
+			Script_ProfileBegin(&profile_sample);
+
+		switch (op->type)
+		{
+			case SCRIPT_OP_COMMAND:
+				if (op->has_exprs)
+				{
+					for (uint32_t i = 1; i <= op->argc; i++)
+					{
+						if (op->exprs[i])
+							op->argv_hex[i] = Script_Evaluate(op->exprs[i]);
+					}
+				}
+
+				if (profile_entries)
+					Script_ProfileCommandBegin(&profile_sample);
+
+				bool command_success = op->command->function();
+
+				if (profile_entries)
+					Script_ProfileCommandEnd(&profile_sample);
+
+				if (!command_success)
+				{
+					Logging_Write(LOG_LEVEL_ERROR, "Line %lu: Command %s failed to execute!\n", op->line_number, op->command->name_full);
+					success = false;
+				}
+				break;
+			case SCRIPT_OP_USER_BATCH:
+				if (profile_entries)
+					Script_ProfileCommandBegin(&profile_sample);
+
+				bool batch_success = NV_SubmitUserMethods(op->argv_hex[1] & NV_USER_SUBCHANNEL_MASK, op->batch_methods, op->batch_values, op->batch_count);
+
+				if (profile_entries)
+					Script_ProfileCommandEnd(&profile_sample);
+
+				if (!batch_success)
+				{
+					Logging_Write(LOG_LEVEL_ERROR, "Line %lu: %lu batched USER writes failed to execute!\n", op->line_number, op->batch_count);
+					success = false;
+				}
+				break;
+			case SCRIPT_OP_SET:
+				Script_SetVariable(op->variable, Script_Evaluate(op->exprs[0]));
+				break;
+			case SCRIPT_OP_BRANCH_FALSE:
+				if (!Script_Evaluate(op->exprs[0]))
+					op_id = op->target;
+				break;
+			case SCRIPT_OP_JUMP:
+				op_id = op->target;
+				break;
+			case SCRIPT_OP_FOR_CHECK:
+				if (script_variables[op->variable].value >= Script_Evaluate(op->exprs[0]))
+					op_id = op->target;
+				break;
+			case SCRIPT_OP_FOR_STEP:
+				Script_SetVariable(op->variable, script_variables[op->variable].value + (op->exprs[0] ? Script_Evaluate(op->exprs[0]) : 1));
+				op_id = op->target;
+				break;
+		}
+
+		if (profile_entries)
+			Script_ProfileEnd(profile_entries[this_op], &profile_sample);
+	}
+
+	free(profile_entries);
+	current_op = last_op;
+	return success;
+}
+
+void Script_Free(gpu_script_program_t* program)
+{
+	for (uint32_t op_id = 0; op_id < program->num_ops; op_id++)
+		Script_FreeOp(&program->ops[op_id]);
+
+	free(program->ops);
+	memset(program, 0, sizeof(gpu_script_program_t));
+}
@@ -0,0 +1,572 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    script_expr.c: Script variables and expressions
+
+    Expressions are compiled to RPN when the script is compiled. They can use variables ($name), hex numbers (like everything else in scripts;
+    #123 for decimal), register names (see script_registers.c), C operators and register reads like rm32(addr). Reads in expressions are silent, so read-modify-write doesn't log.
+*/
+
+#include "core/script/script.h"
+#include "util/util.h"
+#include <nvplay.h>
+
+script_variable_t script_variables[SCRIPT_MAX_VARIABLES] = {0};
+uint32_t script_num_variables = 0;
+
+typedef enum script_expr_operator_e
+{
+    // Binary
+    SCRIPT_OPERATOR_ADD,
+    SCRIPT_OPERATOR_SUB,
+    SCRIPT_OPERATOR_MUL,
+    SCRIPT_OPERATOR_DIV,
+    SCRIPT_OPERATOR_MOD,
+    SCRIPT_OPERATOR_AND,
+    SCRIPT_OPERATOR_OR,
+    SCRIPT_OPERATOR_XOR,
+    SCRIPT_OPERATOR_SHL,
+    SCRIPT_OPERATOR_SHR,
+    SCRIPT_OPERATOR_EQ,
+    SCRIPT_OPERATOR_NE,
+    SCRIPT_OPERATOR_LT,
+    SCRIPT_OPERATOR_LE,
+    SCRIPT_OPERATOR_GT,
+    SCRIPT_OPERATOR_GE,
+    SCRIPT_OPERATOR_LOGICAL_AND,
+    SCRIPT_OPERATOR_LOGICAL_OR,
+
+    // Unary
+    SCRIPT_OPERATOR_NEGATE,
+    SCRIPT_OPERATOR_INVERT,
+    SCRIPT_OPERATOR_LOGICAL_NOT,
+} script_expr_operator_t;
+
+typedef struct script_binary_operator_s
+{
+    const char* str;
+    uint32_t precedence;                                        // Higher binds tighter, same as C
+    script_expr_operator_t operator;
+} script_binary_operator_t;
+
+// Two character operators have to come first
+script_binary_operator_t binary_operators[] =
+{
+    { "||", 1, SCRIPT_OPERATOR_LOGICAL_OR },
+    { "&&", 2, SCRIPT_OPERATOR_LOGICAL_AND },
+    { "==", 6, SCRIPT_OPERATOR_EQ },
+    { "!=", 6, SCRIPT_OPERATOR_NE },
+    { "<=", 7, SCRIPT_OPERATOR_LE },
+    { ">=", 7, SCRIPT_OPERATOR_GE },
+    { "<<", 8, SCRIPT_OPERATOR_SHL },
+    { ">>", 8, SCRIPT_OPERATOR_SHR },
+    { "|", 3, SCRIPT_OPERATOR_OR },
+    { "^", 4, SCRIPT_OPERATOR_XOR },
+    { "&", 5, SCRIPT_OPERATOR_AND },
+    { "<", 7, SCRIPT_OPERATOR_LT },
+    { ">", 7, SCRIPT_OPERATOR_GT },
+    { "+", 9, SCRIPT_OPERATOR_ADD },
+    { "-", 9, SCRIPT_OPERATOR_SUB },
+    { "*", 10, SCRIPT_OPERATOR_MUL },
+    { "/", 10, SCRIPT_OPERATOR_DIV },
+    { "%", 10, SCRIPT_OPERATOR_MOD },
+    { NULL, 0, 0 },                                             // Sentinel value
+};
+
+//
+// Register reads. These don't log anything
+//
+
+uint32_t Script_ReadMMIO8(uint32_t addr)
+{
+    return Command_MMIOBoundsCheck(addr) ? NV_ReadMMIO8(addr) : 0;
+}
+
+uint32_t Script_ReadMMIO32(uint32_t addr)
+{
+    return Command_MMIOBoundsCheck(addr) ? NV_ReadMMIO32(addr) : 0;
+}
+
+uint32_t Script_ReadVRAM8(uint32_t addr)
+{
+    return Command_VRAMBoundsCheck(addr) ? NV_ReadDfb8(addr) : 0;
+}
+
+uint32_t Script_ReadVRAM16(uint32_t addr)
+{
+    return Command_VRAMBoundsCheck(addr) ? NV_ReadDfb16(addr) : 0;
+}
+
+uint32_t Script_ReadVRAM32(uint32_t addr)
+{
+    return Command_VRAMBoundsCheck(addr) ? NV_ReadDfb32(addr) : 0;
+}
+
+uint32_t Script_ReadRamin32(uint32_t addr)
+{
+    return NV_ReadRamin32(addr);
+}
+
+uint32_t Script_ReadPCI8(uint32_t offset)
+{
+    return PCI_ReadConfig8(current_device.bus_info.bus_number, current_device.bus_info.function_number, offset);
+}
+
+uint32_t Script_ReadPCI16(uint32_t offset)
+{
+    return PCI_ReadConfig16(current_device.bus_info.bus_number, current_device.bus_info.function_number, offset);
+}
+
+uint32_t Script_ReadPCI32(uint32_t offset)
+{
+    return PCI_ReadConfig32(current_device.bus_info.bus_number, current_device.bus_info.function_number, offset);
+}
+
+uint32_t Script_ReadCRTC(uint32_t index)
+{
+    return VGA_ReadCRTC(index);
+}
+
+uint32_t Script_ReadSR(uint32_t index)
+{
+    return VGA_ReadSequencer(index);
+}
+
+uint32_t Script_ReadGR(uint32_t index)
+{
+    return VGA_ReadGraphics(index);
+}
+
+uint32_t Script_ReadAR(uint32_t index)
+{
+    return VGA_ReadAttribute(index);
+}
+
+typedef struct script_read_function_s
+{
+    const char* name;
+    uint32_t (*function)(uint32_t);
+} script_read_function_t;
+
+// Same names as the console read commands, minus the "c"
+script_read_function_t read_functions[] =
+{
+    { "rm8", Script_ReadMMIO8 },
+    { "rm32", Script_ReadMMIO32 },
+    { "rv8", Script_ReadVRAM8 },
+    { "rv16", Script_ReadVRAM16 },
+    { "rv32", Script_ReadVRAM32 },
+    { "rr32", Script_ReadRamin32 },
+    { "rp8", Script_ReadPCI8 },
+    { "rp16", Script_ReadPCI16 },
+    { "rp32", Script_ReadPCI32 },
+    { "rcrtc", Script_ReadCRTC },
+    { "rsr", Script_ReadSR },
+    { "rgr", Script_ReadGR },
+    { "rar", Script_ReadAR },
+    { NULL, NULL },                                             // Sentinel value
+};
+
+//
+// Variables
+//
+
+// Returns the index of the variable, or -1 if it doesn't exist and create is false (or there's no room)
+int32_t Script_FindVariable(const char* name, bool create)
+{
+    for (uint32_t i = 0; i < script_num_variables; i++)
+    {
+        if (!strcmp(script_variables[i].name, name))
+            return i;
+    }
+
+    if (!create)
+        return -1;
+
+    if (script_num_variables >= SCRIPT_MAX_VARIABLES)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "Too many script variables (max %d)\n", SCRIPT_MAX_VARIABLES);
+        return -1;
+    }
+
+    if (strlen(name) >= SCRIPT_MAX_VARIABLE_NAME)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "Variable name %s is too long (max %d characters)\n", name, SCRIPT_MAX_VARIABLE_NAME - 1);
+        return -1;
+    }
+
+    script_variable_t* variable = &script_variables[script_num_variables];
+
+    strncpy(variable->name, name, SCRIPT_MAX_VARIABLE_NAME);
+    variable->type = SCRIPT_VARIABLE_U32;
+    variable->value = 0;
+
+    return script_num_variables++;
+}
+
+void Script_SetVariable(uint32_t variable, uint32_t value)
+{
+    switch (script_variables[variable].type)
+    {
+        case SCRIPT_VARIABLE_U8:
+            value &= 0xFF;
+            break;
+        case SCRIPT_VARIABLE_U16:
+            value &= 0xFFFF;
+            break;
+        default:
+            break;
+    }
+
+    script_variables[variable].value = value;
+}
+
+//
+// Compiler (precedence climbing, emits RPN)
+//
+
+typedef struct script_expr_parser_s
+{
+    const char* pos;
+    uint32_t line_number;
+    bool error;
+    uint32_t num_tokens;
+    uint32_t depth;                                             // Stack depth needed so far
+    uint32_t max_depth;
+    script_expr_token_t tokens[SCRIPT_MAX_EXPR_TOKENS];
+} script_expr_parser_t;
+
+void Script_ExprError(script_expr_parser_t* parser, const char* message)
+{
+    if (!parser->error)
+        Logging_Write(LOG_LEVEL_ERROR, "Line %lu: %s near \"%s\"\n", parser->line_number, message, parser->pos);
+
+    parser->error = true;
+}
+
+void Script_ExprEmit(script_expr_parser_t* parser, script_expr_token_type_t type, uint32_t value)
+{
+    if (parser->num_tokens >= SCRIPT_MAX_EXPR_TOKENS)
+    {
+        Script_ExprError(parser, "Expression too long");
+        return;
+    }
+
+    if (type == SCRIPT_EXPR_CONSTANT
+    || type == SCRIPT_EXPR_VARIABLE)
+        parser->depth++;
+    else if (type == SCRIPT_EXPR_BINARY)
+        parser->depth--;
+
+    if (parser->depth > parser->max_depth)
+        parser->max_depth = parser->depth;
+
+    parser->tokens[parser->num_tokens].type = type;
+    parser->tokens[parser->num_tokens].value = value;
+    parser->num_tokens++;
+}
+
+void Script_ExprSkipSpace(script_expr_parser_t* parser)
+{
+    while (isspace((unsigned char)*parser->pos))
+        parser->pos++;
+}
+
+void Script_ExprParse(script_expr_parser_t* parser, uint32_t min_precedence);
+
+void Script_ExprParsePrimary(script_expr_parser_t* parser)
+{
+    Script_ExprSkipSpace(parser);
+
+    char c = *parser->pos;
+
+    if (c == '(')
+    {
+        parser->pos++;
+        Script_ExprParse(parser, 1);
+        Script_ExprSkipSpace(parser);
+
+        if (*parser->pos != ')')
+        {
+            Script_ExprError(parser, "Missing )");
+            return;
+        }
+
+        parser->pos++;
+    }
+    else if (c == '-' || c == '~' || c == '!')
+    {
+        parser->pos++;
+        Script_ExprParsePrimary(parser);
+        Script_ExprEmit(parser, SCRIPT_EXPR_UNARY,
+            (c == '-') ? SCRIPT_OPERATOR_NEGATE : (c == '~') ? SCRIPT_OPERATOR_INVERT : SCRIPT_OPERATOR_LOGICAL_NOT);
+    }
+    else if (c == '$')
+    {
+        char name[SCRIPT_MAX_VARIABLE_NAME] = {0};
+        uint32_t length = 0;
+
+        name[length++] = *parser->pos++;
+
+        while ((isalnum((unsigned char)*parser->pos) || *parser->pos == '_')
+        && length < SCRIPT_MAX_VARIABLE_NAME - 1)
+            name[length++] = *parser->pos++;
+
+        int32_t variable = Script_FindVariable(name, false);
+
+        // Allowed (it's just 0), but probably a typo
+        if (variable < 0)
+        {
+            Logging_Write(LOG_LEVEL_WARNING, "Line %lu: Variable %s used before it was set\n", parser->line_number, name);
+            variable = Script_FindVariable(name, true);
+        }
+
+        if (variable < 0)
+        {
+            Script_ExprError(parser, "Can't create variable");
+            return;
+        }
+
+        Script_ExprEmit(parser, SCRIPT_EXPR_VARIABLE, variable);
+    }
+    else if (c == '#')
+    {
+        char* end = NULL;
+
+        parser->pos++;
+        Script_ExprEmit(parser, SCRIPT_EXPR_CONSTANT, (uint32_t)strtoul(parser->pos, &end, 10));
+
+        if (end == parser->pos)
+            Script_ExprError(parser, "Expected a decimal number");
+
+        parser->pos = end;
+    }
+    else if (Script_RegisterNameLength(parser->pos))
+    {
+        uint32_t length = Script_RegisterNameLength(parser->pos);
+        uint32_t value = 0;
+
+        // Script_ResolveRegister has already said why
+        if (!Script_ResolveRegister(parser->pos, length, parser->line_number, &value))
+        {
+            parser->error = true;
+            return;
+        }
+
+        parser->pos += length;
+        Script_ExprEmit(parser, SCRIPT_EXPR_CONSTANT, value);
+    }
+    else if (isalnum((unsigned char)c))
+    {
+        const char* start = parser->pos;
+        uint32_t length = 0;
+
+        while (isalnum((unsigned char)start[length]) || start[length] == '_')
+            length++;
+
+        // name( is a read function, otherwise it's a hex number
+        const char* after = start + length;
+
+        while (isspace((unsigned char)*after))
+            after++;
+
+        if (*after == '(')
+        {
+            uint32_t function = 0;
+
+            while (read_functions[function].name
+            && (strlen(read_functions[function].name) != length || strncasecmp(read_functions[function].name, start, length)))
+                function++;
+
+            if (!read_functions[function].name)
+            {
+                Script_ExprError(parser, "Unknown function");
+                return;
+            }
+
+            parser->pos = after + 1;
+            Script_ExprParse(parser, 1);
+            Script_ExprSkipSpace(parser);
+
+            if (*parser->pos != ')')
+            {
+                Script_ExprError(parser, "Missing )");
+                return;
+            }
+
+            parser->pos++;
+            Script_ExprEmit(parser, SCRIPT_EXPR_READ, function);
+        }
+        else
+        {
+            char* end = NULL;
+            uint32_t value = (uint32_t)strtoul(start, &end, 16);
+
+            if (end != start + length)
+            {
+                Script_ExprError(parser, "Not a hex number");
+                return;
+            }
+
+            parser->pos = end;
+            Script_ExprEmit(parser, SCRIPT_EXPR_CONSTANT, value);
+        }
+    }
+    else
+        Script_ExprError(parser, "Expected a value");
+}
+
+void Script_ExprParse(script_expr_parser_t* parser, uint32_t min_precedence)
+{
+    Script_ExprParsePrimary(parser);
+
+    while (!parser->error)
+    {
+        Script_ExprSkipSpace(parser);
+
+        script_binary_operator_t* binary_operator = &binary_operators[0];
+
+        while (binary_operator->str
+        && strncmp(parser->pos, binary_operator->str, strlen(binary_operator->str)))
+            binary_operator++;
+
+        if (!binary_operator->str
+        || binary_operator->precedence < min_precedence)
+            return;
+
+        parser->pos += strlen(binary_operator->str);
+
+        // Left associative
+        Script_ExprParse(parser, binary_operator->precedence + 1);
+        Script_ExprEmit(parser, SCRIPT_EXPR_BINARY, binary_operator->operator);
+    }
+}
+
+// Compile an expression. Returns NULL (and logs why) if it isn't valid
+script_expr_t* Script_CompileExpression(const char* str, uint32_t line_number)
+{
+    script_expr_parser_t parser = {0};
+
+    parser.pos = str;
+    parser.line_number = line_number;
+
+    Script_ExprParse(&parser, 1);
+    Script_ExprSkipSpace(&parser);
+
+    if (!parser.error
+    && *parser.pos)
+        Script_ExprError(&parser, "Unexpected characters after expression");
+
+    if (!parser.error
+    && parser.max_depth > SCRIPT_MAX_EXPR_STACK)
+        Script_ExprError(&parser, "Expression too complex");
+
+    if (parser.error)
+        return NULL;
+
+    script_expr_t* expr = malloc(sizeof(script_expr_t) + parser.num_tokens * sizeof(script_expr_token_t));
+
+    if (!expr)
+        return NULL;
+
+    expr->num_tokens = parser.num_tokens;
+    memcpy(expr->tokens, parser.tokens, parser.num_tokens * sizeof(script_expr_token_t));
+    return expr;
+}
+
+//
+// Evaluator
+//
+
+uint32_t Script_EvaluateBinary(script_expr_operator_t operator, uint32_t a, uint32_t b)
+{
+    switch (operator)
+    {
+        case SCRIPT_OPERATOR_ADD:
+            return a + b;
+        case SCRIPT_OPERATOR_SUB:
+            return a - b;
+        case SCRIPT_OPERATOR_MUL:
+            return a * b;
+        case SCRIPT_OPERATOR_DIV:
+        case SCRIPT_OPERATOR_MOD:
+            if (!b)
+            {
+                Logging_Write(LOG_LEVEL_WARNING, "Division by zero in script expression, result is 0\n");
+                return 0;
+            }
+
+            return (operator == SCRIPT_OPERATOR_DIV) ? (a / b) : (a % b);
+        case SCRIPT_OPERATOR_AND:
+            return a & b;
+        case SCRIPT_OPERATOR_OR:
+            return a | b;
+        case SCRIPT_OPERATOR_XOR:
+            return a ^ b;
+        case SCRIPT_OPERATOR_SHL:
+            return (b >= 32) ? 0 : (a << b);
+        case SCRIPT_OPERATOR_SHR:
+            return (b >= 32) ? 0 : (a >> b);
+        case SCRIPT_OPERATOR_EQ:
+            return a == b;
+        case SCRIPT_OPERATOR_NE:
+            return a != b;
+        case SCRIPT_OPERATOR_LT:
+            return a < b;
+        case SCRIPT_OPERATOR_LE:
+            return a <= b;
+        case SCRIPT_OPERATOR_GT:
+            return a > b;
+        case SCRIPT_OPERATOR_GE:
+            return a >= b;
+        case SCRIPT_OPERATOR_LOGICAL_AND:
+            return a && b;
+        case SCRIPT_OPERATOR_LOGICAL_OR:
+            return a || b;
+        default:
+            return 0;
+    }
+}
+
+// Both sides of && and || are always evaluated (so reads in them always happen)
+uint32_t Script_Evaluate(script_expr_t* expr)
+{
+    uint32_t stack[SCRIPT_MAX_EXPR_STACK];
+    uint32_t sp = 0;
+
+    for (uint32_t i = 0; i < expr->num_tokens; i++)
+    {
+        script_expr_token_t* token = &expr->tokens[i];
+
+        switch (token->type)
+        {
+            case SCRIPT_EXPR_CONSTANT:
+                stack[sp++] = token->value;
+                break;
+            case SCRIPT_EXPR_VARIABLE:
+                stack[sp++] = script_variables[token->value].value;
+                break;
+            case SCRIPT_EXPR_UNARY:
+                if (token->value == SCRIPT_OPERATOR_NEGATE)
+                    stack[sp - 1] = -stack[sp - 1];
+                else if (token->value == SCRIPT_OPERATOR_INVERT)
+                    stack[sp - 1] = ~stack[sp - 1];
+                else
+                    stack[sp - 1] = !stack[sp - 1];
+                break;
+            case SCRIPT_EXPR_BINARY:
+                sp--;
+                stack[sp - 1] = Script_EvaluateBinary(token->value, stack[sp - 1], stack[sp]);
+                break;
+            case SCRIPT_EXPR_READ:
+                stack[sp - 1] = read_functions[token->value].function(stack[sp - 1]);
+                break;
+        }
+    }
+
+    return sp ? stack[0] : 0;
+}
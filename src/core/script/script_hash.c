@@ -0,0 +1,191 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    script_hash.c: Minimal perfect hash over the command names
+
+    Both the short and long name of every command in commands[] go into one table, built the first time a command is looked up. It uses
+    hash-and-displace: names are put into buckets with one hash, then each bucket (biggest first) searches for a seed that puts all of its names
+    into free slots of the table. A lookup is then two hashes and one strcmp, no matter how long commands[] gets.
+*/
+
+#include "core/script/script.h"
+#include "util/util.h"
+#include <nvplay.h>
+
+typedef struct script_hash_entry_s
+{
+	const char* name;
+	gpu_script_command_t* command;
+} script_hash_entry_t;
+
+script_hash_entry_t script_hash_slots[SCRIPT_HASH_MAX_NAMES];
+uint32_t script_hash_seeds[SCRIPT_HASH_MAX_NAMES];		// One per bucket
+uint32_t script_hash_num_names = 0;
+bool script_hash_built = false;
+bool script_hash_failed = false;
+
+// FNV-1a with a seed, plus a final mix so different seeds give unrelated results
+uint32_t Script_HashName(const char* name, uint32_t seed)
+{
+	uint32_t hash = 0x811C9DC5 ^ (seed * 0x9E3779B9);
+
+	while (*name)
+	{
+		hash ^= (uint8_t)*name++;
+		hash *= 0x01000193;
+	}
+
+	hash ^= hash >> 16;
+	hash *= 0x85EBCA6B;
+	hash ^= hash >> 13;
+
+	return hash;
+}
+
+bool Script_BuildCommandHash()
+{
+	script_hash_entry_t names[SCRIPT_HASH_MAX_NAMES] = {0};
+	uint32_t num_names = 0;
+
+	// Collect every distinct name (some commands use the same name for both)
+	for (gpu_script_command_t* command = &commands[0]; command->name_abbrev; command++)
+	{
+		const char* command_names[2] = { command->name_abbrev, command->name_full };
+
+		for (uint32_t i = 0; i < 2; i++)
+		{
+			if (i == 1 && !strcmp(command_names[0], command_names[1]))
+				break;
+
+			if (num_names >= SCRIPT_HASH_MAX_NAMES)
+			{
+				Logging_Write(LOG_LEVEL_ERROR, "Too many script commands for the command hash (max %d)\n", SCRIPT_HASH_MAX_NAMES);
+				return false;
+			}
+
+			names[num_names].name = command_names[i];
+			names[num_names].command = command;
+			num_names++;
+		}
+	}
+
+	// Bucket everything with seed 0
+	uint32_t bucket_sizes[SCRIPT_HASH_MAX_NAMES] = {0};
+	uint32_t name_buckets[SCRIPT_HASH_MAX_NAMES] = {0};
+
+	for (uint32_t i = 0; i < num_names; i++)
+	{
+		name_buckets[i] = Script_HashName(names[i].name, 0) % num_names;
+		bucket_sizes[name_buckets[i]]++;
+	}
+
+	bool slot_used[SCRIPT_HASH_MAX_NAMES] = {0};
+	uint32_t slots[SCRIPT_HASH_MAX_NAMES] = {0};
+
+	memset(script_hash_slots, 0, sizeof(script_hash_slots));
+	memset(script_hash_seeds, 0, sizeof(script_hash_seeds));
+
+	// Place buckets from biggest to smallest, so the hard ones get the emptiest table
+	for (uint32_t size = SCRIPT_HASH_MAX_NAMES; size > 0; size--)
+	{
+		for (uint32_t bucket = 0; bucket < num_names; bucket++)
+		{
+			if (bucket_sizes[bucket] != size)
+				continue;
+
+			bool placed = false;
+
+			for (uint32_t seed = 1; seed < SCRIPT_HASH_MAX_SEED && !placed; seed++)
+			{
+				uint32_t num_placed = 0;
+				placed = true;
+
+				for (uint32_t i = 0; i < num_names; i++)
+				{
+					if (name_buckets[i] != bucket)
+						continue;
+
+					uint32_t slot = Script_HashName(names[i].name, seed) % num_names;
+
+					// Also check against the other names in this bucket
+					bool clash = slot_used[slot];
+
+					for (uint32_t j = 0; j < num_placed; j++)
+						clash |= (slots[j] == slot);
+
+					if (clash)
+					{
+						placed = false;
+						break;
+					}
+
+					slots[num_placed++] = slot;
+				}
+
+				if (placed)
+				{
+					script_hash_seeds[bucket] = seed;
+					num_placed = 0;
+
+					for (uint32_t i = 0; i < num_names; i++)
+					{
+						if (name_buckets[i] != bucket)
+							continue;
+
+						uint32_t slot = slots[num_placed++];
+
+						slot_used[slot] = true;
+						script_hash_slots[slot] = names[i];
+					}
+				}
+			}
+
+			if (!placed)
+			{
+				Logging_Write(LOG_LEVEL_ERROR, "Couldn't build the command hash (bucket %lu)\n", bucket);
+				return false;
+			}
+		}
+	}
+
+	script_hash_num_names = num_names;
+	Logging_WriteTo(LOG_CHANNEL_SCRIPT, LOG_LEVEL_DEBUG, "Built command hash (%lu names)\n", num_names);
+	return true;
+}
+
+gpu_script_command_t* Script_FindCommand(const char* name)
+{
+	if (!script_hash_built
+	&& !script_hash_failed)
+	{
+		script_hash_built = Script_BuildCommandHash();
+		script_hash_failed = !script_hash_built;
+	}
+
+	// Shouldn't happen, but don't stop scripts working if it does
+	if (script_hash_failed)
+	{
+		for (gpu_script_command_t* command = &commands[0]; command->name_abbrev; command++)
+		{
+			if (!strcmp(command->name_abbrev, name)
+			|| !strcmp(command->name_full, name))
+				return command;
+		}
+
+		return NULL;
+	}
+
+	uint32_t bucket = Script_HashName(name, 0) % script_hash_num_names;
+	script_hash_entry_t* entry = &script_hash_slots[Script_HashName(name, script_hash_seeds[bucket]) % script_hash_num_names];
+
+	// Names that aren't commands still land on some slot
+	if (!entry->name
+	|| strcmp(entry->name, name))
+		return NULL;
+
+	return entry->command;
+}
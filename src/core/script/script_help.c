@@ -18,6 +18,7 @@ const char* msg_help_script = "nvPlay Commands help:\n\n"
 "printwarning text: Print message (Warning verbosity)\n"
 "printerror text: Print message (Error verbosity)\n"
 "printversion: Print nvPlay version\n"
+"logsync [0/1]: 1 writes every log line to disk as it's logged (nothing is lost in a lockup), 0 buffers the log file (much faster)\n"
 ".\n"
 "---IO---\n\n"
 "\x1b[1;32mrmc[8/32] readmmioconsole[8/16/32]offset\x1b[00m: Read the 8/32-bit MMIO register (there are no 16-bit MMIO registers) at the address \"offset\" and print it to the console.\n"
@@ -41,8 +42,32 @@ const char* msg_help_script = "nvPlay Commands help:\n\n"
 "\x1b[1;32mrsrc, readsrconsole offset\x1b[00m: Read the VGA sequencer register at the address \"offset\" and print it to the console.\n"
 "\x1b[1;32mwsr, writesr offset value\x1b[00m: Write the VGA sequencer register starting at the address \"offset\".\n"
 "\x1b[1;32mwsrrange, writesrrange offset_start offset_end value\x1b[00m: Write a single value to all of the VGA sequencer registers from index_start to index_end.\n"
+"\x1b[1;32mlv, loadvram file offset\x1b[00m: Load a file into VRAM at the BAR1 address \"offset\". BMPs are loaded as pixels (top-down, unpadded, 24bpp becomes 32bpp), anything else as-is.\n"
+"\x1b[1;32mlr, loadramin file offset\x1b[00m: Load a file into instance memory at \"offset\", the same way as loadvram.\n"
+"\x1b[1;32msv, savevram file offset size\x1b[00m: Save \"size\" bytes of VRAM starting at \"offset\" to a file.\n"
 
+".\n"
+"---VARIABLES AND CONTROL FLOW---\n\n"
+"Numbers are hex (#123 for decimal). Parameters starting with $ or ( are expressions, e.g. wm32 200 ($v | 1)\n"
+"Register names from the reference headers can be used anywhere a number can, e.g. wm32 NV3_PGRAPH_DEBUG_0 ($v | 1). NAME.VALUE is a field value\n"
+"shifted into place (NV4_PMC_INTR_0_PFIFO.PENDING). Names for a different GPU generation stop the script from compiling.\n"
+"\x1b[1;32mset $name expression\x1b[00m: Set a variable. Expressions can use $variables, + - * / % & | ^ ~ << >> == != < <= > >= && || ! and reads.\n"
+"\x1b[1;32mrm8/rm32/rv8/rv16/rv32/rr32/rp8/rp16/rp32/rcrtc/rsr/rgr/rar(offset)\x1b[00m: Read a register inside an expression. These don't print anything.\n"
+"\x1b[1;32mvar $name u8/u16/u32\x1b[00m: Give a variable a type. Values are truncated to it when set.\n"
+"\x1b[1;32mif expression / else / endif\x1b[00m: Run lines if the expression is not 0.\n"
+"\x1b[1;32mwhile expression / endwhile\x1b[00m: Run lines while the expression is not 0.\n"
+"\x1b[1;32mfor $name start end [step] / endfor\x1b[00m: Run lines with $name going from start up to (not including) end.\n"
+"\x1b[1;32mpv, printvar value...\x1b[00m: Print the value of each parameter.\n"
+"\x1b[1;32mwaitfor offset mask value timeout\x1b[00m: Wait until (MMIO register \"offset\" & mask) == value, for at most timeout microseconds (e.g. #100000 for 100ms). The line fails if it times out.\n"
+"\x1b[1;32mwatch [mmio|ramin|pci|crtc|sr|gr|ar] offset [interval]\x1b[00m: Show a register (MMIO if no space is given) in a panel in the REPL, refreshed every interval milliseconds\n"
+"(default #250). Hex digits with bits that changed are highlighted. Needs the curses console.\n"
+"\x1b[1;32munwatch [[space] offset]\x1b[00m: Stop watching a register, or all of them.\n"
+"\x1b[1;32mremote port [baud]\x1b[00m: Take requests from tools/nvremote over a serial port (COM1-COM4) until it disconnects or a key is pressed.\n"
+"The baud rate is decimal (57600 or #57600), 115200 unless given.\n"
+"\x1b[1;32mhe, hexedit [mmio|vram|ramin|pci] [offset]\x1b[00m: Full screen hex editor. Only the page on screen is read, and again every half second; bytes that\n"
+"changed are highlighted. g goes to an offset or register name, e/Enter writes the selected dword, / and n find a dword, Tab changes space.\n"
 ".\n"
 "---MISC---\n\n"
+"\x1b[1;32mrs, runscript file [-profile]\x1b[00m: Run a script file. -profile times every line from then on and writes a report (and nvprof.csv) on exit.\n"
 "\x1b[1;32mnv3_explode\x1b[00m: NV3 Mediaport test. ***MAY CRASH GPU OR SYSTEM***\n"
 ;
@@ -0,0 +1,208 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    script_memcache.c: Keeps recently run scripts compiled in memory
+
+    rs, autoexec and -script all get their program from here, so a helper script run from a loop (or rerun from the REPL) is only read and
+    compiled once. Entries are keyed by path, modification time and size; that's one stat() per run instead of an open, a read and a hash.
+    DOS only keeps modification times to 2 seconds, so an edit that keeps the same size within 2 seconds of the last one is missed.
+
+    A program that is running can't be evicted or freed (rs can nest), so it is counted while in use. If every entry is in use, the script is
+    compiled into a temporary program that is freed after it runs.
+*/
+
+#include "core/script/script.h"
+#include "util/util.h"
+#include <nvplay.h>
+#include <sys/stat.h>
+
+typedef struct script_memcache_entry_s
+{
+	char path[MAX_STR];
+	time_t modified_time;
+	off_t size;
+	uint32_t last_used;
+	uint32_t users;							// Script_Execute calls running this program
+	bool valid;								// Can be found by path
+	bool stale;								// The file changed while the program was running, free it when it's done
+	gpu_script_program_t program;
+} script_memcache_entry_t;
+
+script_memcache_entry_t memcache_entries[SCRIPT_MEMCACHE_SIZE] = {0};
+uint32_t memcache_clock = 0;
+uint32_t memcache_hits = 0;
+uint32_t memcache_misses = 0;
+uint32_t memcache_reloads = 0;
+uint32_t memcache_evictions = 0;
+
+script_memcache_entry_t* Script_MemcacheFind(const char* filename)
+{
+	for (uint32_t i = 0; i < SCRIPT_MEMCACHE_SIZE; i++)
+	{
+		// DOS paths aren't case sensitive
+		if (memcache_entries[i].valid
+		&& !strcasecmp(memcache_entries[i].path, filename))
+			return &memcache_entries[i];
+	}
+
+	return NULL;
+}
+
+/* An empty entry, or the least recently used one that isn't running. NULL if they're all running */
+script_memcache_entry_t* Script_MemcacheGetFreeEntry()
+{
+	script_memcache_entry_t* lru = NULL;
+
+	for (uint32_t i = 0; i < SCRIPT_MEMCACHE_SIZE; i++)
+	{
+		script_memcache_entry_t* entry = &memcache_entries[i];
+
+		if (!entry->valid
+		&& !entry->stale)
+			return entry;
+
+		if (entry->valid
+		&& !entry->users
+		&& (!lru || entry->last_used < lru->last_used))
+			lru = entry;
+	}
+
+	if (lru)
+	{
+		memcache_evictions++;
+		Script_Free(&lru->program);
+		lru->valid = false;
+	}
+
+	return lru;
+}
+
+/* Compile a script that can't be cached. Script_ReleaseProgram frees it */
+gpu_script_program_t* Script_CompileTemporary(const char* filename)
+{
+	gpu_script_program_t* program = calloc(1, sizeof(gpu_script_program_t));
+
+	if (!program)
+	{
+		Logging_Write(LOG_LEVEL_ERROR, "Couldn't run script file %s: Out of memory\n", filename);
+		return NULL;
+	}
+
+	if (!Script_CompileFile(filename, program))
+	{
+		free(program);
+		return NULL;
+	}
+
+	program->filename = filename;
+	return program;
+}
+
+/*
+	Get the compiled program for a script file, compiling it if it isn't cached or has changed. Returns NULL if it can't be compiled.
+	Every program returned must be given back with Script_ReleaseProgram once it has run.
+*/
+gpu_script_program_t* Script_AcquireProgram(const char* filename)
+{
+	struct stat file_info;
+
+	// Let Script_CompileFile report it (or not, for autoexec.nvs)
+	if (stat(filename, &file_info))
+		return Script_CompileTemporary(filename);
+
+	script_memcache_entry_t* entry = Script_MemcacheFind(filename);
+
+	if (entry
+	&& entry->modified_time == file_info.st_mtime
+	&& entry->size == file_info.st_size)
+	{
+		memcache_hits++;
+		entry->last_used = ++memcache_clock;
+		entry->users++;
+		return &entry->program;
+	}
+
+	memcache_misses++;
+
+	if (entry)
+	{
+		memcache_reloads++;
+		entry->valid = false;
+
+		if (entry->users)
+			entry->stale = true;
+		else
+			Script_Free(&entry->program);
+	}
+
+	entry = Script_MemcacheGetFreeEntry();
+
+	if (!entry)
+		return Script_CompileTemporary(filename);
+
+	if (!Script_CompileFile(filename, &entry->program))
+		return NULL;
+
+	strncpy(entry->path, filename, MAX_STR - 1);
+	entry->modified_time = file_info.st_mtime;
+	entry->size = file_info.st_size;
+	entry->last_used = ++memcache_clock;
+	entry->users = 1;
+	entry->valid = true;
+	entry->program.filename = entry->path;
+
+	return &entry->program;
+}
+
+void Script_ReleaseProgram(gpu_script_program_t* program)
+{
+	for (uint32_t i = 0; i < SCRIPT_MEMCACHE_SIZE; i++)
+	{
+		script_memcache_entry_t* entry = &memcache_entries[i];
+
+		if (&entry->program != program)
+			continue;
+
+		if (entry->users)
+			entry->users--;
+
+		if (entry->stale
+		&& !entry->users)
+		{
+			Script_Free(&entry->program);
+			entry->stale = false;
+		}
+
+		return;
+	}
+
+	// Temporary
+	Script_Free(program);
+	free(program);
+}
+
+void Script_LogMemcacheStatistics()
+{
+	if (!memcache_hits
+	&& !memcache_misses)
+		return;
+
+	Logging_WriteTo(LOG_CHANNEL_SCRIPT, LOG_LEVEL_DEBUG, "Script cache: %lu hits, %lu misses (%lu changed on disk), %lu evictions\n", memcache_hits, memcache_misses,
+		memcache_reloads, memcache_evictions);
+}
+
+void Script_FreeMemcache()
+{
+	for (uint32_t i = 0; i < SCRIPT_MEMCACHE_SIZE; i++)
+	{
+		if (memcache_entries[i].valid
+		|| memcache_entries[i].stale)
+			Script_Free(&memcache_entries[i].program);
+
+		memset(&memcache_entries[i], 0, sizeof(script_memcache_entry_t));
+	}
+}
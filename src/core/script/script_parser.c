@@ -14,204 +14,62 @@
 #include <nvplay.h>
 #include <cmake/nvplay_version.h>
 
-/* This is probably not threadsafe */
-char last_command[MAX_STR] = {0};
-/* This is so we can do stuff like strtok */
-char last_token[MAX_STR] = {0};
+/* Set by the executor in script_compiler.c */
+extern gpu_script_op_t* current_op;
 
 uint32_t Command_Argc()
 {
-    // restore the original last command so we can parse it
+	if (!current_op)
+		return 0;
 
-    strncpy(last_token, last_command, MAX_STR);
-	uint32_t amount = 0;
-
-	// skip the command name
-
-	char* tok = strtok(NULL,  " ");
-
-	while (tok)
-	{
-		amount++;
-		tok = strtok(NULL, " ");
-	}
-
-	return amount; 
+	return current_op->argc; 
 }
 
-// Return parameter "argv" of command "command".
+// Return parameter "argv" of the running command.
 const char* Command_Argv(uint32_t argv)
 {
-    // restore the original last command so we can parse it
-    strncpy(last_token, last_command, MAX_STR);
+	if (!current_op
+	|| argv > current_op->argc)
+		return STRING_EMPTY;
 
-	char* str = String_GetTokenSeparatedPart(last_token, " ", argv);
+	return current_op->argv[argv]; 
+}
 
-	if (!str)
-		return STRING_EMPTY;
+// Return parameter "argv" of the running command, decoded as hex when the script was compiled.
+uint32_t Command_ArgHex(uint32_t argv)
+{
+	if (!current_op
+	|| argv > current_op->argc)
+		return 0;
 
-	return str; 
+	return current_op->argv_hex[argv];
 }
 
+// Runs a single line (e.g. from the REPL). It goes through the same compile step as a script, it's just a one-line program.
 void NVPlay_RunScriptCommand(char* line_buf)
 {
-	// skip blank lines if they exist
-	if (String_IsEntirelyWhitespace(line_buf, MAX_STR))
-		return; 
-
-	// trim any whitespace
-	// todo: string_rtrim (after the test rectangle script is verified to work.)
-	char* line_buf_trimmed = String_LTrim(String_RTrim(line_buf, MAX_STR), MAX_STR);
-
-	// skip commented lines
-	if (line_buf_trimmed[0] == '/'
-	&& line_buf_trimmed[1] == '/')
-		return; 
-
-	Logging_Write(LOG_LEVEL_DEBUG, "Trimmed command string: %s\n", line_buf, line_buf_trimmed);
-
-	strncpy(last_command, line_buf_trimmed, MAX_STR);
-
-	// this gets the command
-	char* command_name = strtok(line_buf_trimmed, " ");
-
-	int32_t script_command_id = 0;
-	gpu_script_command_t* script_command = &commands[script_command_id];
-
-	bool command_valid = false; 
-	bool command_found = false; 
-
-	// just use a valid abbreviated name
-	while (script_command->name_abbrev)
-	{
-		if (!strncmp(script_command->name_full, command_name, MAX_STR)
-		|| !strncmp(script_command->name_abbrev, command_name, MAX_STR))
-		{
-			// store one for found and one for valid
-			command_found = true; 
-			command_valid = true; 
-
-			// command code uses Command_Argc and Command_Argv to get functions	
-			// don't terminate processing if a function pointer is not present though
-			if (!script_command->function)
-			{
-				Logging_Write(LOG_LEVEL_WARNING, "Command %s has no function!\n", script_command->name_full);
-				command_valid = false; 
-			}
-
-			if (Command_Argc() < script_command->num_parameters)
-			{
-				Logging_Write(LOG_LEVEL_WARNING, "Command %s does not have enough parameters!\n", script_command->name_full);
-				command_valid = false; 
-			}
-
-			if (command_found
-			&& command_valid)
-			{
-				if (!script_command->function())
-					Logging_Write(LOG_LEVEL_ERROR, "Command %s failed to execute!\n", script_command->name_full);
-
-				// keep command_valid true
-			}
-
-		}
-
-		// increment command id
-		script_command_id++;
-		script_command = &commands[script_command_id];
-	}
-
-	if (!command_valid && !command_found)
-		Logging_Write(LOG_LEVEL_WARNING, "Unknown command %s\n", last_token);
+	gpu_script_program_t program = {0};
+
+	if (Script_CompileLine(&program, line_buf, 1)
+	&& Script_FinishCompile(&program))
+		Script_Execute(&program);
+
+	Script_Free(&program);
 }
 
 void NVPlay_RunScript(const char* filename)
 {
-	FILE* script_file = fopen(filename, "rb+");
-	char line_buf[MAX_STR] = {0};
+	uint64_t compile_start = profile_state.enabled ? Profile_ReadCounter() : 0;
+	gpu_script_program_t* program = Script_AcquireProgram(filename);
 
-	// Don't log if the string is not autoexec.nvs
-	if (!script_file)
-	{
-		// don't log
-		if (strcasecmp(filename, AUTOEXEC_FILENAME))
-			Logging_Write(LOG_LEVEL_ERROR, "Couldn't open script file %s\n", filename);
-
-		return;
-	}
-
-	Logging_Write(LOG_LEVEL_MESSAGE, "Running script file %s\n", script_file);
-
-	// Check for version compatibility
-	uint32_t script_start = 0;
-	int32_t script_major = 0, script_minor = 0, script_revision = 0;
-
-	bool done = false;
-	bool is_supported_version = true; 
-
-	/* 
-		Apparently this is faster than strspn and strcspn 
-		If we need to add more keywords this code will have to be reworked
-
-		WARNING: VERY BAD
-	*/
-	while (!done)
-	{
-		if (feof(script_file))
-			break; // get out=
-
-		fgets(line_buf, MAX_STR, script_file);
-
-		for (uint32_t i = 0; i < strlen(line_buf); i++)
-		{
-			// if it is NOT a space...
-			if (!isspace(line_buf[i]))
-				break;  // don't bother processing the rest of the line
-		}
-	}
-
-	// Find version string
-	if (!strstr(line_buf, AUTOEXEC_FILENAME))
-	{
-		char* ver_tok = strtok(line_buf, ".");
-
-		if (!ver_tok)
-			goto parsed_version; 
-		
-		// try and extract each individual version
-		script_major = atoi(strtok(NULL, "."));
-		if (!script_major) goto parsed_version;
-		script_minor = atoi(strtok(NULL, "."));
-		if (!script_minor) goto parsed_version;
-		script_revision = atoi(strtok(NULL, "."));
-		if (!script_revision) goto parsed_version; 
-
-		// Support strategy:
-		// Older not supported, newer supported (DUH!)
-		is_supported_version = (script_major >= APP_MAJOR
-		&& script_minor >= APP_MINOR
-		&& script_revision >= APP_REVISION);
-
-		// this is horrible (WRITE A REAL LEXER!!!!), don't try and execute the minimum_version command
-		script_start = ftell(script_file);
-	}
-
-parsed_version:
-	if (!is_supported_version)
-	{
-		Logging_Write(LOG_LEVEL_ERROR, "This script requires NVPlay version %d.%d.%d but you have version %d.%d.%d. Please update to use this script.\n",
-		script_major, script_minor, script_revision, APP_MAJOR, APP_MINOR, APP_REVISION);
+	if (!program)
 		return;
-	}
 
-	// go back to the start of the script so that we can actually read the script
-	fseek(script_file, script_start, SEEK_SET);
+	if (profile_state.enabled)
+		Script_ProfileCompile(filename, Profile_ReadCounter() - compile_start);
 
-	while (!feof(script_file))
-	{
-		// start a new line
-		fgets(line_buf, MAX_STR, script_file);
+	Logging_Write(LOG_LEVEL_MESSAGE, "Running script file %s\n", filename);
 
-		NVPlay_RunScriptCommand(line_buf);
-	}
-}
\ No newline at end of file
+	Script_Execute(program);
+	Script_ReleaseProgram(program);
+}
@@ -0,0 +1,347 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    script_profile.c: Per-line script profiler (-profile, or rs file -profile)
+
+    Every op that runs is timed with Profile_ReadCounter and its time is split four ways:
+    - Interpreter: evaluating expressions, dispatch, control flow
+    - Command: the command function itself, minus the two below
+    - Hardware: inside the NV_/VGA_/PCI_ I/O functions
+    - Logging: inside Logging_Write
+
+    Times are inclusive, so an rs line includes everything the script it runs does. The report (hottest lines, then per command) goes to the log at
+    exit and every line goes to nvprof.csv.
+*/
+
+#include "core/script/script.h"
+#include "util/util.h"
+#include <nvplay.h>
+
+typedef struct script_profile_line_s
+{
+	uint32_t file;
+	uint32_t line_number;
+	const char* name;							// Command or keyword
+	uint32_t count;
+	uint64_t total_ticks;
+	uint64_t interpreter_ticks;
+	uint64_t command_ticks;
+	uint64_t io_ticks;
+	uint64_t log_ticks;
+	int32_t next;								// Next entry in the same bucket
+} script_profile_line_t;
+
+typedef struct script_profile_file_s
+{
+	char name[SCRIPT_PROFILE_MAX_FILE_NAME];
+	uint32_t runs;
+	uint64_t compile_ticks;
+} script_profile_file_t;
+
+script_profile_line_t* profile_lines = NULL;
+uint32_t profile_num_lines = 0;
+uint32_t profile_lines_capacity = 0;
+int32_t profile_buckets[SCRIPT_PROFILE_BUCKETS];
+
+script_profile_file_t profile_files[SCRIPT_PROFILE_MAX_FILES];
+uint32_t profile_num_files = 0;
+
+const char* profile_op_names[] =
+{
+	"command",
+	"set",
+	"branch",
+	"jump",
+	"for",
+	"endfor",
+	"wm32 batch",
+};
+
+void Script_ProfileEnable()
+{
+	if (profile_state.enabled)
+		return;
+
+	Profile_Init();
+
+	for (uint32_t i = 0; i < SCRIPT_PROFILE_BUCKETS; i++)
+		profile_buckets[i] = -1;
+
+	profile_state.enabled = true;
+	Logging_Write(LOG_LEVEL_MESSAGE, "Script profiling enabled. The report is written on exit\n");
+}
+
+// Returns the index of a file, adding it if it's new. Files past the limit share the last slot
+uint32_t Script_ProfileFile(const char* filename)
+{
+	if (!filename)
+		filename = SCRIPT_PROFILE_CONSOLE_NAME;
+
+	for (uint32_t i = 0; i < profile_num_files; i++)
+	{
+		if (!strncmp(profile_files[i].name, filename, SCRIPT_PROFILE_MAX_FILE_NAME - 1))
+			return i;
+	}
+
+	if (profile_num_files >= SCRIPT_PROFILE_MAX_FILES)
+		return SCRIPT_PROFILE_MAX_FILES - 1;
+
+	strncpy(profile_files[profile_num_files].name, filename, SCRIPT_PROFILE_MAX_FILE_NAME - 1);
+	return profile_num_files++;
+}
+
+void Script_ProfileCompile(const char* filename, uint64_t ticks)
+{
+	script_profile_file_t* file = &profile_files[Script_ProfileFile(filename)];
+
+	file->runs++;
+	file->compile_ticks += ticks;
+}
+
+int32_t Script_ProfileFindLine(uint32_t file, gpu_script_op_t* op)
+{
+	// Keywords are named by what was written, batches and the second op of a for line by their type
+	bool is_keyword = (op->type != SCRIPT_OP_COMMAND && op->type != SCRIPT_OP_USER_BATCH && op->argv[0]);
+	const char* name = (op->type == SCRIPT_OP_COMMAND) ? op->command->name_full : (is_keyword ? op->argv[0] : profile_op_names[op->type]);
+	uint32_t bucket = (file * 31 + op->line_number) % SCRIPT_PROFILE_BUCKETS;
+
+	// for lines are two ops, keep them apart by name
+	for (int32_t entry = profile_buckets[bucket]; entry >= 0; entry = profile_lines[entry].next)
+	{
+		if (profile_lines[entry].file == file
+		&& profile_lines[entry].line_number == op->line_number
+		&& !strcmp(profile_lines[entry].name, name))
+			return entry;
+	}
+
+	if (profile_num_lines >= profile_lines_capacity)
+	{
+		uint32_t new_capacity = profile_lines_capacity ? profile_lines_capacity << 1 : SCRIPT_INITIAL_CAPACITY;
+		script_profile_line_t* new_lines = realloc(profile_lines, new_capacity * sizeof(script_profile_line_t));
+
+		if (!new_lines)
+			return -1;
+
+		profile_lines = new_lines;
+		profile_lines_capacity = new_capacity;
+	}
+
+	script_profile_line_t* line = &profile_lines[profile_num_lines];
+	memset(line, 0, sizeof(script_profile_line_t));
+
+	// The name has to outlive the program, so copy keywords (command names are static)
+	line->file = file;
+	line->line_number = op->line_number;
+	line->name = is_keyword ? strdup(name) : name;
+	line->next = profile_buckets[bucket];
+
+	if (!line->name)
+		return -1;
+
+	profile_buckets[bucket] = profile_num_lines;
+	return profile_num_lines++;
+}
+
+/* Look up the profile entry of every op once, before the program runs. Returns NULL if out of memory (the program then runs unprofiled) */
+int32_t* Script_ProfileResolve(gpu_script_program_t* program)
+{
+	int32_t* entries = calloc(program->num_ops ? program->num_ops : 1, sizeof(int32_t));
+
+	if (!entries)
+		return NULL;
+
+	uint32_t file = Script_ProfileFile(program->filename);
+
+	for (uint32_t op_id = 0; op_id < program->num_ops; op_id++)
+	{
+		entries[op_id] = Script_ProfileFindLine(file, &program->ops[op_id]);
+
+		if (entries[op_id] < 0)
+		{
+			free(entries);
+			return NULL;
+		}
+	}
+
+	return entries;
+}
+
+void Script_ProfileBegin(script_profile_sample_t* sample)
+{
+	memset(sample, 0, sizeof(script_profile_sample_t));
+	sample->io = profile_state.io_ticks;
+	sample->log = profile_state.log_ticks;
+	sample->start = Profile_ReadCounter();
+}
+
+void Script_ProfileCommandBegin(script_profile_sample_t* sample)
+{
+	sample->command_io = profile_state.io_ticks;
+	sample->command_log = profile_state.log_ticks;
+	sample->command_start = Profile_ReadCounter();
+}
+
+void Script_ProfileCommandEnd(script_profile_sample_t* sample)
+{
+	sample->command_end = Profile_ReadCounter();
+	sample->command_end_io = profile_state.io_ticks;
+	sample->command_end_log = profile_state.log_ticks;
+}
+
+void Script_ProfileEnd(int32_t entry, script_profile_sample_t* sample)
+{
+	uint64_t total = Profile_ReadCounter() - sample->start;
+	uint64_t io = profile_state.io_ticks - sample->io;
+	uint64_t log = profile_state.log_ticks - sample->log;
+	uint64_t command = 0;
+
+	if (sample->command_end)
+	{
+		command = (sample->command_end - sample->command_start) - (sample->command_end_io - sample->command_io)
+		- (sample->command_end_log - sample->command_log);
+	}
+
+	script_profile_line_t* line = &profile_lines[entry];
+
+	line->count++;
+	line->total_ticks += total;
+	line->io_ticks += io;
+	line->log_ticks += log;
+	line->command_ticks += command;
+
+	// Whatever is left is the interpreter. Counter jitter can make this slightly negative on very short ops
+	if (total > io + log + command)
+		line->interpreter_ticks += total - io - log - command;
+}
+
+int Script_ProfileCompareLines(const void* a, const void* b)
+{
+	uint64_t total_a = profile_lines[*(const uint32_t*)a].total_ticks;
+	uint64_t total_b = profile_lines[*(const uint32_t*)b].total_ticks;
+
+	return (total_a < total_b) - (total_a > total_b);
+}
+
+bool Script_ProfileWriteCSV(const char* csv_filename)
+{
+	FILE* stream = fopen(csv_filename, "w");
+
+	if (!stream)
+	{
+		Logging_Write(LOG_LEVEL_ERROR, "Couldn't write script profile %s\n", csv_filename);
+		return false;
+	}
+
+	fprintf(stream, "file,line,command,count,total_us,interpreter_us,command_us,hardware_us,log_us\n");
+
+	for (uint32_t i = 0; i < profile_num_lines; i++)
+	{
+		script_profile_line_t* line = &profile_lines[i];
+
+		fprintf(stream, "%s,%lu,%s,%lu,%.1f,%.1f,%.1f,%.1f,%.1f\n", profile_files[line->file].name, line->line_number, line->name, line->count,
+			Profile_TicksToUs(line->total_ticks), Profile_TicksToUs(line->interpreter_ticks), Profile_TicksToUs(line->command_ticks),
+			Profile_TicksToUs(line->io_ticks), Profile_TicksToUs(line->log_ticks));
+	}
+
+	fclose(stream);
+	return true;
+}
+
+void Script_ProfileReport()
+{
+	if (!profile_state.enabled
+	|| !profile_num_lines)
+		return;
+
+	// Stop counting logging and I/O done by the report itself
+	profile_state.enabled = false;
+
+	uint32_t* order = malloc(profile_num_lines * sizeof(uint32_t));
+
+	if (!order)
+		return;
+
+	for (uint32_t i = 0; i < profile_num_lines; i++)
+		order[i] = i;
+
+	qsort(order, profile_num_lines, sizeof(uint32_t), Script_ProfileCompareLines);
+
+	Logging_Write(LOG_LEVEL_MESSAGE, "Script profile (us, inclusive):\n");
+
+	for (uint32_t i = 0; i < profile_num_files; i++)
+	{
+		Logging_Write(LOG_LEVEL_MESSAGE, "%s: %lu runs, %.1f loading/compiling\n", profile_files[i].name, profile_files[i].runs,
+			Profile_TicksToUs(profile_files[i].compile_ticks));
+	}
+
+	Logging_Write(LOG_LEVEL_MESSAGE, "%-20s %-16s %8s %10s %8s %10s %10s %10s %10s\n", "Line", "Command", "Count", "Total", "Avg", "Interp",
+		"Command", "Hardware", "Log");
+
+	for (uint32_t i = 0; i < profile_num_lines && i < SCRIPT_PROFILE_REPORT_LINES; i++)
+	{
+		script_profile_line_t* line = &profile_lines[order[i]];
+		char location[SCRIPT_PROFILE_MAX_FILE_NAME + 16] = {0};
+
+		// Resolved when the script was compiled, but never reached (e.g. the other side of an if). No average to show
+		if (!line->count)
+			continue;
+
+		snprintf(location, sizeof(location), "%s:%lu", profile_files[line->file].name, line->line_number);
+
+		Logging_Write(LOG_LEVEL_MESSAGE, "%-20s %-16s %8lu %10.1f %8.2f %10.1f %10.1f %10.1f %10.1f\n", location, line->name, line->count,
+			Profile_TicksToUs(line->total_ticks), Profile_TicksToUs(line->total_ticks) / line->count, Profile_TicksToUs(line->interpreter_ticks),
+			Profile_TicksToUs(line->command_ticks), Profile_TicksToUs(line->io_ticks), Profile_TicksToUs(line->log_ticks));
+	}
+
+	// Same thing grouped by command. Names are either static or strdup'd per line, so compare by contents
+	script_profile_line_t* by_command = calloc(profile_num_lines, sizeof(script_profile_line_t));
+	uint32_t num_commands = 0;
+
+	if (by_command)
+	{
+		for (uint32_t i = 0; i < profile_num_lines; i++)
+		{
+			script_profile_line_t* line = &profile_lines[i];
+			uint32_t command = 0;
+
+			while (command < num_commands
+			&& strcmp(by_command[command].name, line->name))
+				command++;
+
+			if (command == num_commands)
+				by_command[num_commands++].name = line->name;
+
+			by_command[command].count += line->count;
+			by_command[command].total_ticks += line->total_ticks;
+			by_command[command].interpreter_ticks += line->interpreter_ticks;
+			by_command[command].command_ticks += line->command_ticks;
+			by_command[command].io_ticks += line->io_ticks;
+			by_command[command].log_ticks += line->log_ticks;
+		}
+
+		Logging_Write(LOG_LEVEL_MESSAGE, "By command:\n");
+
+		for (uint32_t i = 0; i < num_commands; i++)
+		{
+			script_profile_line_t* line = &by_command[i];
+
+			if (!line->count)
+				continue;
+
+			Logging_Write(LOG_LEVEL_MESSAGE, "%-20s %-16s %8lu %10.1f %8.2f %10.1f %10.1f %10.1f %10.1f\n", "", line->name, line->count,
+				Profile_TicksToUs(line->total_ticks), Profile_TicksToUs(line->total_ticks) / line->count, Profile_TicksToUs(line->interpreter_ticks),
+				Profile_TicksToUs(line->command_ticks), Profile_TicksToUs(line->io_ticks), Profile_TicksToUs(line->log_ticks));
+		}
+
+		free(by_command);
+	}
+
+	free(order);
+
+	if (Script_ProfileWriteCSV(SCRIPT_PROFILE_CSV_FILE))
+		Logging_Write(LOG_LEVEL_MESSAGE, "Wrote every line to %s\n", SCRIPT_PROFILE_CSV_FILE);
+}
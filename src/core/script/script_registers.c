@@ -0,0 +1,158 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    script_registers.c: Register names in scripts
+
+    Anything starting with NV<generation>_ is looked up in a table generated from nv1_ref.h, nv3_ref.h and nv4_ref.h (cmake/RegisterTable.cmake)
+    when the line is compiled, and replaced by its value, so a name costs nothing when the line runs. NAME.VALUE is a field: the bit position in NAME
+    shifted by the value in NAME_VALUE, e.g. NV4_PMC_INTR_0_PFIFO.PENDING is (NV4_PMC_INTR_0_PFIFO_PENDING << NV4_PMC_INTR_0_PFIFO).
+
+    Names are checked against the GPU the script is compiled for, so an NV4 register in a script run on an NV3 is a compile error rather than a write
+    to whatever happens to be at that address on the NV3.
+*/
+
+#include "core/script/script.h"
+#include "util/util.h"
+#include <nvplay.h>
+#include <cmake/nvplay_registers.h>
+
+/* Names that couldn't be resolved. Script_CompileSource refuses to run a script that adds to this */
+uint32_t script_register_errors = 0;
+
+// Which table names can come from for this GPU. 0 if there isn't one
+uint32_t Script_RegisterGeneration()
+{
+	if (GPU_IsNV1())
+		return 1;
+	else if (GPU_IsNV3())
+		return 3;
+	else if (GPU_IsNV4orBetter()
+	&& !GPU_IsNV10())
+		return 4;
+
+	return 0;
+}
+
+// Returns the length of the register name (including any .VALUE) at the start of str, or 0 if there isn't one
+uint32_t Script_RegisterNameLength(const char* str)
+{
+	if (toupper((unsigned char)str[0]) != 'N'
+	|| toupper((unsigned char)str[1]) != 'V'
+	|| !isdigit((unsigned char)str[2]))
+		return 0;
+
+	uint32_t length = 3;
+
+	while (isdigit((unsigned char)str[length]))
+		length++;
+
+	if (str[length] != '_')
+		return 0;
+
+	while (isalnum((unsigned char)str[length]) || str[length] == '_')
+		length++;
+
+	if (str[length] == '.')
+	{
+		length++;
+
+		while (isalnum((unsigned char)str[length]) || str[length] == '_')
+			length++;
+	}
+
+	return length;
+}
+
+int Script_CompareRegisters(const void* a, const void* b)
+{
+	return strcmp(((const script_register_t*)a)->name, ((const script_register_t*)b)->name);
+}
+
+/* Find the first length characters of name in the table, for any generation. Doesn't log anything */
+const script_register_t* Script_FindRegister(const char* name, uint32_t length)
+{
+	char upper_name[SCRIPT_MAX_REGISTER_NAME];
+
+	if (length >= SCRIPT_MAX_REGISTER_NAME)
+		return NULL;
+
+	for (uint32_t i = 0; i < length; i++)
+		upper_name[i] = toupper((unsigned char)name[i]);
+
+	upper_name[length] = '\0';
+
+	script_register_t key = { upper_name, 0, 0 };
+
+	return bsearch(&key, script_registers, SCRIPT_NUM_REGISTERS, sizeof(script_register_t), Script_CompareRegisters);
+}
+
+/* Find a name that this GPU has. Logs why if it isn't there */
+const script_register_t* Script_FindRegisterForGPU(const char* name, uint32_t length, uint32_t line_number)
+{
+	const script_register_t* reg = Script_FindRegister(name, length);
+	uint32_t generation = Script_RegisterGeneration();
+
+	if (!reg)
+		Logging_Write(LOG_LEVEL_ERROR, "Line %lu: Unknown register %.*s\n", line_number, (int)length, name);
+	else if (!generation)
+		Logging_Write(LOG_LEVEL_ERROR, "Line %lu: Can't use %s, there are no register names for this GPU\n", line_number, reg->name);
+	else if (reg->generation != generation)
+	{
+		Logging_Write(LOG_LEVEL_ERROR, "Line %lu: %s is an NV%lu register, but this GPU uses NV%lu registers\n", line_number, reg->name,
+			reg->generation, generation);
+	}
+	else
+		return reg;
+
+	return NULL;
+}
+
+/* Get the value of the name (or NAME.VALUE field) in the first length characters of name. Returns false, and logs why, if it can't be used */
+bool Script_ResolveRegister(const char* name, uint32_t length, uint32_t line_number, uint32_t* value)
+{
+	const char* dot = memchr(name, '.', length);
+	uint32_t name_length = dot ? (uint32_t)(dot - name) : length;
+	const script_register_t* reg = Script_FindRegisterForGPU(name, name_length, line_number);
+
+	if (!reg)
+	{
+		script_register_errors++;
+		return false;
+	}
+
+	if (!dot)
+	{
+		*value = reg->value;
+		return true;
+	}
+
+	// NAME_VALUE
+	char field_name[SCRIPT_MAX_REGISTER_NAME];
+	uint32_t field_length = snprintf(field_name, SCRIPT_MAX_REGISTER_NAME, "%s_%.*s", reg->name, (int)(length - name_length - 1), dot + 1);
+
+	if (reg->value > 31)
+	{
+		Logging_Write(LOG_LEVEL_ERROR, "Line %lu: %s is %08lX, not a field's bit position\n", line_number, reg->name, reg->value);
+		script_register_errors++;
+		return false;
+	}
+
+	const script_register_t* field_value = (field_length < SCRIPT_MAX_REGISTER_NAME)
+		? Script_FindRegisterForGPU(field_name, field_length, line_number) : NULL;
+
+	if (!field_value)
+	{
+		if (field_length >= SCRIPT_MAX_REGISTER_NAME)
+			Logging_Write(LOG_LEVEL_ERROR, "Line %lu: Unknown register %.*s\n", line_number, (int)length, name);
+
+		script_register_errors++;
+		return false;
+	}
+
+	*value = field_value->value << reg->value;
+	return true;
+}
@@ -30,6 +30,9 @@ nv_test_t nv_tests[] =
     { PCI_VENDOR_GENERIC, PCI_DEVICE_GENERIC, "NV_DumpRAMFC", "NV Generic - Dump RAMFC", NVGeneric_DumpRAMFC},
     { PCI_VENDOR_GENERIC, PCI_DEVICE_GENERIC, "NV_DumpRAMRO", "NV Generic - Dump RAMRO", NVGeneric_DumpRAMRO}, 
     { PCI_VENDOR_GENERIC, PCI_DEVICE_GENERIC, "NV_DumpCACHE", "NV Generic - Dump on-die cache", NVGeneric_DumpPGRAPHCache}, 
+    { PCI_VENDOR_GENERIC, PCI_DEVICE_GENERIC, "NV_FingerprintMMIO", "NV Generic - Fingerprint MMIO", NVGeneric_FingerprintMMIO}, 
+    { PCI_VENDOR_GENERIC, PCI_DEVICE_GENERIC, "NV_DiscoverMMIOMap", "NV Generic - Discover MMIO map", NVGeneric_DiscoverMMIOMap}, 
+    { PCI_VENDOR_GENERIC, PCI_DEVICE_GENERIC, "NV_DetectVolatile", "NV Generic - Detect volatile registers", NVGeneric_DetectVolatile}, 
 
     // NV1 has two vendor ids
     { PCI_VENDOR_SGS, PCI_DEVICE_NV1_NV, "NV1_PrintMfgInfo", "NV1 Print Manufacturing Info", NV1_PrintMFGInfo},
@@ -8,6 +8,7 @@
     main.c: Runs main function and test mode
 */
 
+#include "core/remote/remote.h"
 #include "core/script/script.h"
 #include "nvplay.h"
 #include "util/util.h"
@@ -25,8 +26,13 @@ void NVPlay_Run()
 	// Make sure that nv_pmc_boot_0 got set
 	current_device.nv_pmc_boot_0 = NV_ReadMMIO32(NV_PMC_BOOT);
 
-	// Run autoexec.nvs if it exists
-	NVPlay_RunScript(AUTOEXEC_FILENAME);
+	// -profile. Turned on here so autoexec.nvs is profiled too
+	if (nvplay_state.config.profile_scripts)
+		Script_ProfileEnable();
+
+	// Run autoexec.nvs if it exists. Not in a dry run, its writes would end up in the report of the script being checked
+	if (nvplay_state.run_mode != NVPLAY_MODE_DRYRUN)
+		NVPlay_RunScript(AUTOEXEC_FILENAME);
 
 	switch (nvplay_state.run_mode)
 	{
@@ -44,6 +50,14 @@ void NVPlay_Run()
 			Logging_Write(LOG_LEVEL_DEBUG, "Running script and exiting...\n");
 			NVPlay_RunScript(nvplay_state.reg_script_file);
 			break;
+		case NVPLAY_MODE_DRYRUN:
+			Logging_Write(LOG_LEVEL_DEBUG, "Running script against the register model and exiting...\n");
+			NVPlay_RunScript(nvplay_state.reg_script_file);
+			break;
+		case NVPLAY_MODE_REMOTE:
+			Logging_Write(LOG_LEVEL_DEBUG, "Serving remote requests...\n");
+			Remote_Serve(nvplay_state.remote_port, nvplay_state.remote_baud);
+			break;
 		case NVPLAY_MODE_REPLAY:
 			Logging_Write(LOG_LEVEL_WARNING, "Replay mode is not yet implemented!\n");
 			break;
@@ -68,7 +82,7 @@ bool NVPlay_Init(int32_t argc, char** argv)
 	Console_Init();
 
 	log_settings.destination = (LOG_DEST_FILE | LOG_DEST_CONSOLE);
-	log_settings.flush_on_line = true; //bad idea?
+	log_settings.flush_on_line = false; // Buffered, see Log_Synchronous in nvplay.ini
 	log_settings.level = (LOG_LEVEL_DEBUG | LOG_LEVEL_MESSAGE | LOG_LEVEL_WARNING | LOG_LEVEL_ERROR);
 	log_settings.valid = true;
 	log_settings.redirect = LOG_REDIRECT_STDIN;
@@ -91,6 +105,15 @@ bool NVPlay_Init(int32_t argc, char** argv)
 		return true;
 	}
 
+	// No hardware needed (or touched), so none of the checks below apply
+	if (nvplay_state.run_mode == NVPLAY_MODE_DRYRUN)
+	{
+		if (!NV_ShadowInit())
+			NVPlay_Shutdown(NVPLAY_EXIT_CODE_NO_GPU_INIT);
+
+		return true;
+	}
+
 	NVPlay_DetectOS();
 
 	if (nvplay_state.os_level == NVPLAY_OS_NT)
@@ -129,10 +152,17 @@ bool NVPlay_Init(int32_t argc, char** argv)
 
 void NVPlay_Shutdown(uint32_t exit_code)
 {
+	Script_ProfileReport();
+	NV_ShadowReport();
+
 	if (current_device.initialised 
+		&& current_device.device_info.hal
 		&& current_device.device_info.hal->shutdown_function)
 		current_device.device_info.hal->shutdown_function();
 
+	NV_LogWaitStatistics();
+	Script_LogMemcacheStatistics();
+	Script_FreeMemcache();
 	Logging_Shutdown();
 	exit(exit_code);
 }
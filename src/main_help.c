@@ -13,7 +13,11 @@
 const char* msg_help = "nvPlay help:\n\n"
 "---COMMAND LINE OPTIONS---\n\n"
 "By default (without any command-line options) nvPlay enters into a REPL loop that lets you perform raw level I/O with a supported GPU.\n"
+"In the REPL, Up/Down go through the command history and PageUp shows the last 64KB printed: PgUp/PgDn/Up/Down/Home/End scroll, / searches, n/N find the next/previous match and Esc goes back.\n"
 "\x1b[1;32m-s, -script <file>.\x1b[1;00m: Run a .NVS script file.\n"
+"\x1b[1;32m-dryrun <file>.\x1b[1;00m: Run a .NVS script file against a model of the GPU's registers instead of the GPU (no card needed, DryRun_Boot0 in nvplay.ini picks the GPU). Out of bounds accesses and writes to read-only registers or registers with side effects are logged, and every register written and its final value is logged on exit. autoexec.nvs isn't run, and tests (rt) are refused, since they need the real GPU.\n"
+"\x1b[1;32m-remote <port> [baud].\x1b[1;00m: Take requests from tools/nvremote over a serial port (COM1-COM4, 115200 baud unless given) instead of entering the REPL. Press any key to stop.\n"
+"\x1b[1;32m-profile.\x1b[1;00m: Time every script line (split into interpreter, command, hardware access and logging) and write the hottest lines to the log and all of them to nvprof.csv on exit.\n"
 "\x1b[1;32m-nvs, -savestate <file>.\x1b[1;00m: EXPERIMENTAL FUNCTIONALITY: Load an NVS savestate file into your graphics hardware\n"
 "\x1b[1;32m-?, -help.\x1b[1;00m: Show this text and exit\n\n"
 "\x1b[1;32m---SUPPORTED GRAPHICS CARDS---\x1b[1;00m\n\n"
@@ -70,6 +70,8 @@ typedef enum nvplay_run_mode_e
 	NVPLAY_MODE_BOOTGPU = 3,		// Initialise graphics hardware and exit
 	NVPLAY_MODE_HELP = 4,			// Print help and exit
     NVPLAY_MODE_KERNEL_TEST = 5,    // GPU driver test mode
+    NVPLAY_MODE_DRYRUN = 6,         // Run script file against a model of the GPU (gpu_shadow.c)
+    NVPLAY_MODE_REMOTE = 7,         // Take requests over a serial port (remote_server.c)
 	// Should help be a mode?
 	// Dry run is not a mode - it's a variant of TESTS mode, same for all tests
 } nvplay_run_mode;
@@ -126,6 +128,17 @@ typedef struct nv_config_s
     bool nv10_always_map_128m;                      // NV1x: Always map 128MB
 	bool dumb_console;								// Use dumb console
     bool key_debug;                                 // Keyboard debug
+    bool console_fast_scroll;                       // Draw the console less often while output scrolls faster than it can be read
+    bool mmio_map_probe_writes;                     // NV_DiscoverMMIOMap: Write to each mapped page to find out if it is read-only
+    uint32_t volatile_samples;                      // NV_DetectVolatile: Reads per register
+    uint32_t volatile_interval_us;                  // NV_DetectVolatile: Time between reads
+    uint32_t volatile_range_start;                  // NV_DetectVolatile: Range to scan instead of the default regions
+    uint32_t volatile_range_end;
+    bool script_disable_cache;                      // Always compile scripts from source, don't read or write .nvc files
+    bool script_disable_batching;                   // Run every wm32 to USER on its own instead of batching them into PFIFO submissions
+    bool profile_scripts;                           // -profile: Time every script line and write a report on exit
+    uint32_t dry_run_boot_0;                        // -dryrun: NV_PMC_BOOT_0 of the GPU to pretend to be
+    uint32_t dry_run_vram;                          // -dryrun: Amount of VRAM to pretend to have
 } nv_config_t;
 
 bool Config_Load();
@@ -139,6 +152,8 @@ typedef struct nvplay_state_s
     char reg_script_file[MAX_STR];  // The registry script file to use
     char savestate_file[MAX_STR];   // The savestate file to use
     char replay_file[MAX_STR];      // The replay file to use
+    char remote_port[MAX_STR];      // -remote: COM1-COM4
+    uint32_t remote_baud;           // -remote: Baud rate
 	nv_config_t config;				// The configuration information loaded frromt he INI file
     WINDOW* window;                 // Curses window
 
@@ -9,6 +9,9 @@
 */
 
 #pragma once
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
 #include <util/util_ini.h>
 #include <util/util_scancodes.h>
 
@@ -16,6 +19,8 @@
 
 /* Logging system */
 #define LOG_FILE_DEFAULT_NAME           "nvplay.log"   
+#define LOG_BUFFER_SIZE                 65536       // Log file output is kept here until it's full, LOG_FLUSH_INTERVAL_MS passes or an error is logged
+#define LOG_FLUSH_INTERVAL_MS           1000
 
 typedef enum log_level 
 {
@@ -46,23 +51,119 @@ typedef enum log_redirect_e
     LOG_REDIRECT_STDERR = 1 << 3,               // Redirect STDERR to the log file
 } log_redirect; 
 
+// Subsystems that can log at their own level (Log_<name> in the [Debug] section of nvplay.ini)
+typedef enum log_channel_e
+{
+    LOG_CHANNEL_GENERAL = 0,                    // Everything that doesn't say otherwise (Logging_Write)
+    LOG_CHANNEL_SCRIPT = 1,                     // Script compiler and commands
+    LOG_CHANNEL_PCI = 2,                        // PCI BIOS calls
+    LOG_CHANNEL_FIFO = 3,                       // PFIFO and USER submission
+    LOG_CHANNEL_GRAPH = 4,                      // PGRAPH
+    LOG_CHANNEL_KERNEL = 5,                     // GPU kernel state changes
+    LOG_CHANNEL_DUMP = 6,                       // Dump tests
+
+    LOG_NUM_CHANNELS,
+} log_channel;
+
+// Messages below this level aren't compiled in at all. Set by NVPLAY_LOG_MIN_LEVEL in CMakeLists.txt
+#ifndef LOG_MIN_LEVEL
+#define LOG_MIN_LEVEL                   LOG_LEVEL_DEBUG
+#endif
+
 typedef struct log_settings_s
 {
     log_level level;
+    log_level channel_levels[LOG_NUM_CHANNELS];     // Levels each channel logs (as a bitfield). Start as level
     log_dest destination; 
     const char* file_name; 
     bool valid;                 // Determines if the log settings were actually set up
     bool open;                  // Determines if the log is actually open
-    bool flush_on_line;         // Determines if we should flush every single line.
+    bool flush_on_line;         // Write every line to the log file as it's logged, instead of buffering it. Slow, but nothing is lost in a hard lockup
     log_redirect redirect;      // Redirection flags
 } log_settings_t;
 
 extern log_settings_t log_settings; 
 
+extern const char* log_channel_names[LOG_NUM_CHANNELS];
+
 bool Logging_Init();
-void Logging_Write(log_level level, const char* fmt, ...);
+void Logging_WriteChannel(log_channel channel, log_level level, const char* fmt, ...);
+bool Logging_ParseLevel(const char* name, log_level* levels);
+void Logging_SetSynchronous(bool synchronous);
+void Logging_Flush();
 void Logging_Shutdown();
 
+/*
+    Check the level before anything else, so the arguments of a message nobody will see are never evaluated or formatted. Below LOG_MIN_LEVEL
+    the whole call is compiled out.
+*/
+#define Logging_IsEnabled(channel, level) \
+    ((level) >= LOG_MIN_LEVEL && (log_settings.channel_levels[(channel)] & (level)))
+
+#define Logging_WriteTo(channel, level, ...) \
+    do \
+    { \
+        if (Logging_IsEnabled(channel, level)) \
+            Logging_WriteChannel(channel, level, __VA_ARGS__); \
+    } while (0)
+
+#define Logging_Write(level, ...)       Logging_WriteTo(LOG_CHANNEL_GENERAL, level, __VA_ARGS__)
+
+// Structured events (util_eventlog.c)
+#include <util/util_events.h>
+
+#define LOG_EVENT_FILE_NAME             "nvplay.nvl"
+#define LOG_EVENT_FILE_MAGIC            0x474C564E      // 'NVLG'
+#define LOG_EVENT_FILE_VERSION          1
+#define LOG_EVENT_MAX_ARGS              6
+
+#define LOG_EVENT_ENUM(name, channel, level, num_args, format) name,
+
+typedef enum log_event_e
+{
+    LOG_EVENT_LIST(LOG_EVENT_ENUM)
+
+    LOG_NUM_EVENTS,
+} log_event;
+
+/*
+    The same table as constants, so Logging_Event can check an event's level against LOG_MIN_LEVEL and its number of arguments at compile time
+    instead of looking them up in log_events[]. The event has to be named directly for this to work.
+*/
+#define LOG_EVENT_CONSTANTS(name, channel, level, num_args, format) \
+    name##_CHANNEL = channel, name##_LEVEL = level, name##_NUM_ARGS = num_args,
+
+enum
+{
+    LOG_EVENT_LIST(LOG_EVENT_CONSTANTS)
+};
+
+typedef struct log_event_info_s
+{
+    const char* name;
+    log_channel channel;
+    log_level level;
+    uint32_t num_args;
+    const char* format;
+} log_event_info_t;
+
+extern const log_event_info_t log_events[LOG_NUM_EVENTS];
+
+bool Logging_OpenEventLog(const char* file_name);
+void Logging_WriteEvent(log_event event, const uint32_t* args);
+void Logging_FlushEventLog();
+void Logging_CloseEventLog();
+
+// Log an event with its arguments. Like Logging_WriteTo, nothing is evaluated if its channel doesn't log its level
+#define Logging_Event(event, ...) \
+    do \
+    { \
+        _Static_assert(sizeof((const uint32_t[]){ __VA_ARGS__ }) / sizeof(uint32_t) == event##_NUM_ARGS, \
+            #event " logged with the wrong number of arguments"); \
+        if (Logging_IsEnabled(event##_CHANNEL, event##_LEVEL)) \
+            Logging_WriteEvent(event, (const uint32_t[]){ __VA_ARGS__ }); \
+    } while (0)
+
 // String utils
 
 bool String_IsEntirelyWhitespace(char* fmt, uint32_t max);
@@ -70,3 +171,69 @@ char* String_GetTokenSeparatedPart(char* fmt, const char* delim, uint32_t n);
 
 char* String_LTrim(char* fmt, uint32_t max);
 char* String_RTrim(char* fmt, uint32_t max);
+
+// Profiling (util_profile.c)
+// Time is counted in TSC ticks if the CPU has one, otherwise in uclock ticks. Profile_TicksToUs converts either.
+
+typedef struct profile_state_s
+{
+    bool initialised;
+    bool use_tsc;
+    double ticks_per_us;
+
+    // Time spent in hardware I/O and logging since profiling started. Only the outermost call counts, so nested I/O functions aren't counted twice
+    bool enabled;
+    uint32_t io_depth;
+    uint64_t io_ticks;
+    uint32_t log_depth;
+    uint64_t log_ticks;
+} profile_state_t;
+
+extern profile_state_t profile_state;
+
+static inline uint64_t Profile_ReadCounter()
+{
+    if (profile_state.use_tsc)
+    {
+        uint32_t low, high;
+        __asm__ __volatile__("rdtsc" : "=a"(low), "=d"(high));
+        return ((uint64_t)high << 32) | low;
+    }
+
+    return (uint64_t)uclock();
+}
+
+static inline uint64_t Profile_IOStart()
+{
+    if (!profile_state.enabled
+    || profile_state.io_depth++)
+        return 0;
+
+    return Profile_ReadCounter();
+}
+
+static inline void Profile_IOEnd(uint64_t start)
+{
+    if (profile_state.enabled
+    && !--profile_state.io_depth)
+        profile_state.io_ticks += Profile_ReadCounter() - start;
+}
+
+static inline uint64_t Profile_LogStart()
+{
+    if (!profile_state.enabled
+    || profile_state.log_depth++)
+        return 0;
+
+    return Profile_ReadCounter();
+}
+
+static inline void Profile_LogEnd(uint64_t start)
+{
+    if (profile_state.enabled
+    && !--profile_state.log_depth)
+        profile_state.log_ticks += Profile_ReadCounter() - start;
+}
+
+bool Profile_Init();
+double Profile_TicksToUs(uint64_t ticks);
@@ -0,0 +1,149 @@
+/* 
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs 
+    Licensed under the MIT license (see license file)
+
+    util_eventlog.c: Binary event log
+
+    nvplay.nvl starts with a header holding the channel names and the whole event table (format strings included), so tools/nvlogdec can decode
+    it without knowing which build wrote it. After that every event is one record:
+
+        event (2) timestamp (4) arguments (4 each, as many as the event table says)
+
+    The timestamp is uclock ticks since the log was opened, truncated to 32 bits; the decoder adds the wraps back (once an hour). Everything is
+    little endian, like the machine writing it, so records are copied out as they are.
+*/
+
+#include "util.h"
+#include <nvplay.h>
+
+#define LOG_EVENT_INFO(name, channel, level, num_args, format) { #name, channel, level, num_args, format },
+
+const log_event_info_t log_events[LOG_NUM_EVENTS] =
+{
+    LOG_EVENT_LIST(LOG_EVENT_INFO)
+};
+
+FILE* log_event_stream = NULL;
+uclock_t log_event_start = 0;
+
+static void Logging_EventWrite8(uint8_t value)
+{
+    fwrite(&value, sizeof(uint8_t), 1, log_event_stream);
+}
+
+static void Logging_EventWrite16(uint16_t value)
+{
+    fwrite(&value, sizeof(uint16_t), 1, log_event_stream);
+}
+
+static void Logging_EventWrite32(uint32_t value)
+{
+    fwrite(&value, sizeof(uint32_t), 1, log_event_stream);
+}
+
+static void Logging_EventWriteString(const char* string)
+{
+    uint16_t length = strlen(string);
+
+    Logging_EventWrite16(length);
+    fwrite(string, length, 1, log_event_stream);
+}
+
+/* Start writing events to file_name instead of logging them as text. Returns false (and keeps logging them as text) if it can't be opened */
+bool Logging_OpenEventLog(const char* file_name)
+{
+    if (log_event_stream)
+        return true;
+
+    log_event_stream = fopen(file_name, "wb");
+
+    if (!log_event_stream)
+    {
+        Logging_Write(LOG_LEVEL_ERROR, "Couldn't open the event log %s, logging events as text\n", file_name);
+        return false;
+    }
+
+    // Flushed along with the text log (see Logging_Flush)
+    setvbuf(log_event_stream, NULL, _IOFBF, LOG_BUFFER_SIZE);
+
+    Logging_EventWrite32(LOG_EVENT_FILE_MAGIC);
+    Logging_EventWrite16(LOG_EVENT_FILE_VERSION);
+    Logging_EventWrite32(UCLOCKS_PER_SEC);
+
+    Logging_EventWrite8(LOG_NUM_CHANNELS);
+
+    for (uint32_t i = 0; i < LOG_NUM_CHANNELS; i++)
+        Logging_EventWriteString(log_channel_names[i]);
+
+    Logging_EventWrite16(LOG_NUM_EVENTS);
+
+    for (uint32_t i = 0; i < LOG_NUM_EVENTS; i++)
+    {
+        Logging_EventWrite8(log_events[i].channel);
+        Logging_EventWrite8(log_events[i].level);
+        Logging_EventWrite8(log_events[i].num_args);
+        Logging_EventWriteString(log_events[i].name);
+        Logging_EventWriteString(log_events[i].format);
+    }
+
+    log_event_start = uclock();
+
+    Logging_Write(LOG_LEVEL_MESSAGE, "Logging events to %s (decode it with tools/nvlogdec)\n", file_name);
+    return true;
+}
+
+/*
+    Use Logging_Event instead, it doesn't evaluate the arguments if the event won't be logged. It has also already checked args holds as many
+    arguments as the event takes, so every record of an event is the same size
+*/
+void Logging_WriteEvent(log_event event, const uint32_t* args)
+{
+    const log_event_info_t* info = &log_events[event];
+    uint32_t num_args = info->num_args;
+
+    if (!log_event_stream)
+    {
+        // The format strings only print the arguments they have, the rest are ignored
+        uint32_t text_args[LOG_EVENT_MAX_ARGS] = {0};
+
+        memcpy(text_args, args, num_args * sizeof(uint32_t));
+        Logging_WriteChannel(info->channel, info->level, info->format, text_args[0], text_args[1], text_args[2], text_args[3], text_args[4],
+            text_args[5]);
+        return;
+    }
+
+    uint64_t profile_start = Profile_LogStart();
+    uint8_t record[6 + (LOG_EVENT_MAX_ARGS << 2)];
+    uint32_t timestamp = (uint32_t)(uclock() - log_event_start);
+    uint16_t id = event;
+
+    memcpy(&record[0], &id, sizeof(uint16_t));
+    memcpy(&record[2], &timestamp, sizeof(uint32_t));
+    memcpy(&record[6], args, num_args * sizeof(uint32_t));
+    fwrite(record, 6 + (num_args << 2), 1, log_event_stream);
+
+    // Same rule as the text log, errors go to disk straight away
+    if (info->level == LOG_LEVEL_ERROR
+    || log_settings.flush_on_line)
+        fflush(log_event_stream);
+
+    Profile_LogEnd(profile_start);
+}
+
+void Logging_FlushEventLog()
+{
+    if (log_event_stream)
+        fflush(log_event_stream);
+}
+
+void Logging_CloseEventLog()
+{
+    if (!log_event_stream)
+        return;
+
+    fclose(log_event_stream);
+    log_event_stream = NULL;
+}
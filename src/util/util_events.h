@@ -0,0 +1,38 @@
+/* 
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    util_events.h: Structured log events
+
+    Messages that get logged thousands of times are events instead of printf calls. Each one has its format string here, once, and is logged with
+    Logging_Event and its arguments (all uint32_t). With the binary event log on (Log_Binary in nvplay.ini) they are written to nvplay.nvl as
+    raw numbers and never formatted on the target; tools/nvlogdec turns that back into text, CSV or JSON. Otherwise they are logged as text as usual.
+    Logging_Event has to be given the event by name, it checks the level and the number of arguments at compile time.
+
+    New events go at the end, the IDs are in the files. Events that are no longer logged are removed; every file carries the table it was
+    written with, so old logs still decode. The format strings take %d/%u/%x/%X/%c (with l, flags and width) and nothing else.
+*/
+
+#pragma once
+
+//  X(name, channel, level, number of arguments, format)
+#define LOG_EVENT_LIST(X) \
+    X(LOG_EVENT_DUMP_BAR0_PROGRESS, LOG_CHANNEL_DUMP, LOG_LEVEL_DEBUG, 1, \
+        "Dumped BAR0 up to: %08lX\n") \
+    X(LOG_EVENT_DUMP_BAR1_PROGRESS, LOG_CHANNEL_DUMP, LOG_LEVEL_DEBUG, 1, \
+        "Dumped BAR1 up to: %08lX\n") \
+    X(LOG_EVENT_VOLATILE_COUNTER, LOG_CHANNEL_GENERAL, LOG_LEVEL_DEBUG, 4, \
+        "NV_DetectVolatile: %06lX is counter (%08lX -> %08lX, %lu/sec)\n") \
+    X(LOG_EVENT_VOLATILE_NOISE, LOG_CHANNEL_GENERAL, LOG_LEVEL_DEBUG, 4, \
+        "NV_DetectVolatile: %06lX is noise (%08lX -> %08lX, %lu/sec)\n") \
+    X(LOG_EVENT_VOLATILE_READ_SIDE_EFFECT, LOG_CHANNEL_GENERAL, LOG_LEVEL_DEBUG, 4, \
+        "NV_DetectVolatile: %06lX is readsideeffect (%08lX -> %08lX, %lu/sec)\n") \
+    X(LOG_EVENT_FINGERPRINT_PAGE_DIFFERS, LOG_CHANNEL_GENERAL, LOG_LEVEL_MESSAGE, 3, \
+        "Fingerprint: Page %06lX differs (expected %08lX, got %08lX)\n") \
+    X(LOG_EVENT_SCRIPT_WAIT_DONE, LOG_CHANNEL_SCRIPT, LOG_LEVEL_DEBUG, 4, \
+        "Command_WaitFor: %06lX & %08lX == %08lX after %lu us\n") \
+    X(LOG_EVENT_OVERCLOCK_STEP, LOG_CHANNEL_GENERAL, LOG_LEVEL_MESSAGE, 2, \
+        "Trying MCLK = %lu kHz (NV_PRAMDAC_MPLL_COEFF = %08lX)...\n")
@@ -11,15 +11,103 @@
 #include <core/console/console.h>
 #include "util.h"
 #include <nvplay.h>
+#include <signal.h>
 
 log_settings_t log_settings = {0};  
 
 // Internal globals
 FILE* log_file_stream = NULL; 
 
+// File output waiting to be written
+char log_buffer[LOG_BUFFER_SIZE];
+uint32_t log_buffer_used = 0;
+uclock_t log_last_flush = 0;
+
 // Internal defines
 #define LOG_STRING_BUF_SIZE     1024
 
+// Also the nvplay.ini names (Log_Script etc.)
+const char* log_channel_names[LOG_NUM_CHANNELS] =
+{
+    "General",
+    "Script",
+    "PCI",
+    "FIFO",
+    "Graph",
+    "Kernel",
+    "Dump",
+};
+
+// Set while Logging_Flush is writing, so a signal that arrives in the middle doesn't write the buffer a second time
+volatile sig_atomic_t log_flushing = 0;
+
+/* Write out everything buffered. Safe to call at any time, including from the crash handler */
+void Logging_Flush()
+{
+    log_flushing = 1;
+    Logging_FlushEventLog();
+
+    if (log_file_stream
+    && log_buffer_used)
+    {
+        fwrite(log_buffer, log_buffer_used, 1, log_file_stream);
+        fflush(log_file_stream);
+
+        log_buffer_used = 0;
+        log_last_flush = uclock();
+    }
+
+    log_flushing = 0;
+}
+
+static void Logging_BufferWrite(const char* string, uint32_t size)
+{
+    if (!log_file_stream)
+        return;
+
+    if (log_buffer_used + size > LOG_BUFFER_SIZE)
+        Logging_Flush();
+
+    memcpy(&log_buffer[log_buffer_used], string, size);
+    log_buffer_used += size;
+}
+
+static void Logging_FlushTick(void* context)
+{
+    Logging_Flush();
+}
+
+/* Get what we have onto the disk before we go down, then let the default handler do its thing (e.g. DJGPP's register dump) */
+static void Logging_CrashHandler(int signal_number)
+{
+    char message[64] = {0};
+
+    // Interrupted a flush (Ctrl-C while it was writing, or it faulted). The buffer is already on its way, so only push out what stdio has
+    if (log_flushing)
+    {
+        if (log_file_stream)
+            fflush(log_file_stream);
+    }
+    else
+    {
+        snprintf(message, sizeof(message), "[ERROR]: Caught signal %d, exiting\n", signal_number);
+        Logging_BufferWrite(message, strlen(message));
+        Logging_Flush();
+    }
+
+    signal(signal_number, SIG_DFL);
+    raise(signal_number);
+}
+
+/* Switch between flushing every line and buffering. Takes effect immediately */
+void Logging_SetSynchronous(bool synchronous)
+{
+    log_settings.flush_on_line = synchronous;
+
+    if (synchronous)
+        Logging_Flush();
+}
+
 bool Logging_Init()
 {
     if (!log_settings.valid)
@@ -28,6 +116,10 @@ bool Logging_Init()
         return false; 
     }
 
+    // Every channel logs what the main level does until nvplay.ini says otherwise
+    for (uint32_t i = 0; i < LOG_NUM_CHANNELS; i++)
+        log_settings.channel_levels[i] = log_settings.level;
+
     if (!log_settings.level)
     {
         printf("Warning: No log channels specified. Nothing will be logged!\n");
@@ -41,6 +133,20 @@ bool Logging_Init()
             log_file_stream = fopen(log_settings.file_name, "w+"); // open in text mode
         else
             log_file_stream = fopen(LOG_FILE_DEFAULT_NAME, "w+");
+
+        log_last_flush = uclock();
+
+        // Exits, crashes, Ctrl-C and Ctrl-Break (SIGINT under DJGPP) all flush the buffer first
+        atexit(Logging_Flush);
+        signal(SIGABRT, Logging_CrashHandler);
+        signal(SIGFPE, Logging_CrashHandler);
+        signal(SIGILL, Logging_CrashHandler);
+        signal(SIGINT, Logging_CrashHandler);
+        signal(SIGSEGV, Logging_CrashHandler);
+        signal(SIGTERM, Logging_CrashHandler);
+
+        // Sitting at the REPL prompt still gets the log written
+        Console_RegisterTick("Log flush", Logging_FlushTick, NULL, LOG_FLUSH_INTERVAL_MS);
     }
 
     if (log_settings.redirect & LOG_REDIRECT_STDIN)
@@ -55,14 +161,44 @@ bool Logging_Init()
     return true; 
 }
 
-void Logging_Write(log_level level, const char* fmt, ...)
+/*
+    Turn a level name from nvplay.ini into the levels to log: that level and everything more important. "none" logs nothing.
+    Returns false if the name isn't a level
+*/
+bool Logging_ParseLevel(const char* name, log_level* levels)
+{
+    static const char* level_names[] = { "debug", "message", "warning", "error" };
+
+    if (!strcasecmp(name, "none"))
+    {
+        *levels = 0;
+        return true;
+    }
+
+    for (uint32_t i = 0; i < sizeof(level_names) / sizeof(level_names[0]); i++)
+    {
+        if (!strcasecmp(name, level_names[i]))
+        {
+            // Levels are single bits, most important last
+            *levels = (log_level)(~((1 << i) - 1) & (LOG_LEVEL_DEBUG | LOG_LEVEL_MESSAGE | LOG_LEVEL_WARNING | LOG_LEVEL_ERROR));
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* Use Logging_Write or Logging_WriteTo instead, they don't evaluate the arguments if the message won't be logged */
+void Logging_WriteChannel(log_channel channel, log_level level, const char* fmt, ...)
 {
     if (!log_settings.open)
         return; 
 
+    uint64_t profile_start = Profile_LogStart();
     va_list ap = {0};
     
     const char* prefix = NULL;
+    char prefix_buf[32] = {0};
     char log_string[LOG_STRING_BUF_SIZE] = {0};
 
     // ignore prefix if LOG_LEVEL_MESSAGE
@@ -81,19 +217,22 @@ void Logging_Write(log_level level, const char* fmt, ...)
             break;
     }
 
+    // Say where it came from, unless that's anywhere
+    if (prefix
+    && channel != LOG_CHANNEL_GENERAL)
+    {
+        snprintf(prefix_buf, sizeof(prefix_buf), "%.*s/%s]: ", (int)(strchr(prefix, ']') - prefix), prefix, log_channel_names[channel]);
+        prefix = prefix_buf;
+    }
+
     // write out the prefix separately, it simplifies the code below
     if (prefix)
     {
         if (log_settings.destination & LOG_DEST_CONSOLE)
-        {
-            if (nvplay_state.config.dumb_console)
-                fputs(prefix, stdout);
-            else
-                Console_PushLine(prefix);
-        }
+            Console_PushLine(prefix);
 
         if (log_settings.destination & LOG_DEST_FILE)
-            fwrite(prefix, strlen(prefix), 1, log_file_stream);
+            Logging_BufferWrite(prefix, strlen(prefix));
     }
 
     va_start(ap, fmt);
@@ -103,24 +242,31 @@ void Logging_Write(log_level level, const char* fmt, ...)
 
     // don't print a newline after
     if (log_settings.destination & LOG_DEST_CONSOLE)
-    {
-        if (nvplay_state.config.dumb_console)
-            fputs(log_string, stdout);
-        else 
-            Console_PushLine(log_string);
-    }
+        Console_PushLine(log_string);
 
     if (log_settings.destination & LOG_DEST_FILE)
-        fwrite(log_string, strlen(log_string), 1, log_file_stream);
+        Logging_BufferWrite(log_string, strlen(log_string));
 
     va_end(ap);
 
-    if (log_settings.flush_on_line)
-        fflush(log_file_stream);
+    // Errors are often followed by a lockup, so don't leave them in memory
+    if (log_settings.flush_on_line
+    || level == LOG_LEVEL_ERROR
+    || uclock() - log_last_flush >= (uclock_t)LOG_FLUSH_INTERVAL_MS * UCLOCKS_PER_SEC / 1000)
+        Logging_Flush();
+
+    Profile_LogEnd(profile_start);
 }
 
 void Logging_Shutdown()
 {
-    fclose(log_file_stream);
+    Logging_Flush();
+    Logging_CloseEventLog();
+    Console_UnregisterTick(Logging_FlushTick, NULL);
+
+    if (log_file_stream)
+        fclose(log_file_stream);
+
+    log_file_stream = NULL;
     log_settings.open = false;
 }
\ No newline at end of file
@@ -0,0 +1,64 @@
+/* 
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs 
+    Licensed under the MIT license (see license file)
+
+    util_profile.c: High resolution counter for profiling
+
+    Uses RDTSC on anything that has it (Pentium and later), calibrated against uclock. A 486 falls back to uclock, which is only ~0.84us
+    but good enough to find a slow register.
+*/
+
+#include "util.h"
+#include <nvplay.h>
+#include <cpuid.h>
+
+profile_state_t profile_state = {0};
+
+// Time the TSC against uclock for this long
+#define PROFILE_CALIBRATION_US      50000
+#define PROFILE_CPUID_EDX_TSC       (1 << 4)        // CPUID leaf 1: Time stamp counter present
+
+bool Profile_Init()
+{
+    if (profile_state.initialised)
+        return true;
+
+    uint32_t eax = 0, ebx = 0, ecx = 0, edx = 0;
+
+    // __get_cpuid checks that CPUID exists first (486s without it just get uclock)
+    profile_state.use_tsc = (__get_cpuid(1, &eax, &ebx, &ecx, &edx)
+    && (edx & PROFILE_CPUID_EDX_TSC));
+
+    if (profile_state.use_tsc)
+    {
+        uclock_t calibration_ticks = ((uclock_t)PROFILE_CALIBRATION_US * UCLOCKS_PER_SEC) / 1000000;
+        uclock_t start_clock = uclock();
+        uint64_t start_tsc = Profile_ReadCounter();
+
+        while (uclock() - start_clock < calibration_ticks)
+            ;
+
+        uclock_t elapsed_clock = uclock() - start_clock;
+        uint64_t elapsed_tsc = Profile_ReadCounter() - start_tsc;
+
+        profile_state.ticks_per_us = (double)elapsed_tsc / ((double)elapsed_clock * 1000000.0 / UCLOCKS_PER_SEC);
+    }
+    else
+        profile_state.ticks_per_us = (double)UCLOCKS_PER_SEC / 1000000.0;
+
+    Logging_Write(LOG_LEVEL_DEBUG, "Profiler using %s (%.2f ticks/us)\n", profile_state.use_tsc ? "RDTSC" : "uclock", profile_state.ticks_per_us);
+
+    profile_state.initialised = true;
+    return true;
+}
+
+double Profile_TicksToUs(uint64_t ticks)
+{
+    if (profile_state.ticks_per_us <= 0)
+        return 0;
+
+    return (double)ticks / profile_state.ticks_per_us;
+}
@@ -0,0 +1,808 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    nvfbx.c: Host-side framebuffer extractor
+
+    Takes the nvbar0.bin/nvbar1.bin pair written by NV_DumpMMIO and turns the VRAM dump into a picture, so dumps can be looked at without
+    running them through an emulator. The scanout surface is worked out from the registers in the BAR0 dump (PFB_CONFIG_0 for the width and
+    depth, PRAMDAC_GENERAL_CONTROL for 555/565 and PCRTC_START for the start address on NV4+), but everything can be overridden on the command
+    line to pull arbitrary surfaces out of VRAM.
+
+    This runs on the machine you copy the dumps to, not under DOS. Build it with any C99 compiler, e.g.:
+        cc -O2 -o nvfbx tools/nvfbx/nvfbx.c
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// Registers we read out of the BAR0 dump (same offsets on NV3 and NV4)
+#define NV_PMC_BOOT_0                           0x000000
+#define NV_PFB_CONFIG_0                         0x100200
+#define NV_PFB_CONFIG_0_RESOLUTION_MASK         0x3F        // Horizontal resolution / 32
+#define NV_PFB_CONFIG_0_PIXEL_DEPTH             8
+#define NV_PFB_CONFIG_0_PIXEL_DEPTH_MASK        0x03
+#define NV_PCRTC_START                          0x600800    // NV4+ only. On NV3 the start address only lives in CR0C/CR0D/CR19
+#define NV_PCRTC_START_MASK                     0x01FFFFFC
+#define NV_PRAMDAC_GENERAL_CONTROL              0x680600
+#define NV_PRAMDAC_GENERAL_CONTROL_565_MODE     12          // "ALT_MODE" on NV4
+
+// What NV_DumpMMIO writes for registers it didn't read
+#define NV_DUMP_NOT_READ                        0x4E4F4E45  // 'NONE'
+
+#define NVFBX_MAX_DIMENSION                     4096
+#define NVFBX_PNG_MAX_STORED_BLOCK              65535
+
+typedef enum nvfbx_format_e
+{
+    NVFBX_FORMAT_NONE = 0,
+    NVFBX_FORMAT_8BPP = 1,                      // Palettised
+    NVFBX_FORMAT_555 = 2,
+    NVFBX_FORMAT_565 = 3,
+    NVFBX_FORMAT_32BPP = 4,                     // X8R8G8B8
+} nvfbx_format_t;
+
+typedef struct nvfbx_surface_s
+{
+    uint32_t offset;                            // Offset into BAR1
+    uint32_t width;
+    uint32_t height;
+    uint32_t pitch;                             // In bytes
+    nvfbx_format_t format;
+} nvfbx_surface_t;
+
+typedef struct nvfbx_buffer_s
+{
+    uint8_t* data;
+    uint32_t size;
+} nvfbx_buffer_t;
+
+const char* format_names[] =
+{
+    "none",
+    "8bpp (palettised)",
+    "15bpp (X1R5G5B5)",
+    "16bpp (R5G6B5)",
+    "32bpp (X8R8G8B8)",
+};
+
+// Output palette for 8bpp, stored as B8G8R8X8 like every other converted pixel
+uint32_t palette[256];
+
+//
+// Files
+//
+
+bool NVFBX_ReadFile(const char* file_name, nvfbx_buffer_t* buffer)
+{
+    FILE* stream = fopen(file_name, "rb");
+
+    if (!stream)
+    {
+        printf("Failed to open %s\n", file_name);
+        return false;
+    }
+
+    fseek(stream, 0, SEEK_END);
+    long size = ftell(stream);
+    fseek(stream, 0, SEEK_SET);
+
+    if (size <= 0)
+    {
+        printf("%s is empty\n", file_name);
+        fclose(stream);
+        return false;
+    }
+
+    buffer->size = (uint32_t)size;
+    buffer->data = malloc(buffer->size);
+
+    if (!buffer->data
+    || fread(buffer->data, 1, buffer->size, stream) != buffer->size)
+    {
+        printf("Failed to read %s\n", file_name);
+        free(buffer->data);
+        buffer->data = NULL;
+        fclose(stream);
+        return false;
+    }
+
+    fclose(stream);
+    return true;
+}
+
+// Little endian, regardless of what the host is
+uint32_t NVFBX_Read32(nvfbx_buffer_t* buffer, uint32_t offset, bool* valid)
+{
+    if (offset + 4 > buffer->size)
+    {
+        *valid = false;
+        return 0;
+    }
+
+    uint8_t* ptr = &buffer->data[offset];
+    uint32_t value = ptr[0] | (ptr[1] << 8) | (ptr[2] << 16) | ((uint32_t)ptr[3] << 24);
+
+    *valid = (value != NV_DUMP_NOT_READ);
+    return value;
+}
+
+//
+// Palette
+//
+
+void NVFBX_DefaultPalette()
+{
+    // The DAC palette can't be dumped (it's behind an index/data port), so default to a greyscale ramp
+    for (uint32_t i = 0; i < 256; i++)
+        palette[i] = 0xFF000000 | (i << 16) | (i << 8) | i;
+}
+
+// 768 bytes of R, G, B. Values are assumed to be 6-bit VGA DAC values if none of them go above 63
+bool NVFBX_LoadPalette(const char* file_name)
+{
+    nvfbx_buffer_t buffer = {0};
+
+    if (!NVFBX_ReadFile(file_name, &buffer))
+        return false;
+
+    if (buffer.size < 768)
+    {
+        printf("Palette %s is too small (%u bytes, need 768)\n", file_name, buffer.size);
+        free(buffer.data);
+        return false;
+    }
+
+    bool six_bit = true;
+
+    for (uint32_t i = 0; i < 768; i++)
+    {
+        if (buffer.data[i] > 63)
+            six_bit = false;
+    }
+
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        uint32_t r = buffer.data[i * 3], g = buffer.data[i * 3 + 1], b = buffer.data[i * 3 + 2];
+
+        if (six_bit)
+        {
+            r = (r << 2) | (r >> 4);
+            g = (g << 2) | (g >> 4);
+            b = (b << 2) | (b >> 4);
+        }
+
+        palette[i] = 0xFF000000 | (r << 16) | (g << 8) | b;
+    }
+
+    free(buffer.data);
+    return true;
+}
+
+//
+// Pixel conversion. Everything is converted to B8G8R8A8 (0xAARRGGBB little endian) rows first, then packed by the writers.
+//
+
+void NVFBX_Convert8(const uint8_t* src, uint32_t* dst, uint32_t width)
+{
+    // SSE2 has no gather, and the lookup is cheap anyway
+    for (uint32_t x = 0; x < width; x++)
+        dst[x] = palette[src[x]];
+}
+
+void NVFBX_Convert16(const uint8_t* src, uint32_t* dst, uint32_t width, bool is_565)
+{
+    uint32_t x = 0;
+
+#ifdef __SSE2__
+    const __m128i mask5 = _mm_set1_epi16(0x1F);
+    const __m128i mask6 = _mm_set1_epi16(0x3F);
+    const __m128i alpha = _mm_set1_epi16((short)0xFF00);
+
+    // 8 pixels at a time
+    for (; x + 8 <= width; x += 8)
+    {
+        __m128i pixels = _mm_loadu_si128((const __m128i*)&src[x << 1]);
+        __m128i r, g, b;
+
+        b = _mm_and_si128(pixels, mask5);
+
+        if (is_565)
+        {
+            g = _mm_and_si128(_mm_srli_epi16(pixels, 5), mask6);
+            r = _mm_and_si128(_mm_srli_epi16(pixels, 11), mask5);
+            g = _mm_or_si128(_mm_slli_epi16(g, 2), _mm_srli_epi16(g, 4));
+        }
+        else
+        {
+            g = _mm_and_si128(_mm_srli_epi16(pixels, 5), mask5);
+            r = _mm_and_si128(_mm_srli_epi16(pixels, 10), mask5);
+            g = _mm_or_si128(_mm_slli_epi16(g, 3), _mm_srli_epi16(g, 2));
+        }
+
+        // Expand 5 bit to 8 bit by replicating the top bits
+        r = _mm_or_si128(_mm_slli_epi16(r, 3), _mm_srli_epi16(r, 2));
+        b = _mm_or_si128(_mm_slli_epi16(b, 3), _mm_srli_epi16(b, 2));
+
+        // Low 16 bits of each output pixel are B,G and the high 16 bits are R,A
+        __m128i bg = _mm_or_si128(b, _mm_slli_epi16(g, 8));
+        __m128i ra = _mm_or_si128(r, alpha);
+
+        _mm_storeu_si128((__m128i*)&dst[x], _mm_unpacklo_epi16(bg, ra));
+        _mm_storeu_si128((__m128i*)&dst[x + 4], _mm_unpackhi_epi16(bg, ra));
+    }
+#endif
+
+    // Tail (or everything, without SSE2)
+    for (; x < width; x++)
+    {
+        uint32_t pixel = src[x << 1] | (src[(x << 1) + 1] << 8);
+        uint32_t r, g, b;
+
+        b = pixel & 0x1F;
+
+        if (is_565)
+        {
+            g = (pixel >> 5) & 0x3F;
+            r = (pixel >> 11) & 0x1F;
+            g = (g << 2) | (g >> 4);
+        }
+        else
+        {
+            g = (pixel >> 5) & 0x1F;
+            r = (pixel >> 10) & 0x1F;
+            g = (g << 3) | (g >> 2);
+        }
+
+        r = (r << 3) | (r >> 2);
+        b = (b << 3) | (b >> 2);
+
+        dst[x] = 0xFF000000 | (r << 16) | (g << 8) | b;
+    }
+}
+
+void NVFBX_Convert32(const uint8_t* src, uint32_t* dst, uint32_t width)
+{
+    uint32_t x = 0;
+
+#ifdef __SSE2__
+    const __m128i alpha = _mm_set1_epi32((int)0xFF000000);
+
+    // Already in the right layout, just force the X byte to opaque
+    for (; x + 4 <= width; x += 4)
+    {
+        __m128i pixels = _mm_loadu_si128((const __m128i*)&src[x << 2]);
+        _mm_storeu_si128((__m128i*)&dst[x], _mm_or_si128(pixels, alpha));
+    }
+#endif
+
+    for (; x < width; x++)
+    {
+        const uint8_t* pixel = &src[x << 2];
+        dst[x] = 0xFF000000 | (pixel[2] << 16) | (pixel[1] << 8) | pixel[0];
+    }
+}
+
+uint32_t NVFBX_BytesPerPixel(nvfbx_format_t format)
+{
+    switch (format)
+    {
+        case NVFBX_FORMAT_8BPP:
+            return 1;
+        case NVFBX_FORMAT_555:
+        case NVFBX_FORMAT_565:
+            return 2;
+        case NVFBX_FORMAT_32BPP:
+            return 4;
+        default:
+            return 0;
+    }
+}
+
+// Convert the whole surface. Rows (or parts of rows) that fall off the end of the dump come out black.
+uint32_t* NVFBX_ConvertSurface(nvfbx_buffer_t* bar1, nvfbx_surface_t* surface)
+{
+    uint32_t* image = calloc((size_t)surface->width * surface->height, sizeof(uint32_t));
+    uint32_t bytes_per_pixel = NVFBX_BytesPerPixel(surface->format);
+
+    if (!image)
+        return NULL;
+
+    for (uint32_t y = 0; y < surface->height; y++)
+    {
+        uint64_t row_start = (uint64_t)surface->offset + (uint64_t)y * surface->pitch;
+        uint32_t* dst = &image[(size_t)y * surface->width];
+        uint32_t width = surface->width;
+
+        if (row_start >= bar1->size)
+            break;
+
+        if (row_start + (uint64_t)width * bytes_per_pixel > bar1->size)
+            width = (uint32_t)((bar1->size - row_start) / bytes_per_pixel);
+
+        const uint8_t* src = &bar1->data[row_start];
+
+        switch (surface->format)
+        {
+            case NVFBX_FORMAT_8BPP:
+                NVFBX_Convert8(src, dst, width);
+                break;
+            case NVFBX_FORMAT_555:
+                NVFBX_Convert16(src, dst, width, false);
+                break;
+            case NVFBX_FORMAT_565:
+                NVFBX_Convert16(src, dst, width, true);
+                break;
+            case NVFBX_FORMAT_32BPP:
+                NVFBX_Convert32(src, dst, width);
+                break;
+            default:
+                break;
+        }
+    }
+
+    return image;
+}
+
+//
+// Writers
+//
+
+void NVFBX_Put16(uint8_t* ptr, uint32_t value)
+{
+    ptr[0] = value & 0xFF;
+    ptr[1] = (value >> 8) & 0xFF;
+}
+
+void NVFBX_Put32(uint8_t* ptr, uint32_t value)
+{
+    ptr[0] = value & 0xFF;
+    ptr[1] = (value >> 8) & 0xFF;
+    ptr[2] = (value >> 16) & 0xFF;
+    ptr[3] = (value >> 24) & 0xFF;
+}
+
+void NVFBX_Put32BE(uint8_t* ptr, uint32_t value)
+{
+    ptr[0] = (value >> 24) & 0xFF;
+    ptr[1] = (value >> 16) & 0xFF;
+    ptr[2] = (value >> 8) & 0xFF;
+    ptr[3] = value & 0xFF;
+}
+
+// 24-bit bottom-up BMP
+bool NVFBX_WriteBMP(const char* file_name, uint32_t* image, uint32_t width, uint32_t height)
+{
+    FILE* stream = fopen(file_name, "wb");
+
+    if (!stream)
+    {
+        printf("Failed to open %s for writing\n", file_name);
+        return false;
+    }
+
+    uint32_t row_size = (width * 3 + 3) & ~3;
+    uint8_t header[54] = {0};
+    uint8_t* row = calloc(1, row_size);
+
+    if (!row)
+    {
+        fclose(stream);
+        return false;
+    }
+
+    header[0] = 'B';
+    header[1] = 'M';
+    NVFBX_Put32(&header[2], 54 + row_size * height);
+    NVFBX_Put32(&header[10], 54);
+    NVFBX_Put32(&header[14], 40);
+    NVFBX_Put32(&header[18], width);
+    NVFBX_Put32(&header[22], height);
+    NVFBX_Put16(&header[26], 1);
+    NVFBX_Put16(&header[28], 24);
+    NVFBX_Put32(&header[34], row_size * height);
+
+    fwrite(header, sizeof(header), 1, stream);
+
+    for (int32_t y = height - 1; y >= 0; y--)
+    {
+        uint32_t* src = &image[(size_t)y * width];
+
+        for (uint32_t x = 0; x < width; x++)
+        {
+            row[x * 3] = src[x] & 0xFF;
+            row[x * 3 + 1] = (src[x] >> 8) & 0xFF;
+            row[x * 3 + 2] = (src[x] >> 16) & 0xFF;
+        }
+
+        fwrite(row, row_size, 1, stream);
+    }
+
+    free(row);
+    fclose(stream);
+    return true;
+}
+
+uint32_t crc_table[256];
+
+void NVFBX_InitCRC()
+{
+    for (uint32_t n = 0; n < 256; n++)
+    {
+        uint32_t c = n;
+
+        for (uint32_t k = 0; k < 8; k++)
+            c = (c & 1) ? (0xEDB88320 ^ (c >> 1)) : (c >> 1);
+
+        crc_table[n] = c;
+    }
+}
+
+uint32_t NVFBX_CRC(uint32_t crc, const uint8_t* data, size_t length)
+{
+    crc = ~crc;
+
+    for (size_t i = 0; i < length; i++)
+        crc = crc_table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+
+    return ~crc;
+}
+
+void NVFBX_WritePNGChunk(FILE* stream, const char* type, const uint8_t* data, uint32_t length)
+{
+    uint8_t word[4];
+
+    NVFBX_Put32BE(word, length);
+    fwrite(word, 4, 1, stream);
+    fwrite(type, 4, 1, stream);
+
+    if (length)
+        fwrite(data, length, 1, stream);
+
+    uint32_t crc = NVFBX_CRC(0, (const uint8_t*)type, 4);
+    crc = NVFBX_CRC(crc, data, length);
+
+    NVFBX_Put32BE(word, crc);
+    fwrite(word, 4, 1, stream);
+}
+
+// RGB8 PNG. There's no zlib dependency, so the image data goes into stored (uncompressed) deflate blocks.
+bool NVFBX_WritePNG(const char* file_name, uint32_t* image, uint32_t width, uint32_t height)
+{
+    static const uint8_t png_signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+    size_t raw_row = (size_t)width * 3 + 1;
+    size_t raw_size = raw_row * height;
+    size_t num_blocks = (raw_size + NVFBX_PNG_MAX_STORED_BLOCK - 1) / NVFBX_PNG_MAX_STORED_BLOCK;
+    size_t idat_size = 2 + num_blocks * 5 + raw_size + 4;
+
+    uint8_t* raw = malloc(raw_size);
+    uint8_t* idat = malloc(idat_size);
+
+    if (!raw || !idat)
+    {
+        printf("Out of memory writing %s\n", file_name);
+        free(raw);
+        free(idat);
+        return false;
+    }
+
+    // Filter type 0 (none) for every row
+    for (uint32_t y = 0; y < height; y++)
+    {
+        uint8_t* dst = &raw[y * raw_row];
+        uint32_t* src = &image[(size_t)y * width];
+
+        *dst++ = 0;
+
+        for (uint32_t x = 0; x < width; x++)
+        {
+            *dst++ = (src[x] >> 16) & 0xFF;
+            *dst++ = (src[x] >> 8) & 0xFF;
+            *dst++ = src[x] & 0xFF;
+        }
+    }
+
+    // zlib header, stored blocks, adler32
+    uint8_t* ptr = idat;
+    uint32_t adler_a = 1, adler_b = 0;
+
+    *ptr++ = 0x78;
+    *ptr++ = 0x01;
+
+    for (size_t pos = 0; pos < raw_size; pos += NVFBX_PNG_MAX_STORED_BLOCK)
+    {
+        uint32_t block_size = (raw_size - pos > NVFBX_PNG_MAX_STORED_BLOCK) ? NVFBX_PNG_MAX_STORED_BLOCK : (uint32_t)(raw_size - pos);
+
+        *ptr++ = (pos + block_size >= raw_size) ? 1 : 0;   // BFINAL
+        NVFBX_Put16(ptr, block_size);
+        NVFBX_Put16(ptr + 2, ~block_size & 0xFFFF);
+        ptr += 4;
+
+        memcpy(ptr, &raw[pos], block_size);
+        ptr += block_size;
+    }
+
+    for (size_t i = 0; i < raw_size; i++)
+    {
+        adler_a = (adler_a + raw[i]) % 65521;
+        adler_b = (adler_b + adler_a) % 65521;
+    }
+
+    NVFBX_Put32BE(ptr, (adler_b << 16) | adler_a);
+
+    FILE* stream = fopen(file_name, "wb");
+
+    if (!stream)
+    {
+        printf("Failed to open %s for writing\n", file_name);
+        free(raw);
+        free(idat);
+        return false;
+    }
+
+    uint8_t ihdr[13] = {0};
+
+    NVFBX_Put32BE(&ihdr[0], width);
+    NVFBX_Put32BE(&ihdr[4], height);
+    ihdr[8] = 8;                                            // bit depth
+    ihdr[9] = 2;                                            // colour type: RGB
+
+    NVFBX_InitCRC();
+
+    fwrite(png_signature, sizeof(png_signature), 1, stream);
+    NVFBX_WritePNGChunk(stream, "IHDR", ihdr, sizeof(ihdr));
+    NVFBX_WritePNGChunk(stream, "IDAT", idat, (uint32_t)idat_size);
+    NVFBX_WritePNGChunk(stream, "IEND", NULL, 0);
+
+    fclose(stream);
+    free(raw);
+    free(idat);
+    return true;
+}
+
+//
+// Scanout detection
+//
+
+// Fill in anything the user didn't specify from the BAR0 dump
+bool NVFBX_DetectScanout(nvfbx_buffer_t* bar0, nvfbx_surface_t* surface, bool have_offset)
+{
+    bool boot_valid = false, config_valid = false, general_valid = false, start_valid = false;
+
+    uint32_t boot_0 = NVFBX_Read32(bar0, NV_PMC_BOOT_0, &boot_valid);
+    uint32_t config_0 = NVFBX_Read32(bar0, NV_PFB_CONFIG_0, &config_valid);
+    uint32_t general_control = NVFBX_Read32(bar0, NV_PRAMDAC_GENERAL_CONTROL, &general_valid);
+    uint32_t crtc_start = NVFBX_Read32(bar0, NV_PCRTC_START, &start_valid);
+
+    // NV3 has the architecture in bits 16-19 of NV_PMC_BOOT_0, NV4 moved it down to bits 12-15
+    bool is_nv3 = (boot_valid && ((boot_0 >> 16) & 0x0F) == 0x03 && !(boot_0 & 0xF000));
+
+    printf("NV_PMC_BOOT_0 = %08X (%s)\n", boot_0, is_nv3 ? "NV3" : "NV4 or later");
+    printf("NV_PFB_CONFIG_0 = %08X, NV_PRAMDAC_GENERAL_CONTROL = %08X\n", config_0, general_control);
+
+    if (!surface->format)
+    {
+        if (!config_valid)
+        {
+            printf("NV_PFB_CONFIG_0 isn't in the dump. Specify -format\n");
+            return false;
+        }
+
+        switch ((config_0 >> NV_PFB_CONFIG_0_PIXEL_DEPTH) & NV_PFB_CONFIG_0_PIXEL_DEPTH_MASK)
+        {
+            case 1:
+                surface->format = NVFBX_FORMAT_8BPP;
+                break;
+            case 2:
+                surface->format = ((general_control >> NV_PRAMDAC_GENERAL_CONTROL_565_MODE) & 1) ? NVFBX_FORMAT_565 : NVFBX_FORMAT_555;
+                break;
+            case 3:
+                surface->format = NVFBX_FORMAT_32BPP;
+                break;
+            default:
+                printf("The GPU was in a VGA mode when dumped. Specify -format, -width and -height\n");
+                return false;
+        }
+    }
+
+    if (!surface->width)
+        surface->width = (config_0 & NV_PFB_CONFIG_0_RESOLUTION_MASK) * 32;
+
+    if (!surface->width)
+    {
+        printf("Couldn't work out the width. Specify -width\n");
+        return false;
+    }
+
+    // There's no vertical resolution anywhere in BAR0, so assume 4:3 (or 5:4 for 1280)
+    if (!surface->height)
+        surface->height = (surface->width == 1280) ? 1024 : (surface->width * 3) / 4;
+
+    if (!surface->pitch)
+        surface->pitch = surface->width * NVFBX_BytesPerPixel(surface->format);
+
+    if (!have_offset)
+    {
+        if (!is_nv3 && start_valid)
+            surface->offset = crtc_start & NV_PCRTC_START_MASK;
+        else
+            printf("The start address isn't in the dump on this GPU, assuming 0. Specify -offset if the picture looks wrong\n");
+    }
+
+    return true;
+}
+
+//
+// Main
+//
+
+void NVFBX_ShowHelp()
+{
+    printf("nvfbx: Extract a surface from an NVPlay VRAM dump\n\n");
+    printf("nvfbx [options]\n\n");
+    printf("-bar0 <file>      BAR0 dump used to find the scanout surface (default nvbar0.bin)\n");
+    printf("-bar1 <file>      BAR1 (VRAM) dump (default nvbar1.bin)\n");
+    printf("-o <file>         Output file. .png writes a PNG, anything else a BMP (default nvfb.bmp)\n");
+    printf("-offset <hex>     Surface offset into VRAM\n");
+    printf("-width <n>        Surface width in pixels\n");
+    printf("-height <n>       Surface height in pixels\n");
+    printf("-pitch <n>        Bytes per line\n");
+    printf("-format <f>       8, 15, 16 or 32\n");
+    printf("-palette <file>   768 byte RGB palette for 8bpp surfaces (6 or 8 bits per component)\n");
+    printf("\nIf -offset, -width, -height, -pitch and -format are all given, the BAR0 dump is not needed.\n");
+}
+
+// C23 constexpr pls
+#define ARG_LEFT    (i + 1 >= argc)
+
+int main(int argc, char** argv)
+{
+    const char* bar0_file = "nvbar0.bin";
+    const char* bar1_file = "nvbar1.bin";
+    const char* out_file = "nvfb.bmp";
+    const char* palette_file = NULL;
+
+    nvfbx_surface_t surface = {0};
+    bool have_offset = false;
+
+    for (int32_t i = 1; i < argc; i++)
+    {
+        char* current_arg = argv[i];
+
+        if (!strcasecmp(current_arg, "-?")
+        || !strcasecmp(current_arg, "-help"))
+        {
+            NVFBX_ShowHelp();
+            return 0;
+        }
+
+        if (ARG_LEFT)
+        {
+            printf("%s provided, but no value provided!\n", current_arg);
+            return 1;
+        }
+
+        char* next_arg = argv[++i];
+
+        if (!strcasecmp(current_arg, "-bar0"))
+            bar0_file = next_arg;
+        else if (!strcasecmp(current_arg, "-bar1"))
+            bar1_file = next_arg;
+        else if (!strcasecmp(current_arg, "-o"))
+            out_file = next_arg;
+        else if (!strcasecmp(current_arg, "-palette"))
+            palette_file = next_arg;
+        else if (!strcasecmp(current_arg, "-offset"))
+        {
+            surface.offset = strtoul(next_arg, NULL, 16);
+            have_offset = true;
+        }
+        else if (!strcasecmp(current_arg, "-width"))
+            surface.width = strtoul(next_arg, NULL, 10);
+        else if (!strcasecmp(current_arg, "-height"))
+            surface.height = strtoul(next_arg, NULL, 10);
+        else if (!strcasecmp(current_arg, "-pitch"))
+            surface.pitch = strtoul(next_arg, NULL, 10);
+        else if (!strcasecmp(current_arg, "-format"))
+        {
+            switch (strtoul(next_arg, NULL, 10))
+            {
+                case 8:
+                    surface.format = NVFBX_FORMAT_8BPP;
+                    break;
+                case 15:
+                    surface.format = NVFBX_FORMAT_555;
+                    break;
+                case 16:
+                    surface.format = NVFBX_FORMAT_565;
+                    break;
+                case 32:
+                    surface.format = NVFBX_FORMAT_32BPP;
+                    break;
+                default:
+                    printf("Unknown format %s (must be 8, 15, 16 or 32)\n", next_arg);
+                    return 1;
+            }
+        }
+        else
+        {
+            printf("Unknown option %s\n", current_arg);
+            return 1;
+        }
+    }
+
+    nvfbx_buffer_t bar0 = {0}, bar1 = {0};
+
+    // Only need BAR0 if something has to be worked out from it
+    if (!have_offset || !surface.width || !surface.height || !surface.pitch || !surface.format)
+    {
+        if (!NVFBX_ReadFile(bar0_file, &bar0)
+        || !NVFBX_DetectScanout(&bar0, &surface, have_offset))
+            return 1;
+    }
+
+    if (!surface.width || !surface.height
+    || surface.width > NVFBX_MAX_DIMENSION || surface.height > NVFBX_MAX_DIMENSION)
+    {
+        printf("Invalid surface size %ux%u\n", surface.width, surface.height);
+        return 1;
+    }
+
+    if (surface.pitch < surface.width * NVFBX_BytesPerPixel(surface.format))
+        printf("Warning: pitch %u is smaller than a line (%u bytes)\n", surface.pitch, surface.width * NVFBX_BytesPerPixel(surface.format));
+
+    NVFBX_DefaultPalette();
+
+    if (palette_file
+    && !NVFBX_LoadPalette(palette_file))
+        return 1;
+
+    if (!NVFBX_ReadFile(bar1_file, &bar1))
+        return 1;
+
+    printf("Surface: offset %08X, %ux%u, pitch %u, %s\n", surface.offset, surface.width, surface.height, surface.pitch, format_names[surface.format]);
+
+    if (surface.offset >= bar1.size)
+    {
+        printf("Offset %08X is past the end of %s (%u bytes)\n", surface.offset, bar1_file, bar1.size);
+        return 1;
+    }
+
+    uint32_t* image = NVFBX_ConvertSurface(&bar1, &surface);
+
+    if (!image)
+    {
+        printf("Out of memory\n");
+        return 1;
+    }
+
+    size_t out_len = strlen(out_file);
+    bool success;
+
+    if (out_len > 4
+    && !strcasecmp(&out_file[out_len - 4], ".png"))
+        success = NVFBX_WritePNG(out_file, image, surface.width, surface.height);
+    else
+        success = NVFBX_WriteBMP(out_file, image, surface.width, surface.height);
+
+    if (success)
+        printf("Wrote %s\n", out_file);
+
+    free(image);
+    free(bar0.data);
+    free(bar1.data);
+
+    return success ? 0 : 1;
+}
@@ -0,0 +1,554 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    nvlogdec.c: Host-side decoder for the binary event log
+
+    Turns the nvplay.nvl written with Log_Binary=1 back into text (like nvplay.log), CSV or JSON, optionally only for some channels, events or
+    levels. The file carries its own event table (see util_eventlog.c), so this doesn't need to match the NVPlay build that wrote it.
+
+    This runs on the machine you copy the log to, not under DOS. Build it with any C99 compiler, e.g.:
+        cc -O2 -o nvlogdec tools/nvlogdec/nvlogdec.c
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#define NVLOG_MAGIC                 0x474C564E  // 'NVLG'
+#define NVLOG_VERSION               1
+#define NVLOG_MAX_ARGS              6
+#define NVLOG_MAX_FILTERS           32
+#define NVLOG_TEXT_SIZE             1024
+
+// Same bits as log_level in util.h
+#define NVLOG_LEVEL_DEBUG           1
+#define NVLOG_LEVEL_MESSAGE         (1 << 1)
+#define NVLOG_LEVEL_WARNING         (1 << 2)
+#define NVLOG_LEVEL_ERROR           (1 << 3)
+
+typedef enum nvlog_format_e
+{
+    NVLOG_FORMAT_TEXT,
+    NVLOG_FORMAT_CSV,
+    NVLOG_FORMAT_JSON,
+} nvlog_format_t;
+
+typedef struct nvlog_event_s
+{
+    uint32_t channel;
+    uint32_t level;
+    uint32_t num_args;
+    char* name;
+    char* format;
+} nvlog_event_t;
+
+typedef struct nvlog_file_s
+{
+    const uint8_t* data;
+    size_t size;
+    size_t position;
+    bool truncated;
+
+    uint32_t ticks_per_sec;
+    uint32_t num_channels;
+    char** channel_names;
+    uint32_t num_events;
+    nvlog_event_t* events;
+} nvlog_file_t;
+
+// Command line
+nvlog_format_t nvlog_format = NVLOG_FORMAT_TEXT;
+uint32_t nvlog_min_level = NVLOG_LEVEL_DEBUG;
+const char* nvlog_channel_filters[NVLOG_MAX_FILTERS];
+uint32_t nvlog_num_channel_filters = 0;
+const char* nvlog_event_filters[NVLOG_MAX_FILTERS];
+uint32_t nvlog_num_event_filters = 0;
+
+static bool NVLog_Read(nvlog_file_t* file, void* out, size_t size)
+{
+    if (file->size - file->position < size)
+    {
+        file->truncated = true;
+        return false;
+    }
+
+    memcpy(out, &file->data[file->position], size);
+    file->position += size;
+    return true;
+}
+
+static uint32_t NVLog_Read8(nvlog_file_t* file)
+{
+    uint8_t value = 0;
+
+    NVLog_Read(file, &value, 1);
+    return value;
+}
+
+static uint32_t NVLog_Read16(nvlog_file_t* file)
+{
+    uint8_t value[2] = {0};
+
+    NVLog_Read(file, value, 2);
+    return value[0] | (value[1] << 8);
+}
+
+static uint32_t NVLog_Read32(nvlog_file_t* file)
+{
+    uint8_t value[4] = {0};
+
+    NVLog_Read(file, value, 4);
+    return value[0] | (value[1] << 8) | (value[2] << 16) | ((uint32_t)value[3] << 24);
+}
+
+static char* NVLog_ReadString(nvlog_file_t* file)
+{
+    uint32_t length = NVLog_Read16(file);
+    char* string = calloc(1, length + 1);
+
+    if (string)
+        NVLog_Read(file, string, length);
+
+    return string;
+}
+
+static bool NVLog_ReadHeader(nvlog_file_t* file)
+{
+    if (NVLog_Read32(file) != NVLOG_MAGIC)
+    {
+        fprintf(stderr, "Not an NVPlay event log\n");
+        return false;
+    }
+
+    uint32_t version = NVLog_Read16(file);
+
+    if (version != NVLOG_VERSION)
+    {
+        fprintf(stderr, "Event log version %u isn't supported (this decoder reads version %u)\n", version, NVLOG_VERSION);
+        return false;
+    }
+
+    file->ticks_per_sec = NVLog_Read32(file);
+    file->num_channels = NVLog_Read8(file);
+    file->channel_names = calloc(file->num_channels, sizeof(char*));
+
+    for (uint32_t i = 0; i < file->num_channels; i++)
+        file->channel_names[i] = NVLog_ReadString(file);
+
+    file->num_events = NVLog_Read16(file);
+    file->events = calloc(file->num_events, sizeof(nvlog_event_t));
+
+    for (uint32_t i = 0; i < file->num_events; i++)
+    {
+        nvlog_event_t* event = &file->events[i];
+
+        event->channel = NVLog_Read8(file);
+        event->level = NVLog_Read8(file);
+        event->num_args = NVLog_Read8(file);
+        event->name = NVLog_ReadString(file);
+        event->format = NVLog_ReadString(file);
+
+        if (file->truncated)
+            break;
+
+        if (event->num_args > NVLOG_MAX_ARGS
+        || event->channel >= file->num_channels)
+        {
+            fprintf(stderr, "Event %u in the table is broken\n", i);
+            return false;
+        }
+    }
+
+    if (file->truncated
+    || !file->ticks_per_sec)
+    {
+        fprintf(stderr, "The header is cut short\n");
+        return false;
+    }
+
+    return true;
+}
+
+/*
+    printf for the target's format strings, with every argument a uint32_t. Only %d/%i/%u/%x/%X/%c (with flags, width, precision and any length
+    modifier, which is dropped) are supported, anything else is copied as it is
+*/
+static void NVLog_Format(char* out, size_t out_size, const char* format, const uint32_t* args, uint32_t num_args)
+{
+    size_t used = 0;
+    uint32_t next_arg = 0;
+
+    out[0] = '\0';
+
+    while (*format
+    && used + 1 < out_size)
+    {
+        if (*format != '%')
+        {
+            out[used++] = *format++;
+            continue;
+        }
+
+        char spec[32] = "%";
+        size_t spec_length = 1;
+        const char* start = format++;
+
+        while (*format
+        && strchr("-+ #0123456789.", *format)
+        && spec_length < sizeof(spec) - 2)
+            spec[spec_length++] = *format++;
+
+        while (*format == 'l'
+        || *format == 'h')
+            format++;
+
+        char conversion = *format ? *format++ : '\0';
+        uint32_t value = (next_arg < num_args) ? args[next_arg] : 0;
+        int written = 0;
+
+        spec[spec_length++] = conversion;
+        spec[spec_length] = '\0';
+
+        switch (conversion)
+        {
+            case 'd':
+            case 'i':
+                written = snprintf(&out[used], out_size - used, spec, (int32_t)value);
+                next_arg++;
+                break;
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'c':
+                written = snprintf(&out[used], out_size - used, spec, (unsigned int)value);
+                next_arg++;
+                break;
+            case '%':
+                written = snprintf(&out[used], out_size - used, "%%");
+                break;
+            default:
+                written = snprintf(&out[used], out_size - used, "%.*s", (int)(format - start), start);
+                break;
+        }
+
+        if (written > 0)
+            used += ((size_t)written < out_size - used) ? (size_t)written : out_size - used - 1;
+    }
+
+    out[used] = '\0';
+
+    // Every consumer adds its own line ending
+    while (used
+    && (out[used - 1] == '\n' || out[used - 1] == '\r'))
+        out[--used] = '\0';
+}
+
+static const char* NVLog_LevelName(uint32_t level)
+{
+    switch (level)
+    {
+        case NVLOG_LEVEL_DEBUG:
+            return "DEBUG";
+        case NVLOG_LEVEL_MESSAGE:
+            return "MESSAGE";
+        case NVLOG_LEVEL_WARNING:
+            return "WARNING";
+        case NVLOG_LEVEL_ERROR:
+            return "ERROR";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+static bool NVLog_ParseLevel(const char* name, uint32_t* level)
+{
+    static const uint32_t levels[] = { NVLOG_LEVEL_DEBUG, NVLOG_LEVEL_MESSAGE, NVLOG_LEVEL_WARNING, NVLOG_LEVEL_ERROR };
+
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        if (!strcasecmp(name, NVLog_LevelName(levels[i])))
+        {
+            *level = levels[i];
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool NVLog_Matches(const char* value, const char** filters, uint32_t num_filters)
+{
+    if (!num_filters)
+        return true;
+
+    for (uint32_t i = 0; i < num_filters; i++)
+    {
+        if (!strcasecmp(value, filters[i]))
+            return true;
+    }
+
+    return false;
+}
+
+static void NVLog_PrintCsvString(const char* string)
+{
+    putchar('"');
+
+    for (; *string; string++)
+    {
+        if (*string == '"')
+            putchar('"');
+
+        putchar(*string);
+    }
+
+    putchar('"');
+}
+
+static void NVLog_PrintJsonString(const char* string)
+{
+    putchar('"');
+
+    for (; *string; string++)
+    {
+        unsigned char ch = (unsigned char)*string;
+
+        if (ch == '"' || ch == '\\')
+            printf("\\%c", ch);
+        else if (ch < 0x20)
+            printf("\\u%04x", ch);
+        else
+            putchar(ch);
+    }
+
+    putchar('"');
+}
+
+static void NVLog_PrintEvent(nvlog_file_t* file, const nvlog_event_t* event, double seconds, const uint32_t* args, bool first)
+{
+    char text[NVLOG_TEXT_SIZE];
+    const char* channel = file->channel_names[event->channel];
+
+    NVLog_Format(text, sizeof(text), event->format, args, event->num_args);
+
+    switch (nvlog_format)
+    {
+        case NVLOG_FORMAT_TEXT:
+            // Same prefixes as nvplay.log
+            printf("[%12.6f] ", seconds);
+
+            if (event->level != NVLOG_LEVEL_MESSAGE)
+            {
+                if (event->channel)
+                    printf("[%s/%s]: ", NVLog_LevelName(event->level), channel);
+                else
+                    printf("[%s]: ", NVLog_LevelName(event->level));
+            }
+
+            printf("%s\n", text);
+            break;
+        case NVLOG_FORMAT_CSV:
+            printf("%.6f,%s,%s,%s,", seconds, event->name, channel, NVLog_LevelName(event->level));
+            NVLog_PrintCsvString(text);
+
+            for (uint32_t i = 0; i < NVLOG_MAX_ARGS; i++)
+            {
+                if (i < event->num_args)
+                    printf(",%u", args[i]);
+                else
+                    printf(",");
+            }
+
+            printf("\n");
+            break;
+        case NVLOG_FORMAT_JSON:
+            printf("%s\n  {\"time\": %.6f, \"event\": \"%s\", \"channel\": \"%s\", \"level\": \"%s\", \"text\": ", first ? "" : ",", seconds,
+                event->name, channel, NVLog_LevelName(event->level));
+            NVLog_PrintJsonString(text);
+            printf(", \"args\": [");
+
+            for (uint32_t i = 0; i < event->num_args; i++)
+                printf("%s%u", i ? ", " : "", args[i]);
+
+            printf("]}");
+            break;
+    }
+}
+
+static bool NVLog_Decode(nvlog_file_t* file)
+{
+    uint64_t time = 0;
+    uint32_t last_timestamp = 0;
+    uint32_t num_records = 0;
+    uint32_t num_printed = 0;
+
+    if (nvlog_format == NVLOG_FORMAT_CSV)
+        printf("time,event,channel,level,text,arg0,arg1,arg2,arg3,arg4,arg5\n");
+    else if (nvlog_format == NVLOG_FORMAT_JSON)
+        printf("[");
+
+    while (file->position < file->size)
+    {
+        size_t record_start = file->position;
+        uint32_t id = NVLog_Read16(file);
+        uint32_t timestamp = NVLog_Read32(file);
+        uint32_t args[NVLOG_MAX_ARGS] = {0};
+
+        if (file->truncated)
+            break;
+
+        if (id >= file->num_events)
+        {
+            fprintf(stderr, "Unknown event %u at offset %zu, stopping\n", id, record_start);
+            return false;
+        }
+
+        const nvlog_event_t* event = &file->events[id];
+
+        for (uint32_t i = 0; i < event->num_args; i++)
+            args[i] = NVLog_Read32(file);
+
+        if (file->truncated)
+            break;
+
+        // The target only keeps 32 bits of uclock
+        time += (uint32_t)(timestamp - last_timestamp);
+        last_timestamp = timestamp;
+        num_records++;
+
+        if (event->level < nvlog_min_level
+        || !NVLog_Matches(file->channel_names[event->channel], nvlog_channel_filters, nvlog_num_channel_filters)
+        || !NVLog_Matches(event->name, nvlog_event_filters, nvlog_num_event_filters))
+            continue;
+
+        NVLog_PrintEvent(file, event, (double)time / file->ticks_per_sec, args, !num_printed);
+        num_printed++;
+    }
+
+    if (nvlog_format == NVLOG_FORMAT_JSON)
+        printf("\n]\n");
+
+    // Normal if NVPlay didn't get to flush before the machine died
+    if (file->truncated)
+        fprintf(stderr, "The last record is cut short (the log wasn't closed properly)\n");
+
+    fprintf(stderr, "%u events, %u shown\n", num_records, num_printed);
+    return true;
+}
+
+static void NVLog_Usage()
+{
+    printf("nvlogdec [options] <nvplay.nvl>\n\n"
+        "Options:\n"
+        "    -f text|csv|json    Output format (default text)\n"
+        "    -c <channel>        Only events in this channel (General, Script, PCI, FIFO, Graph, Kernel, Dump). Can be given more than once\n"
+        "    -e <event>          Only this event (e.g. LOG_EVENT_VOLATILE_COUNTER). Can be given more than once\n"
+        "    -l <level>          Only events at this level or above (debug, message, warning, error)\n"
+        "    -t                  List the event table and exit\n");
+}
+
+int main(int argc, char** argv)
+{
+    nvlog_file_t file = {0};
+    const char* file_name = NULL;
+    bool list_table = false;
+
+    for (int32_t i = 1; i < argc; i++)
+    {
+        bool has_value = (i + 1 < argc);
+
+        if (!strcmp(argv[i], "-f") && has_value)
+        {
+            i++;
+
+            if (!strcasecmp(argv[i], "text"))
+                nvlog_format = NVLOG_FORMAT_TEXT;
+            else if (!strcasecmp(argv[i], "csv"))
+                nvlog_format = NVLOG_FORMAT_CSV;
+            else if (!strcasecmp(argv[i], "json"))
+                nvlog_format = NVLOG_FORMAT_JSON;
+            else
+            {
+                NVLog_Usage();
+                return 1;
+            }
+        }
+        else if (!strcmp(argv[i], "-c") && has_value
+        && nvlog_num_channel_filters < NVLOG_MAX_FILTERS)
+            nvlog_channel_filters[nvlog_num_channel_filters++] = argv[++i];
+        else if (!strcmp(argv[i], "-e") && has_value
+        && nvlog_num_event_filters < NVLOG_MAX_FILTERS)
+            nvlog_event_filters[nvlog_num_event_filters++] = argv[++i];
+        else if (!strcmp(argv[i], "-l") && has_value)
+        {
+            if (!NVLog_ParseLevel(argv[++i], &nvlog_min_level))
+            {
+                NVLog_Usage();
+                return 1;
+            }
+        }
+        else if (!strcmp(argv[i], "-t"))
+            list_table = true;
+        else if (argv[i][0] != '-')
+            file_name = argv[i];
+        else
+        {
+            NVLog_Usage();
+            return 1;
+        }
+    }
+
+    if (!file_name)
+    {
+        NVLog_Usage();
+        return 1;
+    }
+
+    FILE* stream = fopen(file_name, "rb");
+
+    if (!stream)
+    {
+        fprintf(stderr, "Couldn't open %s\n", file_name);
+        return 1;
+    }
+
+    fseek(stream, 0, SEEK_END);
+    file.size = (size_t)ftell(stream);
+    fseek(stream, 0, SEEK_SET);
+
+    uint8_t* data = malloc(file.size ? file.size : 1);
+
+    if (!data
+    || fread(data, 1, file.size, stream) != file.size)
+    {
+        fprintf(stderr, "Couldn't read %s\n", file_name);
+        fclose(stream);
+        return 1;
+    }
+
+    fclose(stream);
+    file.data = data;
+
+    if (!NVLog_ReadHeader(&file))
+        return 1;
+
+    if (list_table)
+    {
+        for (uint32_t i = 0; i < file.num_events; i++)
+        {
+            printf("%3u %-40s %-8s %-8s %u args  %s", i, file.events[i].name, file.channel_names[file.events[i].channel],
+                NVLog_LevelName(file.events[i].level), file.events[i].num_args, file.events[i].format);
+        }
+
+        return 0;
+    }
+
+    return NVLog_Decode(&file) ? 0 : 1;
+}
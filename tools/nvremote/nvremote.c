@@ -0,0 +1,294 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    nvremote.c: Command line client for the remote REPL
+
+    Talks to nvplay -remote (or the remote command in the REPL) over a serial cable, so registers can be poked and scripts run from the machine
+    you're writing them on. Numbers are hex, like in scripts. The cable needs RTS/CTS wired through (a full null modem cable), since the server
+    holds requests back with RTS while it runs one.
+
+    This runs on the host, not under DOS. Build it with any C99 compiler on a POSIX system, e.g.:
+        cc -O2 -o nvremote tools/nvremote/nvremote.c tools/nvremote/nvremote_client.c
+
+    nvremote_test.c tests the client against the server over a pty, see there for how to build it.
+*/
+
+#include "nvremote_client.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+static const char* nvremote_space_names[REMOTE_NUM_SPACES] = { "mmio", "vram", "ramin", "pci" };
+
+static void NVRemote_Usage()
+{
+    printf("nvremote <device> [-b baud] <command>\n\n"
+        "Commands (numbers are hex, space is mmio, vram, ramin or pci and defaults to mmio):\n"
+        "    hello                             Show what the server is running on\n"
+        "    rd [space] <offset> [count]       Read count (default 1) dwords\n"
+        "    wr [space] <offset> <value>...    Write dwords starting at offset\n"
+        "    dump [space] <offset> <size> <file>  Read size bytes into file\n"
+        "    load [space] <offset> <file>      Write file starting at offset\n"
+        "    cmd \"<command>\"                   Run one REPL command\n"
+        "    script <file>                     Run a script file\n"
+        "    stop                              Stop the server\n");
+}
+
+/* Take a space name off the front of the arguments if there is one */
+static remote_space_t NVRemote_ParseSpace(int* argc, char*** argv)
+{
+    if (*argc > 0)
+    {
+        for (uint32_t i = 0; i < REMOTE_NUM_SPACES; i++)
+        {
+            if (!strcasecmp((*argv)[0], nvremote_space_names[i]))
+            {
+                (*argc)--;
+                (*argv)++;
+                return (remote_space_t)i;
+            }
+        }
+    }
+
+    return REMOTE_SPACE_MMIO;
+}
+
+static void* NVRemote_LoadFile(const char* path, uint32_t* size)
+{
+    FILE* file = fopen(path, "rb");
+
+    if (!file)
+    {
+        fprintf(stderr, "Couldn't open %s\n", path);
+        return NULL;
+    }
+
+    fseek(file, 0, SEEK_END);
+    *size = (uint32_t)ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    // Room to round up to a whole dword
+    uint8_t* data = calloc(1, *size + 4);
+
+    if (data
+    && fread(data, 1, *size, file) != *size)
+    {
+        free(data);
+        data = NULL;
+    }
+
+    fclose(file);
+    return data;
+}
+
+static bool NVRemote_Read(nvremote_client_t* client, remote_space_t space, int argc, char** argv)
+{
+    if (argc < 1)
+        return false;
+
+    uint32_t offset = strtoul(argv[0], NULL, 16);
+    uint32_t count = (argc >= 2) ? strtoul(argv[1], NULL, 16) : 1;
+    uint32_t* buffer = calloc(count ? count : 1, sizeof(uint32_t));
+
+    if (!buffer
+    || !NVRemote_ReadBlock(client, space, offset, buffer, count))
+    {
+        free(buffer);
+        return false;
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (!(i & 3))
+            printf("%s%08X:", i ? "\n" : "", offset + (i << 2));
+
+        printf(" %08X", buffer[i]);
+    }
+
+    printf("\n");
+    free(buffer);
+    return true;
+}
+
+static bool NVRemote_Write(nvremote_client_t* client, remote_space_t space, int argc, char** argv)
+{
+    if (argc < 2)
+        return false;
+
+    uint32_t offset = strtoul(argv[0], NULL, 16);
+    uint32_t count = argc - 1;
+    uint32_t* buffer = calloc(count, sizeof(uint32_t));
+
+    if (!buffer)
+        return false;
+
+    for (uint32_t i = 0; i < count; i++)
+        buffer[i] = strtoul(argv[i + 1], NULL, 16);
+
+    bool success = NVRemote_WriteBlock(client, space, offset, buffer, count)
+        && NVRemote_Flush(client)
+        && !client->errors;
+
+    free(buffer);
+    return success;
+}
+
+static bool NVRemote_Dump(nvremote_client_t* client, remote_space_t space, int argc, char** argv)
+{
+    if (argc < 3)
+        return false;
+
+    uint32_t offset = strtoul(argv[0], NULL, 16);
+    uint32_t size = strtoul(argv[1], NULL, 16) & ~3;
+    uint32_t* buffer = calloc(1, size + 4);
+    FILE* file = NULL;
+    bool success = false;
+
+    if (buffer
+    && NVRemote_ReadBlock(client, space, offset, buffer, size >> 2)
+    && (file = fopen(argv[2], "wb")))
+    {
+        // Little endian, like the GPU
+        uint8_t* bytes = (uint8_t*)buffer;
+
+        for (uint32_t i = 0; i < (size >> 2); i++)
+            Remote_Put32(&bytes[i << 2], buffer[i]);
+
+        success = (fwrite(buffer, 1, size, file) == size);
+        fclose(file);
+        printf("%u bytes from %s %08X written to %s\n", size, nvremote_space_names[space], offset, argv[2]);
+    }
+
+    free(buffer);
+    return success;
+}
+
+static bool NVRemote_Load(nvremote_client_t* client, remote_space_t space, int argc, char** argv)
+{
+    if (argc < 2)
+        return false;
+
+    uint32_t offset = strtoul(argv[0], NULL, 16);
+    uint32_t size = 0;
+    uint8_t* data = NVRemote_LoadFile(argv[1], &size);
+
+    if (!data)
+        return false;
+
+    uint32_t count = (size + 3) >> 2;
+    uint32_t* buffer = calloc(count ? count : 1, sizeof(uint32_t));
+
+    for (uint32_t i = 0; buffer && i < count; i++)
+        buffer[i] = Remote_Get32(&data[i << 2]);
+
+    bool success = buffer
+        && NVRemote_WriteBlock(client, space, offset, buffer, count)
+        && NVRemote_Flush(client)
+        && !client->errors;
+
+    free(buffer);
+    free(data);
+    return success;
+}
+
+int main(int argc, char** argv)
+{
+    nvremote_client_t* client = calloc(1, sizeof(nvremote_client_t));
+    uint32_t baud = REMOTE_DEFAULT_BAUD;
+    const char* device;
+    bool success = false;
+
+    if (argc < 3
+    || !client)
+    {
+        NVRemote_Usage();
+        return 1;
+    }
+
+    device = argv[1];
+    argc -= 2;
+    argv += 2;
+
+    if (argc >= 2
+    && !strcmp(argv[0], "-b"))
+    {
+        baud = strtoul(argv[1], NULL, 10);
+        argc -= 2;
+        argv += 2;
+    }
+
+    if (argc < 1)
+    {
+        NVRemote_Usage();
+        return 1;
+    }
+
+    if (!NVRemote_Open(client, device, baud))
+        return 1;
+
+    const char* command = argv[0];
+
+    argc--;
+    argv++;
+
+    // Every session starts with a hello, so we know the server is there and what it can take
+    if (!NVRemote_Hello(client))
+    {
+        fprintf(stderr, "No NVPlay server on %s\n", device);
+        NVRemote_Close(client);
+        return 1;
+    }
+
+    if (!strcasecmp(command, "hello"))
+    {
+        printf("Protocol version %u, NV_PMC_BOOT_0 %08X, %u KB VRAM, up to %u dwords per block\n", client->version, client->boot0,
+            client->vram_amount >> 10, client->max_block_dwords);
+        success = true;
+    }
+    else if (!strcasecmp(command, "cmd")
+    && argc >= 1)
+    {
+        success = NVRemote_RunScript(client, argv[0], strlen(argv[0]));
+    }
+    else if (!strcasecmp(command, "script")
+    && argc >= 1)
+    {
+        uint32_t size = 0;
+        char* source = NVRemote_LoadFile(argv[0], &size);
+
+        success = source
+            && NVRemote_RunScript(client, source, size);
+
+        free(source);
+    }
+    else if (!strcasecmp(command, "stop"))
+        success = NVRemote_Stop(client);
+    else
+    {
+        remote_space_t space = NVRemote_ParseSpace(&argc, &argv);
+
+        if (!strcasecmp(command, "rd"))
+            success = NVRemote_Read(client, space, argc, argv);
+        else if (!strcasecmp(command, "wr"))
+            success = NVRemote_Write(client, space, argc, argv);
+        else if (!strcasecmp(command, "dump"))
+            success = NVRemote_Dump(client, space, argc, argv);
+        else if (!strcasecmp(command, "load"))
+            success = NVRemote_Load(client, space, argc, argv);
+        else
+            NVRemote_Usage();
+    }
+
+    if (client->errors)
+        fprintf(stderr, "%u requests failed (last: %s)\n", client->errors, NVRemote_StatusName(client->last_error));
+
+    NVRemote_Close(client);
+    free(client);
+    return success ? 0 : 1;
+}
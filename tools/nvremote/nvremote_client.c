@@ -0,0 +1,462 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    nvremote_client.c: Host-side client for the remote REPL
+
+    The server runs requests strictly in order, so a reply also tells us that every older request without a reply was lost on the way (usually
+    line noise before its sync bytes). Those are failed straight away instead of waiting for the timeout.
+*/
+
+#include "nvremote_client.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+// Result of a request that is waited for
+typedef struct nvremote_result_s
+{
+    bool done;
+    remote_status_t status;
+    uint8_t* data;                              // Copy the reply here (can be NULL)
+    uint32_t max_size;
+    uint32_t size;
+} nvremote_result_t;
+
+static const char* nvremote_status_names[] =
+{
+    "OK",
+    "bad frame",
+    "bad request",
+    "unknown opcode",
+    "bad space",
+    "out of bounds",
+    "failed",
+};
+
+const char* NVRemote_StatusName(remote_status_t status)
+{
+    if (status > REMOTE_STATUS_FAILED)
+        return "unknown status";
+
+    return nvremote_status_names[status];
+}
+
+static uint64_t NVRemote_Milliseconds()
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+static speed_t NVRemote_Speed(uint32_t baud)
+{
+    switch (baud)
+    {
+        case 9600:
+            return B9600;
+        case 19200:
+            return B19200;
+        case 38400:
+            return B38400;
+        case 57600:
+            return B57600;
+        case 115200:
+            return B115200;
+        default:
+            return B0;
+    }
+}
+
+/* Use a descriptor that is already open, e.g. the master side of a pty. It has to be non-blocking */
+void NVRemote_Attach(nvremote_client_t* client, int fd)
+{
+    memset(client, 0, sizeof(nvremote_client_t));
+    client->timeout_ms = NVREMOTE_DEFAULT_TIMEOUT_MS;
+    client->fd = fd;
+}
+
+bool NVRemote_Open(nvremote_client_t* client, const char* device, uint32_t baud)
+{
+    struct termios settings;
+    speed_t speed = NVRemote_Speed(baud);
+
+    NVRemote_Attach(client, -1);
+
+    if (speed == B0)
+    {
+        fprintf(stderr, "Unsupported baud rate %u\n", baud);
+        return false;
+    }
+
+    client->fd = open(device, O_RDWR | O_NOCTTY | O_NONBLOCK);
+
+    if (client->fd < 0)
+    {
+        fprintf(stderr, "Couldn't open %s: %s\n", device, strerror(errno));
+        return false;
+    }
+
+    // A pty isn't a serial port, so don't worry if this doesn't work
+    if (!tcgetattr(client->fd, &settings))
+    {
+        cfmakeraw(&settings);
+        cfsetispeed(&settings, speed);
+        cfsetospeed(&settings, speed);
+
+        // The server drops RTS while it runs a request, since it can't read the UART then
+#ifdef CRTSCTS
+        settings.c_cflag |= CRTSCTS;
+#endif
+        tcsetattr(client->fd, TCSANOW, &settings);
+        tcflush(client->fd, TCIOFLUSH);
+    }
+
+    return true;
+}
+
+void NVRemote_Close(nvremote_client_t* client)
+{
+    if (client->fd < 0)
+        return;
+
+    close(client->fd);
+    client->fd = -1;
+}
+
+static void NVRemote_Complete(nvremote_client_t* client, uint8_t sequence, remote_status_t status, const uint8_t* data, uint32_t size)
+{
+    nvremote_request_t* request = &client->requests[sequence];
+
+    if (!request->pending)
+        return;
+
+    request->pending = false;
+    client->in_flight -= request->frame_size;
+    client->num_pending--;
+
+    if (status != REMOTE_STATUS_OK)
+    {
+        client->errors++;
+        client->last_error = status;
+    }
+
+    if (request->callback)
+        request->callback(request->context, status, data, size);
+}
+
+/* The oldest request still waiting for a reply */
+static uint8_t NVRemote_OldestPending(nvremote_client_t* client)
+{
+    uint8_t sequence = client->next_sequence - client->num_pending;
+
+    while (!client->requests[sequence].pending)
+        sequence++;
+
+    return sequence;
+}
+
+static void NVRemote_HandleFrame(nvremote_client_t* client)
+{
+    uint8_t opcode = client->parser.frame[2];
+    uint8_t sequence = client->parser.frame[3];
+    uint32_t length = client->parser.length;
+    const uint8_t* payload = &client->parser.frame[REMOTE_FRAME_HEADER_SIZE];
+
+    // We can't tell which request this was for. It will time out
+    if (!client->parser.crc_ok
+    || !length)
+    {
+        client->errors++;
+        client->last_error = REMOTE_STATUS_BAD_FRAME;
+        return;
+    }
+
+    if (!(opcode & REMOTE_OP_REPLY)
+    || !client->requests[sequence].pending)
+        return;
+
+    // Anything sent before this request that hasn't been answered never got there
+    while (client->num_pending
+    && NVRemote_OldestPending(client) != sequence)
+        NVRemote_Complete(client, NVRemote_OldestPending(client), REMOTE_STATUS_BAD_FRAME, NULL, 0);
+
+    NVRemote_Complete(client, sequence, (remote_status_t)payload[0], payload + 1, length - 1);
+}
+
+/* Handle replies that arrive within timeout_ms. Returns false if nothing arrived */
+static bool NVRemote_Receive(nvremote_client_t* client, uint32_t timeout_ms)
+{
+    struct pollfd port_poll = { client->fd, POLLIN, 0 };
+    uint8_t buffer[1024];
+    ssize_t size;
+    bool received = false;
+
+    if (poll(&port_poll, 1, timeout_ms) <= 0)
+        return false;
+
+    while ((size = read(client->fd, buffer, sizeof(buffer))) > 0)
+    {
+        received = true;
+
+        for (ssize_t i = 0; i < size; i++)
+        {
+            if (Remote_ParseByte(&client->parser, buffer[i]))
+                NVRemote_HandleFrame(client);
+        }
+    }
+
+    return received;
+}
+
+/* Wait for replies until at most max_in_flight bytes and max_pending requests are outstanding. Everything outstanding fails on a timeout */
+static bool NVRemote_WaitFor(nvremote_client_t* client, uint32_t max_in_flight, uint32_t max_pending)
+{
+    uint64_t deadline = NVRemote_Milliseconds() + client->timeout_ms;
+
+    while (client->in_flight > max_in_flight
+    || client->num_pending > max_pending)
+    {
+        uint64_t now = NVRemote_Milliseconds();
+
+        if (now >= deadline)
+        {
+            fprintf(stderr, "No reply from the server in %ums, giving up on %u requests\n", client->timeout_ms, client->num_pending);
+
+            while (client->num_pending)
+                NVRemote_Complete(client, NVRemote_OldestPending(client), REMOTE_STATUS_FAILED, NULL, 0);
+
+            return false;
+        }
+
+        // Anything that arrives restarts the clock, a big block read takes a while at 115200 baud
+        if (NVRemote_Receive(client, (uint32_t)(deadline - now)))
+            deadline = NVRemote_Milliseconds() + client->timeout_ms;
+    }
+
+    return true;
+}
+
+static bool NVRemote_WriteAll(nvremote_client_t* client, const uint8_t* data, uint32_t size)
+{
+    while (size)
+    {
+        ssize_t result = write(client->fd, data, size);
+
+        if (result > 0)
+        {
+            data += result;
+            size -= result;
+            continue;
+        }
+
+        if (result < 0
+        && errno != EAGAIN)
+        {
+            fprintf(stderr, "Write failed: %s\n", strerror(errno));
+            return false;
+        }
+
+        // Keep taking replies while the line is busy, or the server could end up waiting on us
+        NVRemote_Receive(client, 10);
+    }
+
+    return true;
+}
+
+bool NVRemote_Submit(nvremote_client_t* client, uint8_t opcode, const uint8_t* payload, uint32_t length, nvremote_callback_t callback, void* context)
+{
+    uint32_t frame_size = REMOTE_FRAME_HEADER_SIZE + length + REMOTE_FRAME_CRC_SIZE;
+
+    if (length > REMOTE_MAX_PAYLOAD)
+        return false;
+
+    // Room in the window, and the sequence number isn't still in use from 256 requests ago
+    if (!NVRemote_WaitFor(client, REMOTE_WINDOW_SIZE - frame_size, 255))
+        return false;
+
+    uint8_t sequence = client->next_sequence++;
+    nvremote_request_t* request = &client->requests[sequence];
+
+    request->pending = true;
+    request->opcode = opcode;
+    request->frame_size = frame_size;
+    request->callback = callback;
+    request->context = context;
+    client->in_flight += frame_size;
+    client->num_pending++;
+
+    Remote_BuildFrame(client->frame, opcode, sequence, payload, length);
+    return NVRemote_WriteAll(client, client->frame, frame_size);
+}
+
+bool NVRemote_Flush(nvremote_client_t* client)
+{
+    return NVRemote_WaitFor(client, 0, 0);
+}
+
+static void NVRemote_StoreResult(void* context, remote_status_t status, const uint8_t* data, uint32_t size)
+{
+    nvremote_result_t* result = (nvremote_result_t*)context;
+
+    result->done = true;
+    result->status = status;
+    result->size = (size < result->max_size) ? size : result->max_size;
+
+    if (result->data)
+        memcpy(result->data, data, result->size);
+}
+
+/* Send a request and wait for its reply (and everything before it) */
+static bool NVRemote_Transact(nvremote_client_t* client, uint8_t opcode, const uint8_t* payload, uint32_t length, uint8_t* reply,
+    uint32_t reply_size)
+{
+    nvremote_result_t result = { false, REMOTE_STATUS_FAILED, reply, reply_size, 0 };
+
+    if (!NVRemote_Submit(client, opcode, payload, length, NVRemote_StoreResult, &result)
+    || !NVRemote_Flush(client))
+        return false;
+
+    if (result.status != REMOTE_STATUS_OK)
+    {
+        fprintf(stderr, "Request %02X failed: %s\n", opcode, NVRemote_StatusName(result.status));
+        return false;
+    }
+
+    if (result.size < reply_size)
+    {
+        fprintf(stderr, "Reply to request %02X is too short (%u bytes)\n", opcode, result.size);
+        return false;
+    }
+
+    return true;
+}
+
+bool NVRemote_Hello(nvremote_client_t* client)
+{
+    uint8_t reply[11];
+
+    if (!NVRemote_Transact(client, REMOTE_OP_HELLO, NULL, 0, reply, sizeof(reply)))
+        return false;
+
+    client->version = reply[0];
+    client->max_block_dwords = Remote_Get16(&reply[1]);
+    client->boot0 = Remote_Get32(&reply[3]);
+    client->vram_amount = Remote_Get32(&reply[7]);
+
+    if (client->version != REMOTE_PROTOCOL_VERSION)
+    {
+        fprintf(stderr, "The server speaks protocol version %u, we speak %u\n", client->version, REMOTE_PROTOCOL_VERSION);
+        return false;
+    }
+
+    return true;
+}
+
+bool NVRemote_Read32(nvremote_client_t* client, remote_space_t space, uint32_t offset, uint32_t* value)
+{
+    uint8_t payload[5], reply[4];
+
+    payload[0] = space;
+    Remote_Put32(&payload[1], offset);
+
+    if (!NVRemote_Transact(client, REMOTE_OP_READ32, payload, sizeof(payload), reply, sizeof(reply)))
+        return false;
+
+    *value = Remote_Get32(reply);
+    return true;
+}
+
+bool NVRemote_Write32(nvremote_client_t* client, remote_space_t space, uint32_t offset, uint32_t value)
+{
+    uint8_t payload[9];
+
+    payload[0] = space;
+    Remote_Put32(&payload[1], offset);
+    Remote_Put32(&payload[5], value);
+
+    return NVRemote_Submit(client, REMOTE_OP_WRITE32, payload, sizeof(payload), NULL, NULL);
+}
+
+static void NVRemote_StoreBlock(void* context, remote_status_t status, const uint8_t* data, uint32_t size)
+{
+    uint32_t* buffer = (uint32_t*)context;
+
+    if (status != REMOTE_STATUS_OK)
+        return;
+
+    for (uint32_t i = 0; i < (size >> 2); i++)
+        buffer[i] = Remote_Get32(&data[i << 2]);
+}
+
+/* Read count dwords. Bigger reads are split into blocks the server can take, all sent at once */
+bool NVRemote_ReadBlock(nvremote_client_t* client, remote_space_t space, uint32_t offset, uint32_t* buffer, uint32_t count)
+{
+    uint32_t block_dwords = client->max_block_dwords ? client->max_block_dwords : REMOTE_MAX_BLOCK_DWORDS;
+    uint32_t errors = client->errors;
+    uint8_t payload[7];
+
+    for (uint32_t done = 0; done < count; done += block_dwords)
+    {
+        uint32_t block = (count - done < block_dwords) ? count - done : block_dwords;
+
+        payload[0] = space;
+        Remote_Put32(&payload[1], offset + (done << 2));
+        Remote_Put16(&payload[5], block);
+
+        if (!NVRemote_Submit(client, REMOTE_OP_READ_BLOCK, payload, sizeof(payload), NVRemote_StoreBlock, &buffer[done]))
+            return false;
+    }
+
+    return NVRemote_Flush(client)
+        && client->errors == errors;
+}
+
+bool NVRemote_WriteBlock(nvremote_client_t* client, remote_space_t space, uint32_t offset, const uint32_t* buffer, uint32_t count)
+{
+    uint32_t block_dwords = client->max_block_dwords ? client->max_block_dwords : REMOTE_MAX_BLOCK_DWORDS;
+    uint8_t payload[REMOTE_MAX_PAYLOAD];
+
+    for (uint32_t done = 0; done < count; done += block_dwords)
+    {
+        uint32_t block = (count - done < block_dwords) ? count - done : block_dwords;
+
+        payload[0] = space;
+        Remote_Put32(&payload[1], offset + (done << 2));
+
+        for (uint32_t i = 0; i < block; i++)
+            Remote_Put32(&payload[5 + (i << 2)], buffer[done + i]);
+
+        if (!NVRemote_Submit(client, REMOTE_OP_WRITE_BLOCK, payload, 5 + (block << 2), NULL, NULL))
+            return false;
+    }
+
+    return true;
+}
+
+bool NVRemote_RunScript(nvremote_client_t* client, const char* source, uint32_t size)
+{
+    if (size > REMOTE_MAX_PAYLOAD)
+    {
+        fprintf(stderr, "Script is too big to send (%u bytes, at most %u)\n", size, REMOTE_MAX_PAYLOAD);
+        return false;
+    }
+
+    return NVRemote_Transact(client, REMOTE_OP_RUN_SCRIPT, (const uint8_t*)source, size, NULL, 0);
+}
+
+/* Tell the server to stop serving */
+bool NVRemote_Stop(nvremote_client_t* client)
+{
+    return NVRemote_Transact(client, REMOTE_OP_CLOSE, NULL, 0, NULL, 0);
+}
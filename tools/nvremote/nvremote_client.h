@@ -0,0 +1,76 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    nvremote_client.h: Host-side client for the remote REPL (nvplay -remote, or the remote command)
+
+    Requests are sent as soon as they are submitted, up to REMOTE_WINDOW_SIZE bytes ahead of the replies, so a run of writes or a big block read
+    keeps the serial line busy in both directions instead of waiting for a round trip after every request. Replies come back in order and are
+    handed to the callback given with the request.
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "../../src/core/remote/remote_protocol.h"
+
+#define NVREMOTE_DEFAULT_TIMEOUT_MS     2000    // Give up on a reply after this long
+
+/* Called with the reply to a request. data/size are the payload after the status byte */
+typedef void (*nvremote_callback_t)(void* context, remote_status_t status, const uint8_t* data, uint32_t size);
+
+typedef struct nvremote_request_s
+{
+    bool pending;
+    uint8_t opcode;
+    uint32_t frame_size;                        // Counted against the window until the reply arrives
+    nvremote_callback_t callback;
+    void* context;
+} nvremote_request_t;
+
+typedef struct nvremote_client_s
+{
+    int fd;
+    uint8_t next_sequence;
+    uint32_t in_flight;                         // Bytes of requests sent without a reply yet
+    uint32_t num_pending;
+    uint32_t timeout_ms;
+    nvremote_request_t requests[256];           // By sequence number
+    remote_parser_t parser;
+    uint8_t frame[REMOTE_MAX_FRAME];
+
+    // Replies that weren't REMOTE_STATUS_OK, lost requests and bad frames. Asynchronous requests report errors here
+    uint32_t errors;
+    remote_status_t last_error;
+
+    // From REMOTE_OP_HELLO
+    uint32_t version;
+    uint32_t max_block_dwords;
+    uint32_t boot0;
+    uint32_t vram_amount;
+} nvremote_client_t;
+
+void NVRemote_Attach(nvremote_client_t* client, int fd);
+bool NVRemote_Open(nvremote_client_t* client, const char* device, uint32_t baud);
+void NVRemote_Close(nvremote_client_t* client);
+
+// Pipelined requests. These only wait if the window is full
+bool NVRemote_Submit(nvremote_client_t* client, uint8_t opcode, const uint8_t* payload, uint32_t length, nvremote_callback_t callback, void* context);
+bool NVRemote_Flush(nvremote_client_t* client);
+
+// Requests that wait for their reply
+bool NVRemote_Hello(nvremote_client_t* client);
+bool NVRemote_Read32(nvremote_client_t* client, remote_space_t space, uint32_t offset, uint32_t* value);
+bool NVRemote_ReadBlock(nvremote_client_t* client, remote_space_t space, uint32_t offset, uint32_t* buffer, uint32_t count);
+bool NVRemote_RunScript(nvremote_client_t* client, const char* source, uint32_t size);
+bool NVRemote_Stop(nvremote_client_t* client);
+
+// Writes don't wait. Call NVRemote_Flush and check errors to find out if they worked
+bool NVRemote_Write32(nvremote_client_t* client, remote_space_t space, uint32_t offset, uint32_t value);
+bool NVRemote_WriteBlock(nvremote_client_t* client, remote_space_t space, uint32_t offset, const uint32_t* buffer, uint32_t count);
+
+const char* NVRemote_StatusName(remote_status_t status);
@@ -0,0 +1,261 @@
+/*
+    NVPlay
+    Copyright © 2025-2026 starfrost
+
+    Raw GPU programming for early Nvidia GPUs
+    Licensed under the MIT license (see license file)
+
+    nvremote_test.c: Runs the remote server against the client over a pty pair
+
+    The server half is the real remote_server.c, built for the host with remote_serial_host.c on the slave side of the pty and a fake GPU
+    (64KB of MMIO and nothing else) behind it. The client half is nvremote_client.c on the master side. Frames with a bad CRC and line noise
+    are written by hand, to check the server reports the first and finds the next frame after the second. Build and run it on a POSIX system:
+        cc -O2 -Isrc -o nvremote_test tools/nvremote/nvremote_test.c tools/nvremote/nvremote_client.c src/core/remote/remote_server.c \
+            src/core/remote/remote_serial_host.c
+        ./nvremote_test
+*/
+
+#define _DEFAULT_SOURCE
+#define _XOPEN_SOURCE 600
+
+#include "nvremote_client.h"
+#include "../../src/core/remote/remote.h"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <unistd.h>
+
+#define NVREMOTE_TEST_BOOT_0        0x00030100
+#define NVREMOTE_TEST_VRAM          0x400000
+#define NVREMOTE_TEST_MMIO_SIZE     0x10000
+#define NVREMOTE_TEST_BLOCK_DWORDS  (REMOTE_MAX_BLOCK_DWORDS * 2)      // Two blocks, so the client has to split it
+
+uint32_t nvremote_test_mmio[NVREMOTE_TEST_MMIO_SIZE >> 2];
+uint32_t nvremote_test_failures = 0;
+
+//
+// The fake GPU the server runs on
+//
+
+static uint32_t NVRemoteTest_Boot0()
+{
+    return NVREMOTE_TEST_BOOT_0;
+}
+
+static uint32_t NVRemoteTest_VRAMAmount()
+{
+    return NVREMOTE_TEST_VRAM;
+}
+
+static bool NVRemoteTest_SpaceSize(uint8_t space, uint32_t* size)
+{
+    if (space != REMOTE_SPACE_MMIO)
+        return false;
+
+    *size = NVREMOTE_TEST_MMIO_SIZE;
+    return true;
+}
+
+static void NVRemoteTest_ReadBlock(uint8_t space, uint32_t offset, uint32_t* data, uint32_t count)
+{
+    memcpy(data, &nvremote_test_mmio[offset >> 2], count << 2);
+}
+
+static void NVRemoteTest_WriteBlock(uint8_t space, uint32_t offset, const uint32_t* data, uint32_t count)
+{
+    memcpy(&nvremote_test_mmio[offset >> 2], data, count << 2);
+}
+
+/* "fail" fails, anything else works */
+static bool NVRemoteTest_RunScript(const char* source, uint32_t size)
+{
+    return !(size == 4 && !memcmp(source, "fail", 4));
+}
+
+static bool NVRemoteTest_StopRequested()
+{
+    usleep(100);
+    return false;
+}
+
+const remote_backend_t nvremote_test_backend =
+{
+    NVRemoteTest_Boot0,
+    NVRemoteTest_VRAMAmount,
+    NVRemoteTest_SpaceSize,
+    NVRemoteTest_ReadBlock,
+    NVRemoteTest_WriteBlock,
+    NVRemoteTest_RunScript,
+    NVRemoteTest_StopRequested,
+};
+
+//
+// Checks
+//
+
+static void NVRemoteTest_Check(bool passed, const char* what)
+{
+    printf("%s: %s\n", passed ? "PASS" : "FAIL", what);
+
+    if (!passed)
+        nvremote_test_failures++;
+}
+
+/* Read one frame from fd, a byte at a time so nothing after it is taken. Returns false if none arrives within a second */
+static bool NVRemoteTest_ReadFrame(int fd, remote_parser_t* parser)
+{
+    struct pollfd port_poll = { fd, POLLIN, 0 };
+    uint8_t byte;
+
+    while (poll(&port_poll, 1, 1000) > 0)
+    {
+        while (read(fd, &byte, 1) == 1)
+        {
+            if (Remote_ParseByte(parser, byte))
+                return true;
+        }
+    }
+
+    return false;
+}
+
+/* A HELLO with its CRC broken gets a BAD_FRAME error with the same sequence number */
+static void NVRemoteTest_BadCrc(int fd)
+{
+    uint8_t frame[REMOTE_MAX_FRAME];
+    remote_parser_t parser = {0};
+    uint32_t size = Remote_BuildFrame(frame, REMOTE_OP_HELLO, 0x40, NULL, 0);
+
+    frame[size - 1] ^= 0xFF;
+    write(fd, frame, size);
+
+    NVRemoteTest_Check(NVRemoteTest_ReadFrame(fd, &parser)
+        && parser.crc_ok
+        && parser.frame[2] == REMOTE_OP_ERROR
+        && parser.frame[3] == 0x40
+        && parser.frame[REMOTE_FRAME_HEADER_SIZE] == REMOTE_STATUS_BAD_FRAME, "Bad CRC is answered with BAD_FRAME");
+}
+
+/* Noise, a false sync and a header too long to be real, then a HELLO. Only the HELLO is answered */
+static void NVRemoteTest_Resync(int fd)
+{
+    static const uint8_t noise[] = { 0x00, 'N', 'Q', 'N', 0xFF, 'N', 'V', REMOTE_OP_HELLO, 0x41, 0xFF, 0xFF };
+    uint8_t frame[REMOTE_MAX_FRAME];
+    remote_parser_t parser = {0};
+    uint32_t size = Remote_BuildFrame(frame, REMOTE_OP_HELLO, 0x42, NULL, 0);
+
+    write(fd, noise, sizeof(noise));
+    write(fd, frame, size);
+
+    NVRemoteTest_Check(NVRemoteTest_ReadFrame(fd, &parser)
+        && parser.crc_ok
+        && parser.frame[2] == (REMOTE_OP_HELLO | REMOTE_OP_REPLY)
+        && parser.frame[3] == 0x42
+        && parser.frame[REMOTE_FRAME_HEADER_SIZE] == REMOTE_STATUS_OK, "Finds the next frame after line noise");
+}
+
+static void NVRemoteTest_Client(int fd)
+{
+    static uint32_t written[NVREMOTE_TEST_BLOCK_DWORDS], read_back[NVREMOTE_TEST_BLOCK_DWORDS];
+    nvremote_client_t client;
+    uint32_t value = 0;
+
+    NVRemote_Attach(&client, fd);
+
+    NVRemoteTest_Check(NVRemote_Hello(&client)
+        && client.boot0 == NVREMOTE_TEST_BOOT_0
+        && client.vram_amount == NVREMOTE_TEST_VRAM
+        && client.max_block_dwords == REMOTE_MAX_BLOCK_DWORDS, "HELLO");
+
+    for (uint32_t i = 0; i < NVREMOTE_TEST_BLOCK_DWORDS; i++)
+        written[i] = (i * 0x9E3779B9) ^ 0xA5A5A5A5;
+
+    NVRemoteTest_Check(NVRemote_WriteBlock(&client, REMOTE_SPACE_MMIO, 0x1000, written, NVREMOTE_TEST_BLOCK_DWORDS)
+        && NVRemote_Flush(&client)
+        && !client.errors, "WRITE_BLOCK");
+
+    NVRemoteTest_Check(NVRemote_ReadBlock(&client, REMOTE_SPACE_MMIO, 0x1000, read_back, NVREMOTE_TEST_BLOCK_DWORDS)
+        && !memcmp(written, read_back, sizeof(written)), "READ_BLOCK returns what WRITE_BLOCK wrote");
+
+    NVRemoteTest_Check(NVRemote_Write32(&client, REMOTE_SPACE_MMIO, 0xFFFC, 0x12345678)
+        && NVRemote_Read32(&client, REMOTE_SPACE_MMIO, 0xFFFC, &value)
+        && value == 0x12345678, "WRITE32 and READ32 at the end of the space");
+
+    NVRemoteTest_Check(!NVRemote_ReadBlock(&client, REMOTE_SPACE_MMIO, 0xFFF0, read_back, 8)
+        && client.last_error == REMOTE_STATUS_OUT_OF_BOUNDS, "READ_BLOCK past the end is OUT_OF_BOUNDS");
+
+    NVRemoteTest_Check(!NVRemote_Read32(&client, REMOTE_SPACE_VRAM, 0, &value)
+        && client.last_error == REMOTE_STATUS_BAD_SPACE, "A space the GPU doesn't have is BAD_SPACE");
+
+    NVRemoteTest_Check(NVRemote_RunScript(&client, "rd 0", 4), "RUN_SCRIPT");
+
+    NVRemoteTest_Check(!NVRemote_RunScript(&client, "fail", 4)
+        && client.last_error == REMOTE_STATUS_FAILED, "A script that fails is FAILED");
+
+    NVRemoteTest_Check(NVRemote_Stop(&client), "CLOSE");
+}
+
+int main()
+{
+    struct termios settings;
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+
+    if (master < 0
+    || grantpt(master)
+    || unlockpt(master))
+    {
+        perror("Couldn't make a pty pair");
+        return 1;
+    }
+
+    const char* slave_name = ptsname(master);
+
+    // Raw before anything is sent, or the line discipline echoes and translates it. Kept open so the pty doesn't hang up between the two
+    int slave = open(slave_name, O_RDWR | O_NOCTTY);
+
+    if (slave < 0
+    || tcgetattr(slave, &settings))
+    {
+        perror("Couldn't open the pty");
+        return 1;
+    }
+
+    cfmakeraw(&settings);
+    tcsetattr(slave, TCSANOW, &settings);
+
+    pid_t server = fork();
+
+    if (!server)
+    {
+        if (!Remote_SerialOpen(&remote_port, slave_name, REMOTE_DEFAULT_BAUD))
+            _exit(2);
+
+        Remote_Run(&nvremote_test_backend);
+        Remote_SerialClose(&remote_port);
+
+        // Only the hand-made bad frame should have been bad
+        _exit(remote_bad_frames == 1 ? 0 : 3);
+    }
+
+    fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+
+    NVRemoteTest_BadCrc(master);
+    NVRemoteTest_Resync(master);
+    NVRemoteTest_Client(master);
+
+    int status = 0;
+
+    waitpid(server, &status, 0);
+    NVRemoteTest_Check(WIFEXITED(status) && !WEXITSTATUS(status), "Server stopped after CLOSE with one bad frame");
+
+    close(slave);
+    close(master);
+
+    printf("%u failed\n", nvremote_test_failures);
+    return nvremote_test_failures ? 1 : 0;
+}